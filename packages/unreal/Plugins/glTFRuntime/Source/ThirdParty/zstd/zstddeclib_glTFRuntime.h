@@ -0,0 +1,117 @@
+/*
+ * Zstandard 1.5.7 single-file decompressor (zstddeclib.c, BSD license, see LICENSE) as vendored by glTFRuntime.
+ *
+ * zstddeclib.c is the unmodified amalgamation of the decompression sources (build/single_file_libs/zstddeclib-in.c).
+ * The external symbols are renamed here, so the decoder never clashes with other zstd copies linked in the same binary.
+ * Regenerate this list from the symbols exported by zstddeclib.c when updating it.
+ */
+#pragma once
+
+#define ERR_getErrorString glTFRuntime_ERR_getErrorString
+#define FSE_buildDTable_wksp glTFRuntime_FSE_buildDTable_wksp
+#define FSE_decompress_wksp_bmi2 glTFRuntime_FSE_decompress_wksp_bmi2
+#define FSE_getErrorName glTFRuntime_FSE_getErrorName
+#define FSE_isError glTFRuntime_FSE_isError
+#define FSE_readNCount glTFRuntime_FSE_readNCount
+#define FSE_readNCount_bmi2 glTFRuntime_FSE_readNCount_bmi2
+#define FSE_versionNumber glTFRuntime_FSE_versionNumber
+#define HUF_decompress1X1_DCtx_wksp glTFRuntime_HUF_decompress1X1_DCtx_wksp
+#define HUF_decompress1X2_DCtx_wksp glTFRuntime_HUF_decompress1X2_DCtx_wksp
+#define HUF_decompress1X_DCtx_wksp glTFRuntime_HUF_decompress1X_DCtx_wksp
+#define HUF_decompress1X_usingDTable glTFRuntime_HUF_decompress1X_usingDTable
+#define HUF_decompress4X_hufOnly_wksp glTFRuntime_HUF_decompress4X_hufOnly_wksp
+#define HUF_decompress4X_usingDTable glTFRuntime_HUF_decompress4X_usingDTable
+#define HUF_getErrorName glTFRuntime_HUF_getErrorName
+#define HUF_isError glTFRuntime_HUF_isError
+#define HUF_readDTableX1_wksp glTFRuntime_HUF_readDTableX1_wksp
+#define HUF_readDTableX2_wksp glTFRuntime_HUF_readDTableX2_wksp
+#define HUF_readStats glTFRuntime_HUF_readStats
+#define HUF_readStats_wksp glTFRuntime_HUF_readStats_wksp
+#define HUF_selectDecoder glTFRuntime_HUF_selectDecoder
+#define ZSTD_DCtx_getParameter glTFRuntime_ZSTD_DCtx_getParameter
+#define ZSTD_DCtx_loadDictionary glTFRuntime_ZSTD_DCtx_loadDictionary
+#define ZSTD_DCtx_loadDictionary_advanced glTFRuntime_ZSTD_DCtx_loadDictionary_advanced
+#define ZSTD_DCtx_loadDictionary_byReference glTFRuntime_ZSTD_DCtx_loadDictionary_byReference
+#define ZSTD_DCtx_refDDict glTFRuntime_ZSTD_DCtx_refDDict
+#define ZSTD_DCtx_refPrefix glTFRuntime_ZSTD_DCtx_refPrefix
+#define ZSTD_DCtx_refPrefix_advanced glTFRuntime_ZSTD_DCtx_refPrefix_advanced
+#define ZSTD_DCtx_reset glTFRuntime_ZSTD_DCtx_reset
+#define ZSTD_DCtx_setFormat glTFRuntime_ZSTD_DCtx_setFormat
+#define ZSTD_DCtx_setMaxWindowSize glTFRuntime_ZSTD_DCtx_setMaxWindowSize
+#define ZSTD_DCtx_setParameter glTFRuntime_ZSTD_DCtx_setParameter
+#define ZSTD_DDict_dictContent glTFRuntime_ZSTD_DDict_dictContent
+#define ZSTD_DDict_dictSize glTFRuntime_ZSTD_DDict_dictSize
+#define ZSTD_DStreamInSize glTFRuntime_ZSTD_DStreamInSize
+#define ZSTD_DStreamOutSize glTFRuntime_ZSTD_DStreamOutSize
+#define ZSTD_buildFSETable glTFRuntime_ZSTD_buildFSETable
+#define ZSTD_checkContinuity glTFRuntime_ZSTD_checkContinuity
+#define ZSTD_copyDCtx glTFRuntime_ZSTD_copyDCtx
+#define ZSTD_copyDDictParameters glTFRuntime_ZSTD_copyDDictParameters
+#define ZSTD_createDCtx glTFRuntime_ZSTD_createDCtx
+#define ZSTD_createDCtx_advanced glTFRuntime_ZSTD_createDCtx_advanced
+#define ZSTD_createDDict glTFRuntime_ZSTD_createDDict
+#define ZSTD_createDDict_advanced glTFRuntime_ZSTD_createDDict_advanced
+#define ZSTD_createDDict_byReference glTFRuntime_ZSTD_createDDict_byReference
+#define ZSTD_createDStream glTFRuntime_ZSTD_createDStream
+#define ZSTD_createDStream_advanced glTFRuntime_ZSTD_createDStream_advanced
+#define ZSTD_dParam_getBounds glTFRuntime_ZSTD_dParam_getBounds
+#define ZSTD_decodeLiteralsBlock_wrapper glTFRuntime_ZSTD_decodeLiteralsBlock_wrapper
+#define ZSTD_decodeSeqHeaders glTFRuntime_ZSTD_decodeSeqHeaders
+#define ZSTD_decodingBufferSize_min glTFRuntime_ZSTD_decodingBufferSize_min
+#define ZSTD_decompress glTFRuntime_ZSTD_decompress
+#define ZSTD_decompressBegin glTFRuntime_ZSTD_decompressBegin
+#define ZSTD_decompressBegin_usingDDict glTFRuntime_ZSTD_decompressBegin_usingDDict
+#define ZSTD_decompressBegin_usingDict glTFRuntime_ZSTD_decompressBegin_usingDict
+#define ZSTD_decompressBlock glTFRuntime_ZSTD_decompressBlock
+#define ZSTD_decompressBlock_deprecated glTFRuntime_ZSTD_decompressBlock_deprecated
+#define ZSTD_decompressBlock_internal glTFRuntime_ZSTD_decompressBlock_internal
+#define ZSTD_decompressBound glTFRuntime_ZSTD_decompressBound
+#define ZSTD_decompressContinue glTFRuntime_ZSTD_decompressContinue
+#define ZSTD_decompressDCtx glTFRuntime_ZSTD_decompressDCtx
+#define ZSTD_decompressStream glTFRuntime_ZSTD_decompressStream
+#define ZSTD_decompressStream_simpleArgs glTFRuntime_ZSTD_decompressStream_simpleArgs
+#define ZSTD_decompress_usingDDict glTFRuntime_ZSTD_decompress_usingDDict
+#define ZSTD_decompress_usingDict glTFRuntime_ZSTD_decompress_usingDict
+#define ZSTD_decompressionMargin glTFRuntime_ZSTD_decompressionMargin
+#define ZSTD_estimateDCtxSize glTFRuntime_ZSTD_estimateDCtxSize
+#define ZSTD_estimateDDictSize glTFRuntime_ZSTD_estimateDDictSize
+#define ZSTD_estimateDStreamSize glTFRuntime_ZSTD_estimateDStreamSize
+#define ZSTD_estimateDStreamSize_fromFrame glTFRuntime_ZSTD_estimateDStreamSize_fromFrame
+#define ZSTD_findDecompressedSize glTFRuntime_ZSTD_findDecompressedSize
+#define ZSTD_findFrameCompressedSize glTFRuntime_ZSTD_findFrameCompressedSize
+#define ZSTD_frameHeaderSize glTFRuntime_ZSTD_frameHeaderSize
+#define ZSTD_freeDCtx glTFRuntime_ZSTD_freeDCtx
+#define ZSTD_freeDDict glTFRuntime_ZSTD_freeDDict
+#define ZSTD_freeDStream glTFRuntime_ZSTD_freeDStream
+#define ZSTD_getDecompressedSize glTFRuntime_ZSTD_getDecompressedSize
+#define ZSTD_getDictID_fromDDict glTFRuntime_ZSTD_getDictID_fromDDict
+#define ZSTD_getDictID_fromDict glTFRuntime_ZSTD_getDictID_fromDict
+#define ZSTD_getDictID_fromFrame glTFRuntime_ZSTD_getDictID_fromFrame
+#define ZSTD_getErrorCode glTFRuntime_ZSTD_getErrorCode
+#define ZSTD_getErrorName glTFRuntime_ZSTD_getErrorName
+#define ZSTD_getErrorString glTFRuntime_ZSTD_getErrorString
+#define ZSTD_getFrameContentSize glTFRuntime_ZSTD_getFrameContentSize
+#define ZSTD_getFrameHeader glTFRuntime_ZSTD_getFrameHeader
+#define ZSTD_getFrameHeader_advanced glTFRuntime_ZSTD_getFrameHeader_advanced
+#define ZSTD_getcBlockSize glTFRuntime_ZSTD_getcBlockSize
+#define ZSTD_initDStream glTFRuntime_ZSTD_initDStream
+#define ZSTD_initDStream_usingDDict glTFRuntime_ZSTD_initDStream_usingDDict
+#define ZSTD_initDStream_usingDict glTFRuntime_ZSTD_initDStream_usingDict
+#define ZSTD_initStaticDCtx glTFRuntime_ZSTD_initStaticDCtx
+#define ZSTD_initStaticDDict glTFRuntime_ZSTD_initStaticDDict
+#define ZSTD_initStaticDStream glTFRuntime_ZSTD_initStaticDStream
+#define ZSTD_insertBlock glTFRuntime_ZSTD_insertBlock
+#define ZSTD_isError glTFRuntime_ZSTD_isError
+#define ZSTD_isFrame glTFRuntime_ZSTD_isFrame
+#define ZSTD_isSkippableFrame glTFRuntime_ZSTD_isSkippableFrame
+#define ZSTD_loadDEntropy glTFRuntime_ZSTD_loadDEntropy
+#define ZSTD_nextInputType glTFRuntime_ZSTD_nextInputType
+#define ZSTD_nextSrcSizeToDecompress glTFRuntime_ZSTD_nextSrcSizeToDecompress
+#define ZSTD_readSkippableFrame glTFRuntime_ZSTD_readSkippableFrame
+#define ZSTD_resetDStream glTFRuntime_ZSTD_resetDStream
+#define ZSTD_sizeof_DCtx glTFRuntime_ZSTD_sizeof_DCtx
+#define ZSTD_sizeof_DDict glTFRuntime_ZSTD_sizeof_DDict
+#define ZSTD_sizeof_DStream glTFRuntime_ZSTD_sizeof_DStream
+#define ZSTD_versionNumber glTFRuntime_ZSTD_versionNumber
+#define ZSTD_versionString glTFRuntime_ZSTD_versionString
+#define g_debuglevel glTFRuntime_g_debuglevel
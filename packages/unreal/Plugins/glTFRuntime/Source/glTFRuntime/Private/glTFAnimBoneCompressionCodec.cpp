@@ -2,8 +2,438 @@
 
 
 #include "glTFAnimBoneCompressionCodec.h"
+#include "Async/ParallelFor.h"
+#include "Math/VectorRegister.h"
 #include "Runtime/Launch/Resources/Version.h"
 
+namespace glTFRuntime
+{
+	namespace AnimCompression
+	{
+		// longest run of frames checked when extending a segment (bounds the reduction cost on long linear tracks)
+		constexpr int32 MaxSegmentFrames = 256;
+
+		// range of the components not dropped by smallest-three
+		constexpr double Sqrt2 = 1.4142135623730951;
+
+		// smallest-three, 2 bits for the index of the dropped component and 15 bits for each of the others
+		void QuantizeRotation(const FQuat& Rotation, uint16* Values)
+		{
+			const double Components[4] = { Rotation.X, Rotation.Y, Rotation.Z, Rotation.W };
+			int32 LargestIndex = 0;
+			for (int32 Index = 1; Index < 4; Index++)
+			{
+				if (FMath::Abs(Components[Index]) > FMath::Abs(Components[LargestIndex]))
+				{
+					LargestIndex = Index;
+				}
+			}
+
+			// q and -q are the same rotation, the dropped component is always positive
+			const double Sign = Components[LargestIndex] < 0 ? -1 : 1;
+
+			uint64 Packed = static_cast<uint64>(LargestIndex);
+			for (int32 Index = 0; Index < 4; Index++)
+			{
+				if (Index != LargestIndex)
+				{
+					const double Normalized = FMath::Clamp(Components[Index] * Sign * Sqrt2 * 0.5 + 0.5, 0.0, 1.0);
+					Packed = (Packed << 15) | static_cast<uint64>(FMath::RoundToInt(Normalized * 32767.0));
+				}
+			}
+
+			Values[0] = static_cast<uint16>(Packed >> 32);
+			Values[1] = static_cast<uint16>(Packed >> 16);
+			Values[2] = static_cast<uint16>(Packed);
+		}
+
+		FQuat DequantizeRotation(const uint16* Values)
+		{
+			const uint64 Packed = (static_cast<uint64>(Values[0]) << 32) | (static_cast<uint64>(Values[1]) << 16) | static_cast<uint64>(Values[2]);
+			const int32 LargestIndex = static_cast<int32>(Packed >> 45) & 0x03;
+
+			double Components[4];
+			double SquaredSum = 0;
+			int32 Shift = 30;
+			for (int32 Index = 0; Index < 4; Index++)
+			{
+				if (Index != LargestIndex)
+				{
+					Components[Index] = ((static_cast<double>((Packed >> Shift) & 0x7FFF) / 32767.0) - 0.5) * Sqrt2;
+					SquaredSum += Components[Index] * Components[Index];
+					Shift -= 15;
+				}
+			}
+			Components[LargestIndex] = FMath::Sqrt(FMath::Max(1.0 - SquaredSum, 0.0));
+
+			return FQuat(Components[0], Components[1], Components[2], Components[3]).GetNormalized();
+		}
+
+		void QuantizeVector(const FVector& Vector, const FVector& RangeMin, const FVector& RangeExtent, uint16* Values)
+		{
+			for (int32 Index = 0; Index < 3; Index++)
+			{
+				const double Normalized = RangeExtent[Index] > 0 ? FMath::Clamp(static_cast<double>((Vector[Index] - RangeMin[Index]) / RangeExtent[Index]), 0.0, 1.0) : 0.0;
+				Values[Index] = static_cast<uint16>(FMath::RoundToInt(Normalized * 65535.0));
+			}
+		}
+
+		FVector DequantizeVector(const uint16* Values, const FVector& RangeMin, const FVector& RangeExtent)
+		{
+			return RangeMin + FVector(static_cast<float>(Values[0]), static_cast<float>(Values[1]), static_cast<float>(Values[2])) * RangeExtent / 65535.0f;
+		}
+
+		void Quantize(const FQuat& Rotation, FglTFRuntimeCompressedAnimChannel& Channel, const int32 KeyIndex)
+		{
+			QuantizeRotation(Rotation, &Channel.Values[KeyIndex * 3]);
+		}
+
+		void Quantize(const FVector& Vector, FglTFRuntimeCompressedAnimChannel& Channel, const int32 KeyIndex)
+		{
+			QuantizeVector(Vector, Channel.RangeMin, Channel.RangeExtent, &Channel.Values[KeyIndex * 3]);
+		}
+
+		int32 GetFloatsPerKey(const FQuat&)
+		{
+			return 4;
+		}
+
+		int32 GetFloatsPerKey(const FVector&)
+		{
+			return 3;
+		}
+
+		// raw float storage, for channels that cannot be quantized within the tolerance
+		void StoreFloats(const FQuat& Rotation, FglTFRuntimeCompressedAnimChannel& Channel, const int32 KeyIndex)
+		{
+			float* Values = &Channel.FloatValues[KeyIndex * 4];
+			Values[0] = static_cast<float>(Rotation.X);
+			Values[1] = static_cast<float>(Rotation.Y);
+			Values[2] = static_cast<float>(Rotation.Z);
+			Values[3] = static_cast<float>(Rotation.W);
+		}
+
+		void StoreFloats(const FVector& Vector, FglTFRuntimeCompressedAnimChannel& Channel, const int32 KeyIndex)
+		{
+			float* Values = &Channel.FloatValues[KeyIndex * 3];
+			Values[0] = static_cast<float>(Vector.X);
+			Values[1] = static_cast<float>(Vector.Y);
+			Values[2] = static_cast<float>(Vector.Z);
+		}
+
+		template<typename T>
+		T Dequantize(const FglTFRuntimeCompressedAnimChannel& Channel, const int32 KeyIndex);
+
+		template<>
+		FQuat Dequantize(const FglTFRuntimeCompressedAnimChannel& Channel, const int32 KeyIndex)
+		{
+			if (!Channel.IsQuantized())
+			{
+				const float* Values = &Channel.FloatValues[KeyIndex * 4];
+				return FQuat(Values[0], Values[1], Values[2], Values[3]);
+			}
+			return DequantizeRotation(&Channel.Values[KeyIndex * 3]);
+		}
+
+		template<>
+		FVector Dequantize(const FglTFRuntimeCompressedAnimChannel& Channel, const int32 KeyIndex)
+		{
+			if (!Channel.IsQuantized())
+			{
+				const float* Values = &Channel.FloatValues[KeyIndex * 3];
+				return FVector(Values[0], Values[1], Values[2]);
+			}
+			return DequantizeVector(&Channel.Values[KeyIndex * 3], Channel.RangeMin, Channel.RangeExtent);
+		}
+
+		// only the retained keys of an array with ValuesPerKey elements per key
+		template<typename ValueType>
+		TArray<ValueType> GatherKeys(const TArray<ValueType>& Values, const TArray<int32>& RetainedKeys, const int32 ValuesPerKey)
+		{
+			TArray<ValueType> Gathered;
+			Gathered.AddUninitialized(RetainedKeys.Num() * ValuesPerKey);
+			for (int32 Index = 0; Index < RetainedKeys.Num(); Index++)
+			{
+				FMemory::Memcpy(&Gathered[Index * ValuesPerKey], &Values[RetainedKeys[Index] * ValuesPerKey], sizeof(ValueType) * ValuesPerKey);
+			}
+			return Gathered;
+		}
+
+		FQuat Interpolate(const FQuat& A, const FQuat& B, const float Alpha)
+		{
+			return FQuat::Slerp(A, B, Alpha);
+		}
+
+		FVector Interpolate(const FVector& A, const FVector& B, const float Alpha)
+		{
+			return FMath::Lerp(A, B, Alpha);
+		}
+
+		// T is FQuat or FVector, Error returns the distance between two values
+		template<typename T, typename ErrorCallback>
+		void CompressChannel(const TArray<T>& Keys, const float Tolerance, FglTFRuntimeCompressedAnimChannel& Channel, ErrorCallback Error)
+		{
+			Channel.NumFrames = Keys.Num();
+			if (Keys.Num() == 0)
+			{
+				return;
+			}
+
+			// quantize everything first, so the reduction accounts for the quantization error too
+			Channel.Values.AddUninitialized(Keys.Num() * 3);
+			for (int32 KeyIndex = 0; KeyIndex < Keys.Num(); KeyIndex++)
+			{
+				Quantize(Keys[KeyIndex], Channel, KeyIndex);
+			}
+
+			TArray<T> Dequantized;
+			Dequantized.AddUninitialized(Keys.Num());
+			for (int32 KeyIndex = 0; KeyIndex < Keys.Num(); KeyIndex++)
+			{
+				Dequantized[KeyIndex] = Dequantize<T>(Channel, KeyIndex);
+			}
+
+			// the reduction only checks the frames in between the retained keys, so the error of every key must be within the tolerance
+			// (a 16 bit step is range / 65535, too coarse for large translation ranges): fall back to raw floats (lossless for the source tracks)
+			for (int32 KeyIndex = 0; KeyIndex < Keys.Num(); KeyIndex++)
+			{
+				if (Error(Dequantized[KeyIndex], Keys[KeyIndex]) > Tolerance)
+				{
+					Channel.Values.Empty();
+					Channel.FloatValues.AddUninitialized(Keys.Num() * GetFloatsPerKey(Keys[0]));
+					for (int32 FloatKeyIndex = 0; FloatKeyIndex < Keys.Num(); FloatKeyIndex++)
+					{
+						StoreFloats(Keys[FloatKeyIndex], Channel, FloatKeyIndex);
+						Dequantized[FloatKeyIndex] = Dequantize<T>(Channel, FloatKeyIndex);
+					}
+					break;
+				}
+			}
+
+			TArray<int32> RetainedKeys;
+			RetainedKeys.Add(0);
+
+			bool bConstant = true;
+			for (int32 KeyIndex = 1; KeyIndex < Keys.Num(); KeyIndex++)
+			{
+				if (Error(Dequantized[0], Keys[KeyIndex]) > Tolerance)
+				{
+					bConstant = false;
+					break;
+				}
+			}
+
+			if (!bConstant)
+			{
+				// greedy: extend every segment until a frame in between is no more predictable
+				int32 Anchor = 0;
+				while (Anchor < Keys.Num() - 1)
+				{
+					int32 Best = Anchor + 1;
+					const int32 Last = FMath::Min(Keys.Num() - 1, Anchor + MaxSegmentFrames);
+					for (int32 Candidate = Anchor + 2; Candidate <= Last; Candidate++)
+					{
+						bool bPredictable = true;
+						for (int32 KeyIndex = Anchor + 1; KeyIndex < Candidate; KeyIndex++)
+						{
+							const float Alpha = static_cast<float>(KeyIndex - Anchor) / (Candidate - Anchor);
+							if (Error(Interpolate(Dequantized[Anchor], Dequantized[Candidate], Alpha), Keys[KeyIndex]) > Tolerance)
+							{
+								bPredictable = false;
+								break;
+							}
+						}
+
+						if (!bPredictable)
+						{
+							break;
+						}
+						Best = Candidate;
+					}
+
+					RetainedKeys.Add(Best);
+					Anchor = Best;
+				}
+			}
+
+			Channel.Frames.AddUninitialized(RetainedKeys.Num());
+			for (int32 Index = 0; Index < RetainedKeys.Num(); Index++)
+			{
+				Channel.Frames[Index] = static_cast<uint16>(RetainedKeys[Index]);
+			}
+
+			if (Channel.IsQuantized())
+			{
+				Channel.Values = GatherKeys(Channel.Values, RetainedKeys, 3);
+			}
+			else
+			{
+				Channel.FloatValues = GatherKeys(Channel.FloatValues, RetainedKeys, GetFloatsPerKey(Keys[0]));
+			}
+		}
+
+		void ComputeRange(const TArray<FVector>& Keys, FglTFRuntimeCompressedAnimChannel& Channel)
+		{
+			if (Keys.Num() == 0)
+			{
+				return;
+			}
+
+			FVector Min = Keys[0];
+			FVector Max = Min;
+			for (const FVector& Key : Keys)
+			{
+				Min = Min.ComponentMin(Key);
+				Max = Max.ComponentMax(Key);
+			}
+			Channel.RangeMin = Min;
+			Channel.RangeExtent = Max - Min;
+		}
+
+#if ENGINE_MAJOR_VERSION > 4
+		using FFloatRegister = VectorRegister4Float;
+#else
+		using FFloatRegister = VectorRegister;
+#endif
+
+		// normalized lerp (along the shortest path) of two float quaternions in a single register
+		FORCEINLINE void NLerpQuat(const float* A, const float* B, const FFloatRegister& Alpha, float* Out)
+		{
+			const FFloatRegister QuatA = VectorLoad(A);
+			const FFloatRegister QuatB = VectorLoad(B);
+			const FFloatRegister Sign = VectorSelect(VectorCompareGE(VectorDot4(QuatA, QuatB), GlobalVectorConstants::FloatZero), GlobalVectorConstants::FloatOne, GlobalVectorConstants::FloatMinusOne);
+			const FFloatRegister Blended = VectorMultiplyAdd(VectorSubtract(VectorMultiply(QuatB, Sign), QuatA), Alpha, QuatA);
+			VectorStore(VectorNormalizeQuaternion(Blended), Out);
+		}
+
+		float GetFramePosition(const float RelativePos, const int32 NumFrames, const EAnimInterpolationType Interpolation)
+		{
+			if (NumFrames < 2 || RelativePos <= 0.f)
+			{
+				return 0;
+			}
+
+			if (RelativePos >= 1.0f)
+			{
+				return NumFrames - 1;
+			}
+
+			const float FramePosition = RelativePos * (NumFrames - 1);
+			return Interpolation == EAnimInterpolationType::Step ? FMath::FloorToFloat(FramePosition) : FramePosition;
+		}
+
+		template<typename T>
+		T DecompressChannelAtFrame(const FglTFRuntimeCompressedAnimChannel& Channel, const float FramePosition, const T& DefaultValue)
+		{
+			if (Channel.Frames.Num() == 0)
+			{
+				return DefaultValue;
+			}
+
+			if (Channel.Frames.Num() == 1)
+			{
+				return Dequantize<T>(Channel, 0);
+			}
+
+			// the last retained key whose frame is <= FramePosition
+			int32 First = 0;
+			int32 Size = Channel.Frames.Num() - 1;
+			while (Size > 0)
+			{
+				const int32 Half = Size / 2;
+				if (Channel.Frames[First + Half + 1] <= FramePosition)
+				{
+					First += Half + 1;
+					Size -= Half + 1;
+				}
+				else
+				{
+					Size = Half;
+				}
+			}
+
+			if (First >= Channel.Frames.Num() - 1)
+			{
+				return Dequantize<T>(Channel, Channel.Frames.Num() - 1);
+			}
+
+			const float Alpha = (FramePosition - Channel.Frames[First]) / (Channel.Frames[First + 1] - Channel.Frames[First]);
+			return Interpolate(Dequantize<T>(Channel, First), Dequantize<T>(Channel, First + 1), Alpha);
+		}
+
+		template<typename T>
+		T DecompressChannel(const FglTFRuntimeCompressedAnimChannel& Channel, const float RelativePos, const EAnimInterpolationType Interpolation, const T& DefaultValue)
+		{
+			return DecompressChannelAtFrame(Channel, GetFramePosition(RelativePos, Channel.NumFrames, Interpolation), DefaultValue);
+		}
+	}
+}
+
+bool UglTFAnimBoneCompressionCodec::CompressTracks(const float TranslationTolerance, const float RotationTolerance, const float ScaleTolerance)
+{
+	using namespace glTFRuntime::AnimCompression;
+
+	SCOPED_NAMED_EVENT(UglTFAnimBoneCompressionCodec_CompressTracks, FColor::Magenta);
+
+	RawSize = 0;
+	for (const FRawAnimSequenceTrack& Track : Tracks)
+	{
+		if (Track.RotKeys.Num() > 65536 || Track.PosKeys.Num() > 65536 || Track.ScaleKeys.Num() > 65536)
+		{
+			return false;
+		}
+		RawSize += Track.RotKeys.GetAllocatedSize() + Track.PosKeys.GetAllocatedSize() + Track.ScaleKeys.GetAllocatedSize();
+	}
+
+	const float RotationToleranceRadians = FMath::DegreesToRadians(RotationTolerance);
+
+	CompressedTracks.SetNum(Tracks.Num());
+	ParallelFor(Tracks.Num(), [&](const int32 TrackIndex)
+		{
+			const FRawAnimSequenceTrack& Track = Tracks[TrackIndex];
+			FglTFRuntimeCompressedAnimTrack& CompressedTrack = CompressedTracks[TrackIndex];
+
+			TArray<FQuat> Rotations;
+			Rotations.Reserve(Track.RotKeys.Num());
+			for (const auto& RotKey : Track.RotKeys)
+			{
+				Rotations.Add(FQuat(RotKey).GetNormalized());
+			}
+
+			TArray<FVector> Translations;
+			Translations.Reserve(Track.PosKeys.Num());
+			for (const auto& PosKey : Track.PosKeys)
+			{
+				Translations.Add(FVector(PosKey));
+			}
+
+			TArray<FVector> Scales;
+			Scales.Reserve(Track.ScaleKeys.Num());
+			for (const auto& ScaleKey : Track.ScaleKeys)
+			{
+				Scales.Add(FVector(ScaleKey));
+			}
+
+			ComputeRange(Translations, CompressedTrack.Translations);
+			ComputeRange(Scales, CompressedTrack.Scales);
+
+			CompressChannel(Rotations, RotationToleranceRadians, CompressedTrack.Rotations, [](const FQuat& A, const FQuat& B) { return static_cast<float>(A.AngularDistance(B)); });
+			CompressChannel(Translations, TranslationTolerance, CompressedTrack.Translations, [](const FVector& A, const FVector& B) { return static_cast<float>(FVector::Distance(A, B)); });
+			CompressChannel(Scales, ScaleTolerance, CompressedTrack.Scales, [](const FVector& A, const FVector& B) { return static_cast<float>((A - B).GetAbsMax()); });
+		});
+
+	CompressedSize = CompressedTracks.GetAllocatedSize();
+	for (const FglTFRuntimeCompressedAnimTrack& CompressedTrack : CompressedTracks)
+	{
+		CompressedSize += CompressedTrack.Rotations.GetAllocatedSize() + CompressedTrack.Translations.GetAllocatedSize() + CompressedTrack.Scales.GetAllocatedSize();
+	}
+
+	Tracks.Empty();
+	bCompressed = true;
+
+	return true;
+}
+
 void UglTFAnimBoneCompressionCodec::DecompressBone(FAnimSequenceDecompressionContext& DecompContext, int32 TrackIndex, FTransform& OutAtom) const
 {
 	OutAtom.SetLocation(GetTrackLocation(DecompContext, TrackIndex));
@@ -11,16 +441,42 @@ void UglTFAnimBoneCompressionCodec::DecompressBone(FAnimSequenceDecompressionCon
 	OutAtom.SetScale3D(GetTrackScale(DecompContext, TrackIndex));
 }
 
+float UglTFAnimBoneCompressionCodec::GetRelativePosition(FAnimSequenceDecompressionContext& DecompContext) const
+{
+#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION > 0
+	return DecompContext.GetRelativePosition();
+#else
+	return DecompContext.RelativePos;
+#endif
+}
+
 FQuat UglTFAnimBoneCompressionCodec::GetTrackRotation(FAnimSequenceDecompressionContext& DecompContext, const int32 TrackIndex) const
 {
+	return GetTrackRotation(TrackIndex, GetRelativePosition(DecompContext), DecompContext.Interpolation);
+}
+
+FVector UglTFAnimBoneCompressionCodec::GetTrackLocation(FAnimSequenceDecompressionContext& DecompContext, const int32 TrackIndex) const
+{
+	return GetTrackLocation(TrackIndex, GetRelativePosition(DecompContext), DecompContext.Interpolation);
+}
+
+FVector UglTFAnimBoneCompressionCodec::GetTrackScale(FAnimSequenceDecompressionContext& DecompContext, const int32 TrackIndex) const
+{
+	return GetTrackScale(TrackIndex, GetRelativePosition(DecompContext), DecompContext.Interpolation);
+}
+
+FQuat UglTFAnimBoneCompressionCodec::GetTrackRotation(const int32 TrackIndex, const float RelativePos, const EAnimInterpolationType Interpolation) const
+{
+	if (bCompressed)
+	{
+		return glTFRuntime::AnimCompression::DecompressChannel(CompressedTracks[TrackIndex].Rotations, RelativePos, Interpolation, FQuat::Identity);
+	}
+
 	int32 FrameA = 0;
 	int32 FrameB = 0;
 
-#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION > 0
-	float Alpha = TimeToIndex(DecompContext.GetPlayableLength(), DecompContext.GetRelativePosition(), Tracks[TrackIndex].RotKeys.Num(), DecompContext.Interpolation, FrameA, FrameB);
-#else
-	float Alpha = TimeToIndex(DecompContext.SequenceLength, DecompContext.RelativePos, Tracks[TrackIndex].RotKeys.Num(), DecompContext.Interpolation, FrameA, FrameB);
-#endif
+	// SequenceLength is not used by TimeToIndex
+	float Alpha = TimeToIndex(0, RelativePos, Tracks[TrackIndex].RotKeys.Num(), Interpolation, FrameA, FrameB);
 #if ENGINE_MAJOR_VERSION > 4
 	return FQuat::Slerp(FQuat(Tracks[TrackIndex].RotKeys[FrameA]), FQuat(Tracks[TrackIndex].RotKeys[FrameB]), Alpha);
 #else
@@ -28,16 +484,17 @@ FQuat UglTFAnimBoneCompressionCodec::GetTrackRotation(FAnimSequenceDecompression
 #endif
 }
 
-FVector UglTFAnimBoneCompressionCodec::GetTrackLocation(FAnimSequenceDecompressionContext& DecompContext, const int32 TrackIndex) const
+FVector UglTFAnimBoneCompressionCodec::GetTrackLocation(const int32 TrackIndex, const float RelativePos, const EAnimInterpolationType Interpolation) const
 {
+	if (bCompressed)
+	{
+		return glTFRuntime::AnimCompression::DecompressChannel(CompressedTracks[TrackIndex].Translations, RelativePos, Interpolation, FVector::ZeroVector);
+	}
+
 	int32 FrameA = 0;
 	int32 FrameB = 0;
 
-#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION > 0
-	float Alpha = TimeToIndex(DecompContext.GetPlayableLength(), DecompContext.GetRelativePosition(), Tracks[TrackIndex].PosKeys.Num(), DecompContext.Interpolation, FrameA, FrameB);
-#else
-	float Alpha = TimeToIndex(DecompContext.SequenceLength, DecompContext.RelativePos, Tracks[TrackIndex].PosKeys.Num(), DecompContext.Interpolation, FrameA, FrameB);
-#endif
+	float Alpha = TimeToIndex(0, RelativePos, Tracks[TrackIndex].PosKeys.Num(), Interpolation, FrameA, FrameB);
 #if ENGINE_MAJOR_VERSION > 4
 	return FMath::Lerp(FVector(Tracks[TrackIndex].PosKeys[FrameA]), FVector(Tracks[TrackIndex].PosKeys[FrameB]), Alpha);
 #else
@@ -45,16 +502,17 @@ FVector UglTFAnimBoneCompressionCodec::GetTrackLocation(FAnimSequenceDecompressi
 #endif
 }
 
-FVector UglTFAnimBoneCompressionCodec::GetTrackScale(FAnimSequenceDecompressionContext& DecompContext, const int32 TrackIndex) const
+FVector UglTFAnimBoneCompressionCodec::GetTrackScale(const int32 TrackIndex, const float RelativePos, const EAnimInterpolationType Interpolation) const
 {
+	if (bCompressed)
+	{
+		return glTFRuntime::AnimCompression::DecompressChannel(CompressedTracks[TrackIndex].Scales, RelativePos, Interpolation, FVector::OneVector);
+	}
+
 	int32 FrameA = 0;
 	int32 FrameB = 0;
 
-#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION > 0
-	float Alpha = TimeToIndex(DecompContext.GetPlayableLength(), DecompContext.GetRelativePosition(), Tracks[TrackIndex].ScaleKeys.Num(), DecompContext.Interpolation, FrameA, FrameB);
-#else
-	float Alpha = TimeToIndex(DecompContext.SequenceLength, DecompContext.RelativePos, Tracks[TrackIndex].ScaleKeys.Num(), DecompContext.Interpolation, FrameA, FrameB);
-#endif
+	float Alpha = TimeToIndex(0, RelativePos, Tracks[TrackIndex].ScaleKeys.Num(), Interpolation, FrameA, FrameB);
 #if ENGINE_MAJOR_VERSION > 4
 	return FMath::Lerp(FVector(Tracks[TrackIndex].ScaleKeys[FrameA]), FVector(Tracks[TrackIndex].ScaleKeys[FrameB]), Alpha);
 #else
@@ -64,19 +522,87 @@ FVector UglTFAnimBoneCompressionCodec::GetTrackScale(FAnimSequenceDecompressionC
 
 void UglTFAnimBoneCompressionCodec::DecompressPose(FAnimSequenceDecompressionContext& DecompContext, const BoneTrackArray& RotationPairs, const BoneTrackArray& TranslationPairs, const BoneTrackArray& ScalePairs, TArrayView<FTransform>& OutAtoms) const
 {
+	DecompressPose(GetRelativePosition(DecompContext), DecompContext.Interpolation, RotationPairs, TranslationPairs, ScalePairs, OutAtoms);
+}
+
+void UglTFAnimBoneCompressionCodec::DecompressPose(const float RelativePos, const EAnimInterpolationType Interpolation, const BoneTrackArray& RotationPairs, const BoneTrackArray& TranslationPairs, const BoneTrackArray& ScalePairs, TArrayView<FTransform>& OutAtoms) const
+{
+	using namespace glTFRuntime::AnimCompression;
+
+	if (bCompressed)
+	{
+		// channels are resampled at the same rate, so the frame position is shared (only the retained keys differ)
+		int32 CachedNumFrames = INDEX_NONE;
+		float FramePosition = 0;
+		auto GetChannelFramePosition = [&](const FglTFRuntimeCompressedAnimChannel& Channel)
+			{
+				if (Channel.NumFrames != CachedNumFrames)
+				{
+					FramePosition = GetFramePosition(RelativePos, Channel.NumFrames, Interpolation);
+					CachedNumFrames = Channel.NumFrames;
+				}
+				return FramePosition;
+			};
+
+		for (const BoneTrackPair& BoneTrackPair : RotationPairs)
+		{
+			const FglTFRuntimeCompressedAnimChannel& Channel = CompressedTracks[BoneTrackPair.TrackIndex].Rotations;
+			OutAtoms[BoneTrackPair.AtomIndex].SetRotation(DecompressChannelAtFrame(Channel, GetChannelFramePosition(Channel), FQuat::Identity));
+		}
+
+		for (const BoneTrackPair& BoneTrackPair : TranslationPairs)
+		{
+			const FglTFRuntimeCompressedAnimChannel& Channel = CompressedTracks[BoneTrackPair.TrackIndex].Translations;
+			OutAtoms[BoneTrackPair.AtomIndex].SetLocation(DecompressChannelAtFrame(Channel, GetChannelFramePosition(Channel), FVector::ZeroVector));
+		}
+
+		for (const BoneTrackPair& BoneTrackPair : ScalePairs)
+		{
+			const FglTFRuntimeCompressedAnimChannel& Channel = CompressedTracks[BoneTrackPair.TrackIndex].Scales;
+			OutAtoms[BoneTrackPair.AtomIndex].SetScale3D(DecompressChannelAtFrame(Channel, GetChannelFramePosition(Channel), FVector::OneVector));
+		}
+
+		return;
+	}
+
+	// raw tracks have the same number of keys (but constant ones could be collapsed), so TimeToIndex runs only when it changes
+	int32 CachedNumKeys = INDEX_NONE;
+	int32 FrameA = 0;
+	int32 FrameB = 0;
+	float Alpha = 0;
+	FFloatRegister AlphaRegister = VectorSetFloat1(Alpha);
+	auto UpdateFrames = [&](const int32 NumKeys)
+		{
+			if (NumKeys != CachedNumKeys)
+			{
+				Alpha = TimeToIndex(0, RelativePos, NumKeys, Interpolation, FrameA, FrameB);
+				AlphaRegister = VectorSetFloat1(Alpha);
+				CachedNumKeys = NumKeys;
+			}
+		};
+
 	for (const BoneTrackPair& BoneTrackPair : RotationPairs)
 	{
-		OutAtoms[BoneTrackPair.AtomIndex].SetRotation(GetTrackRotation(DecompContext, BoneTrackPair.TrackIndex));
+		const FRawAnimSequenceTrack& Track = Tracks[BoneTrackPair.TrackIndex];
+		UpdateFrames(Track.RotKeys.Num());
+
+		alignas(16) float Rotation[4];
+		NLerpQuat(&Track.RotKeys[FrameA].X, &Track.RotKeys[FrameB].X, AlphaRegister, Rotation);
+		OutAtoms[BoneTrackPair.AtomIndex].SetRotation(FQuat(Rotation[0], Rotation[1], Rotation[2], Rotation[3]));
 	}
 
 	for (const BoneTrackPair& BoneTrackPair : TranslationPairs)
 	{
-		OutAtoms[BoneTrackPair.AtomIndex].SetLocation(GetTrackLocation(DecompContext, BoneTrackPair.TrackIndex));
+		const FRawAnimSequenceTrack& Track = Tracks[BoneTrackPair.TrackIndex];
+		UpdateFrames(Track.PosKeys.Num());
+		OutAtoms[BoneTrackPair.AtomIndex].SetLocation(FVector(Track.PosKeys[FrameA] + (Track.PosKeys[FrameB] - Track.PosKeys[FrameA]) * Alpha));
 	}
 
 	for (const BoneTrackPair& BoneTrackPair : ScalePairs)
 	{
-		OutAtoms[BoneTrackPair.AtomIndex].SetScale3D(GetTrackScale(DecompContext, BoneTrackPair.TrackIndex));
+		const FRawAnimSequenceTrack& Track = Tracks[BoneTrackPair.TrackIndex];
+		UpdateFrames(Track.ScaleKeys.Num());
+		OutAtoms[BoneTrackPair.AtomIndex].SetScale3D(FVector(Track.ScaleKeys[FrameA] + (Track.ScaleKeys[FrameB] - Track.ScaleKeys[FrameA]) * Alpha));
 	}
 }
 
@@ -128,4 +654,4 @@ float UglTFAnimBoneCompressionCodec::TimeToIndex(
 		}
 	}
 	return Alpha;
-}
\ No newline at end of file
+}
@@ -1,6 +1,7 @@
 // Copyright 2020-2023, Roberto De Ioris.
 
 #include "glTFRuntime.h"
+#include "glTFRuntimeTaskPool.h"
 
 #define LOCTEXT_NAMESPACE "FglTFRuntimeModule"
 
@@ -10,6 +11,7 @@ void FglTFRuntimeModule::StartupModule()
 
 void FglTFRuntimeModule::ShutdownModule()
 {
+	FglTFRuntimeTaskPool::Shutdown();
 }
 
 #undef LOCTEXT_NAMESPACE
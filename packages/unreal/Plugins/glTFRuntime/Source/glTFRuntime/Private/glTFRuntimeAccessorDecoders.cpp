@@ -0,0 +1,195 @@
+// Copyright 2020-2025, Roberto De Ioris.
+
+#include "glTFRuntimeAccessorDecoders.h"
+#include "Runtime/Launch/Resources/Version.h"
+#include "Math/VectorRegister.h"
+
+namespace glTFRuntime
+{
+	namespace Accessors
+	{
+#if ENGINE_MAJOR_VERSION > 4
+		using FBasisRegister = VectorRegister4Float;
+#else
+		using FBasisRegister = VectorRegister;
+#endif
+
+		// the basis rows are converted to float once, the scale is premultiplied into them
+		struct FBasisRows
+		{
+			FBasisRegister Rows[4];
+
+			FBasisRows(const FMatrix& Basis, const float Scale)
+			{
+				for (int32 RowIndex = 0; RowIndex < 4; RowIndex++)
+				{
+					Rows[RowIndex] = MakeVectorRegister(
+						static_cast<float>(Basis.M[RowIndex][0] * Scale),
+						static_cast<float>(Basis.M[RowIndex][1] * Scale),
+						static_cast<float>(Basis.M[RowIndex][2] * Scale),
+						static_cast<float>(Basis.M[RowIndex][3] * Scale));
+				}
+			}
+
+			FORCEINLINE FBasisRegister Transform3(const FBasisRegister& V, const bool bPosition) const
+			{
+				FBasisRegister Result = bPosition ? Rows[3] : VectorZero();
+				Result = VectorMultiplyAdd(VectorReplicate(V, 0), Rows[0], Result);
+				Result = VectorMultiplyAdd(VectorReplicate(V, 1), Rows[1], Result);
+				Result = VectorMultiplyAdd(VectorReplicate(V, 2), Rows[2], Result);
+				return Result;
+			}
+
+			FORCEINLINE FBasisRegister Transform4(const FBasisRegister& V) const
+			{
+				FBasisRegister Result = VectorMultiply(VectorReplicate(V, 0), Rows[0]);
+				Result = VectorMultiplyAdd(VectorReplicate(V, 1), Rows[1], Result);
+				Result = VectorMultiplyAdd(VectorReplicate(V, 2), Rows[2], Result);
+				Result = VectorMultiplyAdd(VectorReplicate(V, 3), Rows[3], Result);
+				return Result;
+			}
+		};
+
+		template<typename VectorType>
+		void DecodeFloat3WithBasisKernel(const uint8* Data, const int64 Stride, const int64 Count, VectorType* Out, const FMatrix& Basis, const float Scale, const bool bPosition)
+		{
+			// vectors are not scaled
+			const FBasisRows BasisRows(Basis, bPosition ? Scale : 1.0f);
+
+			ForEachBlock(Count, [&](const int64 Start, const int64 End)
+				{
+					const uint8* Ptr = Data + Start * Stride;
+					alignas(16) float Result[4];
+					for (int64 ElementIndex = Start; ElementIndex < End; ElementIndex++)
+					{
+						// VectorLoadFloat3 reads exactly 3 floats, so the last element never goes out of bounds
+						const FBasisRegister V = VectorLoadFloat3(reinterpret_cast<const float*>(Ptr));
+						VectorStoreAligned(BasisRows.Transform3(V, bPosition), Result);
+						Out[ElementIndex] = VectorType(Result[0], Result[1], Result[2]);
+						Ptr += Stride;
+					}
+				});
+		}
+
+		template<typename VectorType>
+		void DecodeFloat4WithBasisKernel(const uint8* Data, const int64 Stride, const int64 Count, VectorType* Out, const FMatrix& Basis)
+		{
+			const FBasisRows BasisRows(Basis, 1.0f);
+
+			ForEachBlock(Count, [&](const int64 Start, const int64 End)
+				{
+					const uint8* Ptr = Data + Start * Stride;
+					alignas(16) float Result[4];
+					for (int64 ElementIndex = Start; ElementIndex < End; ElementIndex++)
+					{
+						const FBasisRegister V = VectorLoad(reinterpret_cast<const float*>(Ptr));
+						VectorStoreAligned(BasisRows.Transform4(V), Result);
+						Out[ElementIndex] = VectorType(Result[0], Result[1], Result[2], Result[3]);
+						Ptr += Stride;
+					}
+				});
+		}
+
+		void DecodeFloat3WithBasis(const uint8* Data, const int64 Stride, const int64 Count, FVector* Out, const FMatrix& Basis, const float Scale, const bool bPosition)
+		{
+			DecodeFloat3WithBasisKernel(Data, Stride, Count, Out, Basis, Scale, bPosition);
+		}
+
+		void DecodeFloat4WithBasis(const uint8* Data, const int64 Stride, const int64 Count, FVector4* Out, const FMatrix& Basis)
+		{
+			DecodeFloat4WithBasisKernel(Data, Stride, Count, Out, Basis);
+		}
+
+#if ENGINE_MAJOR_VERSION > 4
+		void DecodeFloat3WithBasis(const uint8* Data, const int64 Stride, const int64 Count, FVector3f* Out, const FMatrix& Basis, const float Scale, const bool bPosition)
+		{
+			DecodeFloat3WithBasisKernel(Data, Stride, Count, Out, Basis, Scale, bPosition);
+		}
+
+		void DecodeFloat4WithBasis(const uint8* Data, const int64 Stride, const int64 Count, FVector4f* Out, const FMatrix& Basis)
+		{
+			DecodeFloat4WithBasisKernel(Data, Stride, Count, Out, Basis);
+		}
+#endif
+
+		template<typename ComponentType, typename Function>
+		void DecodeWeights16Kernel(const uint8* Data, const int64 Stride, const int64 Elements, const int64 Count, uint16* Out, Function&& Convert)
+		{
+			ForEachBlock(Count, [&](const int64 Start, const int64 End)
+				{
+					const uint8* Ptr = Data + Start * Stride;
+					for (int64 ElementIndex = Start; ElementIndex < End; ElementIndex++)
+					{
+						const ComponentType* Components = reinterpret_cast<const ComponentType*>(Ptr);
+						for (int64 i = 0; i < Elements; i++)
+						{
+							Out[ElementIndex * Elements + i] = Convert(Components[i]);
+						}
+						Ptr += Stride;
+					}
+				});
+		}
+
+		bool DecodeWeights16(const int64 ComponentType, const uint8* Data, const int64 Stride, const int64 Elements, const int64 Count, uint16* Out)
+		{
+			switch (ComponentType)
+			{
+			case(5121):// UNSIGNED_BYTE (x / 255 == x * 257 / 65535)
+				DecodeWeights16Kernel<uint8>(Data, Stride, Elements, Count, Out, [](const uint8 Value) -> uint16 { return static_cast<uint16>(Value * 257); });
+				return true;
+			case(5123):// UNSIGNED_SHORT
+				DecodeWeights16Kernel<uint16>(Data, Stride, Elements, Count, Out, [](const uint16 Value) -> uint16 { return Value; });
+				return true;
+			case(5126):// FLOAT
+				DecodeWeights16Kernel<float>(Data, Stride, Elements, Count, Out, [](const float Value) -> uint16 { return static_cast<uint16>(FMath::Clamp(FMath::RoundToInt(Value * 65535.0f), 0, 65535)); });
+				return true;
+			default:
+				break;
+			}
+			return false;
+		}
+
+		template<typename IndexType>
+		void DecodeIndicesKernel(const uint8* Data, const int64 Stride, const int64 Count, uint32* Out)
+		{
+			ForEachBlock(Count, [&](const int64 Start, const int64 End)
+				{
+					if (Stride == sizeof(IndexType))
+					{
+						// packed, plain widening loop the compiler can vectorize
+						const IndexType* Indices = reinterpret_cast<const IndexType*>(Data);
+						for (int64 Index = Start; Index < End; Index++)
+						{
+							Out[Index] = Indices[Index];
+						}
+					}
+					else
+					{
+						for (int64 Index = Start; Index < End; Index++)
+						{
+							Out[Index] = *reinterpret_cast<const IndexType*>(Data + Index * Stride);
+						}
+					}
+				});
+		}
+
+		bool DecodeIndices(const int64 ComponentType, const uint8* Data, const int64 Stride, const int64 Count, uint32* Out)
+		{
+			switch (ComponentType)
+			{
+			case(5121):// UNSIGNED_BYTE
+				DecodeIndicesKernel<uint8>(Data, Stride, Count, Out);
+				return true;
+			case(5123):// UNSIGNED_SHORT
+				DecodeIndicesKernel<uint16>(Data, Stride, Count, Out);
+				return true;
+			case(5125):// UNSIGNED_INT
+				DecodeIndicesKernel<uint32>(Data, Stride, Count, Out);
+				return true;
+			default:
+				break;
+			}
+			return false;
+		}
+	}
+}
@@ -7,6 +7,8 @@ UglTFRuntimeAnimationCurve::UglTFRuntimeAnimationCurve()
 {
 	glTFCurveAnimationIndex = INDEX_NONE;
 	glTFCurveAnimationDuration = 0;
+	bIsStepped = false;
+	bBaked = false;
 }
 
 FTransform UglTFRuntimeAnimationCurve::GetTransformValue(float InTime) const
@@ -110,6 +112,8 @@ FTransform UglTFRuntimeAnimationCurve::GetTransformValue(float InTime) const
 
 void UglTFRuntimeAnimationCurve::SetDefaultValues(const FVector Location, const FQuat Quat, const FRotator Rotator, const FVector Scale)
 {
+	bBaked = false;
+
 	LocationCurves[0].DefaultValue = Location.X;
 	LocationCurves[1].DefaultValue = Location.Y;
 	LocationCurves[2].DefaultValue = Location.Z;
@@ -216,6 +220,8 @@ bool UglTFRuntimeAnimationCurve::IsValidCurve(FRichCurveEditInfo CurveInfo)
 
 void UglTFRuntimeAnimationCurve::AddLocationValue(const float InTime, const FVector InLocation, const ERichCurveInterpMode InterpolationMode)
 {
+	bBaked = false;
+
 	FKeyHandle LocationKey0 = LocationCurves[0].AddKey(InTime, InLocation.X);
 	LocationCurves[0].SetKeyInterpMode(LocationKey0, InterpolationMode);
 	FKeyHandle LocationKey1 = LocationCurves[1].AddKey(InTime, InLocation.Y);
@@ -226,6 +232,8 @@ void UglTFRuntimeAnimationCurve::AddLocationValue(const float InTime, const FVec
 
 void UglTFRuntimeAnimationCurve::AddQuatValue(const float InTime, const FQuat InQuat, const ERichCurveInterpMode InterpolationMode)
 {
+	bBaked = false;
+
 	FKeyHandle RotationKey0 = QuatCurves[0].AddKey(InTime, InQuat.X);
 	QuatCurves[0].SetKeyInterpMode(RotationKey0, InterpolationMode);
 	FKeyHandle RotationKey1 = QuatCurves[1].AddKey(InTime, InQuat.Y);
@@ -238,6 +246,8 @@ void UglTFRuntimeAnimationCurve::AddQuatValue(const float InTime, const FQuat In
 
 void UglTFRuntimeAnimationCurve::AddConvertedQuaternion(const float InTime, const FQuat InQuat, const bool bStep)
 {
+	bBaked = false;
+
 	int32 Index = 0;
 	if (ConvertedQuaternions.Num() == 0 || ConvertedQuaternions.Last().Key < InTime)
 	{
@@ -255,6 +265,8 @@ void UglTFRuntimeAnimationCurve::AddConvertedQuaternion(const float InTime, cons
 
 void UglTFRuntimeAnimationCurve::AddRotatorValue(const float InTime, const FRotator InRotator, const ERichCurveInterpMode InterpolationMode)
 {
+	bBaked = false;
+
 	FKeyHandle RotationKey0 = RotatorCurves[0].AddKey(InTime, InRotator.Roll, true);
 	RotatorCurves[0].SetKeyInterpMode(RotationKey0, InterpolationMode);
 	FKeyHandle RotationKey1 = RotatorCurves[1].AddKey(InTime, InRotator.Pitch, true);
@@ -265,6 +277,8 @@ void UglTFRuntimeAnimationCurve::AddRotatorValue(const float InTime, const FRota
 
 void UglTFRuntimeAnimationCurve::AddScaleValue(const float InTime, const FVector InScale, const ERichCurveInterpMode InterpolationMode)
 {
+	bBaked = false;
+
 	FKeyHandle ScaleKey0 = ScaleCurves[0].AddKey(InTime, InScale.X);
 	ScaleCurves[0].SetKeyInterpMode(ScaleKey0, InterpolationMode);
 	FKeyHandle ScaleKey1 = ScaleCurves[1].AddKey(InTime, InScale.Y);
@@ -272,3 +286,159 @@ void UglTFRuntimeAnimationCurve::AddScaleValue(const float InTime, const FVector
 	FKeyHandle ScaleKey2 = ScaleCurves[2].AddKey(InTime, InScale.Z);
 	ScaleCurves[2].SetKeyInterpMode(ScaleKey2, InterpolationMode);
 }
+
+void UglTFRuntimeAnimationCurve::Bake()
+{
+	BakedCurve = FglTFRuntimeBakedAnimationCurve();
+	BakedCurve.Duration = glTFCurveAnimationDuration;
+
+	const FMatrix BasisMatrixInverse = BasisMatrix.Inverse();
+
+	// location and scale keys share the timeline of their X curve (they are added together)
+	const TArray<FRichCurveKey>& LocationKeys = LocationCurves[0].GetConstRefOfKeys();
+	if (LocationKeys.Num() > 0)
+	{
+		BakedCurve.Locations.bStep = LocationKeys[0].InterpMode == ERichCurveInterpMode::RCIM_Constant;
+		for (int32 KeyIndex = 0; KeyIndex < LocationKeys.Num(); KeyIndex++)
+		{
+			const float Time = LocationKeys[KeyIndex].Time;
+			const FVector Location = FTransform(BasisMatrixInverse * FTranslationMatrix(FVector(LocationCurves[0].Eval(Time), LocationCurves[1].Eval(Time), LocationCurves[2].Eval(Time))) * BasisMatrix).GetLocation();
+			BakedCurve.Locations.AddKey(Time, Location.X, Location.Y, Location.Z);
+		}
+	}
+	else
+	{
+		const FVector Location = FTransform(BasisMatrixInverse * FTranslationMatrix(FVector(LocationCurves[0].DefaultValue, LocationCurves[1].DefaultValue, LocationCurves[2].DefaultValue)) * BasisMatrix).GetLocation();
+		BakedCurve.Locations.AddKey(0, Location.X, Location.Y, Location.Z);
+	}
+
+	const TArray<FRichCurveKey>& ScaleKeys = ScaleCurves[0].GetConstRefOfKeys();
+	if (ScaleKeys.Num() > 0)
+	{
+		BakedCurve.Scales.bStep = ScaleKeys[0].InterpMode == ERichCurveInterpMode::RCIM_Constant;
+		for (int32 KeyIndex = 0; KeyIndex < ScaleKeys.Num(); KeyIndex++)
+		{
+			const float Time = ScaleKeys[KeyIndex].Time;
+			const FVector Scale = FTransform(BasisMatrixInverse * FScaleMatrix(FVector(ScaleCurves[0].Eval(Time), ScaleCurves[1].Eval(Time), ScaleCurves[2].Eval(Time))) * BasisMatrix).GetScale3D();
+			BakedCurve.Scales.AddKey(Time, Scale.X, Scale.Y, Scale.Z);
+		}
+	}
+	else
+	{
+		const FVector Scale = FTransform(BasisMatrixInverse * FScaleMatrix(FVector(ScaleCurves[0].DefaultValue, ScaleCurves[1].DefaultValue, ScaleCurves[2].DefaultValue)) * BasisMatrix).GetScale3D();
+		BakedCurve.Scales.AddKey(0, Scale.X, Scale.Y, Scale.Z);
+	}
+
+	// without rotation keys the rotation is the identity (as in GetTransformValue)
+	BakedCurve.Rotations.bStep = bIsStepped;
+	for (const TPair<float, FQuat>& Pair : ConvertedQuaternions)
+	{
+		BakedCurve.Rotations.AddKey(Pair.Key, Pair.Value.X, Pair.Value.Y, Pair.Value.Z, Pair.Value.W);
+	}
+
+	float MinTime = 0;
+	float MaxTime = 0;
+	GetTimeRange(MinTime, MaxTime);
+	BakedCurve.MinTime = MinTime;
+
+	bBaked = true;
+}
+
+void FglTFRuntimeBakedAnimationChannel::AddKey(const float Time, const float InX, const float InY, const float InZ, const float InW)
+{
+	Times.Add(Time);
+	X.Add(InX);
+	Y.Add(InY);
+	Z.Add(InZ);
+	W.Add(InW);
+}
+
+int32 FglTFRuntimeBakedAnimationChannel::FindKey(const float Time, int32& Cursor) const
+{
+	const int32 NumKeys = Times.Num();
+	if (NumKeys < 2 || Time <= Times[0])
+	{
+		Cursor = 0;
+		return 0;
+	}
+
+	if (Time >= Times[NumKeys - 1])
+	{
+		Cursor = NumKeys - 1;
+		return Cursor;
+	}
+
+	// forward playback stays on the same key or moves to the next one
+	if (Cursor >= 0 && Cursor < NumKeys - 1 && Times[Cursor] <= Time)
+	{
+		if (Time < Times[Cursor + 1])
+		{
+			return Cursor;
+		}
+		if (Cursor + 2 < NumKeys && Time < Times[Cursor + 2])
+		{
+			Cursor++;
+			return Cursor;
+		}
+	}
+
+	// Times[0] < Time < Times.Last(), search for the last key <= Time
+	int32 First = 0;
+	int32 Last = NumKeys - 1;
+	while (Last - First > 1)
+	{
+		const int32 Middle = (First + Last) / 2;
+		if (Times[Middle] <= Time)
+		{
+			First = Middle;
+		}
+		else
+		{
+			Last = Middle;
+		}
+	}
+
+	Cursor = First;
+	return First;
+}
+
+float FglTFRuntimeBakedAnimationChannel::GetAlpha(const int32 KeyIndex, const float Time) const
+{
+	if (bStep || KeyIndex + 1 >= Times.Num() || Time <= Times[KeyIndex])
+	{
+		return 0;
+	}
+
+	return FMath::Min((Time - Times[KeyIndex]) / (Times[KeyIndex + 1] - Times[KeyIndex]), 1.0f);
+}
+
+FVector FglTFRuntimeBakedAnimationChannel::GetVector(const float Time, int32& Cursor) const
+{
+	const int32 KeyIndex = FindKey(Time, Cursor);
+	const float Alpha = GetAlpha(KeyIndex, Time);
+	if (Alpha <= 0)
+	{
+		return FVector(X[KeyIndex], Y[KeyIndex], Z[KeyIndex]);
+	}
+
+	return FVector(FMath::Lerp(X[KeyIndex], X[KeyIndex + 1], Alpha), FMath::Lerp(Y[KeyIndex], Y[KeyIndex + 1], Alpha), FMath::Lerp(Z[KeyIndex], Z[KeyIndex + 1], Alpha));
+}
+
+FQuat FglTFRuntimeBakedAnimationChannel::GetQuat(const float Time, int32& Cursor) const
+{
+	const int32 KeyIndex = FindKey(Time, Cursor);
+	const float Alpha = GetAlpha(KeyIndex, Time);
+	const FQuat Quat = FQuat(X[KeyIndex], Y[KeyIndex], Z[KeyIndex], W[KeyIndex]);
+	if (Alpha <= 0)
+	{
+		return Quat;
+	}
+
+	return FQuat::Slerp(Quat, FQuat(X[KeyIndex + 1], Y[KeyIndex + 1], Z[KeyIndex + 1], W[KeyIndex + 1]), Alpha);
+}
+
+FTransform FglTFRuntimeBakedAnimationCurve::Evaluate(const float Time, FglTFRuntimeBakedAnimationCursor& Cursor) const
+{
+	const FQuat Rotation = Rotations.Times.Num() > 0 ? Rotations.GetQuat(Time, Cursor.Rotation) : FQuat::Identity;
+	return FTransform(Rotation, Locations.GetVector(Time, Cursor.Location), Scales.GetVector(Time, Cursor.Scale));
+}
@@ -359,6 +359,28 @@ bool UglTFRuntimeAsset::LoadFromData(const uint8* DataPtr, int64 DataNum, const
 	return Parser != nullptr;
 }
 
+bool UglTFRuntimeAsset::LoadFromData(TArray64<uint8>&& Data, const FglTFRuntimeConfig& LoaderConfig)
+{
+	// asset already loaded ?
+	if (Parser)
+	{
+		return false;
+	}
+
+	Parser = FglTFRuntimeParser::FromData(MoveTemp(Data), LoaderConfig);
+	if (Parser)
+	{
+		FScriptDelegate Delegate;
+		Delegate.BindUFunction(this, GET_FUNCTION_NAME_CHECKED(UglTFRuntimeAsset, OnErrorProxy));
+		Parser->OnError.Add(Delegate);
+		Delegate.BindUFunction(this, GET_FUNCTION_NAME_CHECKED(UglTFRuntimeAsset, OnStaticMeshCreatedProxy));
+		Parser->OnStaticMeshCreated.Add(Delegate);
+		Delegate.BindUFunction(this, GET_FUNCTION_NAME_CHECKED(UglTFRuntimeAsset, OnSkeletalMeshCreatedProxy));
+		Parser->OnSkeletalMeshCreated.Add(Delegate);
+	}
+	return Parser != nullptr;
+}
+
 void UglTFRuntimeAsset::OnErrorProxy(const FString& ErrorContext, const FString& ErrorMessage)
 {
 	if (OnError.IsBound())
@@ -585,6 +607,26 @@ void UglTFRuntimeAsset::LoadSkeletalMeshAsync(const int32 MeshIndex, const int32
 	Parser->LoadSkeletalMeshAsync(MeshIndex, SkinIndex, AsyncCallback, SkeletalMeshConfig);
 }
 
+TArray<FglTFRuntimeNode> UglTFRuntimeAsset::GetSkinnedMeshNodes()
+{
+	GLTF_CHECK_PARSER(TArray<FglTFRuntimeNode>());
+
+	TArray<FglTFRuntimeNode> SkinnedMeshNodes;
+	if (!Parser->GetSkinnedMeshNodes(SkinnedMeshNodes))
+	{
+		Parser->AddError("UglTFRuntimeAsset::GetSkinnedMeshNodes()", "Unable to retrieve Nodes from glTF Asset.");
+		return TArray<FglTFRuntimeNode>();
+	}
+	return SkinnedMeshNodes;
+}
+
+void UglTFRuntimeAsset::LoadSkinnedMeshNodesAsync(const FglTFRuntimeSkeletalMeshesAsync& AsyncCallback, const FglTFRuntimeSkeletalMeshConfig& SkeletalMeshConfig)
+{
+	GLTF_CHECK_PARSER_VOID();
+
+	Parser->LoadSkinnedMeshNodesAsync(GetSkinnedMeshNodes(), AsyncCallback, SkeletalMeshConfig);
+}
+
 USkeletalMesh* UglTFRuntimeAsset::LoadSkeletalMeshRecursive(const FString& NodeName, const TArray<FString>& ExcludeNodes, const FglTFRuntimeSkeletalMeshConfig& SkeletalMeshConfig, const EglTFRuntimeRecursiveMode TransformApplyRecursiveMode)
 {
 	GLTF_CHECK_PARSER(nullptr);
@@ -1122,23 +1164,22 @@ UTexture2D* UglTFRuntimeAsset::LoadImageFromBlob(const FglTFRuntimeImagesConfig&
 
 void UglTFRuntimeAsset::LoadImageFromBlobAsync(const FglTFRuntimeTexture2DAsync& AsyncCallback, const FglTFRuntimeImagesConfig& ImagesConfig)
 {
-	Async(EAsyncExecution::Thread, [this, ImagesConfig, AsyncCallback]()
+	FglTFRuntimeTaskPool::Get().AddTask([this, ImagesConfig, AsyncCallback](const bool bCancelled)
 		{
 			TArray64<uint8> UncompressedBytes;
 			int32 Width = 0;
 			int32 Height = 0;
 			EPixelFormat PixelFormat;
 
-			if (!Parser ||
+			if (bCancelled || !Parser ||
 				!Parser->LoadImageFromBlob(Parser->GetBlob(), MakeShared<FJsonObject>(), UncompressedBytes, Width, Height, PixelFormat, ImagesConfig) ||
 				Width <= 0 ||
 				Height <= 0)
 			{
-				FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([&, AsyncCallback]()
+				FFunctionGraphTask::CreateAndDispatchWhenReady([AsyncCallback]()
 					{
 						AsyncCallback.ExecuteIfBound(nullptr);
 					}, TStatId(), nullptr, ENamedThreads::GameThread);
-				FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
 				return;
 			}
 
@@ -1150,13 +1191,11 @@ void UglTFRuntimeAsset::LoadImageFromBlobAsync(const FglTFRuntimeTexture2DAsync&
 			TArray<FglTFRuntimeMipMap> Mips;
 			Mips.Add(MoveTemp(Mip));
 
-			FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([&]()
+			FFunctionGraphTask::CreateAndDispatchWhenReady([this, Mips = MoveTemp(Mips), ImagesConfig, AsyncCallback]()
 				{
 					AsyncCallback.ExecuteIfBound(Parser->BuildTexture(this, Mips, ImagesConfig, FglTFRuntimeTextureSampler()));
 				}, TStatId(), nullptr, ENamedThreads::GameThread);
-			FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
-		}
-	);
+		}, ImagesConfig.AsyncPriority, ImagesConfig.AsyncCancellationToken);
 }
 
 UTexture2DArray* UglTFRuntimeAsset::LoadImageArrayFromBlob(const FglTFRuntimeImagesConfig& ImagesConfig)
@@ -1202,21 +1241,20 @@ UTexture2DArray* UglTFRuntimeAsset::LoadImageArrayFromBlob(const FglTFRuntimeIma
 
 void UglTFRuntimeAsset::LoadImageArrayFromBlobAsync(const FglTFRuntimeTexture2DArrayAsync& AsyncCallback, const FglTFRuntimeImagesConfig& ImagesConfig)
 {
-	Async(EAsyncExecution::Thread, [this, ImagesConfig, AsyncCallback]()
+	FglTFRuntimeTaskPool::Get().AddTask([this, ImagesConfig, AsyncCallback](const bool bCancelled)
 		{
 			TArray64<uint8> UncompressedBytes;
 			int32 Width = 0;
 			int32 Height = 0;
 			EPixelFormat PixelFormat;
-			if (!Parser || !Parser->LoadImageFromBlob(Parser->GetBlob(), MakeShared<FJsonObject>(), UncompressedBytes, Width, Height, PixelFormat, ImagesConfig) ||
+			if (bCancelled || !Parser || !Parser->LoadImageFromBlob(Parser->GetBlob(), MakeShared<FJsonObject>(), UncompressedBytes, Width, Height, PixelFormat, ImagesConfig) ||
 				Width <= 0 ||
 				Height <= 0)
 			{
-				FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([&, AsyncCallback]()
+				FFunctionGraphTask::CreateAndDispatchWhenReady([AsyncCallback]()
 					{
 						AsyncCallback.ExecuteIfBound(nullptr);
 					}, TStatId(), nullptr, ENamedThreads::GameThread);
-				FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
 				return;
 			}
 
@@ -1241,13 +1279,11 @@ void UglTFRuntimeAsset::LoadImageArrayFromBlobAsync(const FglTFRuntimeTexture2DA
 				Mips.Add(MoveTemp(Mip));
 			}
 
-			FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([&]()
+			FFunctionGraphTask::CreateAndDispatchWhenReady([this, Mips = MoveTemp(Mips), ImagesConfig, AsyncCallback]()
 				{
 					AsyncCallback.ExecuteIfBound(Parser->BuildTextureArray(this, Mips, ImagesConfig, FglTFRuntimeTextureSampler()));
 				}, TStatId(), nullptr, ENamedThreads::GameThread);
-			FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
-		}
-	);
+		}, ImagesConfig.AsyncPriority, ImagesConfig.AsyncCancellationToken);
 }
 
 UTexture2D* UglTFRuntimeAsset::LoadMipsFromBlob(const FglTFRuntimeImagesConfig& ImagesConfig)
@@ -1270,15 +1306,14 @@ UTexture2D* UglTFRuntimeAsset::LoadMipsFromBlob(const FglTFRuntimeImagesConfig&
 
 void UglTFRuntimeAsset::LoadMipsFromBlobAsync(const FglTFRuntimeImagesConfig& ImagesConfig, const FglTFRuntimeTexture2DAsync& AsyncCallback)
 {
-	Async(EAsyncExecution::Thread, [this, ImagesConfig, AsyncCallback]()
+	FglTFRuntimeTaskPool::Get().AddTask([this, ImagesConfig, AsyncCallback](const bool bCancelled)
 		{
-			if (!Parser)
+			if (bCancelled || !Parser)
 			{
-				FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([&, AsyncCallback]()
+				FFunctionGraphTask::CreateAndDispatchWhenReady([AsyncCallback]()
 					{
 						AsyncCallback.ExecuteIfBound(nullptr);
 					}, TStatId(), nullptr, ENamedThreads::GameThread);
-				FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
 				return;
 			}
 
@@ -1294,7 +1329,7 @@ void UglTFRuntimeAsset::LoadMipsFromBlobAsync(const FglTFRuntimeImagesConfig& Im
 				}
 			}
 
-			FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([&, AsyncCallback]()
+			FFunctionGraphTask::CreateAndDispatchWhenReady([this, Mips = MoveTemp(Mips), ImagesConfig, AsyncCallback]()
 				{
 					if (Mips.Num() > 0)
 					{
@@ -1305,21 +1340,19 @@ void UglTFRuntimeAsset::LoadMipsFromBlobAsync(const FglTFRuntimeImagesConfig& Im
 						AsyncCallback.ExecuteIfBound(nullptr);
 					}
 				}, TStatId(), nullptr, ENamedThreads::GameThread);
-			FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
-		});
+		}, ImagesConfig.AsyncPriority, ImagesConfig.AsyncCancellationToken);
 }
 
 void UglTFRuntimeAsset::LoadCubeMapFromBlobAsync(const bool bSpherical, const bool bAutoRotate, const FglTFRuntimeTextureCubeAsync& AsyncCallback, const FglTFRuntimeImagesConfig& ImagesConfig)
 {
-	Async(EAsyncExecution::Thread, [this, bSpherical, bAutoRotate, ImagesConfig, AsyncCallback]()
+	FglTFRuntimeTaskPool::Get().AddTask([this, bSpherical, bAutoRotate, ImagesConfig, AsyncCallback](const bool bCancelled)
 		{
-			if (!Parser)
+			if (bCancelled || !Parser)
 			{
-				FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([&, AsyncCallback]()
+				FFunctionGraphTask::CreateAndDispatchWhenReady([AsyncCallback]()
 					{
 						AsyncCallback.ExecuteIfBound(nullptr);
 					}, TStatId(), nullptr, ENamedThreads::GameThread);
-				FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
 				return;
 			}
 			TArray<FglTFRuntimeMipMap> MipsXP;
@@ -1334,7 +1367,7 @@ void UglTFRuntimeAsset::LoadCubeMapFromBlobAsync(const bool bSpherical, const bo
 				bLoaded = true;
 			}
 
-			FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([&, AsyncCallback]()
+			FFunctionGraphTask::CreateAndDispatchWhenReady([this, MipsXP = MoveTemp(MipsXP), MipsXN = MoveTemp(MipsXN), MipsYP = MoveTemp(MipsYP), MipsYN = MoveTemp(MipsYN), MipsZP = MoveTemp(MipsZP), MipsZN = MoveTemp(MipsZN), bLoaded, bSpherical, bAutoRotate, ImagesConfig, AsyncCallback]()
 				{
 					if (bLoaded)
 					{
@@ -1345,9 +1378,7 @@ void UglTFRuntimeAsset::LoadCubeMapFromBlobAsync(const bool bSpherical, const bo
 						AsyncCallback.ExecuteIfBound(nullptr);
 					}
 				}, TStatId(), nullptr, ENamedThreads::GameThread);
-			FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
-		}
-	);
+		}, ImagesConfig.AsyncPriority, ImagesConfig.AsyncCancellationToken);
 }
 
 UTextureCube* UglTFRuntimeAsset::LoadCubeMapFromBlob(const bool bSpherical, const bool bAutoRotate, const FglTFRuntimeImagesConfig& ImagesConfig)
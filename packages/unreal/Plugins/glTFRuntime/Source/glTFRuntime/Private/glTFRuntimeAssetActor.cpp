@@ -7,6 +7,7 @@
 #include "Components/SkeletalMeshComponent.h"
 #include "Engine/StaticMeshSocket.h"
 #include "Animation/AnimSequence.h"
+#include "glTFRuntimeNodeAnimationSubsystem.h"
 #include "glTFRuntimeSkeletalMeshComponent.h"
 
 // Sets default values
@@ -91,9 +92,24 @@ void AglTFRuntimeAssetActor::BeginPlay()
 		}
 	}
 
+	if (UglTFRuntimeNodeAnimationSubsystem* NodeAnimationSubsystem = GetWorld()->GetSubsystem<UglTFRuntimeNodeAnimationSubsystem>())
+	{
+		NodeAnimationSubsystem->RegisterNodeAnimations(this, CurveBasedAnimations);
+	}
+
 	UE_LOG(LogGLTFRuntime, Log, TEXT("Asset loaded in %f seconds"), FPlatformTime::Seconds() - LoadingStartTime);
 }
 
+void AglTFRuntimeAssetActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UglTFRuntimeNodeAnimationSubsystem* NodeAnimationSubsystem = GetWorld()->GetSubsystem<UglTFRuntimeNodeAnimationSubsystem>())
+	{
+		NodeAnimationSubsystem->UnregisterNodeAnimations(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void AglTFRuntimeAssetActor::ProcessNode(USceneComponent* NodeParentComponent, const FName SocketName, FglTFRuntimeNode& Node)
 {
 	// special case for bones/joints
@@ -332,7 +348,6 @@ void AglTFRuntimeAssetActor::ProcessNode(USceneComponent* NodeParentComponent, c
 				if (!CurveBasedAnimations.Contains(NewComponent))
 				{
 					CurveBasedAnimations.Add(NewComponent, ComponentAnimationCurve);
-					CurveBasedAnimationsTimeTracker.Add(NewComponent, 0);
 				}
 				DiscoveredCurveAnimationsNames.Add(ComponentAnimationCurve->glTFCurveAnimationName);
 				ComponentAnimationCurvesMap.Add(ComponentAnimationCurve->glTFCurveAnimationName, ComponentAnimationCurve);
@@ -423,7 +438,6 @@ void AglTFRuntimeAssetActor::SetCurveAnimationByName(const FString& CurveAnimati
 		if (WantedCurveAnimationsMap.Contains(CurveAnimationName))
 		{
 			Pair.Value = WantedCurveAnimationsMap[CurveAnimationName];
-			CurveBasedAnimationsTimeTracker[Pair.Key] = 0;
 		}
 		else
 		{
@@ -432,38 +446,17 @@ void AglTFRuntimeAssetActor::SetCurveAnimationByName(const FString& CurveAnimati
 
 	}
 
+	if (UglTFRuntimeNodeAnimationSubsystem* NodeAnimationSubsystem = GetWorld()->GetSubsystem<UglTFRuntimeNodeAnimationSubsystem>())
+	{
+		NodeAnimationSubsystem->RegisterNodeAnimations(this, CurveBasedAnimations);
+	}
 }
 
 // Called every frame
 void AglTFRuntimeAssetActor::Tick(float DeltaTime)
 {
+	// node animations are evaluated (in batch with the other actors) by UglTFRuntimeNodeAnimationSubsystem
 	Super::Tick(DeltaTime);
-
-	for (TPair<USceneComponent*, UglTFRuntimeAnimationCurve*>& Pair : CurveBasedAnimations)
-	{
-		// the curve could be null
-		if (!Pair.Value)
-		{
-			continue;
-		}
-		float MinTime;
-		float MaxTime;
-		Pair.Value->GetTimeRange(MinTime, MaxTime);
-
-		float CurrentTime = CurveBasedAnimationsTimeTracker[Pair.Key];
-		if (CurrentTime > Pair.Value->glTFCurveAnimationDuration)
-		{
-			CurveBasedAnimationsTimeTracker[Pair.Key] = 0;
-			CurrentTime = 0;
-		}
-
-		if (CurrentTime >= MinTime)
-		{
-			FTransform FrameTransform = Pair.Value->GetTransformValue(CurveBasedAnimationsTimeTracker[Pair.Key]);
-			Pair.Key->SetRelativeTransform(FrameTransform);
-		}
-		CurveBasedAnimationsTimeTracker[Pair.Key] += DeltaTime;
-	}
 }
 
 void AglTFRuntimeAssetActor::ReceiveOnStaticMeshComponentCreated_Implementation(UStaticMeshComponent* StaticMeshComponent, const FglTFRuntimeNode& Node)
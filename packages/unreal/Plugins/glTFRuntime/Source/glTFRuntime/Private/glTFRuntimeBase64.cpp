@@ -0,0 +1,294 @@
+// Copyright 2020-2025, Roberto De Ioris.
+
+#include "glTFRuntimeBase64.h"
+#include "Async/ParallelFor.h"
+
+#if defined(PLATFORM_ALWAYS_HAS_AVX_2) && PLATFORM_ALWAYS_HAS_AVX_2
+#define GLTFRUNTIME_BASE64_AVX2 1
+#include <immintrin.h>
+#else
+#define GLTFRUNTIME_BASE64_AVX2 0
+#endif
+
+#if defined(PLATFORM_ALWAYS_HAS_SSE4_1) && PLATFORM_ALWAYS_HAS_SSE4_1
+#define GLTFRUNTIME_BASE64_SSE 1
+#include <smmintrin.h>
+#else
+#define GLTFRUNTIME_BASE64_SSE 0
+#endif
+
+namespace glTFRuntime
+{
+	namespace Base64
+	{
+		// characters per parallel chunk (multiple of 4, so every chunk but the last one decodes to whole triplets)
+		constexpr int64 ChunkChars = 256 * 1024;
+		constexpr int64 MinParallelChars = 1024 * 1024;
+
+		FORCEINLINE int32 DecodeChar(const TCHAR Char)
+		{
+			if (Char >= 'A' && Char <= 'Z')
+			{
+				return Char - 'A';
+			}
+			if (Char >= 'a' && Char <= 'z')
+			{
+				return Char - 'a' + 26;
+			}
+			if (Char >= '0' && Char <= '9')
+			{
+				return Char - '0' + 52;
+			}
+			if (Char == '+')
+			{
+				return 62;
+			}
+			if (Char == '/')
+			{
+				return 63;
+			}
+			return -1;
+		}
+
+#if GLTFRUNTIME_BASE64_SSE
+		/*
+		* Wojciech Mula's lookup: the low and high nibbles of every character index two tables whose AND is zero only for the Base64 alphabet,
+		* the high nibble (with '/' as a special case) selects the offset to add to get the 6 bits value.
+		* The 16 values are then merged in 12 bytes with multiply-adds and a final shuffle (16 bytes are stored).
+		*/
+		FORCEINLINE bool DecodeBlockSSE(const __m128i Chars, uint8* Output)
+		{
+			const __m128i LutLo = _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+			const __m128i LutHi = _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+			const __m128i LutRoll = _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+			const __m128i NibbleMask = _mm_set1_epi8(0x0F);
+
+			const __m128i HiNibbles = _mm_and_si128(_mm_srli_epi32(Chars, 4), NibbleMask);
+			const __m128i LoNibbles = _mm_and_si128(Chars, NibbleMask);
+			const __m128i Hi = _mm_shuffle_epi8(LutHi, HiNibbles);
+			const __m128i Lo = _mm_shuffle_epi8(LutLo, LoNibbles);
+			if (!_mm_testz_si128(Lo, Hi))
+			{
+				return false;
+			}
+
+			const __m128i IsSlash = _mm_cmpeq_epi8(Chars, _mm_set1_epi8('/'));
+			const __m128i Roll = _mm_shuffle_epi8(LutRoll, _mm_add_epi8(IsSlash, HiNibbles));
+			const __m128i Values = _mm_add_epi8(Chars, Roll);
+
+			const __m128i Merged = _mm_madd_epi16(_mm_maddubs_epi16(Values, _mm_set1_epi32(0x01400140)), _mm_set1_epi32(0x00011000));
+			const __m128i Bytes = _mm_shuffle_epi8(Merged, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Output), Bytes);
+			return true;
+		}
+#endif
+
+#if GLTFRUNTIME_BASE64_AVX2
+		// same as DecodeBlockSSE on both lanes, 24 bytes are compacted at the start of the 32 stored ones
+		FORCEINLINE bool DecodeBlockAVX2(const __m256i Chars, uint8* Output)
+		{
+			const __m256i LutLo = _mm256_setr_epi8(
+				0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A,
+				0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+			const __m256i LutHi = _mm256_setr_epi8(
+				0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+				0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+			const __m256i LutRoll = _mm256_setr_epi8(
+				0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0,
+				0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+			const __m256i NibbleMask = _mm256_set1_epi8(0x0F);
+
+			const __m256i HiNibbles = _mm256_and_si256(_mm256_srli_epi32(Chars, 4), NibbleMask);
+			const __m256i LoNibbles = _mm256_and_si256(Chars, NibbleMask);
+			const __m256i Hi = _mm256_shuffle_epi8(LutHi, HiNibbles);
+			const __m256i Lo = _mm256_shuffle_epi8(LutLo, LoNibbles);
+			if (!_mm256_testz_si256(Lo, Hi))
+			{
+				return false;
+			}
+
+			const __m256i IsSlash = _mm256_cmpeq_epi8(Chars, _mm256_set1_epi8('/'));
+			const __m256i Roll = _mm256_shuffle_epi8(LutRoll, _mm256_add_epi8(IsSlash, HiNibbles));
+			const __m256i Values = _mm256_add_epi8(Chars, Roll);
+
+			const __m256i Merged = _mm256_madd_epi16(_mm256_maddubs_epi16(Values, _mm256_set1_epi32(0x01400140)), _mm256_set1_epi32(0x00011000));
+			const __m256i Bytes = _mm256_shuffle_epi8(Merged, _mm256_setr_epi8(
+				2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+				2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(Output), _mm256_permutevar8x32_epi32(Bytes, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7)));
+			return true;
+		}
+#endif
+
+		/*
+		* Decodes NumChars characters (no padding) into exactly the expected number of bytes (vector stores never cross OutputNum).
+		* UTF-16 characters are packed to bytes with unsigned saturation, so anything out of the latin1 range fails the validation.
+		*/
+		bool DecodeChunk(const TCHAR* Chars, const int64 NumChars, uint8* Output, const int64 OutputNum)
+		{
+			int64 CharIndex = 0;
+			int64 OutputIndex = 0;
+
+#if GLTFRUNTIME_BASE64_AVX2
+			if (sizeof(TCHAR) == 2)
+			{
+				const __m256i* Chars16 = reinterpret_cast<const __m256i*>(Chars);
+				while (CharIndex + 32 <= NumChars && OutputIndex + 32 <= OutputNum)
+				{
+					const __m256i Chars0 = _mm256_loadu_si256(Chars16);
+					const __m256i Chars1 = _mm256_loadu_si256(Chars16 + 1);
+					const __m256i Packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(Chars0, Chars1), 0xD8);
+					if (!DecodeBlockAVX2(Packed, Output + OutputIndex))
+					{
+						// let the scalar path report (or accept) it
+						break;
+					}
+					Chars16 += 2;
+					CharIndex += 32;
+					OutputIndex += 24;
+				}
+			}
+#endif
+
+#if GLTFRUNTIME_BASE64_SSE
+			if (sizeof(TCHAR) == 2)
+			{
+				while (CharIndex + 16 <= NumChars && OutputIndex + 16 <= OutputNum)
+				{
+					const __m128i* Chars16 = reinterpret_cast<const __m128i*>(Chars + CharIndex);
+					const __m128i Packed = _mm_packus_epi16(_mm_loadu_si128(Chars16), _mm_loadu_si128(Chars16 + 1));
+					if (!DecodeBlockSSE(Packed, Output + OutputIndex))
+					{
+						break;
+					}
+					CharIndex += 16;
+					OutputIndex += 12;
+				}
+			}
+#endif
+
+			for (; CharIndex + 4 <= NumChars; CharIndex += 4)
+			{
+				const int32 A = DecodeChar(Chars[CharIndex]);
+				const int32 B = DecodeChar(Chars[CharIndex + 1]);
+				const int32 C = DecodeChar(Chars[CharIndex + 2]);
+				const int32 D = DecodeChar(Chars[CharIndex + 3]);
+				if ((A | B | C | D) < 0)
+				{
+					return false;
+				}
+
+				const uint32 Triplet = (A << 18) | (B << 12) | (C << 6) | D;
+				Output[OutputIndex++] = static_cast<uint8>(Triplet >> 16);
+				Output[OutputIndex++] = static_cast<uint8>(Triplet >> 8);
+				Output[OutputIndex++] = static_cast<uint8>(Triplet);
+			}
+
+			// 2 or 3 characters left (missing padding)
+			const int64 NumTail = NumChars - CharIndex;
+			if (NumTail > 1)
+			{
+				const int32 A = DecodeChar(Chars[CharIndex]);
+				const int32 B = DecodeChar(Chars[CharIndex + 1]);
+				const int32 C = NumTail > 2 ? DecodeChar(Chars[CharIndex + 2]) : 0;
+				if ((A | B | C) < 0)
+				{
+					return false;
+				}
+
+				const uint32 Triplet = (A << 18) | (B << 12) | (C << 6);
+				Output[OutputIndex++] = static_cast<uint8>(Triplet >> 16);
+				if (NumTail > 2)
+				{
+					Output[OutputIndex++] = static_cast<uint8>(Triplet >> 8);
+				}
+			}
+
+			return OutputIndex == OutputNum;
+		}
+
+		// number of characters without the (up to 2) padding ones
+		int64 GetNumDataChars(const TCHAR* Chars, const int64 NumChars)
+		{
+			int64 NumDataChars = NumChars;
+			if (NumDataChars > 0 && Chars[NumDataChars - 1] == '=')
+			{
+				NumDataChars--;
+				if (NumDataChars > 0 && Chars[NumDataChars - 1] == '=')
+				{
+					NumDataChars--;
+				}
+				// padding is only allowed to complete a quartet
+				if (NumChars % 4 != 0)
+				{
+					return -1;
+				}
+			}
+
+			return NumDataChars % 4 == 1 ? -1 : NumDataChars;
+		}
+
+		int64 GetDecodedSize(const int64 NumDataChars)
+		{
+			return (NumDataChars / 4) * 3 + FMath::Max<int64>(NumDataChars % 4 - 1, 0);
+		}
+	}
+}
+
+int64 FglTFRuntimeBase64::GetDecodedSize(const TCHAR* Chars, const int64 NumChars)
+{
+	const int64 NumDataChars = glTFRuntime::Base64::GetNumDataChars(Chars, NumChars);
+	if (NumDataChars < 0)
+	{
+		return -1;
+	}
+	return glTFRuntime::Base64::GetDecodedSize(NumDataChars);
+}
+
+bool FglTFRuntimeBase64::Decode(const TCHAR* Chars, const int64 NumChars, uint8* Output)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeBase64_Decode, FColor::Magenta);
+
+	const int64 NumDataChars = glTFRuntime::Base64::GetNumDataChars(Chars, NumChars);
+	if (NumDataChars < 0)
+	{
+		return false;
+	}
+
+	if (NumDataChars < glTFRuntime::Base64::MinParallelChars)
+	{
+		return glTFRuntime::Base64::DecodeChunk(Chars, NumDataChars, Output, glTFRuntime::Base64::GetDecodedSize(NumDataChars));
+	}
+
+	const int32 NumChunks = static_cast<int32>((NumDataChars + glTFRuntime::Base64::ChunkChars - 1) / glTFRuntime::Base64::ChunkChars);
+	TArray<bool> Results;
+	Results.AddZeroed(NumChunks);
+
+	ParallelFor(NumChunks, [&](const int32 ChunkIndex)
+		{
+			const int64 CharIndex = ChunkIndex * glTFRuntime::Base64::ChunkChars;
+			const int64 NumChunkChars = FMath::Min(NumDataChars - CharIndex, glTFRuntime::Base64::ChunkChars);
+			Results[ChunkIndex] = glTFRuntime::Base64::DecodeChunk(Chars + CharIndex, NumChunkChars, Output + (CharIndex / 4) * 3, glTFRuntime::Base64::GetDecodedSize(NumChunkChars));
+		});
+
+	return !Results.Contains(false);
+}
+
+bool FglTFRuntimeBase64::Decode(const TCHAR* Chars, const int64 NumChars, TArray64<uint8>& Output)
+{
+	const int64 DecodedSize = GetDecodedSize(Chars, NumChars);
+	if (DecodedSize < 0)
+	{
+		return false;
+	}
+
+	const int64 Offset = Output.Num();
+	Output.AddUninitialized(DecodedSize);
+	if (!Decode(Chars, NumChars, Output.GetData() + Offset))
+	{
+		Output.SetNum(Offset);
+		return false;
+	}
+
+	return true;
+}
@@ -0,0 +1,536 @@
+// Copyright 2020-2025, Roberto De Ioris.
+
+#include "glTFRuntimeCookedMeshCache.h"
+#include "glTFRuntimeParser.h"
+#include "glTFRuntimeMappedFile.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
+#include "Serialization/BufferReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace glTFRuntime
+{
+	namespace CookedMeshCache
+	{
+		// "gRMC"
+		constexpr uint32 Magic = 0x434D5267;
+
+		// raw copy of trivially copyable elements
+		template<typename T>
+		void SerializeArray(FArchive& Ar, TArray<T>& Array)
+		{
+			int32 Num = Array.Num();
+			Ar << Num;
+			if (Ar.IsLoading())
+			{
+				if (Num < 0 || static_cast<int64>(Num) * sizeof(T) > Ar.TotalSize() - Ar.Tell())
+				{
+					Ar.SetError();
+					return;
+				}
+				Array.SetNumUninitialized(Num);
+			}
+			Ar.Serialize(Array.GetData(), static_cast<int64>(Num) * sizeof(T));
+		}
+
+		template<typename T>
+		void SerializeArrays(FArchive& Ar, TArray<TArray<T>>& Arrays)
+		{
+			int32 Num = Arrays.Num();
+			Ar << Num;
+			if (Ar.IsLoading())
+			{
+				if (Num < 0 || static_cast<int64>(Num) * sizeof(int32) > Ar.TotalSize() - Ar.Tell())
+				{
+					Ar.SetError();
+					return;
+				}
+				Arrays.SetNum(Num);
+			}
+			for (TArray<T>& Array : Arrays)
+			{
+				SerializeArray(Ar, Array);
+			}
+		}
+
+		void SerializeBoneMap(FArchive& Ar, TMap<int32, FName>& BoneMap)
+		{
+			// FNames cannot be serialized by plain archives
+			TMap<int32, FString> BoneNamesMap;
+			for (const TPair<int32, FName>& Pair : BoneMap)
+			{
+				BoneNamesMap.Add(Pair.Key, Pair.Value.ToString());
+			}
+
+			Ar << BoneNamesMap;
+
+			if (Ar.IsLoading())
+			{
+				BoneMap.Empty(BoneNamesMap.Num());
+				for (const TPair<int32, FString>& Pair : BoneNamesMap)
+				{
+					BoneMap.Add(Pair.Key, FName(*Pair.Value));
+				}
+			}
+		}
+
+		void SerializePrimitive(FArchive& Ar, FglTFRuntimePrimitive& Primitive, TMap<int32, FName>& BoneMap)
+		{
+			Ar << Primitive.bCompact;
+			SerializeArray(Ar, Primitive.Positions);
+			SerializeArray(Ar, Primitive.Normals);
+			SerializeArray(Ar, Primitive.Tangents);
+			SerializeArrays(Ar, Primitive.UVs);
+			SerializeArray(Ar, Primitive.Indices);
+			SerializeArrays(Ar, Primitive.Joints);
+			SerializeArrays(Ar, Primitive.Weights);
+			SerializeArray(Ar, Primitive.Colors);
+			SerializeArray(Ar, Primitive.CompactPositions);
+			SerializeArray(Ar, Primitive.CompactNormals);
+			SerializeArray(Ar, Primitive.CompactTangents);
+			SerializeArrays(Ar, Primitive.CompactUVs);
+			SerializeArrays(Ar, Primitive.CompactWeights);
+			SerializeArray(Ar, Primitive.CompactColors);
+
+			int32 NumMorphTargets = Primitive.MorphTargets.Num();
+			Ar << NumMorphTargets;
+			if (Ar.IsLoading())
+			{
+				if (NumMorphTargets < 0 || NumMorphTargets > Ar.TotalSize() - Ar.Tell())
+				{
+					Ar.SetError();
+					return;
+				}
+				Primitive.MorphTargets.SetNum(NumMorphTargets);
+			}
+			for (FglTFRuntimeMorphTarget& MorphTarget : Primitive.MorphTargets)
+			{
+				Ar << MorphTarget.Name;
+				SerializeArray(Ar, MorphTarget.Positions);
+				SerializeArray(Ar, MorphTarget.Normals);
+				Ar << MorphTarget.bSparse;
+				SerializeArray(Ar, MorphTarget.Indices);
+			}
+
+			SerializeBoneMap(Ar, BoneMap);
+			Ar << Primitive.WeightMaps;
+			Ar << Primitive.MaterialName;
+			Ar << Primitive.MaterialIndex;
+			Ar << Primitive.AdditionalBufferView;
+			Ar << Primitive.Mode;
+			Ar << Primitive.PrimitiveIndex;
+			Ar << Primitive.SourceMode;
+			Ar << Primitive.bHasMaterial;
+			Ar << Primitive.bHighPrecisionUVs;
+			Ar << Primitive.bHighPrecisionWeights;
+			Ar << Primitive.bDisableShadows;
+			Ar << Primitive.bHasIndices;
+		}
+
+		bool SerializeHeader(FArchive& Ar)
+		{
+			uint32 HeaderMagic = Magic;
+			uint32 HeaderVersion = FglTFRuntimeCookedMeshCache::Version;
+			// the streams are raw copies, so they are valid only for the same engine and vector types
+			uint32 EngineVersion = ENGINE_MAJOR_VERSION * 100 + ENGINE_MINOR_VERSION;
+			uint32 VectorSize = sizeof(FVector);
+
+			Ar << HeaderMagic;
+			Ar << HeaderVersion;
+			Ar << EngineVersion;
+			Ar << VectorSize;
+
+			return !Ar.IsError() &&
+				HeaderMagic == Magic &&
+				HeaderVersion == FglTFRuntimeCookedMeshCache::Version &&
+				EngineVersion == ENGINE_MAJOR_VERSION * 100 + ENGINE_MINOR_VERSION &&
+				VectorSize == sizeof(FVector);
+		}
+
+		// bump it whenever the list of hashed config fields changes
+		constexpr uint32 ConfigHashVersion = 1;
+
+		// hashes only the config fields that change the cooked streams (no object pointers, delegates or async settings)
+		struct FConfigHasher
+		{
+			FSHA1 Sha1;
+
+			FConfigHasher()
+			{
+				Add(ConfigHashVersion);
+			}
+
+			void AddBytes(const void* Value, const int32 Size)
+			{
+				Sha1.Update(reinterpret_cast<const uint8*>(Value), Size);
+			}
+
+			void Add(const bool bValue)
+			{
+				const uint8 Value = bValue ? 1 : 0;
+				AddBytes(&Value, sizeof(Value));
+			}
+
+			void Add(const uint32 Value)
+			{
+				AddBytes(&Value, sizeof(Value));
+			}
+
+			void Add(const int32 Value)
+			{
+				AddBytes(&Value, sizeof(Value));
+			}
+
+			void Add(const float Value)
+			{
+				AddBytes(&Value, sizeof(Value));
+			}
+
+			void Add(const FString& Value)
+			{
+				// length prefixed, so consecutive strings cannot collide
+				FTCHARToUTF8 UTF8(*Value);
+				Add(static_cast<int32>(UTF8.Length()));
+				AddBytes(UTF8.Get(), UTF8.Length());
+			}
+
+			void Add(const FMatrix& Value)
+			{
+				AddBytes(Value.M, sizeof(Value.M));
+			}
+
+			void Add(const FTransform& Value)
+			{
+				Add(Value.ToMatrixWithScale());
+			}
+
+			void Add(const TArray<FString>& Values)
+			{
+				Add(Values.Num());
+				for (const FString& Value : Values)
+				{
+					Add(Value);
+				}
+			}
+
+			// sorted by key, the insertion order does not matter
+			template<typename T>
+			void Add(const TMap<FString, T>& Values)
+			{
+				TArray<FString> Keys;
+				Values.GetKeys(Keys);
+				Keys.Sort();
+				Add(Keys.Num());
+				for (const FString& Key : Keys)
+				{
+					Add(Key);
+					Add(Values[Key]);
+				}
+			}
+
+			template<typename T>
+			void AddEnum(const T Value)
+			{
+				Add(static_cast<int32>(Value));
+			}
+
+			FString Final()
+			{
+				Sha1.Final();
+				FSHAHash Hash;
+				Sha1.GetHash(Hash.Hash);
+				return Hash.ToString();
+			}
+		};
+
+		bool ReadMappedFile(const FString& Filename, TFunctionRef<bool(const uint8*, const int64)> Reader)
+		{
+			FglTFRuntimeMappedFilePtr MappedFile = FglTFRuntimeMappedFile::Open(Filename);
+			if (MappedFile)
+			{
+				return Reader(MappedFile->GetData(), MappedFile->Num());
+			}
+
+			// platforms without memory mapping support
+			TArray64<uint8> Content;
+			if (!FFileHelper::LoadFileToArray(Content, *Filename))
+			{
+				return false;
+			}
+			return Reader(Content.GetData(), Content.Num());
+		}
+	}
+}
+
+std::atomic<int64> FglTFRuntimeCookedMeshCache::MaxSize(1024 * 1024 * 1024);
+
+FString FglTFRuntimeCookedMeshCache::GetDirectory()
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("glTFRuntime"), TEXT("CookedMeshes"));
+}
+
+FString FglTFRuntimeCookedMeshCache::HashContent(const uint8* DataPtr, const int64 DataNum, const FglTFRuntimeConfig& LoaderConfig)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeCookedMeshCache_HashContent, FColor::Magenta);
+
+	FSHA1 Sha1;
+	// Update() takes 32 bit sizes on older engines
+	constexpr int64 ChunkSize = 64 * 1024 * 1024;
+	for (int64 Offset = 0; Offset < DataNum; Offset += ChunkSize)
+	{
+		Sha1.Update(DataPtr + Offset, static_cast<uint32>(FMath::Min(ChunkSize, DataNum - Offset)));
+	}
+
+	// scene basis and scale, node names and how the asset (and its external buffers) are resolved
+	glTFRuntime::CookedMeshCache::FConfigHasher ConfigHasher;
+	ConfigHasher.Add(LoaderConfig.GetMatrix());
+	ConfigHasher.Add(LoaderConfig.SceneScale);
+	ConfigHasher.Add(LoaderConfig.PrefixForUnnamedNodes);
+	ConfigHasher.Add(LoaderConfig.bNoArchive);
+	ConfigHasher.Add(LoaderConfig.ArchiveEntryPoint);
+	ConfigHasher.Add(LoaderConfig.ArchiveAutoEntryPointExtensions);
+	ConfigHasher.Add(LoaderConfig.bAllowExternalFiles);
+	ConfigHasher.Add(LoaderConfig.OverrideBaseDirectory);
+	ConfigHasher.Add(LoaderConfig.bOverrideBaseDirectoryFromContentDir);
+	ConfigHasher.Add(LoaderConfig.bSearchContentDir);
+	ConfigHasher.Add(LoaderConfig.ContentPluginsToScan);
+	const FString ConfigHash = ConfigHasher.Final();
+	Sha1.UpdateWithString(*ConfigHash, ConfigHash.Len());
+	Sha1.Final();
+
+	FSHAHash Hash;
+	Sha1.GetHash(Hash.Hash);
+	return Hash.ToString();
+}
+
+FString FglTFRuntimeCookedMeshCache::GetFilename(const FString& ContentHash, const int32 MeshIndex, const int32 SkinIndex, const FglTFRuntimeSkeletalMeshConfig& SkeletalMeshConfig)
+{
+	const FglTFRuntimeSkeletonConfig& SkeletonConfig = SkeletalMeshConfig.SkeletonConfig;
+
+	// the result of a remapper cannot be hashed
+	if (SkeletonConfig.BoneRemapper.Remapper.IsBound())
+	{
+		return FString();
+	}
+
+	glTFRuntime::CookedMeshCache::FConfigHasher ConfigHasher;
+
+	// primitives decoding and the normals/tangents generated in place by the render data builder
+	ConfigHasher.Add(SkeletalMeshConfig.bIgnoreSkin);
+	ConfigHasher.Add(SkeletalMeshConfig.OverrideSkinIndex);
+	ConfigHasher.Add(SkeletalMeshConfig.bCompactPrimitives);
+	ConfigHasher.Add(SkeletalMeshConfig.bUseHighPrecisionUVs);
+	ConfigHasher.Add(SkeletalMeshConfig.bUseHighPrecisionTangentBasis);
+	ConfigHasher.Add(SkeletalMeshConfig.MaterialsConfig.bMergeSectionsByMaterial);
+	ConfigHasher.AddEnum(SkeletalMeshConfig.NormalsGenerationStrategy);
+	ConfigHasher.AddEnum(SkeletalMeshConfig.TangentsGenerationStrategy);
+	ConfigHasher.Add(SkeletalMeshConfig.bReverseTangents);
+	ConfigHasher.Add(SkeletalMeshConfig.bMikkTSpaceTangents);
+	ConfigHasher.Add(SkeletalMeshConfig.bSmoothNormals);
+
+	// reference skeleton (the tweaks applied after the skin resolution are not cooked)
+	ConfigHasher.Add(SkeletonConfig.bAddRootBone);
+	ConfigHasher.Add(SkeletonConfig.RootBoneName);
+	ConfigHasher.Add(SkeletonConfig.BonesNameMap);
+	ConfigHasher.Add(SkeletonConfig.bAssignUnmappedBonesToParent);
+	ConfigHasher.Add(SkeletonConfig.BonesTransformMap);
+	ConfigHasher.Add(SkeletonConfig.RootNodeIndex);
+	ConfigHasher.Add(SkeletonConfig.bSkipAlreadyExistentBoneNames);
+	ConfigHasher.Add(SkeletonConfig.ForceRootNode);
+	ConfigHasher.Add(SkeletonConfig.bAppendNodeIndexOnNameCollision);
+	ConfigHasher.Add(SkeletonConfig.bFallbackToNodesTree);
+	ConfigHasher.Add(SkeletonConfig.bApplyParentNodesTransformsToRoot);
+	ConfigHasher.Add(SkeletonConfig.MaxNodesTreeDepth);
+	ConfigHasher.Add(SkeletonConfig.CachedNodeIndex);
+	ConfigHasher.Add(SkeletonConfig.bApplyUnmappedBonesTransforms);
+	ConfigHasher.Add(SkeletonConfig.NodeBonesDeltaTransformMap);
+	ConfigHasher.Add(SkeletonConfig.bAddRootNodeIfMissing);
+
+	const FString ConfigHash = ConfigHasher.Final();
+
+	return FPaths::Combine(GetDirectory(), FString::Printf(TEXT("%s_%d_%d_%s.gltfmesh"), *ContentHash, MeshIndex, SkinIndex, *ConfigHash));
+}
+
+bool FglTFRuntimeCookedMeshCache::Save(const FString& Filename, const FglTFRuntimeMeshLOD& LOD, const TArray<FglTFRuntimeBone>& Skeleton, const TMap<int32, FName>& BoneMap)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeCookedMeshCache_Save, FColor::Magenta);
+
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes);
+
+	glTFRuntime::CookedMeshCache::SerializeHeader(Writer);
+
+	// the writer never modifies the data
+	FglTFRuntimeMeshLOD& MutableLOD = const_cast<FglTFRuntimeMeshLOD&>(LOD);
+
+	Writer << MutableLOD.bHasNormals;
+	Writer << MutableLOD.bHasTangents;
+	Writer << MutableLOD.bHasUV;
+	Writer << MutableLOD.bHasVertexColors;
+	Writer << MutableLOD.AdditionalTransforms;
+
+	int32 NumBones = Skeleton.Num();
+	Writer << NumBones;
+	for (const FglTFRuntimeBone& Bone : Skeleton)
+	{
+		FglTFRuntimeBone& MutableBone = const_cast<FglTFRuntimeBone&>(Bone);
+		Writer << MutableBone.BoneName;
+		Writer << MutableBone.ParentIndex;
+		Writer << MutableBone.Transform;
+	}
+
+	int32 NumPrimitives = LOD.Primitives.Num();
+	Writer << NumPrimitives;
+	for (FglTFRuntimePrimitive& Primitive : MutableLOD.Primitives)
+	{
+		TMap<int32, FName> PrimitiveBoneMap = Primitive.OverrideBoneMap.Num() > 0 ? Primitive.OverrideBoneMap : BoneMap;
+		glTFRuntime::CookedMeshCache::SerializePrimitive(Writer, Primitive, PrimitiveBoneMap);
+	}
+
+	if (Writer.IsError())
+	{
+		return false;
+	}
+
+	// write to a temporary file first, concurrent loaders must never see a partial entry
+	const FString TempFilename = FString::Printf(TEXT("%s.%s.tmp"), *Filename, *FGuid::NewGuid().ToString());
+	if (!FFileHelper::SaveArrayToFile(Bytes, *TempFilename))
+	{
+		return false;
+	}
+
+	if (!IFileManager::Get().Move(*Filename, *TempFilename, true, true))
+	{
+		IFileManager::Get().Delete(*TempFilename);
+		return false;
+	}
+
+	return true;
+}
+
+bool FglTFRuntimeCookedMeshCache::Load(const FString& Filename, FglTFRuntimeMeshLOD& LOD)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeCookedMeshCache_Load, FColor::Magenta);
+
+	if (!FPaths::FileExists(Filename))
+	{
+		return false;
+	}
+
+	const bool bLoaded = glTFRuntime::CookedMeshCache::ReadMappedFile(Filename, [&LOD](const uint8* DataPtr, const int64 DataNum)
+		{
+			FBufferReader Reader(const_cast<uint8*>(DataPtr), DataNum, false);
+
+			if (!glTFRuntime::CookedMeshCache::SerializeHeader(Reader))
+			{
+				return false;
+			}
+
+			Reader << LOD.bHasNormals;
+			Reader << LOD.bHasTangents;
+			Reader << LOD.bHasUV;
+			Reader << LOD.bHasVertexColors;
+			Reader << LOD.AdditionalTransforms;
+
+			int32 NumBones = 0;
+			Reader << NumBones;
+			if (NumBones < 1 || NumBones > DataNum - Reader.Tell())
+			{
+				return false;
+			}
+
+			LOD.Skeleton.SetNum(NumBones);
+			for (FglTFRuntimeBone& Bone : LOD.Skeleton)
+			{
+				Reader << Bone.BoneName;
+				Reader << Bone.ParentIndex;
+				Reader << Bone.Transform;
+			}
+
+			int32 NumPrimitives = 0;
+			Reader << NumPrimitives;
+			if (NumPrimitives < 1 || NumPrimitives > DataNum - Reader.Tell())
+			{
+				return false;
+			}
+
+			LOD.Primitives.SetNum(NumPrimitives);
+			for (FglTFRuntimePrimitive& Primitive : LOD.Primitives)
+			{
+				glTFRuntime::CookedMeshCache::SerializePrimitive(Reader, Primitive, Primitive.OverrideBoneMap);
+				if (Reader.IsError())
+				{
+					return false;
+				}
+			}
+
+			return !Reader.IsError();
+		});
+
+	// the timestamp is the last use of the entry for Trim()
+	if (bLoaded)
+	{
+		IFileManager::Get().SetTimeStamp(*Filename, FDateTime::UtcNow());
+	}
+
+	return bLoaded;
+}
+
+void FglTFRuntimeCookedMeshCache::Purge()
+{
+	IFileManager::Get().DeleteDirectory(*GetDirectory(), false, true);
+}
+
+void FglTFRuntimeCookedMeshCache::Trim()
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeCookedMeshCache_Trim, FColor::Magenta);
+
+	const int64 CurrentMaxSize = MaxSize.load();
+	if (CurrentMaxSize <= 0)
+	{
+		return;
+	}
+
+	struct FCookedEntry
+	{
+		FString Filename;
+		FDateTime TimeStamp;
+		int64 Size;
+	};
+
+	TArray<FCookedEntry> Entries;
+	int64 TotalSize = 0;
+	IFileManager::Get().IterateDirectoryStat(*GetDirectory(), [&Entries, &TotalSize](const TCHAR* Filename, const FFileStatData& StatData)
+		{
+			// temporary files of concurrent writers are skipped
+			if (!StatData.bIsDirectory && FPaths::GetExtension(Filename) == TEXT("gltfmesh"))
+			{
+				Entries.Add({ Filename, StatData.ModificationTime, StatData.FileSize });
+				TotalSize += StatData.FileSize;
+			}
+			return true;
+		});
+
+	if (TotalSize <= CurrentMaxSize)
+	{
+		return;
+	}
+
+	Entries.Sort([](const FCookedEntry& A, const FCookedEntry& B) { return A.TimeStamp < B.TimeStamp; });
+
+	for (const FCookedEntry& Entry : Entries)
+	{
+		if (TotalSize <= CurrentMaxSize)
+		{
+			break;
+		}
+
+		// entries in use (mapped) by other loaders may fail to be deleted, they will be evicted by a later Trim()
+		if (IFileManager::Get().Delete(*Entry.Filename, false, true, true))
+		{
+			TotalSize -= Entry.Size;
+		}
+	}
+}
@@ -0,0 +1,418 @@
+// Copyright 2020-2025, Roberto De Ioris.
+
+#include "glTFRuntimeDeflate64.h"
+#include "glTFRuntimeParser.h"
+
+namespace glTFRuntime
+{
+	namespace Deflate64
+	{
+		constexpr int32 MaxBits = 15;
+		constexpr int32 FastBits = 10;
+		constexpr int32 MaxLiteralCodes = 288;
+		constexpr int32 MaxDistanceCodes = 32;
+
+		// length code 285 is base 3 with 16 extra bits (258 with no extra bits in Deflate)
+		static const uint16 LengthBase[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 3 };
+		static const uint8 LengthExtra[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 16 };
+
+		// distance codes 30 and 31 address the upper 32K of the window
+		static const uint32 DistanceBase[MaxDistanceCodes] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577, 32769, 49153 };
+		static const uint8 DistanceExtra[MaxDistanceCodes] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13, 14, 14 };
+
+		static const uint8 CodeLengthsOrder[19] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+
+		// LSB first bit reader, bytes past the end are read as zeros and tracked to detect truncated streams
+		struct FBitReader
+		{
+			const uint8* Ptr;
+			const uint8* End;
+			uint64 BitBuffer = 0;
+			int32 BitCount = 0;
+			int64 PaddingBytes = 0;
+
+			FBitReader(const uint8* DataPtr, const int64 DataNum) : Ptr(DataPtr), End(DataPtr + DataNum)
+			{
+			}
+
+			FORCEINLINE void Refill()
+			{
+				while (BitCount <= 56)
+				{
+					uint64 Byte = 0;
+					if (Ptr < End)
+					{
+						Byte = *Ptr++;
+					}
+					else
+					{
+						PaddingBytes++;
+					}
+					BitBuffer |= Byte << BitCount;
+					BitCount += 8;
+				}
+			}
+
+			FORCEINLINE uint32 Read(const int32 Bits)
+			{
+				if (BitCount < Bits)
+				{
+					Refill();
+				}
+				const uint32 Value = static_cast<uint32>(BitBuffer & ((1ULL << Bits) - 1));
+				BitBuffer >>= Bits;
+				BitCount -= Bits;
+				return Value;
+			}
+
+			bool IsOverrun() const
+			{
+				return PaddingBytes * 8 > BitCount;
+			}
+
+			// drops the bits of the current byte and returns the unread bytes to the input (for stored blocks)
+			bool AlignToByte()
+			{
+				const int32 BufferedBytes = (BitCount - (BitCount % 8)) / 8;
+				if (PaddingBytes > BufferedBytes)
+				{
+					return false;
+				}
+				Ptr -= BufferedBytes - PaddingBytes;
+				BitBuffer = 0;
+				BitCount = 0;
+				PaddingBytes = 0;
+				return true;
+			}
+		};
+
+		struct FHuffman
+		{
+			uint16 Counts[MaxBits + 1];
+			uint16 Symbols[MaxLiteralCodes];
+			// Symbol << 4 | Length for codes up to FastBits, 0 for longer codes
+			uint16 Fast[1 << FastBits];
+
+			// canonical codes from the code lengths, incomplete codes are allowed (unassigned codes fail at decoding)
+			bool Build(const uint8* Lengths, const int32 Num)
+			{
+				FMemory::Memzero(Counts);
+				for (int32 Symbol = 0; Symbol < Num; Symbol++)
+				{
+					Counts[Lengths[Symbol]]++;
+				}
+
+				int32 Left = 1;
+				for (int32 Length = 1; Length <= MaxBits; Length++)
+				{
+					Left = (Left << 1) - Counts[Length];
+					if (Left < 0)
+					{
+						return false;
+					}
+				}
+
+				uint16 Offsets[MaxBits + 1];
+				Offsets[1] = 0;
+				for (int32 Length = 1; Length < MaxBits; Length++)
+				{
+					Offsets[Length + 1] = Offsets[Length] + Counts[Length];
+				}
+
+				for (int32 Symbol = 0; Symbol < Num; Symbol++)
+				{
+					if (Lengths[Symbol] != 0)
+					{
+						Symbols[Offsets[Lengths[Symbol]]++] = static_cast<uint16>(Symbol);
+					}
+				}
+
+				FMemory::Memzero(Fast);
+				int32 Code = 0;
+				int32 SymbolIndex = 0;
+				for (int32 Length = 1; Length <= FastBits; Length++)
+				{
+					for (int32 Index = 0; Index < Counts[Length]; Index++)
+					{
+						// codes are stored MSB first in the LSB first stream
+						int32 Reversed = 0;
+						for (int32 Bit = 0; Bit < Length; Bit++)
+						{
+							Reversed |= ((Code >> Bit) & 1) << (Length - 1 - Bit);
+						}
+
+						const uint16 Entry = static_cast<uint16>((Symbols[SymbolIndex++] << 4) | Length);
+						for (int32 Slot = Reversed; Slot < (1 << FastBits); Slot += (1 << Length))
+						{
+							Fast[Slot] = Entry;
+						}
+						Code++;
+					}
+					Code <<= 1;
+				}
+
+				return true;
+			}
+
+			FORCEINLINE int32 Decode(FBitReader& Reader) const
+			{
+				if (Reader.BitCount < MaxBits)
+				{
+					Reader.Refill();
+				}
+
+				const uint16 Entry = Fast[Reader.BitBuffer & ((1 << FastBits) - 1)];
+				if (Entry)
+				{
+					Reader.BitBuffer >>= (Entry & 0xF);
+					Reader.BitCount -= (Entry & 0xF);
+					return Entry >> 4;
+				}
+
+				// long codes, walk the canonical ranges
+				int32 Code = 0;
+				int32 First = 0;
+				int32 Index = 0;
+				for (int32 Length = 1; Length <= MaxBits; Length++)
+				{
+					Code |= static_cast<int32>((Reader.BitBuffer >> (Length - 1)) & 1);
+					const int32 Count = Counts[Length];
+					if (Code - Count < First)
+					{
+						Reader.BitBuffer >>= Length;
+						Reader.BitCount -= Length;
+						return Symbols[Index + (Code - First)];
+					}
+					Index += Count;
+					First = (First + Count) << 1;
+					Code <<= 1;
+				}
+
+				return -1;
+			}
+		};
+
+		struct FFixedCodes
+		{
+			FHuffman Literals;
+			FHuffman Distances;
+
+			FFixedCodes()
+			{
+				uint8 Lengths[MaxLiteralCodes];
+				for (int32 Symbol = 0; Symbol < MaxLiteralCodes; Symbol++)
+				{
+					Lengths[Symbol] = Symbol < 144 ? 8 : (Symbol < 256 ? 9 : (Symbol < 280 ? 7 : 8));
+				}
+				Literals.Build(Lengths, MaxLiteralCodes);
+
+				// all of the 32 distance codes are valid in Deflate64
+				FMemory::Memset(Lengths, 5, MaxDistanceCodes);
+				Distances.Build(Lengths, MaxDistanceCodes);
+			}
+		};
+
+		bool InflateCodes(FBitReader& Reader, const FHuffman& Literals, const FHuffman& Distances, uint8* Output, uint8*& OutPtr, uint8* OutEnd)
+		{
+			for (;;)
+			{
+				const int32 Symbol = Literals.Decode(Reader);
+				if (Symbol < 0)
+				{
+					return false;
+				}
+
+				if (Symbol < 256)
+				{
+					if (OutPtr >= OutEnd)
+					{
+						return false;
+					}
+					*OutPtr++ = static_cast<uint8>(Symbol);
+					continue;
+				}
+
+				if (Symbol == 256)
+				{
+					return true;
+				}
+
+				const int32 LengthSymbol = Symbol - 257;
+				if (LengthSymbol >= 29)
+				{
+					return false;
+				}
+
+				const int64 Length = LengthBase[LengthSymbol] + Reader.Read(LengthExtra[LengthSymbol]);
+
+				const int32 DistanceSymbol = Distances.Decode(Reader);
+				if (DistanceSymbol < 0 || DistanceSymbol >= MaxDistanceCodes)
+				{
+					return false;
+				}
+
+				const int64 Distance = DistanceBase[DistanceSymbol] + Reader.Read(DistanceExtra[DistanceSymbol]);
+				if (Distance > OutPtr - Output || Length > OutEnd - OutPtr)
+				{
+					return false;
+				}
+
+				const uint8* MatchPtr = OutPtr - Distance;
+				if (Distance >= Length)
+				{
+					FMemory::Memcpy(OutPtr, MatchPtr, Length);
+					OutPtr += Length;
+				}
+				else
+				{
+					// overlapping match (runs)
+					for (int64 Index = 0; Index < Length; Index++)
+					{
+						*OutPtr++ = *MatchPtr++;
+					}
+				}
+			}
+		}
+
+		bool InflateDynamic(FBitReader& Reader, uint8* Output, uint8*& OutPtr, uint8* OutEnd)
+		{
+			const int32 NumLiterals = Reader.Read(5) + 257;
+			const int32 NumDistances = Reader.Read(5) + 1;
+			const int32 NumCodeLengths = Reader.Read(4) + 4;
+			if (NumLiterals > 286)
+			{
+				return false;
+			}
+
+			uint8 Lengths[MaxLiteralCodes + MaxDistanceCodes] = {};
+			for (int32 Index = 0; Index < NumCodeLengths; Index++)
+			{
+				Lengths[CodeLengthsOrder[Index]] = static_cast<uint8>(Reader.Read(3));
+			}
+
+			FHuffman CodeLengths;
+			if (!CodeLengths.Build(Lengths, 19))
+			{
+				return false;
+			}
+
+			int32 Index = 0;
+			while (Index < NumLiterals + NumDistances)
+			{
+				const int32 Symbol = CodeLengths.Decode(Reader);
+				if (Symbol < 0)
+				{
+					return false;
+				}
+
+				if (Symbol < 16)
+				{
+					Lengths[Index++] = static_cast<uint8>(Symbol);
+					continue;
+				}
+
+				uint8 Length = 0;
+				int32 Repeat;
+				if (Symbol == 16)
+				{
+					if (Index == 0)
+					{
+						return false;
+					}
+					Length = Lengths[Index - 1];
+					Repeat = 3 + Reader.Read(2);
+				}
+				else if (Symbol == 17)
+				{
+					Repeat = 3 + Reader.Read(3);
+				}
+				else
+				{
+					Repeat = 11 + Reader.Read(7);
+				}
+
+				if (Index + Repeat > NumLiterals + NumDistances)
+				{
+					return false;
+				}
+
+				while (Repeat--)
+				{
+					Lengths[Index++] = Length;
+				}
+			}
+
+			// no end of block code
+			if (Lengths[256] == 0)
+			{
+				return false;
+			}
+
+			FHuffman Literals;
+			FHuffman Distances;
+			if (!Literals.Build(Lengths, NumLiterals) || !Distances.Build(Lengths + NumLiterals, NumDistances))
+			{
+				return false;
+			}
+
+			return InflateCodes(Reader, Literals, Distances, Output, OutPtr, OutEnd);
+		}
+	}
+}
+
+bool FglTFRuntimeDeflate64::Inflate(const uint8* DataPtr, const int64 DataNum, uint8* Output, const int64 OutputNum)
+{
+	using namespace glTFRuntime::Deflate64;
+
+	SCOPED_NAMED_EVENT(FglTFRuntimeDeflate64_Inflate, FColor::Magenta);
+
+	static const FFixedCodes FixedCodes;
+
+	FBitReader Reader(DataPtr, DataNum);
+	uint8* OutPtr = Output;
+	uint8* OutEnd = Output + OutputNum;
+
+	bool bLastBlock = false;
+	while (!bLastBlock)
+	{
+		bLastBlock = Reader.Read(1) != 0;
+		const uint32 BlockType = Reader.Read(2);
+
+		bool bSuccess = false;
+		if (BlockType == 0)
+		{
+			if (!Reader.AlignToByte() || Reader.End - Reader.Ptr < 4)
+			{
+				return false;
+			}
+
+			const int64 Length = Reader.Ptr[0] | (Reader.Ptr[1] << 8);
+			const int64 InvertedLength = Reader.Ptr[2] | (Reader.Ptr[3] << 8);
+			Reader.Ptr += 4;
+
+			bSuccess = Length == (~InvertedLength & 0xFFFF) && Length <= Reader.End - Reader.Ptr && Length <= OutEnd - OutPtr;
+			if (bSuccess)
+			{
+				FMemory::Memcpy(OutPtr, Reader.Ptr, Length);
+				OutPtr += Length;
+				Reader.Ptr += Length;
+			}
+		}
+		else if (BlockType == 1)
+		{
+			bSuccess = InflateCodes(Reader, FixedCodes.Literals, FixedCodes.Distances, Output, OutPtr, OutEnd);
+		}
+		else if (BlockType == 2)
+		{
+			bSuccess = InflateDynamic(Reader, Output, OutPtr, OutEnd);
+		}
+
+		if (!bSuccess || Reader.IsOverrun())
+		{
+			UE_LOG(LogGLTFRuntime, Error, TEXT("Invalid Deflate64 stream @%lld"), static_cast<int64>(OutPtr - Output));
+			return false;
+		}
+	}
+
+	return OutPtr == OutEnd;
+}
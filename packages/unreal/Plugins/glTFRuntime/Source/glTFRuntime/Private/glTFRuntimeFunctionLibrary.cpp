@@ -2,13 +2,15 @@
 
 
 #include "glTFRuntimeFunctionLibrary.h"
+#include "glTFRuntimeBase64.h"
+#include "glTFRuntimeCookedMeshCache.h"
+#include "glTFRuntimeGLBStream.h"
 #include "Animation/AnimSequence.h"
 #include "Async/Async.h"
 #include "HttpModule.h"
 #include "HAL/PlatformApplicationMisc.h"
 #include "Interfaces/IHttpRequest.h"
 #include "Interfaces/IHttpResponse.h"
-#include "Misc/Base64.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
 #include "GenericPlatform/GenericPlatformProcess.h"
@@ -61,11 +63,20 @@ void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromFilenameAsync(const FString&
 		OverrideConfig.bSearchContentDir = true;
 	}
 
-	Async(EAsyncExecution::Thread, [Filename, Asset, Completed, OverrideConfig]()
+	FglTFRuntimeTaskPool::Get().AddTask([Filename, Asset, Completed, OverrideConfig](const bool bCancelled)
 		{
+			if (bCancelled)
+			{
+				FFunctionGraphTask::CreateAndDispatchWhenReady([Completed]()
+					{
+						Completed.ExecuteIfBound(nullptr);
+					}, TStatId(), nullptr, ENamedThreads::GameThread);
+				return;
+			}
+
 			TSharedPtr<FglTFRuntimeParser> Parser = FglTFRuntimeParser::FromFilename(Filename, OverrideConfig);
 
-			FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([Parser, Asset, Completed]()
+			FFunctionGraphTask::CreateAndDispatchWhenReady([Parser, Asset, Completed]()
 				{
 					if (Parser.IsValid() && Asset->SetParser(Parser.ToSharedRef()))
 					{
@@ -76,8 +87,7 @@ void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromFilenameAsync(const FString&
 						Completed.ExecuteIfBound(nullptr);
 					}
 				}, TStatId(), nullptr, ENamedThreads::GameThread);
-			FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
-		});
+		}, OverrideConfig.AsyncPriority, OverrideConfig.AsyncCancellationToken);
 }
 
 UglTFRuntimeAsset* UglTFRuntimeFunctionLibrary::glTFLoadAssetFromString(const FString& JsonData, const FglTFRuntimeConfig& LoaderConfig)
@@ -110,14 +120,14 @@ UglTFRuntimeAsset* UglTFRuntimeFunctionLibrary::glTFLoadAssetFromBase64(const FS
 	Asset->RuntimeContextObject = LoaderConfig.RuntimeContextObject;
 	Asset->RuntimeContextString = LoaderConfig.RuntimeContextString;
 
-	TArray<uint8> BytesBase64;
+	TArray64<uint8> BytesBase64;
 
-	if (!FBase64::Decode(Base64, BytesBase64))
+	if (!FglTFRuntimeBase64::Decode(*Base64, Base64.Len(), BytesBase64))
 	{
 		return nullptr;
 	}
 
-	if (!Asset->LoadFromData(BytesBase64.GetData(), BytesBase64.Num(), LoaderConfig))
+	if (!Asset->LoadFromData(MoveTemp(BytesBase64), LoaderConfig))
 	{
 		return nullptr;
 	}
@@ -137,23 +147,31 @@ void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromBase64Async(const FString& Ba
 	Asset->RuntimeContextObject = LoaderConfig.RuntimeContextObject;
 	Asset->RuntimeContextString = LoaderConfig.RuntimeContextString;
 
-	Async(EAsyncExecution::Thread, [Base64, Asset, LoaderConfig, Completed]()
+	FglTFRuntimeTaskPool::Get().AddTask([Base64, Asset, LoaderConfig, Completed](const bool bCancelled)
 		{
-			TArray<uint8> BytesBase64;
+			if (bCancelled)
+			{
+				FFunctionGraphTask::CreateAndDispatchWhenReady([Completed]()
+					{
+						Completed.ExecuteIfBound(nullptr);
+					}, TStatId(), nullptr, ENamedThreads::GameThread);
+				return;
+			}
+
+			TArray64<uint8> BytesBase64;
 
-			if (!FBase64::Decode(Base64, BytesBase64))
+			if (!FglTFRuntimeBase64::Decode(*Base64, Base64.Len(), BytesBase64))
 			{
-				FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([Completed]()
+				FFunctionGraphTask::CreateAndDispatchWhenReady([Completed]()
 					{
 						Completed.ExecuteIfBound(nullptr);
 					}, TStatId(), nullptr, ENamedThreads::GameThread);
-				FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
 				return;
 			}
 
-			TSharedPtr<FglTFRuntimeParser> Parser = FglTFRuntimeParser::FromData(BytesBase64, LoaderConfig);
+			TSharedPtr<FglTFRuntimeParser> Parser = FglTFRuntimeParser::FromData(MoveTemp(BytesBase64), LoaderConfig);
 
-			FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([Parser, Asset, Completed]()
+			FFunctionGraphTask::CreateAndDispatchWhenReady([Parser, Asset, Completed]()
 				{
 					if (Parser.IsValid() && Asset->SetParser(Parser.ToSharedRef()))
 					{
@@ -164,8 +182,7 @@ void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromBase64Async(const FString& Ba
 						Completed.ExecuteIfBound(nullptr);
 					}
 				}, TStatId(), nullptr, ENamedThreads::GameThread);
-			FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
-		});
+		}, LoaderConfig.AsyncPriority, LoaderConfig.AsyncCancellationToken);
 }
 
 UglTFRuntimeAsset* UglTFRuntimeFunctionLibrary::glTFLoadAssetFromUTF8String(const FString& String, const FglTFRuntimeConfig& LoaderConfig)
@@ -205,8 +222,17 @@ void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromUTF8StringAsync(const FString
 	Asset->RuntimeContextObject = LoaderConfig.RuntimeContextObject;
 	Asset->RuntimeContextString = LoaderConfig.RuntimeContextString;
 
-	Async(EAsyncExecution::Thread, [String, Asset, LoaderConfig, Completed]()
+	FglTFRuntimeTaskPool::Get().AddTask([String, Asset, LoaderConfig, Completed](const bool bCancelled)
 		{
+			if (bCancelled)
+			{
+				FFunctionGraphTask::CreateAndDispatchWhenReady([Completed]()
+					{
+						Completed.ExecuteIfBound(nullptr);
+					}, TStatId(), nullptr, ENamedThreads::GameThread);
+				return;
+			}
+
 #if ENGINE_MAJOR_VERSION >= 5
 			auto UTF8String = StringCast<UTF8CHAR>(*String);
 #else
@@ -215,7 +241,7 @@ void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromUTF8StringAsync(const FString
 
 			TSharedPtr<FglTFRuntimeParser> Parser = FglTFRuntimeParser::FromData(reinterpret_cast<const uint8*>(UTF8String.Get()), UTF8String.Length(), LoaderConfig);
 
-			FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([Parser, Asset, Completed]()
+			FFunctionGraphTask::CreateAndDispatchWhenReady([Parser, Asset, Completed]()
 				{
 					if (Parser.IsValid() && Asset->SetParser(Parser.ToSharedRef()))
 					{
@@ -226,8 +252,7 @@ void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromUTF8StringAsync(const FString
 						Completed.ExecuteIfBound(nullptr);
 					}
 				}, TStatId(), nullptr, ENamedThreads::GameThread);
-			FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
-		});
+		}, LoaderConfig.AsyncPriority, LoaderConfig.AsyncCancellationToken);
 }
 
 void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromStringAsync(const FString& JsonData, const FglTFRuntimeConfig& LoaderConfig, const FglTFRuntimeHttpResponse& Completed)
@@ -242,11 +267,20 @@ void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromStringAsync(const FString& Js
 	Asset->RuntimeContextObject = LoaderConfig.RuntimeContextObject;
 	Asset->RuntimeContextString = LoaderConfig.RuntimeContextString;
 
-	Async(EAsyncExecution::Thread, [JsonData, Asset, LoaderConfig, Completed]()
+	FglTFRuntimeTaskPool::Get().AddTask([JsonData, Asset, LoaderConfig, Completed](const bool bCancelled)
 		{
+			if (bCancelled)
+			{
+				FFunctionGraphTask::CreateAndDispatchWhenReady([Completed]()
+					{
+						Completed.ExecuteIfBound(nullptr);
+					}, TStatId(), nullptr, ENamedThreads::GameThread);
+				return;
+			}
+
 			TSharedPtr<FglTFRuntimeParser> Parser = FglTFRuntimeParser::FromString(JsonData, LoaderConfig);
 
-			FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([Parser, Asset, Completed]()
+			FFunctionGraphTask::CreateAndDispatchWhenReady([Parser, Asset, Completed]()
 				{
 					if (Parser.IsValid() && Asset->SetParser(Parser.ToSharedRef()))
 					{
@@ -257,8 +291,7 @@ void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromStringAsync(const FString& Js
 						Completed.ExecuteIfBound(nullptr);
 					}
 				}, TStatId(), nullptr, ENamedThreads::GameThread);
-			FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
-		});
+		}, LoaderConfig.AsyncPriority, LoaderConfig.AsyncCancellationToken);
 }
 
 UglTFRuntimeAsset* UglTFRuntimeFunctionLibrary::glTFLoadAssetFromFileMap(const TMap<FString, FString>& FileMap, const FglTFRuntimeConfig& LoaderConfig)
@@ -305,8 +338,17 @@ void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromFileMapAsync(const TMap<FStri
 	Asset->RuntimeContextObject = LoaderConfig.RuntimeContextObject;
 	Asset->RuntimeContextString = LoaderConfig.RuntimeContextString;
 
-	Async(EAsyncExecution::Thread, [FileMap, Asset, LoaderConfig, Completed]()
+	FglTFRuntimeTaskPool::Get().AddTask([FileMap, Asset, LoaderConfig, Completed](const bool bCancelled)
 		{
+			if (bCancelled)
+			{
+				FFunctionGraphTask::CreateAndDispatchWhenReady([Completed]()
+					{
+						Completed.ExecuteIfBound(nullptr);
+					}, TStatId(), nullptr, ENamedThreads::GameThread);
+				return;
+			}
+
 			TMap<FString, TArray64<uint8>> Map;
 
 			for (const TPair<FString, FString>& Pair : FileMap)
@@ -320,7 +362,7 @@ void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromFileMapAsync(const TMap<FStri
 
 			TSharedPtr<FglTFRuntimeParser> Parser = FglTFRuntimeParser::FromMap(Map, LoaderConfig);
 
-			FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([Parser, Asset, Completed]()
+			FFunctionGraphTask::CreateAndDispatchWhenReady([Parser, Asset, Completed]()
 				{
 					if (Parser.IsValid() && Asset->SetParser(Parser.ToSharedRef()))
 					{
@@ -331,8 +373,74 @@ void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromFileMapAsync(const TMap<FStri
 						Completed.ExecuteIfBound(nullptr);
 					}
 				}, TStatId(), nullptr, ENamedThreads::GameThread);
-			FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
-		});
+		}, LoaderConfig.AsyncPriority, LoaderConfig.AsyncCancellationToken);
+}
+
+namespace glTFRuntime
+{
+	// collects the http response body in an array the parser can adopt (IHttpResponse::GetContent() could only be copied)
+	class FglTFRuntimeHttpBodyArchive : public FArchive
+	{
+	public:
+		FglTFRuntimeHttpBodyArchive()
+		{
+			SetIsSaving(true);
+		}
+
+		virtual void Serialize(void* V, int64 Length) override
+		{
+			Body.Append(static_cast<const uint8*>(V), Length);
+		}
+
+		virtual FString GetArchiveName() const override
+		{
+			return TEXT("FglTFRuntimeHttpBodyArchive");
+		}
+
+		TArray64<uint8> Body;
+	};
+
+	// the request type depends on the engine version
+	template<typename HttpRequestType>
+	TSharedRef<FglTFRuntimeHttpBodyArchive> SetHttpBodyArchive(HttpRequestType& HttpRequest)
+	{
+		TSharedRef<FglTFRuntimeHttpBodyArchive> BodyArchive = MakeShared<FglTFRuntimeHttpBodyArchive>();
+#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 3
+		HttpRequest->SetResponseBodyReceiveStream(BodyArchive);
+#endif
+		return BodyArchive;
+	}
+
+	// older engines without body streaming fill the response content, so a single copy is still required there
+	TArray64<uint8> TakeHttpBody(FHttpResponsePtr ResponsePtr, TSharedRef<FglTFRuntimeHttpBodyArchive> BodyArchive)
+	{
+#if !(ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 3)
+		if (ResponsePtr.IsValid())
+		{
+			BodyArchive->Body.Append(ResponsePtr->GetContent().GetData(), ResponsePtr->GetContent().Num());
+		}
+#endif
+		return MoveTemp(BodyArchive->Body);
+	}
+
+	UglTFRuntimeAsset* LoadAssetFromOwnedData(TArray64<uint8>&& Data, const FglTFRuntimeConfig& LoaderConfig)
+	{
+		UglTFRuntimeAsset* Asset = NewObject<UglTFRuntimeAsset>();
+		if (!Asset)
+		{
+			return nullptr;
+		}
+
+		Asset->RuntimeContextObject = LoaderConfig.RuntimeContextObject;
+		Asset->RuntimeContextString = LoaderConfig.RuntimeContextString;
+
+		if (!Asset->LoadFromData(MoveTemp(Data), LoaderConfig))
+		{
+			return nullptr;
+		}
+
+		return Asset;
+	}
 }
 
 void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromUrl(const FString& Url, const TMap<FString, FString>& Headers, FglTFRuntimeHttpResponse Completed, const FglTFRuntimeConfig& LoaderConfig)
@@ -350,12 +458,14 @@ void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromUrl(const FString& Url, const
 
 	float StartTime = FPlatformTime::Seconds();
 
-	HttpRequest->OnProcessRequestComplete().BindLambda([StartTime](FHttpRequestPtr RequestPtr, FHttpResponsePtr ResponsePtr, bool bSuccess, FglTFRuntimeHttpResponse Completed, const FglTFRuntimeConfig& LoaderConfig)
+	TSharedRef<glTFRuntime::FglTFRuntimeHttpBodyArchive> BodyArchive = glTFRuntime::SetHttpBodyArchive(HttpRequest);
+
+	HttpRequest->OnProcessRequestComplete().BindLambda([StartTime, BodyArchive](FHttpRequestPtr RequestPtr, FHttpResponsePtr ResponsePtr, bool bSuccess, FglTFRuntimeHttpResponse Completed, const FglTFRuntimeConfig& LoaderConfig)
 		{
 			UglTFRuntimeAsset* Asset = nullptr;
 			if (bSuccess && !IsGarbageCollecting())
 			{
-				Asset = glTFLoadAssetFromData(ResponsePtr->GetContent(), LoaderConfig);
+				Asset = glTFRuntime::LoadAssetFromOwnedData(glTFRuntime::TakeHttpBody(ResponsePtr, BodyArchive), LoaderConfig);
 				if (Asset)
 				{
 					Asset->GetParser()->SetDownloadTime(FPlatformTime::Seconds() - StartTime);
@@ -393,7 +503,9 @@ void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromUrlWithCache(const FString& U
 
 	float StartTime = FPlatformTime::Seconds();
 
-	HttpRequest->OnProcessRequestComplete().BindLambda([StartTime, bCacheFileValid, bUseCacheOnError](FHttpRequestPtr RequestPtr, FHttpResponsePtr ResponsePtr, bool bSuccess, FglTFRuntimeHttpResponse Completed, const FglTFRuntimeConfig& LoaderConfig, const FString& CacheFilename)
+	TSharedRef<glTFRuntime::FglTFRuntimeHttpBodyArchive> BodyArchive = glTFRuntime::SetHttpBodyArchive(HttpRequest);
+
+	HttpRequest->OnProcessRequestComplete().BindLambda([StartTime, bCacheFileValid, bUseCacheOnError, BodyArchive](FHttpRequestPtr RequestPtr, FHttpResponsePtr ResponsePtr, bool bSuccess, FglTFRuntimeHttpResponse Completed, const FglTFRuntimeConfig& LoaderConfig, const FString& CacheFilename)
 		{
 			UglTFRuntimeAsset* Asset = nullptr;
 			if (!IsGarbageCollecting())
@@ -406,11 +518,12 @@ void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromUrlWithCache(const FString& U
 					}
 					else
 					{
+						TArray64<uint8> Body = glTFRuntime::TakeHttpBody(ResponsePtr, BodyArchive);
 						if (!CacheFilename.IsEmpty())
 						{
-							FFileHelper::SaveArrayToFile(ResponsePtr->GetContent(), *CacheFilename);
+							FFileHelper::SaveArrayToFile(Body, *CacheFilename);
 						}
-						Asset = glTFLoadAssetFromData(ResponsePtr->GetContent(), LoaderConfig);
+						Asset = glTFRuntime::LoadAssetFromOwnedData(MoveTemp(Body), LoaderConfig);
 					}
 				}
 				else if (bCacheFileValid && bUseCacheOnError)
@@ -444,12 +557,14 @@ void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromUrlWithProgress(const FString
 
 	float StartTime = FPlatformTime::Seconds();
 
-	HttpRequest->OnProcessRequestComplete().BindLambda([StartTime](FHttpRequestPtr RequestPtr, FHttpResponsePtr ResponsePtr, bool bSuccess, FglTFRuntimeHttpResponse Completed, const FglTFRuntimeConfig& LoaderConfig)
+	TSharedRef<glTFRuntime::FglTFRuntimeHttpBodyArchive> BodyArchive = glTFRuntime::SetHttpBodyArchive(HttpRequest);
+
+	HttpRequest->OnProcessRequestComplete().BindLambda([StartTime, BodyArchive](FHttpRequestPtr RequestPtr, FHttpResponsePtr ResponsePtr, bool bSuccess, FglTFRuntimeHttpResponse Completed, const FglTFRuntimeConfig& LoaderConfig)
 		{
 			UglTFRuntimeAsset* Asset = nullptr;
 			if (bSuccess && !IsGarbageCollecting())
 			{
-				Asset = glTFLoadAssetFromData(ResponsePtr->GetContent(), LoaderConfig);
+				Asset = glTFRuntime::LoadAssetFromOwnedData(glTFRuntime::TakeHttpBody(ResponsePtr, BodyArchive), LoaderConfig);
 				if (Asset)
 				{
 					Asset->GetParser()->SetDownloadTime(FPlatformTime::Seconds() - StartTime);
@@ -475,6 +590,200 @@ void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromUrlWithProgress(const FString
 	HttpRequest->ProcessRequest();
 }
 
+namespace glTFRuntime
+{
+#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 3
+	// forwards the http response body to the GLB stream (on the http thread)
+	class FglTFRuntimeGLBStreamArchive : public FArchive
+	{
+	public:
+		FglTFRuntimeGLBStreamArchive(TSharedRef<FglTFRuntimeGLBStream, ESPMode::ThreadSafe> InStream) : Stream(InStream)
+		{
+			SetIsSaving(true);
+		}
+
+		virtual void Serialize(void* V, int64 Length) override
+		{
+			Stream->Append(static_cast<const uint8*>(V), Length);
+		}
+
+		virtual FString GetArchiveName() const override
+		{
+			return TEXT("FglTFRuntimeGLBStreamArchive");
+		}
+
+	protected:
+		TSharedRef<FglTFRuntimeGLBStream, ESPMode::ThreadSafe> Stream;
+	};
+#endif
+
+	// game thread only
+	struct FglTFRuntimeStreamingState
+	{
+		TWeakObjectPtr<UglTFRuntimeAsset> Asset;
+		bool bAssetReady = false;
+		bool bDownloadCompleted = false;
+		bool bCompletedTriggered = false;
+		float DownloadTime = 0;
+		FglTFRuntimeHttpResponse Completed;
+	};
+
+	void TryCompleteStreaming(TSharedRef<FglTFRuntimeStreamingState> State, TSharedRef<FglTFRuntimeGLBStream, ESPMode::ThreadSafe> Stream)
+	{
+		if (!State->bAssetReady || !State->bDownloadCompleted || State->bCompletedTriggered)
+		{
+			return;
+		}
+
+		State->bCompletedTriggered = true;
+
+		UglTFRuntimeAsset* Asset = Stream->IsFailed() ? nullptr : State->Asset.Get();
+		if (Asset)
+		{
+			Asset->GetParser()->SetDownloadTime(State->DownloadTime);
+		}
+		State->Completed.ExecuteIfBound(Asset);
+	}
+}
+
+void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromUrlWithStreaming(const FString& Url, const TMap<FString, FString>& Headers, FglTFRuntimeHttpResponse AssetReady, FglTFRuntimeHttpResponse Completed, FglTFRuntimeHttpProgress Progress, const FglTFRuntimeConfig& LoaderConfig)
+{
+#if ENGINE_MAJOR_VERSION > 4 || ENGINE_MINOR_VERSION > 25
+	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
+#else
+	TSharedRef<IHttpRequest> HttpRequest = FHttpModule::Get().CreateRequest();
+#endif
+	HttpRequest->SetURL(Url);
+	for (TPair<FString, FString> Header : Headers)
+	{
+		HttpRequest->AppendToHeader(Header.Key, Header.Value);
+	}
+
+	float StartTime = FPlatformTime::Seconds();
+
+	TSharedRef<FglTFRuntimeGLBStream, ESPMode::ThreadSafe> Stream = MakeShared<FglTFRuntimeGLBStream, ESPMode::ThreadSafe>(LoaderConfig);
+	Stream->SetUrl(Url);
+	TSharedRef<glTFRuntime::FglTFRuntimeStreamingState> State = MakeShared<glTFRuntime::FglTFRuntimeStreamingState>();
+	State->Completed = Completed;
+
+	// the stream is referenced weakly, the parser will keep it alive
+	TWeakPtr<FglTFRuntimeGLBStream, ESPMode::ThreadSafe> WeakStream = Stream;
+	Stream->OnJsonChunkReceived = [WeakStream, State, AssetReady, LoaderConfig]()
+		{
+			FglTFRuntimeTaskPool::Get().AddTask([WeakStream, State, AssetReady, LoaderConfig](const bool bCancelled)
+				{
+					TSharedPtr<FglTFRuntimeGLBStream, ESPMode::ThreadSafe> Stream = WeakStream.Pin();
+					TSharedPtr<FglTFRuntimeParser> Parser = nullptr;
+					if (Stream && !bCancelled)
+					{
+						Parser = FglTFRuntimeParser::FromStream(Stream.ToSharedRef(), LoaderConfig);
+					}
+
+					FFunctionGraphTask::CreateAndDispatchWhenReady([Parser, Stream, State, AssetReady, LoaderConfig]()
+						{
+							UglTFRuntimeAsset* Asset = nullptr;
+							if (Parser.IsValid())
+							{
+								Asset = NewObject<UglTFRuntimeAsset>();
+								Asset->RuntimeContextObject = LoaderConfig.RuntimeContextObject;
+								Asset->RuntimeContextString = LoaderConfig.RuntimeContextString;
+								if (!Asset->SetParser(Parser.ToSharedRef()))
+								{
+									Asset = nullptr;
+								}
+							}
+
+							State->Asset = Asset;
+							State->bAssetReady = true;
+							AssetReady.ExecuteIfBound(Asset);
+
+							if (Stream)
+							{
+								glTFRuntime::TryCompleteStreaming(State, Stream.ToSharedRef());
+							}
+						}, TStatId(), nullptr, ENamedThreads::GameThread);
+				}, LoaderConfig.AsyncPriority, LoaderConfig.AsyncCancellationToken);
+		};
+
+#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 3
+	HttpRequest->SetResponseBodyReceiveStream(MakeShared<glTFRuntime::FglTFRuntimeGLBStreamArchive>(Stream));
+#endif
+
+	// the ETag (when available) is part of the cooked mesh cache key of the stream
+	if (LoaderConfig.bCookedMeshCache)
+	{
+		HttpRequest->OnHeaderReceived().BindLambda([WeakStream](FHttpRequestPtr RequestPtr, const FString& HeaderName, const FString& NewHeaderValue)
+			{
+				TSharedPtr<FglTFRuntimeGLBStream, ESPMode::ThreadSafe> Stream = WeakStream.Pin();
+				if (Stream && HeaderName.Equals(TEXT("ETag"), ESearchCase::IgnoreCase))
+				{
+					Stream->SetETag(NewHeaderValue);
+				}
+			});
+	}
+
+	HttpRequest->OnProcessRequestComplete().BindLambda([StartTime, Stream, State](FHttpRequestPtr RequestPtr, FHttpResponsePtr ResponsePtr, bool bSuccess, FglTFRuntimeHttpResponse AssetReady, const FglTFRuntimeConfig& LoaderConfig)
+		{
+#if !(ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 3)
+			// no body streaming support, feed the whole response at once
+			if (bSuccess && ResponsePtr.IsValid())
+			{
+				Stream->Append(ResponsePtr->GetContent().GetData(), ResponsePtr->GetContent().Num());
+			}
+#endif
+			Stream->Finish(bSuccess);
+
+			State->bDownloadCompleted = true;
+			State->DownloadTime = FPlatformTime::Seconds() - StartTime;
+
+			int64 JsonOffset, JsonSize;
+			if (Stream->GetJsonChunk(JsonOffset, JsonSize))
+			{
+				// the asset is (or will be) created by the json chunk task
+				glTFRuntime::TryCompleteStreaming(State, Stream);
+				return;
+			}
+
+			// non-GLB content (or an incomplete GLB header)
+			UglTFRuntimeAsset* Asset = nullptr;
+			if (bSuccess && !IsGarbageCollecting())
+			{
+				Asset = NewObject<UglTFRuntimeAsset>();
+				Asset->RuntimeContextObject = LoaderConfig.RuntimeContextObject;
+				Asset->RuntimeContextString = LoaderConfig.RuntimeContextString;
+				if (Asset->LoadFromData(MoveTemp(Stream->GetContent()), LoaderConfig))
+				{
+					Asset->GetParser()->SetDownloadTime(State->DownloadTime);
+				}
+				else
+				{
+					Asset = nullptr;
+				}
+			}
+
+			State->bAssetReady = true;
+			State->bCompletedTriggered = true;
+			AssetReady.ExecuteIfBound(Asset);
+			State->Completed.ExecuteIfBound(Asset);
+		}, AssetReady, LoaderConfig);
+
+#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 4
+	HttpRequest->OnRequestProgress64().BindLambda([](FHttpRequestPtr RequestPtr, uint64 BytesSent, uint64 BytesReceived, FglTFRuntimeHttpProgress Progress, const FglTFRuntimeConfig& LoaderConfig)
+#else
+	HttpRequest->OnRequestProgress().BindLambda([](FHttpRequestPtr RequestPtr, int32 BytesSent, int32 BytesReceived, FglTFRuntimeHttpProgress Progress, const FglTFRuntimeConfig& LoaderConfig)
+#endif
+		{
+			int32 ContentLength = 0;
+			if (RequestPtr->GetResponse().IsValid())
+			{
+				ContentLength = RequestPtr->GetResponse()->GetContentLength();
+			}
+			Progress.ExecuteIfBound(LoaderConfig, BytesReceived, ContentLength);
+		}, Progress, LoaderConfig);
+
+	HttpRequest->ProcessRequest();
+}
+
 UglTFRuntimeAsset* UglTFRuntimeFunctionLibrary::glTFLoadAssetFromData(const TArray<uint8>& Data, const FglTFRuntimeConfig& LoaderConfig)
 {
 	UglTFRuntimeAsset* Asset = NewObject<UglTFRuntimeAsset>();
@@ -758,8 +1067,17 @@ void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromCommand(const FString& Comman
 	Asset->RuntimeContextObject = LoaderConfig.RuntimeContextObject;
 	Asset->RuntimeContextString = LoaderConfig.RuntimeContextString;
 
-	Async(EAsyncExecution::Thread, [Command, Arguments, WorkingDirectory, Asset, LoaderConfig, Completed, ExpectedExitCode]()
+	FglTFRuntimeTaskPool::Get().AddTask([Command, Arguments, WorkingDirectory, Asset, LoaderConfig, Completed, ExpectedExitCode](const bool bCancelled)
 		{
+			if (bCancelled)
+			{
+				FFunctionGraphTask::CreateAndDispatchWhenReady([Completed]()
+					{
+						Completed.ExecuteIfBound(nullptr, -1, "Load cancelled");
+					}, TStatId(), nullptr, ENamedThreads::GameThread);
+				return;
+			}
+
 			TArray<uint8> Bytes;
 
 			void* ReadPipe = nullptr;
@@ -767,11 +1085,10 @@ void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromCommand(const FString& Comman
 
 			if (!FPlatformProcess::CreatePipe(ReadPipe, WritePipe))
 			{
-				FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([Completed]()
+				FFunctionGraphTask::CreateAndDispatchWhenReady([Completed]()
 					{
 						Completed.ExecuteIfBound(nullptr, -1, "Unable to create process pipe");
 					}, TStatId(), nullptr, ENamedThreads::GameThread);
-				FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
 				return;
 			}
 
@@ -790,11 +1107,10 @@ void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromCommand(const FString& Comman
 			if (!ProcHandle.IsValid())
 			{
 				FPlatformProcess::ClosePipe(ReadPipe, WritePipe);
-				FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([Completed]()
+				FFunctionGraphTask::CreateAndDispatchWhenReady([Completed]()
 					{
 						Completed.ExecuteIfBound(nullptr, -1, "Unable to launch process");
 					}, TStatId(), nullptr, ENamedThreads::GameThread);
-				FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
 				return;
 			}
 
@@ -815,13 +1131,12 @@ void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromCommand(const FString& Comman
 
 			if (ReturnCode != ExpectedExitCode)
 			{
-				FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([Completed, ReturnCode, &Bytes]()
+				FFunctionGraphTask::CreateAndDispatchWhenReady([Completed, ReturnCode, Bytes = MoveTemp(Bytes)]()
 					{
 						FString StdErr;
 						FFileHelper::BufferToString(StdErr, Bytes.GetData(), Bytes.Num());
 						Completed.ExecuteIfBound(nullptr, ReturnCode, StdErr);
 					}, TStatId(), nullptr, ENamedThreads::GameThread);
-				FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
 				return;
 			}
 
@@ -831,7 +1146,7 @@ void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromCommand(const FString& Comman
 				Parser->SetBaseDirectory(WorkingDirectory);
 			}
 
-			FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([Parser, Asset, Completed, ReturnCode]()
+			FFunctionGraphTask::CreateAndDispatchWhenReady([Parser, Asset, Completed, ReturnCode]()
 				{
 					if (Parser.IsValid() && Asset->SetParser(Parser.ToSharedRef()))
 					{
@@ -842,8 +1157,7 @@ void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromCommand(const FString& Comman
 						Completed.ExecuteIfBound(nullptr, ReturnCode, "Unable to parse command output");
 					}
 				}, TStatId(), nullptr, ENamedThreads::GameThread);
-			FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
-		});
+		}, LoaderConfig.AsyncPriority, LoaderConfig.AsyncCancellationToken);
 
 }
 
@@ -969,4 +1283,20 @@ UBlendSpace1D* UglTFRuntimeFunctionLibrary::CreateRuntimeBlendSpace1D(const FStr
 #else
 	return nullptr;
 #endif
-}
\ No newline at end of file
+}
+
+FglTFRuntimeTaskPoolStats UglTFRuntimeFunctionLibrary::glTFGetAsyncTaskPoolStats()
+{
+	return FglTFRuntimeTaskPool::Get().GetStats();
+}
+
+void UglTFRuntimeFunctionLibrary::glTFPurgeCookedMeshCache()
+{
+	FglTFRuntimeCookedMeshCache::Purge();
+}
+
+void UglTFRuntimeFunctionLibrary::glTFSetCookedMeshCacheMaxSize(const int32 MaxSizeMB)
+{
+	FglTFRuntimeCookedMeshCache::MaxSize = static_cast<int64>(FMath::Max(MaxSizeMB, 0)) * 1024 * 1024;
+	FglTFRuntimeCookedMeshCache::Trim();
+}
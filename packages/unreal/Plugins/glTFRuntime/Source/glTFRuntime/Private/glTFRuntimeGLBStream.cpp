@@ -0,0 +1,277 @@
+// Copyright 2020-2025, Roberto De Ioris.
+
+#include "glTFRuntimeGLBStream.h"
+#include "glTFRuntimeCookedMeshCache.h"
+#include "HAL/PlatformProcess.h"
+#include "Misc/ScopeLock.h"
+
+FglTFRuntimeGLBStream::FglTFRuntimeGLBStream(const FglTFRuntimeConfig& InLoaderConfig) : TotalSize(0), JsonOffset(0), JsonSize(0), BinaryOffset(0), BinarySize(0), bContentHashComputed(false), bSourceFrozen(false), LoaderConfig(InLoaderConfig)
+{
+}
+
+void FglTFRuntimeGLBStream::Append(const uint8* DataPtr, const int64 DataNum)
+{
+	if (bFinished || DataNum <= 0)
+	{
+		return;
+	}
+
+	if (TotalSize > 0)
+	{
+		// the blob is preallocated, bytes are copied in place (consumers hold pointers to it) and published by ReceivedBytes
+		const int64 Received = ReceivedBytes.GetValue();
+		const int64 Available = FMath::Min(TotalSize - Received, DataNum);
+		if (Available <= 0)
+		{
+			return;
+		}
+		FMemory::Memcpy(Data.GetData() + Received, DataPtr, Available);
+		ReceivedBytes.Set(Received + Available);
+	}
+	else
+	{
+		Data.Append(DataPtr, DataNum);
+
+		// 'glTF' magic + version + total length
+		if (Data.Num() >= 12 && Data[0] == 0x67 && Data[1] == 0x6C && Data[2] == 0x54 && Data[3] == 0x46)
+		{
+			const int64 DeclaredSize = *reinterpret_cast<const uint32*>(&Data[8]);
+			if (DeclaredSize >= Data.Num() || DeclaredSize > 20)
+			{
+				// this is the only reallocation, it happens before any consumer can access the data (trailing bytes are ignored)
+				const int64 Received = FMath::Min<int64>(Data.Num(), DeclaredSize);
+				Data.SetNumUninitialized(DeclaredSize);
+				TotalSize = DeclaredSize;
+				ReceivedBytes.Set(Received);
+			}
+		}
+
+		if (TotalSize <= 0)
+		{
+			ReceivedBytes.Set(Data.Num());
+		}
+	}
+
+	WakeWaiters();
+
+	const int64 Received = ReceivedBytes.GetValue();
+	if (TotalSize <= 0 || bJsonChunkReceived || Received < 20)
+	{
+		return;
+	}
+
+	const uint32 JsonChunkLength = *reinterpret_cast<const uint32*>(&Data[12]);
+	const uint32 JsonChunkType = *reinterpret_cast<const uint32*>(&Data[16]);
+	if (JsonChunkType != 0x4E4F534A)
+	{
+		return;
+	}
+
+	const int64 JsonChunkEnd = 20 + static_cast<int64>(JsonChunkLength);
+	// wait for the BIN chunk header too (if any)
+	const int64 RequiredBytes = JsonChunkEnd + 8 <= TotalSize ? JsonChunkEnd + 8 : JsonChunkEnd;
+	if (Received < RequiredBytes)
+	{
+		return;
+	}
+
+	JsonOffset = 20;
+	JsonSize = JsonChunkLength;
+
+	if (RequiredBytes > JsonChunkEnd)
+	{
+		const uint32 BinaryChunkLength = *reinterpret_cast<const uint32*>(&Data[JsonChunkEnd]);
+		const uint32 BinaryChunkType = *reinterpret_cast<const uint32*>(&Data[JsonChunkEnd + 4]);
+		if (BinaryChunkType == 0x004E4942 && JsonChunkEnd + 8 + static_cast<int64>(BinaryChunkLength) <= TotalSize)
+		{
+			BinaryOffset = JsonChunkEnd + 8;
+			BinarySize = BinaryChunkLength;
+		}
+	}
+
+	{
+		// the source identity is frozen here, a late ETag cannot change the key of a load already in progress
+		FScopeLock Lock(&ContentHashLock);
+		bSourceFrozen = true;
+	}
+
+	bJsonChunkReceived = true;
+
+	if (OnJsonChunkReceived)
+	{
+		OnJsonChunkReceived();
+	}
+}
+
+void FglTFRuntimeGLBStream::Finish(const bool bSuccess)
+{
+	if (bFinished)
+	{
+		return;
+	}
+
+	if (TotalSize > 0 && ReceivedBytes.GetValue() < TotalSize)
+	{
+		bFailed = true;
+	}
+
+	if (!bSuccess)
+	{
+		bFailed = true;
+	}
+
+	bFinished = true;
+	WakeWaiters();
+}
+
+void FglTFRuntimeGLBStream::WakeWaiters() const
+{
+	TArray<TUniqueFunction<void()>> ReadyContinuations;
+	{
+		FScopeLock Lock(&WaitersLock);
+		const int64 Received = ReceivedBytes.GetValue();
+		for (int32 WaiterIndex = Waiters.Num() - 1; WaiterIndex >= 0; WaiterIndex--)
+		{
+			if (bFinished || Waiters[WaiterIndex].Bytes <= Received)
+			{
+				Waiters[WaiterIndex].Event->Trigger();
+				Waiters.RemoveAtSwap(WaiterIndex);
+			}
+		}
+
+		for (int32 ContinuationIndex = Continuations.Num() - 1; ContinuationIndex >= 0; ContinuationIndex--)
+		{
+			if (bFinished || Continuations[ContinuationIndex].Bytes <= Received)
+			{
+				ReadyContinuations.Add(MoveTemp(Continuations[ContinuationIndex].Function));
+				Continuations.RemoveAtSwap(ContinuationIndex);
+			}
+		}
+	}
+
+	// out of the lock, as a continuation can register new ones
+	for (TUniqueFunction<void()>& Continuation : ReadyContinuations)
+	{
+		Continuation();
+	}
+}
+
+bool FglTFRuntimeGLBStream::WaitFor(const int64 Bytes) const
+{
+	if (ReceivedBytes.GetValue() >= Bytes)
+	{
+		return true;
+	}
+
+	if (bFinished || IsInGameThread())
+	{
+		return false;
+	}
+
+	SCOPED_NAMED_EVENT(FglTFRuntimeGLBStream_WaitFor, FColor::Magenta);
+
+	FEvent* Event = FPlatformProcess::GetSynchEventFromPool(true);
+	{
+		// the producer updates the counters before taking the lock, so the wake up cannot be missed
+		FScopeLock Lock(&WaitersLock);
+		if (ReceivedBytes.GetValue() < Bytes && !bFinished)
+		{
+			Waiters.Add({ Bytes, Event });
+		}
+		else
+		{
+			Event->Trigger();
+		}
+	}
+
+	Event->Wait();
+	FPlatformProcess::ReturnSynchEventToPool(Event);
+
+	return ReceivedBytes.GetValue() >= Bytes;
+}
+
+void FglTFRuntimeGLBStream::WhenReceived(const int64 Bytes, TUniqueFunction<void()>&& Continuation) const
+{
+	{
+		// same ordering as WaitFor(), the producer cannot run the continuations before they are registered
+		FScopeLock Lock(&WaitersLock);
+		if (ReceivedBytes.GetValue() < Bytes && !bFinished)
+		{
+			Continuations.Add({ Bytes, MoveTemp(Continuation) });
+			return;
+		}
+	}
+
+	Continuation();
+}
+
+bool FglTFRuntimeGLBStream::GetJsonChunk(int64& Offset, int64& Size) const
+{
+	if (!bJsonChunkReceived)
+	{
+		return false;
+	}
+
+	Offset = JsonOffset;
+	Size = JsonSize;
+	return true;
+}
+
+bool FglTFRuntimeGLBStream::GetBinaryChunk(int64& Offset, int64& Size) const
+{
+	if (!bJsonChunkReceived || BinarySize <= 0)
+	{
+		return false;
+	}
+
+	Offset = BinaryOffset;
+	Size = BinarySize;
+	return true;
+}
+
+void FglTFRuntimeGLBStream::SetUrl(const FString& InUrl)
+{
+	FScopeLock Lock(&ContentHashLock);
+	if (!bSourceFrozen)
+	{
+		Url = InUrl;
+	}
+}
+
+void FglTFRuntimeGLBStream::SetETag(const FString& InETag)
+{
+	FScopeLock Lock(&ContentHashLock);
+	if (!bSourceFrozen)
+	{
+		ETag = InETag;
+	}
+}
+
+FString FglTFRuntimeGLBStream::GetContentHash()
+{
+	if (!LoaderConfig.bCookedMeshCache || !bJsonChunkReceived)
+	{
+		return FString();
+	}
+
+	FScopeLock Lock(&ContentHashLock);
+	if (!bContentHashComputed)
+	{
+		// the BIN chunk is not hashed (the key must not wait for it), so only a strong ETag guarantees
+		// that the same JSON and size come with the same binary data, otherwise skip the cache
+		const bool bStrongETag = !ETag.IsEmpty() && !ETag.StartsWith(TEXT("W/"), ESearchCase::CaseSensitive);
+		if (bStrongETag)
+		{
+			const FString SourceString = FString::Printf(TEXT("%s\n%s\n%lld\n"), *Url, *ETag, TotalSize);
+			FTCHARToUTF8 Source(*SourceString);
+			TArray64<uint8> KeyData;
+			KeyData.Reserve(Source.Length() + JsonSize);
+			KeyData.Append(reinterpret_cast<const uint8*>(Source.Get()), Source.Length());
+			KeyData.Append(Data.GetData() + JsonOffset, JsonSize);
+			ContentHash = FglTFRuntimeCookedMeshCache::HashContent(KeyData.GetData(), KeyData.Num(), LoaderConfig);
+		}
+		bContentHashComputed = true;
+	}
+
+	return ContentHash;
+}
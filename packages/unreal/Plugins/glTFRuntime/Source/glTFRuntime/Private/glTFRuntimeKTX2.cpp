@@ -0,0 +1,296 @@
+// Copyright 2020-2025, Roberto De Ioris.
+
+#include "glTFRuntimeKTX2.h"
+#include "glTFRuntimeTextureCompressor.h"
+#include "glTFRuntimeZstd.h"
+#include "Misc/Compression.h"
+
+namespace glTFRuntime
+{
+	namespace KTX2
+	{
+		constexpr uint8 Identifier[12] = { 0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A };
+		constexpr int64 HeaderSize = 80;
+		constexpr int64 LevelIndexEntrySize = 24;
+
+		constexpr uint32 SupercompressionNone = 0;
+		constexpr uint32 SupercompressionZstd = 2;
+		constexpr uint32 SupercompressionZlib = 3;
+
+		constexpr uint8 ColorModelETC1S = 163;
+		constexpr uint8 ColorModelUASTC = 166;
+
+		uint32 ReadUInt32(const uint8* Ptr)
+		{
+			uint32 Value;
+			FMemory::Memcpy(&Value, Ptr, sizeof(uint32));
+			return Value;
+		}
+
+		uint64 ReadUInt64(const uint8* Ptr)
+		{
+			uint64 Value;
+			FMemory::Memcpy(&Value, Ptr, sizeof(uint64));
+			return Value;
+		}
+
+		EPixelFormat GetPixelFormat(const uint32 VkFormat, bool& bSwizzleRGBA)
+		{
+			bSwizzleRGBA = false;
+			switch (VkFormat)
+			{
+			case 37: // VK_FORMAT_R8G8B8A8_UNORM
+			case 43: // VK_FORMAT_R8G8B8A8_SRGB
+				bSwizzleRGBA = true;
+				return EPixelFormat::PF_B8G8R8A8;
+			case 44: // VK_FORMAT_B8G8R8A8_UNORM
+			case 50: // VK_FORMAT_B8G8R8A8_SRGB
+				return EPixelFormat::PF_B8G8R8A8;
+			case 97: // VK_FORMAT_R16G16B16A16_SFLOAT
+				return EPixelFormat::PF_FloatRGBA;
+			case 131: // VK_FORMAT_BC1_RGB_UNORM_BLOCK
+			case 132: // VK_FORMAT_BC1_RGB_SRGB_BLOCK
+			case 133: // VK_FORMAT_BC1_RGBA_UNORM_BLOCK
+			case 134: // VK_FORMAT_BC1_RGBA_SRGB_BLOCK
+				return EPixelFormat::PF_DXT1;
+			case 135: // VK_FORMAT_BC2_UNORM_BLOCK
+			case 136: // VK_FORMAT_BC2_SRGB_BLOCK
+				return EPixelFormat::PF_DXT3;
+			case 137: // VK_FORMAT_BC3_UNORM_BLOCK
+			case 138: // VK_FORMAT_BC3_SRGB_BLOCK
+				return EPixelFormat::PF_DXT5;
+			case 139: // VK_FORMAT_BC4_UNORM_BLOCK
+				return EPixelFormat::PF_BC4;
+			case 141: // VK_FORMAT_BC5_UNORM_BLOCK
+				return EPixelFormat::PF_BC5;
+			case 145: // VK_FORMAT_BC7_UNORM_BLOCK
+			case 146: // VK_FORMAT_BC7_SRGB_BLOCK
+				return EPixelFormat::PF_BC7;
+			default:
+				break;
+			}
+			return EPixelFormat::PF_Unknown;
+		}
+	}
+}
+
+FglTFRuntimeKTX2Transcoder FglTFRuntimeKTX2::Transcoder;
+
+FglTFRuntimeKTX2::FglTFRuntimeKTX2(const TArray64<uint8>& InData) : Data(InData), VkFormat(0), Width(0), Height(0), NumLevels(0), SupercompressionScheme(0), ColorModel(0), bRequiresMipGeneration(false)
+{
+}
+
+bool FglTFRuntimeKTX2::IsKTX2(const TArray64<uint8>& Data)
+{
+	return Data.Num() >= glTFRuntime::KTX2::HeaderSize + glTFRuntime::KTX2::LevelIndexEntrySize && FMemory::Memcmp(Data.GetData(), glTFRuntime::KTX2::Identifier, sizeof(glTFRuntime::KTX2::Identifier)) == 0;
+}
+
+bool FglTFRuntimeKTX2::ParseHeader()
+{
+	using namespace glTFRuntime::KTX2;
+
+	if (!IsKTX2(Data))
+	{
+		return false;
+	}
+
+	const uint8* Ptr = Data.GetData();
+	VkFormat = ReadUInt32(Ptr + 12);
+	Width = ReadUInt32(Ptr + 20);
+	Height = FMath::Max<uint32>(ReadUInt32(Ptr + 24), 1);
+	// 0 means that only the base level is stored and the mips must be generated at runtime, anything above the full chain is garbage
+	const uint32 LevelCount = ReadUInt32(Ptr + 40);
+	bRequiresMipGeneration = LevelCount == 0;
+	NumLevels = FMath::Clamp<uint32>(LevelCount, 1, FMath::FloorLog2(FMath::Max(Width, Height)) + 1);
+	SupercompressionScheme = ReadUInt32(Ptr + 44);
+
+	if (Width == 0 || HeaderSize + NumLevels * LevelIndexEntrySize > Data.Num())
+	{
+		return false;
+	}
+
+	// basic data format descriptor: total size + block header + 16 bytes per sample
+	const uint32 DFDOffset = ReadUInt32(Ptr + 48);
+	const uint32 DFDLength = ReadUInt32(Ptr + 52);
+	ChannelIds.Empty();
+	if (DFDLength >= 4 + 24 && static_cast<int64>(DFDOffset) + DFDLength <= Data.Num())
+	{
+		const uint8* DFD = Ptr + DFDOffset + 4;
+		ColorModel = DFD[8];
+		const uint32 BlockSize = ReadUInt32(DFD + 4) >> 16;
+		const uint32 NumSamples = BlockSize >= 24 ? (FMath::Min(BlockSize, DFDLength - 4) - 24) / 16 : 0;
+		for (uint32 SampleIndex = 0; SampleIndex < NumSamples; SampleIndex++)
+		{
+			ChannelIds.Add(DFD[24 + SampleIndex * 16 + 3] & 0x0F);
+		}
+	}
+
+	return true;
+}
+
+bool FglTFRuntimeKTX2::IsBasisUniversal() const
+{
+	return VkFormat == 0 && (ColorModel == glTFRuntime::KTX2::ColorModelETC1S || ColorModel == glTFRuntime::KTX2::ColorModelUASTC);
+}
+
+bool FglTFRuntimeKTX2::RequiresMipGeneration() const
+{
+	return bRequiresMipGeneration;
+}
+
+bool FglTFRuntimeKTX2::HasAlpha() const
+{
+	if (ColorModel == glTFRuntime::KTX2::ColorModelETC1S)
+	{
+		// RGB + AAA (or RRR + GGG) slices
+		return ChannelIds.Num() > 1;
+	}
+
+	if (ColorModel == glTFRuntime::KTX2::ColorModelUASTC)
+	{
+		// KHR_DF_CHANNEL_UASTC_RGBA and KHR_DF_CHANNEL_UASTC_RRRG
+		return ChannelIds.Num() > 0 && (ChannelIds[0] == 3 || ChannelIds[0] == 5);
+	}
+
+	return true;
+}
+
+void FglTFRuntimeKTX2::LoadMips(const int32 TextureIndex, TArray<FglTFRuntimeMipMap>& Mips, const int32 MaxMip, const FglTFRuntimeImagesConfig& ImagesConfig)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeKTX2_LoadMips, FColor::Magenta);
+
+	using namespace glTFRuntime::KTX2;
+
+	if (!ParseHeader())
+	{
+		UE_LOG(LogGLTFRuntime, Error, TEXT("Invalid KTX2 header"));
+		return;
+	}
+
+	if (IsBasisUniversal())
+	{
+		if (!Transcoder.IsBound())
+		{
+			// no transcoder ships with the plugin, the KHR_texture_basisu core source (if any) is still tried by the caller
+			UE_LOG(LogGLTFRuntime, Error, TEXT("Unable to load Basis Universal KTX2 texture %d: no transcoder bound (FglTFRuntimeKTX2::Transcoder)"), TextureIndex);
+			return;
+		}
+
+		const bool bNormalMap = ImagesConfig.Compression == TextureCompressionSettings::TC_Normalmap;
+		EglTFRuntimeBlockCompression BlockCompression = ImagesConfig.BlockCompression;
+		if (BlockCompression == EglTFRuntimeBlockCompression::None)
+		{
+			// UASTC maps almost losslessly to BC7, ETC1S endpoints to BC1
+			BlockCompression = ColorModel == ColorModelUASTC ? EglTFRuntimeBlockCompression::BC7 : EglTFRuntimeBlockCompression::BC1BC3;
+		}
+
+		EPixelFormat PixelFormat = FglTFRuntimeTextureCompressor::GetPixelFormat(BlockCompression, bNormalMap, HasAlpha());
+		if (PixelFormat == EPixelFormat::PF_Unknown)
+		{
+			PixelFormat = EPixelFormat::PF_B8G8R8A8;
+		}
+
+		TArray<FglTFRuntimeMipMap> TranscodedMips;
+		if (!Transcoder.Execute(Data, PixelFormat, TextureIndex, TranscodedMips) || TranscodedMips.Num() == 0)
+		{
+			UE_LOG(LogGLTFRuntime, Error, TEXT("Unable to transcode Basis Universal KTX2 texture %d"), TextureIndex);
+			return;
+		}
+
+		const int32 NumMips = MaxMip > 0 ? FMath::Min(TranscodedMips.Num(), MaxMip) : TranscodedMips.Num();
+		for (int32 MipIndex = 0; MipIndex < NumMips; MipIndex++)
+		{
+			Mips.Add(MoveTemp(TranscodedMips[MipIndex]));
+		}
+		return;
+	}
+
+	bool bSwizzleRGBA = false;
+	const EPixelFormat PixelFormat = GetPixelFormat(VkFormat, bSwizzleRGBA);
+	if (PixelFormat == EPixelFormat::PF_Unknown)
+	{
+		UE_LOG(LogGLTFRuntime, Error, TEXT("Unsupported KTX2 vkFormat %u"), VkFormat);
+		return;
+	}
+
+	if (SupercompressionScheme != SupercompressionNone && SupercompressionScheme != SupercompressionZstd && SupercompressionScheme != SupercompressionZlib)
+	{
+		UE_LOG(LogGLTFRuntime, Error, TEXT("Unsupported KTX2 supercompression scheme %u"), SupercompressionScheme);
+		return;
+	}
+
+	const int32 BlockSizeX = GPixelFormats[PixelFormat].BlockSizeX;
+	const int32 BlockSizeY = GPixelFormats[PixelFormat].BlockSizeY;
+	const int32 BlockBytes = GPixelFormats[PixelFormat].BlockBytes;
+
+	const int32 NumMips = MaxMip > 0 ? FMath::Min<int32>(NumLevels, MaxMip) : NumLevels;
+	TArray<FglTFRuntimeMipMap> LevelMips;
+	LevelMips.Reserve(NumMips);
+
+	for (int32 Level = 0; Level < NumMips; Level++)
+	{
+		const uint8* LevelIndexEntry = Data.GetData() + HeaderSize + Level * LevelIndexEntrySize;
+		const uint64 LevelOffset = ReadUInt64(LevelIndexEntry);
+		const uint64 LevelLength = ReadUInt64(LevelIndexEntry + 8);
+		const uint64 LevelUncompressedLength = ReadUInt64(LevelIndexEntry + 16);
+
+		const int32 LevelWidth = FMath::Max<int32>(Width >> Level, 1);
+		const int32 LevelHeight = FMath::Max<int32>(Height >> Level, 1);
+		// first layer/face only
+		const int64 ImageSize = static_cast<int64>(FMath::DivideAndRoundUp(LevelWidth, BlockSizeX)) * FMath::DivideAndRoundUp(LevelHeight, BlockSizeY) * BlockBytes;
+
+		if (LevelOffset > MAX_uint64 - LevelLength || LevelOffset + LevelLength > static_cast<uint64>(Data.Num()))
+		{
+			UE_LOG(LogGLTFRuntime, Error, TEXT("Invalid KTX2 level %d"), Level);
+			return;
+		}
+
+		FglTFRuntimeMipMap MipMap(TextureIndex, PixelFormat, LevelWidth, LevelHeight);
+
+		if (SupercompressionScheme == SupercompressionZstd || SupercompressionScheme == SupercompressionZlib)
+		{
+			if (LevelUncompressedLength < static_cast<uint64>(ImageSize) || LevelUncompressedLength > MAX_int32 || LevelLength > MAX_int32)
+			{
+				UE_LOG(LogGLTFRuntime, Error, TEXT("Invalid KTX2 level %d"), Level);
+				return;
+			}
+
+			TArray64<uint8> UncompressedLevel;
+			UncompressedLevel.AddUninitialized(LevelUncompressedLength);
+			const bool bDecompressed = SupercompressionScheme == SupercompressionZstd ?
+				FglTFRuntimeZstd::Decompress(Data.GetData() + LevelOffset, static_cast<int64>(LevelLength), UncompressedLevel.GetData(), static_cast<int64>(LevelUncompressedLength)) :
+				FCompression::UncompressMemory(NAME_Zlib, UncompressedLevel.GetData(), static_cast<int32>(LevelUncompressedLength), Data.GetData() + LevelOffset, static_cast<int32>(LevelLength));
+			if (!bDecompressed)
+			{
+				UE_LOG(LogGLTFRuntime, Error, TEXT("Unable to decompress KTX2 level %d"), Level);
+				return;
+			}
+			UncompressedLevel.SetNum(ImageSize);
+			MipMap.Pixels = MoveTemp(UncompressedLevel);
+		}
+		else
+		{
+			if (LevelLength < static_cast<uint64>(ImageSize))
+			{
+				UE_LOG(LogGLTFRuntime, Error, TEXT("Invalid KTX2 level %d"), Level);
+				return;
+			}
+			MipMap.Pixels.Append(Data.GetData() + LevelOffset, ImageSize);
+		}
+
+		if (bSwizzleRGBA)
+		{
+			for (int64 Index = 0; Index < MipMap.Pixels.Num(); Index += 4)
+			{
+				Swap(MipMap.Pixels[Index], MipMap.Pixels[Index + 2]);
+			}
+		}
+
+		LevelMips.Add(MoveTemp(MipMap));
+	}
+
+	for (FglTFRuntimeMipMap& MipMap : LevelMips)
+	{
+		Mips.Add(MoveTemp(MipMap));
+	}
+}
@@ -0,0 +1,452 @@
+// Copyright 2020-2025, Roberto De Ioris.
+
+#include "glTFRuntimeLZ4.h"
+#include "glTFRuntimeParser.h"
+#include "Async/ParallelFor.h"
+#include "Runtime/Launch/Resources/Version.h"
+
+namespace glTFRuntime
+{
+	namespace LZ4
+	{
+		constexpr uint32 PRIME32_1 = 2654435761U;
+		constexpr uint32 PRIME32_2 = 2246822519U;
+		constexpr uint32 PRIME32_3 = 3266489917U;
+		constexpr uint32 PRIME32_4 = 668265263U;
+		constexpr uint32 PRIME32_5 = 374761393U;
+
+		FORCEINLINE uint32 Read32(const uint8* Ptr)
+		{
+			uint32 Value;
+			FMemory::Memcpy(&Value, Ptr, sizeof(uint32));
+			return Value;
+		}
+
+		FORCEINLINE uint32 RotateLeft(const uint32 Value, const uint32 Bits)
+		{
+			return (Value << Bits) | (Value >> (32 - Bits));
+		}
+
+		FORCEINLINE uint32 Round(uint32 Accumulator, const uint32 Input)
+		{
+			Accumulator += Input * PRIME32_2;
+			Accumulator = RotateLeft(Accumulator, 13);
+			return Accumulator * PRIME32_1;
+		}
+
+		// copies Length bytes, in 16 bytes steps (so it can overwrite up to 15 bytes after Length) when Slack allows it
+		FORCEINLINE void WideCopy(uint8* Dst, const uint8* Src, const int64 Length, const int64 Slack)
+		{
+			if (Length <= 16 && Slack >= 16)
+			{
+				FMemory::Memcpy(Dst, Src, 16);
+			}
+			else
+			{
+				FMemory::Memcpy(Dst, Src, Length);
+			}
+		}
+
+		struct FBlock
+		{
+			const uint8* Data;
+			uint32 Size;
+			bool bUncompressed;
+			const uint8* Checksum;
+		};
+
+		int64 DecompressFrameBlock(const FBlock& Block, const int32 BlockIndex, uint8* Dst, const int64 DstCapacity, const uint8* WindowStart)
+		{
+			if (Block.Checksum && FglTFRuntimeLZ4::XXH32(Block.Data, Block.Size) != Read32(Block.Checksum))
+			{
+				UE_LOG(LogGLTFRuntime, Error, TEXT("LZ4 checksum mismatch @Block %d"), BlockIndex);
+				return -1;
+			}
+
+			if (Block.bUncompressed)
+			{
+				if (Block.Size > DstCapacity)
+				{
+					return -1;
+				}
+				FMemory::Memcpy(Dst, Block.Data, Block.Size);
+				return Block.Size;
+			}
+
+			return FglTFRuntimeLZ4::DecompressBlock(Block.Data, Block.Size, Dst, DstCapacity, WindowStart);
+		}
+	}
+}
+
+bool FglTFRuntimeLZ4::IsFrame(const uint8* DataPtr, const int64 DataNum)
+{
+	return DataNum > 7 && DataPtr[0] == 0x04 && DataPtr[1] == 0x22 && DataPtr[2] == 0x4D && DataPtr[3] == 0x18;
+}
+
+uint32 FglTFRuntimeLZ4::XXH32(const uint8* DataPtr, const int64 DataNum, const uint32 Seed)
+{
+	using namespace glTFRuntime::LZ4;
+
+	const uint8* Ptr = DataPtr;
+	const uint8* End = DataPtr + DataNum;
+	uint32 Hash;
+
+	if (DataNum >= 16)
+	{
+		uint32 V1 = Seed + PRIME32_1 + PRIME32_2;
+		uint32 V2 = Seed + PRIME32_2;
+		uint32 V3 = Seed;
+		uint32 V4 = Seed - PRIME32_1;
+
+		const uint8* Limit = End - 16;
+		do
+		{
+			V1 = Round(V1, Read32(Ptr));
+			V2 = Round(V2, Read32(Ptr + 4));
+			V3 = Round(V3, Read32(Ptr + 8));
+			V4 = Round(V4, Read32(Ptr + 12));
+			Ptr += 16;
+		} while (Ptr <= Limit);
+
+		Hash = RotateLeft(V1, 1) + RotateLeft(V2, 7) + RotateLeft(V3, 12) + RotateLeft(V4, 18);
+	}
+	else
+	{
+		Hash = Seed + PRIME32_5;
+	}
+
+	Hash += static_cast<uint32>(DataNum);
+
+	while (Ptr + 4 <= End)
+	{
+		Hash += Read32(Ptr) * PRIME32_3;
+		Hash = RotateLeft(Hash, 17) * PRIME32_4;
+		Ptr += 4;
+	}
+
+	while (Ptr < End)
+	{
+		Hash += (*Ptr) * PRIME32_5;
+		Hash = RotateLeft(Hash, 11) * PRIME32_1;
+		Ptr++;
+	}
+
+	Hash ^= Hash >> 15;
+	Hash *= PRIME32_2;
+	Hash ^= Hash >> 13;
+	Hash *= PRIME32_3;
+	Hash ^= Hash >> 16;
+
+	return Hash;
+}
+
+int64 FglTFRuntimeLZ4::DecompressBlock(const uint8* Src, const int64 SrcSize, uint8* Dst, const int64 DstCapacity, const uint8* WindowStart)
+{
+	const uint8* InPtr = Src;
+	const uint8* InEnd = Src + SrcSize;
+	uint8* OutPtr = Dst;
+	uint8* OutEnd = Dst + DstCapacity;
+
+	for (;;)
+	{
+		if (InPtr >= InEnd)
+		{
+			return -1;
+		}
+
+		const uint8 Token = *InPtr++;
+
+		int64 LiteralLength = Token >> 4;
+		if (LiteralLength == 15)
+		{
+			uint8 Extra;
+			do
+			{
+				if (InPtr >= InEnd)
+				{
+					return -1;
+				}
+				Extra = *InPtr++;
+				LiteralLength += Extra;
+			} while (Extra == 255);
+		}
+
+		if (LiteralLength > InEnd - InPtr || LiteralLength > OutEnd - OutPtr)
+		{
+			return -1;
+		}
+
+		glTFRuntime::LZ4::WideCopy(OutPtr, InPtr, LiteralLength, FMath::Min<int64>(InEnd - InPtr, OutEnd - OutPtr));
+		OutPtr += LiteralLength;
+		InPtr += LiteralLength;
+
+		// the last sequence has only literals
+		if (InPtr == InEnd)
+		{
+			return OutPtr - Dst;
+		}
+
+		if (InEnd - InPtr < 2)
+		{
+			return -1;
+		}
+
+		const int64 MatchOffset = static_cast<int64>(InPtr[0]) | (static_cast<int64>(InPtr[1]) << 8);
+		InPtr += 2;
+
+		if (MatchOffset == 0 || MatchOffset > OutPtr - WindowStart)
+		{
+			return -1;
+		}
+
+		int64 MatchLength = Token & 0x0F;
+		if (MatchLength == 15)
+		{
+			uint8 Extra;
+			do
+			{
+				if (InPtr >= InEnd)
+				{
+					return -1;
+				}
+				Extra = *InPtr++;
+				MatchLength += Extra;
+			} while (Extra == 255);
+		}
+		MatchLength += 4;
+
+		if (MatchLength > OutEnd - OutPtr)
+		{
+			return -1;
+		}
+
+		const uint8* Match = OutPtr - MatchOffset;
+		const int64 OutSlack = OutEnd - OutPtr;
+
+		if (MatchOffset >= 16)
+		{
+			// source and destination never overlap within a 16 bytes step
+			if (MatchLength <= 16 && OutSlack >= 16)
+			{
+				FMemory::Memcpy(OutPtr, Match, 16);
+			}
+			else if (MatchOffset >= MatchLength)
+			{
+				FMemory::Memcpy(OutPtr, Match, MatchLength);
+			}
+			else
+			{
+				for (int64 Index = 0; Index < MatchLength; Index += 16)
+				{
+					FMemory::Memcpy(OutPtr + Index, Match + Index, FMath::Min<int64>(16, MatchLength - Index));
+				}
+			}
+		}
+		else if (MatchOffset >= 8 && OutSlack >= Align(MatchLength, 8))
+		{
+			for (int64 Index = 0; Index < MatchLength; Index += 8)
+			{
+				FMemory::Memcpy(OutPtr + Index, Match + Index, 8);
+			}
+		}
+		else
+		{
+			// short offsets replicate a pattern, go byte by byte
+			for (int64 Index = 0; Index < MatchLength; Index++)
+			{
+				OutPtr[Index] = Match[Index];
+			}
+		}
+
+		OutPtr += MatchLength;
+	}
+}
+
+bool FglTFRuntimeLZ4::DecompressFrame(const uint8* DataPtr, const int64 DataNum, TArray64<uint8>& Output)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeLZ4_DecompressFrame, FColor::Magenta);
+
+	using namespace glTFRuntime::LZ4;
+
+	if (!IsFrame(DataPtr, DataNum))
+	{
+		return false;
+	}
+
+	const uint8 FLG = DataPtr[4];
+	const uint8 BD = DataPtr[5];
+
+	if ((FLG >> 6) != 0x01)
+	{
+		UE_LOG(LogGLTFRuntime, Error, TEXT("Unsupported LZ4 frame version."));
+		return false;
+	}
+
+	const bool bIndependentBlocks = ((FLG >> 5) & 0x01) == 1;
+	const bool bHasBlockChecksum = ((FLG >> 4) & 0x01) == 1;
+	const bool bHasContentSize = ((FLG >> 3) & 0x01) == 1;
+	const bool bHasContentChecksum = ((FLG >> 2) & 0x01) == 1;
+	const bool bHasDictID = (FLG & 0x01) == 1;
+
+	if (bHasDictID)
+	{
+		UE_LOG(LogGLTFRuntime, Error, TEXT("LZ4 dictionaries are not supported."));
+		return false;
+	}
+
+	const uint32 BlockMaxSizeIndex = (BD >> 4) & 0x07;
+	if (BlockMaxSizeIndex < 4)
+	{
+		UE_LOG(LogGLTFRuntime, Error, TEXT("Invalid LZ4 Block Max Size."));
+		return false;
+	}
+	// 64KB, 256KB, 1MB, 4MB
+	const int64 BlockMaxSize = 1LL << (8 + 2 * BlockMaxSizeIndex);
+
+	const int64 DescriptorSize = 2 + (bHasContentSize ? 8 : 0);
+	int64 Offset = 4 + DescriptorSize + 1;
+	if (Offset > DataNum)
+	{
+		UE_LOG(LogGLTFRuntime, Error, TEXT("Invalid LZ4 frame header."));
+		return false;
+	}
+
+	if (((XXH32(DataPtr + 4, DescriptorSize) >> 8) & 0xFF) != DataPtr[4 + DescriptorSize])
+	{
+		UE_LOG(LogGLTFRuntime, Error, TEXT("LZ4 frame header checksum mismatch."));
+		return false;
+	}
+
+	uint64 ContentSize = 0;
+	if (bHasContentSize)
+	{
+		FMemory::Memcpy(&ContentSize, DataPtr + 6, sizeof(uint64));
+	}
+
+	TArray<FBlock> Blocks;
+	bool bEndMark = false;
+	while (Offset + 4 <= DataNum)
+	{
+		const uint32 BlockSize = Read32(DataPtr + Offset);
+		Offset += 4;
+
+		if (BlockSize == 0)
+		{
+			bEndMark = true;
+			break;
+		}
+
+		FBlock Block;
+		Block.Size = BlockSize & 0x7FFFFFFF;
+		Block.bUncompressed = ((BlockSize >> 31) & 0x01) == 1;
+		Block.Data = DataPtr + Offset;
+		Block.Checksum = bHasBlockChecksum ? DataPtr + Offset + Block.Size : nullptr;
+
+		if (Block.Size > BlockMaxSize || Offset + Block.Size + (bHasBlockChecksum ? 4 : 0) > DataNum)
+		{
+			UE_LOG(LogGLTFRuntime, Error, TEXT("Invalid LZ4 Block at index %d."), Blocks.Num());
+			return false;
+		}
+
+		Blocks.Add(Block);
+		Offset += Block.Size + (bHasBlockChecksum ? 4 : 0);
+	}
+
+	if (!bEndMark || (bHasContentChecksum && Offset + 4 > DataNum))
+	{
+		UE_LOG(LogGLTFRuntime, Error, TEXT("Truncated LZ4 frame."));
+		return false;
+	}
+
+	// every block decompresses to at most BlockMaxSize bytes
+	const int64 MaxContentSize = Blocks.Num() * BlockMaxSize;
+	if (bHasContentSize && ContentSize > static_cast<uint64>(MaxContentSize))
+	{
+		UE_LOG(LogGLTFRuntime, Error, TEXT("Invalid LZ4 Content Size."));
+		return false;
+	}
+
+	const int64 Capacity = bHasContentSize ? static_cast<int64>(ContentSize) : MaxContentSize;
+	Output.Empty(Capacity);
+	Output.AddUninitialized(Capacity);
+	uint8* OutputData = Output.GetData();
+
+	int64 TotalSize = -1;
+
+	// independent blocks are decompressed in parallel in BlockMaxSize slots (only the last one is expected to be shorter)
+	if (bIndependentBlocks && Blocks.Num() > 1)
+	{
+		TArray<int64> BlocksSizes;
+		BlocksSizes.AddUninitialized(Blocks.Num());
+
+		ParallelFor(Blocks.Num(), [&](const int32 BlockIndex)
+			{
+				const int64 SlotStart = BlockIndex * BlockMaxSize;
+				if (SlotStart >= Capacity)
+				{
+					BlocksSizes[BlockIndex] = -1;
+					return;
+				}
+				const int64 SlotCapacity = FMath::Min<int64>(BlockMaxSize, Capacity - SlotStart);
+				BlocksSizes[BlockIndex] = DecompressFrameBlock(Blocks[BlockIndex], BlockIndex, OutputData + SlotStart, SlotCapacity, OutputData + SlotStart);
+			});
+
+		int64 Cursor = 0;
+		for (int32 BlockIndex = 0; BlockIndex < Blocks.Num(); BlockIndex++)
+		{
+			if (BlocksSizes[BlockIndex] < 0)
+			{
+				Cursor = -1;
+				break;
+			}
+
+			// compact short blocks
+			const int64 SlotStart = BlockIndex * BlockMaxSize;
+			if (SlotStart != Cursor)
+			{
+				FMemory::Memmove(OutputData + Cursor, OutputData + SlotStart, BlocksSizes[BlockIndex]);
+			}
+			Cursor += BlocksSizes[BlockIndex];
+		}
+
+		TotalSize = Cursor;
+	}
+
+	// dependent blocks (or slots not fitting the content size), matches can reference the previous blocks
+	if (TotalSize < 0)
+	{
+		int64 Cursor = 0;
+		for (int32 BlockIndex = 0; BlockIndex < Blocks.Num(); BlockIndex++)
+		{
+			const int64 BlockOutputSize = DecompressFrameBlock(Blocks[BlockIndex], BlockIndex, OutputData + Cursor, Capacity - Cursor, bIndependentBlocks ? OutputData + Cursor : OutputData);
+			if (BlockOutputSize < 0)
+			{
+				UE_LOG(LogGLTFRuntime, Error, TEXT("LZ4 decompression error @Block %d"), BlockIndex);
+				return false;
+			}
+			Cursor += BlockOutputSize;
+		}
+		TotalSize = Cursor;
+	}
+
+	if (bHasContentSize && TotalSize != Capacity)
+	{
+		UE_LOG(LogGLTFRuntime, Error, TEXT("LZ4 Content Size mismatch (expected %lld, got %lld)."), Capacity, TotalSize);
+		return false;
+	}
+
+	// no reallocation, the capacity is kept
+#if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 5)
+	Output.SetNumUninitialized(TotalSize, EAllowShrinking::No);
+#else
+	Output.SetNumUninitialized(TotalSize, false);
+#endif
+
+	if (bHasContentChecksum && XXH32(OutputData, TotalSize) != Read32(DataPtr + Offset))
+	{
+		UE_LOG(LogGLTFRuntime, Error, TEXT("LZ4 content checksum mismatch."));
+		return false;
+	}
+
+	return true;
+}
@@ -0,0 +1,37 @@
+// Copyright 2020-2025, Roberto De Ioris.
+
+#include "glTFRuntimeMappedFile.h"
+#include "HAL/PlatformFileManager.h"
+#include "Runtime/Launch/Resources/Version.h"
+
+FglTFRuntimeMappedFilePtr FglTFRuntimeMappedFile::Open(const FString& Filename)
+{
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+	FglTFRuntimeMappedFilePtr MappedFile = MakeShared<FglTFRuntimeMappedFile, ESPMode::ThreadSafe>();
+
+#if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 4)
+	FOpenMappedResult MappedResult = PlatformFile.OpenMappedEx(*Filename);
+	if (MappedResult.HasError())
+	{
+		return nullptr;
+	}
+	MappedFile->MappedFileHandle = MappedResult.StealValue();
+#else
+	MappedFile->MappedFileHandle = TUniquePtr<IMappedFileHandle>(PlatformFile.OpenMapped(*Filename));
+#endif
+
+	// empty files cannot be mapped
+	if (!MappedFile->MappedFileHandle || MappedFile->MappedFileHandle->GetFileSize() <= 0)
+	{
+		return nullptr;
+	}
+
+	MappedFile->MappedFileRegion = TUniquePtr<IMappedFileRegion>(MappedFile->MappedFileHandle->MapRegion(0, MappedFile->MappedFileHandle->GetFileSize()));
+	if (!MappedFile->MappedFileRegion)
+	{
+		return nullptr;
+	}
+
+	return MappedFile;
+}
@@ -0,0 +1,190 @@
+// Copyright 2020-2025, Roberto De Ioris.
+
+#include "glTFRuntimeMipGenerator.h"
+#include "Async/ParallelFor.h"
+
+namespace glTFRuntime
+{
+	namespace MipGenerator
+	{
+		// levels smaller than this are not worth the parallel dispatch
+		constexpr int32 MinParallelPixels = 64 * 64;
+
+		constexpr int32 LinearToSRGBTableSize = 4096;
+
+		struct FTaps
+		{
+			int32 Index[3];
+			float Weight[3];
+			int32 Num;
+		};
+
+		const float* GetSRGBToLinearTable()
+		{
+			static const TArray<float> Table = []()
+				{
+					TArray<float> NewTable;
+					NewTable.AddUninitialized(256);
+					for (int32 Index = 0; Index < 256; Index++)
+					{
+						const float Value = Index / 255.0f;
+						NewTable[Index] = Value <= 0.04045f ? Value / 12.92f : FMath::Pow((Value + 0.055f) / 1.055f, 2.4f);
+					}
+					return NewTable;
+				}();
+			return Table.GetData();
+		}
+
+		const uint8* GetLinearToSRGBTable()
+		{
+			static const TArray<uint8> Table = []()
+				{
+					TArray<uint8> NewTable;
+					NewTable.AddUninitialized(LinearToSRGBTableSize);
+					for (int32 Index = 0; Index < LinearToSRGBTableSize; Index++)
+					{
+						const float Value = Index / static_cast<float>(LinearToSRGBTableSize - 1);
+						const float SRGBValue = Value <= 0.0031308f ? Value * 12.92f : 1.055f * FMath::Pow(Value, 1.0f / 2.4f) - 0.055f;
+						NewTable[Index] = static_cast<uint8>(FMath::Clamp(FMath::RoundToInt(SRGBValue * 255.0f), 0, 255));
+					}
+					return NewTable;
+				}();
+			return Table.GetData();
+		}
+
+		// even sizes: 2 taps box, odd sizes (2N+1 -> N): 3 taps polyphase box
+		void BuildTaps(const int32 SourceSize, const int32 DestinationSize, TArray<FTaps>& Taps)
+		{
+			Taps.SetNumUninitialized(DestinationSize);
+			for (int32 Index = 0; Index < DestinationSize; Index++)
+			{
+				FTaps& Tap = Taps[Index];
+				if (SourceSize == DestinationSize)
+				{
+					Tap.Index[0] = Index;
+					Tap.Weight[0] = 1;
+					Tap.Num = 1;
+				}
+				else if ((SourceSize % 2) == 0)
+				{
+					Tap.Index[0] = Index * 2;
+					Tap.Index[1] = Index * 2 + 1;
+					Tap.Weight[0] = 0.5f;
+					Tap.Weight[1] = 0.5f;
+					Tap.Num = 2;
+				}
+				else
+				{
+					const float Scale = 1.0f / SourceSize;
+					Tap.Index[0] = Index * 2;
+					Tap.Index[1] = Index * 2 + 1;
+					Tap.Index[2] = Index * 2 + 2;
+					Tap.Weight[0] = (DestinationSize - Index) * Scale;
+					Tap.Weight[1] = DestinationSize * Scale;
+					Tap.Weight[2] = (Index + 1) * Scale;
+					Tap.Num = 3;
+				}
+			}
+		}
+	}
+}
+
+int32 FglTFRuntimeMipGenerator::GetNumMips(const int32 Width, const int32 Height)
+{
+	return FMath::FloorLog2(FMath::Max(FMath::Max(Width, Height), 1)) + 1;
+}
+
+void FglTFRuntimeMipGenerator::Downsample(const uint8* Source, const int32 SourceWidth, const int32 SourceHeight, uint8* Destination, const int32 DestinationWidth, const int32 DestinationHeight, const bool sRGB)
+{
+	using namespace glTFRuntime::MipGenerator;
+
+	TArray<FTaps> TapsX;
+	TArray<FTaps> TapsY;
+	BuildTaps(SourceWidth, DestinationWidth, TapsX);
+	BuildTaps(SourceHeight, DestinationHeight, TapsY);
+
+	const float* SRGBToLinear = GetSRGBToLinearTable();
+	const uint8* LinearToSRGB = GetLinearToSRGBTable();
+
+	ParallelFor(DestinationHeight, [&](const int32 Y)
+		{
+			const FTaps& TapY = TapsY[Y];
+			uint8* DestinationRow = Destination + static_cast<int64>(Y) * DestinationWidth * 4;
+
+			for (int32 X = 0; X < DestinationWidth; X++)
+			{
+				const FTaps& TapX = TapsX[X];
+				float Accumulator[4] = { 0, 0, 0, 0 };
+
+				for (int32 RowTap = 0; RowTap < TapY.Num; RowTap++)
+				{
+					const uint8* SourceRow = Source + static_cast<int64>(TapY.Index[RowTap]) * SourceWidth * 4;
+					for (int32 ColumnTap = 0; ColumnTap < TapX.Num; ColumnTap++)
+					{
+						const float Weight = TapY.Weight[RowTap] * TapX.Weight[ColumnTap];
+						const uint8* Pixel = SourceRow + TapX.Index[ColumnTap] * 4;
+						if (sRGB)
+						{
+							Accumulator[0] += SRGBToLinear[Pixel[0]] * Weight;
+							Accumulator[1] += SRGBToLinear[Pixel[1]] * Weight;
+							Accumulator[2] += SRGBToLinear[Pixel[2]] * Weight;
+						}
+						else
+						{
+							Accumulator[0] += Pixel[0] * Weight;
+							Accumulator[1] += Pixel[1] * Weight;
+							Accumulator[2] += Pixel[2] * Weight;
+						}
+						Accumulator[3] += Pixel[3] * Weight;
+					}
+				}
+
+				uint8* DestinationPixel = DestinationRow + X * 4;
+				for (int32 Channel = 0; Channel < 3; Channel++)
+				{
+					if (sRGB)
+					{
+						DestinationPixel[Channel] = LinearToSRGB[FMath::Clamp(FMath::RoundToInt(Accumulator[Channel] * (LinearToSRGBTableSize - 1)), 0, LinearToSRGBTableSize - 1)];
+					}
+					else
+					{
+						DestinationPixel[Channel] = static_cast<uint8>(FMath::Clamp(FMath::RoundToInt(Accumulator[Channel]), 0, 255));
+					}
+				}
+				DestinationPixel[3] = static_cast<uint8>(FMath::Clamp(FMath::RoundToInt(Accumulator[3]), 0, 255));
+			}
+		}, static_cast<int64>(DestinationWidth) * DestinationHeight < MinParallelPixels);
+}
+
+bool FglTFRuntimeMipGenerator::GenerateMips(TArray<FglTFRuntimeMipMap>& Mips, const bool sRGB)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeMipGenerator_GenerateMips, FColor::Magenta);
+
+	if (Mips.Num() == 0)
+	{
+		return false;
+	}
+
+	const FglTFRuntimeMipMap& LastMip = Mips.Last();
+	if (LastMip.PixelFormat != EPixelFormat::PF_B8G8R8A8 || LastMip.Width <= 0 || LastMip.Height <= 0 || LastMip.Pixels.Num() < static_cast<int64>(LastMip.Width) * LastMip.Height * 4)
+	{
+		return false;
+	}
+
+	const int32 TextureIndex = LastMip.TextureIndex;
+	const int32 NumMips = Mips.Num() - 1 + GetNumMips(LastMip.Width, LastMip.Height);
+	Mips.Reserve(NumMips);
+
+	while (Mips.Num() < NumMips)
+	{
+		const FglTFRuntimeMipMap& PreviousMip = Mips.Last();
+		FglTFRuntimeMipMap MipMap(TextureIndex, EPixelFormat::PF_B8G8R8A8, FMath::Max(PreviousMip.Width / 2, 1), FMath::Max(PreviousMip.Height / 2, 1));
+		MipMap.Pixels.AddUninitialized(static_cast<int64>(MipMap.Width) * MipMap.Height * 4);
+
+		Downsample(PreviousMip.Pixels.GetData(), PreviousMip.Width, PreviousMip.Height, MipMap.Pixels.GetData(), MipMap.Width, MipMap.Height, sRGB);
+
+		Mips.Add(MoveTemp(MipMap));
+	}
+
+	return true;
+}
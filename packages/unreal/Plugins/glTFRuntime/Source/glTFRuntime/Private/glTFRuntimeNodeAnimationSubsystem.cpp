@@ -0,0 +1,128 @@
+// Copyright 2020-2024, Roberto De Ioris.
+
+#include "glTFRuntimeNodeAnimationSubsystem.h"
+#include "Async/ParallelFor.h"
+#include "Components/SceneComponent.h"
+#include "GameFramework/Actor.h"
+
+namespace glTFRuntime
+{
+	namespace NodeAnimations
+	{
+		// below this number of animations the batch is evaluated on the game thread
+		constexpr int32 MinParallelInstances = 64;
+	}
+}
+
+void UglTFRuntimeNodeAnimationSubsystem::RegisterNodeAnimations(AActor* Owner, const TMap<USceneComponent*, UglTFRuntimeAnimationCurve*>& NodeAnimations)
+{
+	UnregisterNodeAnimations(Owner);
+
+	for (const TPair<USceneComponent*, UglTFRuntimeAnimationCurve*>& Pair : NodeAnimations)
+	{
+		if (!Pair.Key || !Pair.Value)
+		{
+			continue;
+		}
+
+		if (!Pair.Value->IsBaked())
+		{
+			Pair.Value->Bake();
+		}
+
+		FglTFRuntimeNodeAnimationInstance& Instance = Instances.AddDefaulted_GetRef();
+		Instance.Owner = Owner;
+		Instance.Component = Pair.Key;
+		Instance.Curve = Pair.Value;
+		Instance.BakedCurve = &Pair.Value->GetBakedCurve();
+	}
+}
+
+void UglTFRuntimeNodeAnimationSubsystem::UnregisterNodeAnimations(AActor* Owner)
+{
+	Instances.RemoveAllSwap([Owner](const FglTFRuntimeNodeAnimationInstance& Instance) { return Instance.Owner == Owner; });
+}
+
+void UglTFRuntimeNodeAnimationSubsystem::Tick(float DeltaTime)
+{
+	SCOPED_NAMED_EVENT(UglTFRuntimeNodeAnimationSubsystem_Tick, FColor::Magenta);
+
+	// game thread only work: drop the destroyed actors/components and read the per-actor time dilation
+	for (int32 InstanceIndex = Instances.Num() - 1; InstanceIndex >= 0; InstanceIndex--)
+	{
+		FglTFRuntimeNodeAnimationInstance& Instance = Instances[InstanceIndex];
+		AActor* Owner = Instance.Owner.Get();
+		UglTFRuntimeAnimationCurve* Curve = Instance.Curve.Get();
+		if (!Owner || !Curve || !Instance.Component.IsValid())
+		{
+			Instances.RemoveAtSwap(InstanceIndex);
+			continue;
+		}
+
+		if (!Curve->IsBaked())
+		{
+			Curve->Bake();
+		}
+
+		// node animations advance only while the actor ticks (like when they were evaluated in its Tick)
+		Instance.DeltaTime = Owner->IsActorTickEnabled() ? DeltaTime * Owner->CustomTimeDilation : -1;
+		Instance.bChanged = false;
+	}
+
+	ParallelFor(Instances.Num(), [&](const int32 InstanceIndex)
+		{
+			FglTFRuntimeNodeAnimationInstance& Instance = Instances[InstanceIndex];
+			if (Instance.DeltaTime < 0)
+			{
+				return;
+			}
+
+			const FglTFRuntimeBakedAnimationCurve& BakedCurve = *Instance.BakedCurve;
+
+			if (Instance.Time > BakedCurve.Duration)
+			{
+				Instance.Time = 0;
+			}
+
+			if (Instance.Time >= BakedCurve.MinTime)
+			{
+				const FTransform Transform = BakedCurve.Evaluate(Instance.Time, Instance.Cursor);
+				if (!Instance.bApplied || !Transform.Equals(Instance.Transform, KINDA_SMALL_NUMBER))
+				{
+					Instance.Transform = Transform;
+					Instance.bApplied = true;
+					Instance.bChanged = true;
+				}
+			}
+
+			Instance.Time += Instance.DeltaTime;
+		}, Instances.Num() < glTFRuntime::NodeAnimations::MinParallelInstances);
+
+	for (const FglTFRuntimeNodeAnimationInstance& Instance : Instances)
+	{
+		if (Instance.bChanged)
+		{
+			Instance.Component->SetRelativeTransform(Instance.Transform);
+		}
+	}
+}
+
+TStatId UglTFRuntimeNodeAnimationSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UglTFRuntimeNodeAnimationSubsystem, STATGROUP_Tickables);
+}
+
+ETickableTickType UglTFRuntimeNodeAnimationSubsystem::GetTickableTickType() const
+{
+	return HasAnyFlags(RF_ClassDefaultObject) ? ETickableTickType::Never : ETickableTickType::Conditional;
+}
+
+bool UglTFRuntimeNodeAnimationSubsystem::IsTickable() const
+{
+	return Instances.Num() > 0;
+}
+
+UWorld* UglTFRuntimeNodeAnimationSubsystem::GetTickableGameObjectWorld() const
+{
+	return GetWorld();
+}
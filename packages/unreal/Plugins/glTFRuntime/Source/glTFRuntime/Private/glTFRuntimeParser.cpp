@@ -2,6 +2,7 @@
 
 #include "glTFRuntimeParser.h"
 #include "Async/Async.h"
+#include "Async/ParallelFor.h"
 #include "Runtime/Launch/Resources/Version.h"
 #include "Engine/Texture2D.h"
 #include "GenericPlatform/GenericPlatformHttp.h"
@@ -15,10 +16,11 @@
 #else
 #include "MaterialShared.h"
 #endif
-#include "Misc/Base64.h"
 #include "Misc/Compression.h"
 #include "Misc/Crc.h"
 #include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "Misc/ScopeRWLock.h"
 #include "Interfaces/IPluginManager.h"
 #if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 2
 #include "RenderMath.h"
@@ -27,9 +29,170 @@
 #endif
 
 #include "glTFRuntimeAssetUserData.h"
+#include "glTFRuntimeBase64.h"
+#include "glTFRuntimeCookedMeshCache.h"
+#include "glTFRuntimeDeflate64.h"
+#include "glTFRuntimeGLBStream.h"
+#include "glTFRuntimeLZ4.h"
+#include "glTFRuntimeZstd.h"
 
 DEFINE_LOG_CATEGORY(LogGLTFRuntime);
 
+namespace glTFRuntime
+{
+	// deserialize the json straight from UTF-8 bytes, avoiding the FString (UTF-16) conversion
+	TSharedPtr<FJsonObject> DeserializeUTF8Json(const uint8* DataPtr, int64 DataNum)
+	{
+		if (!DataPtr || DataNum <= 0)
+		{
+			return nullptr;
+		}
+
+		// skip UTF-8 BOM
+		if (DataNum >= 3 && DataPtr[0] == 0xEF && DataPtr[1] == 0xBB && DataPtr[2] == 0xBF)
+		{
+			DataPtr += 3;
+			DataNum -= 3;
+		}
+
+		TSharedPtr<FJsonValue> RootValue;
+#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 2
+		// GLB json chunks are space padded, trailing bytes are harmless
+		TSharedRef<TJsonReader<UTF8CHAR>> JsonReader = TJsonReaderFactory<UTF8CHAR>::CreateFromView(FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(DataPtr), DataNum));
+		if (!FJsonSerializer::Deserialize(JsonReader, RootValue))
+		{
+			return nullptr;
+		}
+#else
+		if (DataNum > INT32_MAX)
+		{
+			return nullptr;
+		}
+		FString JsonData;
+		FFileHelper::BufferToString(JsonData, DataPtr, (int32)DataNum);
+		TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(JsonData);
+		if (!FJsonSerializer::Deserialize(JsonReader, RootValue))
+		{
+			return nullptr;
+		}
+#endif
+
+		if (!RootValue)
+		{
+			return nullptr;
+		}
+
+		return RootValue->AsObject();
+	}
+
+	bool IsUTF16Buffer(const uint8* DataPtr, const int64 DataNum)
+	{
+		return DataNum >= 2 && ((DataPtr[0] == 0xFF && DataPtr[1] == 0xFE) || (DataPtr[0] == 0xFE && DataPtr[1] == 0xFF));
+	}
+
+	bool IsGLB(const uint8* DataPtr, const int64 DataNum)
+	{
+		return DataNum > 20 && DataPtr[0] == 0x67 && DataPtr[1] == 0x6C && DataPtr[2] == 0x54 && DataPtr[3] == 0x46;
+	}
+
+	bool IsZip(const uint8* DataPtr, const int64 DataNum)
+	{
+		return DataNum > 4 && DataPtr[0] == 0x50 && DataPtr[1] == 0x4b && DataPtr[2] == 0x03 && DataPtr[3] == 0x04;
+	}
+
+	namespace Zip
+	{
+		TSharedRef<FglTFRuntimeArchiveZip> MakeArchive(const FglTFRuntimeConfig& LoaderConfig)
+		{
+			TSharedRef<FglTFRuntimeArchiveZip> ZipFile = MakeShared<FglTFRuntimeArchiveZip>();
+			if (!LoaderConfig.EncryptionKey.IsEmpty())
+			{
+				ZipFile->SetPassword(LoaderConfig.EncryptionKey);
+			}
+
+			if (LoaderConfig.PasswordPromptHook.IsBound())
+			{
+				ZipFile->PromptHook = LoaderConfig.PasswordPromptHook;
+			}
+
+			if (LoaderConfig.AESDecrypterHook.IsBound())
+			{
+				ZipFile->AESDecrypterHook = LoaderConfig.AESDecrypterHook;
+			}
+
+			if (LoaderConfig.ZipDecompressorHook.IsBound())
+			{
+				ZipFile->DecompressorHook = LoaderConfig.ZipDecompressorHook;
+			}
+
+			return ZipFile;
+		}
+
+		// zip fields are little endian and not aligned
+		uint16 ReadUInt16(const uint8* DataPtr)
+		{
+			return static_cast<uint16>(DataPtr[0] | (DataPtr[1] << 8));
+		}
+
+		uint32 ReadUInt32(const uint8* DataPtr)
+		{
+			return static_cast<uint32>(DataPtr[0]) | (static_cast<uint32>(DataPtr[1]) << 8) | (static_cast<uint32>(DataPtr[2]) << 16) | (static_cast<uint32>(DataPtr[3]) << 24);
+		}
+
+		constexpr uint16 MethodDeflate64 = 9;
+		constexpr uint16 MethodZstd = 93;
+	}
+
+	// returns the BIN chunk boundaries (if any) and the JSON chunk boundaries of a GLB blob
+	bool FindGLBChunks(const uint8* DataPtr, const int64 DataNum, int64& JsonOffset, int64& JsonSize, int64& BinaryOffset, int64& BinarySize)
+	{
+		bool bJsonFound = false;
+		bool bBinaryFound = false;
+		int64 BlobIndex = 12;
+
+		JsonOffset = 0;
+		JsonSize = 0;
+		BinaryOffset = 0;
+		BinarySize = 0;
+
+		while (BlobIndex < DataNum)
+		{
+			if (BlobIndex + 8 > DataNum)
+			{
+				return false;
+			}
+
+			const uint32 ChunkLength = *reinterpret_cast<const uint32*>(&DataPtr[BlobIndex]);
+			const uint32 ChunkType = *reinterpret_cast<const uint32*>(&DataPtr[BlobIndex + 4]);
+
+			BlobIndex += 8;
+
+			if ((BlobIndex + ChunkLength) > DataNum)
+			{
+				return false;
+			}
+
+			if (ChunkType == 0x4E4F534A && !bJsonFound)
+			{
+				bJsonFound = true;
+				JsonOffset = BlobIndex;
+				JsonSize = ChunkLength;
+			}
+
+			else if (ChunkType == 0x004E4942 && !bBinaryFound)
+			{
+				bBinaryFound = true;
+				BinaryOffset = BlobIndex;
+				BinarySize = ChunkLength;
+			}
+
+			BlobIndex += ChunkLength;
+		}
+
+		return bJsonFound;
+	}
+}
+
 FglTFRuntimeOnPreLoadedPrimitive FglTFRuntimeParser::OnPreLoadedPrimitive;
 FglTFRuntimeOnLoadedPrimitive FglTFRuntimeParser::OnLoadedPrimitive;
 FglTFRuntimeOnLoadedRefSkeleton FglTFRuntimeParser::OnLoadedRefSkeleton;
@@ -79,14 +242,45 @@ TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromFilename(const FString& F
 		}
 	}
 
-	TArray64<uint8> Content;
-	if (!FFileHelper::LoadFileToArray(Content, *TruePath))
+	TSharedPtr<FglTFRuntimeParser> Parser;
+
+	// plain GLB files are mapped instead of being loaded, so only the pages actually read become resident
+	FglTFRuntimeMappedFilePtr MappedFile;
+	if (!LoaderConfig.bAsBlob)
 	{
-		UE_LOG(LogGLTFRuntime, Error, TEXT("Unable to load file %s"), *Filename);
-		return nullptr;
+		MappedFile = FglTFRuntimeMappedFile::Open(TruePath);
+	}
+
+	if (MappedFile && glTFRuntime::IsGLB(MappedFile->GetData(), MappedFile->Num()))
+	{
+		Parser = FromBinary(MappedFile, LoaderConfig);
 	}
+	// zip entries are decompressed straight from the mapping
+	else if (MappedFile && !LoaderConfig.bNoArchive && glTFRuntime::IsZip(MappedFile->GetData(), MappedFile->Num()))
+	{
+		const FString ContentHash = LoaderConfig.bCookedMeshCache ? FglTFRuntimeCookedMeshCache::HashContent(MappedFile->GetData(), MappedFile->Num(), LoaderConfig) : FString();
+		TSharedRef<FglTFRuntimeArchiveZip> ZipFile = glTFRuntime::Zip::MakeArchive(LoaderConfig);
+		if (!ZipFile->FromMappedFile(MappedFile))
+		{
+			UE_LOG(LogGLTFRuntime, Error, TEXT("Unable to parse Zip archive."));
+			return nullptr;
+		}
+		Parser = FromZipArchive(ZipFile, ContentHash, LoaderConfig);
+	}
+	else
+	{
+		// compressed files, archives and json need the whole content anyway
+		MappedFile.Reset();
+
+		TArray64<uint8> Content;
+		if (!FFileHelper::LoadFileToArray(Content, *TruePath))
+		{
+			UE_LOG(LogGLTFRuntime, Error, TEXT("Unable to load file %s"), *Filename);
+			return nullptr;
+		}
 
-	TSharedPtr<FglTFRuntimeParser> Parser = FromData(Content.GetData(), Content.Num(), LoaderConfig);
+		Parser = FromData(MoveTemp(Content), LoaderConfig);
+	}
 
 	if (Parser)
 	{
@@ -172,20 +366,75 @@ TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromRawDataAndArchive(const u
 		}
 	}
 
-	if (DataNum > 0 && DataNum <= INT32_MAX)
+	if (DataNum > 0 && glTFRuntime::IsUTF16Buffer(DataPtr, DataNum))
 	{
+		if (DataNum > INT32_MAX)
+		{
+			return nullptr;
+		}
 		FString JsonData;
 		FFileHelper::BufferToString(JsonData, DataPtr, (int32)DataNum);
 		return FromString(JsonData, LoaderConfig, InArchive);
 	}
 
+	if (DataNum > 0)
+	{
+		return FromUTF8(DataPtr, DataNum, LoaderConfig, InArchive);
+	}
+
 	return nullptr;
 }
 
+TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromData(TArray64<uint8>&& Data, const FglTFRuntimeConfig& LoaderConfig)
+{
+	// only plain GLB blobs can be adopted, everything else (compressed, archives, json, blobs) needs the classic path
+	if (!LoaderConfig.bAsBlob && glTFRuntime::IsGLB(Data.GetData(), Data.Num()))
+	{
+		const FString ContentHash = LoaderConfig.bCookedMeshCache ? FglTFRuntimeCookedMeshCache::HashContent(Data.GetData(), Data.Num(), LoaderConfig) : FString();
+		TSharedPtr<FglTFRuntimeParser> Parser = FromBinary(MoveTemp(Data), LoaderConfig);
+		if (Parser)
+		{
+			Parser->ContentHash = ContentHash;
+		}
+		return Parser;
+	}
+
+	if (!LoaderConfig.bNoArchive && glTFRuntime::IsZip(Data.GetData(), Data.Num()))
+	{
+		const FString ContentHash = LoaderConfig.bCookedMeshCache ? FglTFRuntimeCookedMeshCache::HashContent(Data.GetData(), Data.Num(), LoaderConfig) : FString();
+		TSharedRef<FglTFRuntimeArchiveZip> ZipFile = glTFRuntime::Zip::MakeArchive(LoaderConfig);
+		if (!ZipFile->FromData(MoveTemp(Data)))
+		{
+			UE_LOG(LogGLTFRuntime, Error, TEXT("Unable to parse Zip archive."));
+			return nullptr;
+		}
+		return FromZipArchive(ZipFile, ContentHash, LoaderConfig);
+	}
+
+	return FromData(Data.GetData(), Data.Num(), LoaderConfig);
+}
+
+TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromZipArchive(TSharedRef<FglTFRuntimeArchiveZip> ZipArchive, const FString& ContentHash, const FglTFRuntimeConfig& LoaderConfig)
+{
+	TSharedPtr<FglTFRuntimeParser> Parser = FromRawDataAndArchive(ZipArchive->GetData(), ZipArchive->Num(), ZipArchive, LoaderConfig);
+	if (Parser)
+	{
+		Parser->ContentHash = ContentHash;
+		if (LoaderConfig.bPrefetchArchiveEntries)
+		{
+			Parser->PrefetchArchiveEntries();
+		}
+	}
+	return Parser;
+}
+
 TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromData(const uint8* DataPtr, int64 DataNum, const FglTFRuntimeConfig& LoaderConfig)
 {
 	SCOPED_NAMED_EVENT(FglTFRuntimeParser_FromData, FColor::Magenta);
 
+	// hash the original data, so compressed assets do not need to be decompressed for computing it
+	const FString ContentHash = LoaderConfig.bCookedMeshCache ? FglTFRuntimeCookedMeshCache::HashContent(DataPtr, DataNum, LoaderConfig) : FString();
+
 	// required for Gzip and LZ4;
 	TArray64<uint8> UncompressedData;
 
@@ -270,209 +519,12 @@ TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromData(const uint8* DataPtr
 		DataPtr = UncompressedData.GetData();
 		DataNum = *GzipOriginalSize;
 	}
-	// LZ4 ? magic number(4) + 3 (Note: Unreal includes the classic LZ4 c library, unfortunately it is exposed in a pretty annoying way, so I have reimplemented the decoding process as it is way more fun than messing around with the build system)
-	else if (DataNum > 7 && DataPtr[0] == 0x04 && DataPtr[1] == 0x22 && DataPtr[2] == 0x4D && DataPtr[3] == 0x18)
+	// LZ4 ? magic number(4) + 3
+	else if (FglTFRuntimeLZ4::IsFrame(DataPtr, DataNum))
 	{
-		const uint8* LZ4FLG = DataPtr + 4;
-		const uint8* LZ4BD = DataPtr + 5;
-
-		const bool bLZ4ThreadSafe = ((*LZ4FLG >> 5) & 0x01) == 1;
-		const bool bLZ4BlockHasChecksum = ((*LZ4FLG >> 4) & 0x01) == 1;
-		const bool bLZ4BlockHasContentSize = ((*LZ4FLG >> 3) & 0x01) == 1;
-		const bool bLZ4BlockHasDictID = (*LZ4FLG & 0x01) == 1;
-
-		int64 ReserveBlockSize = 0;
-		if (((*LZ4BD >> 7) & 0x01) == 1)
-		{
-			ReserveBlockSize = 4 * 1024 * 1024;
-		}
-		else if (((*LZ4BD >> 6) & 0x01) == 1)
-		{
-			ReserveBlockSize = 1024 * 1024;
-		}
-		else if (((*LZ4BD >> 5) & 0x01) == 1)
-		{
-			ReserveBlockSize = 256 * 1024;
-		}
-		else if (((*LZ4BD >> 4) & 0x01) == 1)
-		{
-			ReserveBlockSize = 64 * 1024;
-		}
-
-		int64 LZ4Offset = 7 + (bLZ4BlockHasContentSize ? 8 : 0) + (bLZ4BlockHasDictID ? 4 : 0);
-
-		TArray<TPair<const uint8*, int64>> LZ4Blocks;
-
-		while (LZ4Offset < DataNum)
-		{
-			if (LZ4Offset + 4 >= DataNum)
-			{
-				UE_LOG(LogGLTFRuntime, Error, TEXT("Invalid LZ4 Block at index %d."), LZ4Blocks.Num());
-				return nullptr;
-			}
-
-			const uint32* BlockSize = reinterpret_cast<const uint32*>(DataPtr + LZ4Offset);
-
-			const uint32 TrueBlockSize = *BlockSize & 0x7FFFFFFF;
-
-			if (TrueBlockSize == 0)
-			{
-				break;
-			}
-
-			if (LZ4Offset + 4 + TrueBlockSize >= DataNum)
-			{
-				UE_LOG(LogGLTFRuntime, Error, TEXT("Invalid LZ4 Block at index %d."), LZ4Blocks.Num());
-				return nullptr;
-			}
-
-			LZ4Blocks.Add(TPair<const uint8*, int64>(DataPtr + LZ4Offset + 4, *BlockSize));
-
-			LZ4Offset += 4 + TrueBlockSize + (bLZ4BlockHasChecksum ? 4 : 0);
-
-		}
-
-		if (bLZ4BlockHasContentSize)
-		{
-			const uint64* LZ4ContentSize = reinterpret_cast<const uint64*>(DataPtr + 4 + 2);
-			// 64GB seems a pretty reasonable limit...
-			UncompressedData.Reserve(FMath::Min<int64>(*LZ4ContentSize, 64LLU * 1024 * 1024 * 1024));
-		}
-		else
-		{
-			// let's reserve double of the "theoretical" compressed size
-			UncompressedData.Reserve(ReserveBlockSize * LZ4Blocks.Num() * 2);
-		}
-
-		auto LZ4Decompress = [](const uint8* BlockData, const int64 BlockSize, TArray64<uint8>& Output) -> bool
-			{
-				const uint32 TrueBlockSize = BlockSize & 0x7FFFFFFF;
-				// uncompressed block?
-				if (((BlockSize >> 31) & 0x01) == 1)
-				{
-					Output.Append(BlockData, TrueBlockSize);
-					return true;
-				}
-
-				int64 Offset = 0;
-				while (Offset < TrueBlockSize)
-				{
-					const uint8 Token = BlockData[Offset++];
-					int64 Length = Token >> 4;
-
-					if (Length > 0)
-					{
-						int64 TempLength = Length + 240;
-						while (TempLength == 255)
-						{
-							if (Offset + 1 >= TrueBlockSize)
-							{
-								return false;
-							}
-							TempLength = BlockData[Offset++];
-							Length += TempLength;
-						}
-
-						if (Offset + Length > TrueBlockSize)
-						{
-							return false;
-						}
-
-						while (Length > 0)
-						{
-							Output.Add(BlockData[Offset++]);
-							Length--;
-						}
-
-						if (Offset == TrueBlockSize)
-						{
-							return true;
-						}
-					}
-
-					if (Offset + 2 >= TrueBlockSize)
-					{
-						return false;
-					}
-
-					uint16 CopyOffset = static_cast<uint16>(BlockData[Offset++]);
-					CopyOffset |= (static_cast<uint16>(BlockData[Offset++]) << 8);
-
-					if (CopyOffset == 0)
-					{
-						return false;
-					}
-
-					int64 MatchOffset = Output.Num() - CopyOffset;
-					if (MatchOffset < 0)
-					{
-						return false;
-					}
-
-					int64 MatchLength = Token & 0x0F;
-					int64 TempMatchLength = MatchLength + 240;
-					while (TempMatchLength == 255)
-					{
-						if (Offset + 1 > TrueBlockSize)
-						{
-							return false;
-						}
-						TempMatchLength = BlockData[Offset++];
-						MatchLength += TempMatchLength;
-					}
-
-					MatchLength += 4;
-
-					while (MatchLength > 0)
-					{
-						if (!Output.IsValidIndex(MatchOffset))
-						{
-							return false;
-						}
-						const uint8 Byte = Output[MatchOffset++];
-						Output.Add(Byte);
-						MatchLength--;
-					}
-				}
-
-				return true;
-			};
-
-		// can we decompress the blocks in parallel?
-		if (bLZ4ThreadSafe)
+		if (!FglTFRuntimeLZ4::DecompressFrame(DataPtr, DataNum, UncompressedData))
 		{
-			TArray<TPair<TArray64<uint8>, bool>> BlocksStates;
-			BlocksStates.AddDefaulted(LZ4Blocks.Num());
-
-			ParallelFor(LZ4Blocks.Num(), [&](const int32 BlockIndex)
-				{
-					TPair<TArray64<uint8>, bool>& BlockState = BlocksStates[BlockIndex];
-					BlockState.Key.Reserve(ReserveBlockSize);
-					BlockState.Value = LZ4Decompress(LZ4Blocks[BlockIndex].Key, LZ4Blocks[BlockIndex].Value, BlockState.Key);
-				});
-
-			for (int32 BlockIndex = 0; BlockIndex < LZ4Blocks.Num(); BlockIndex++)
-			{
-				const TPair<TArray64<uint8>, bool>& BlockState = BlocksStates[BlockIndex];
-				if (!BlockState.Value)
-				{
-					UE_LOG(LogGLTFRuntime, Error, TEXT("LZ4 parallel decompression error @Block %d"), BlockIndex);
-					return nullptr;
-				}
-
-				UncompressedData.Append(BlockState.Key);
-			}
-		}
-		else
-		{
-			for (int32 BlockIndex = 0; BlockIndex < LZ4Blocks.Num(); BlockIndex++)
-			{
-				if (!LZ4Decompress(LZ4Blocks[BlockIndex].Key, LZ4Blocks[BlockIndex].Value, UncompressedData))
-				{
-					UE_LOG(LogGLTFRuntime, Error, TEXT("LZ4 decompression error @Block %d"), BlockIndex);
-					return nullptr;
-				}
-			}
+			return nullptr;
 		}
 
 		DataPtr = UncompressedData.GetData();
@@ -482,31 +534,19 @@ TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromData(const uint8* DataPtr
 	TSharedPtr<FglTFRuntimeArchive> Archive = nullptr;
 
 	// Zip archive ?
-	if (!LoaderConfig.bNoArchive && DataNum > 4 && DataPtr[0] == 0x50 && DataPtr[1] == 0x4b && DataPtr[2] == 0x03 && DataPtr[3] == 0x04)
+	if (!LoaderConfig.bNoArchive && glTFRuntime::IsZip(DataPtr, DataNum))
 	{
-		TSharedPtr<FglTFRuntimeArchiveZip> ZipFile = MakeShared<FglTFRuntimeArchiveZip>();
-		if (!LoaderConfig.EncryptionKey.IsEmpty())
-		{
-			ZipFile->SetPassword(LoaderConfig.EncryptionKey);
-		}
-
-		if (LoaderConfig.PasswordPromptHook.IsBound())
-		{
-			ZipFile->PromptHook = LoaderConfig.PasswordPromptHook;
-		}
+		TSharedRef<FglTFRuntimeArchiveZip> ZipFile = glTFRuntime::Zip::MakeArchive(LoaderConfig);
 
-		if (LoaderConfig.AESDecrypterHook.IsBound())
-		{
-			ZipFile->AESDecrypterHook = LoaderConfig.AESDecrypterHook;
-		}
-
-		if (!ZipFile->FromData(DataPtr, DataNum))
+		// a decompressed (Gzip/LZ4) zip is adopted, the caller memory is copied (it could be released after loading)
+		const bool bZipParsed = DataPtr == UncompressedData.GetData() ? ZipFile->FromData(MoveTemp(UncompressedData)) : ZipFile->FromData(DataPtr, DataNum);
+		if (!bZipParsed)
 		{
 			UE_LOG(LogGLTFRuntime, Error, TEXT("Unable to parse Zip archive."));
 			return nullptr;
 		}
 
-		Archive = ZipFile;
+		return FromZipArchive(ZipFile, ContentHash, LoaderConfig);
 	}
 	// tar ?
 	else if (!LoaderConfig.bNoArchive && DataNum % 512 == 0 && DataNum >= 10240 && DataPtr[257] == 'u' && DataPtr[258] == 's' && DataPtr[259] == 't' && DataPtr[260] == 'a' && DataPtr[261] == 'r')
@@ -606,7 +646,12 @@ TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromData(const uint8* DataPtr
 		}
 	}
 
-	return FromRawDataAndArchive(DataPtr, DataNum, Archive, LoaderConfig);
+	TSharedPtr<FglTFRuntimeParser> Parser = FromRawDataAndArchive(DataPtr, DataNum, Archive, LoaderConfig);
+	if (Parser)
+	{
+		Parser->ContentHash = ContentHash;
+	}
+	return Parser;
 }
 
 TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromMap(const TMap<FString, TArray64<uint8>> Map, const FglTFRuntimeConfig& LoaderConfig)
@@ -636,7 +681,23 @@ TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromString(const FString& Jso
 	if (!JsonObject)
 		return nullptr;
 
-	TSharedPtr<FglTFRuntimeParser> Parser = MakeShared<FglTFRuntimeParser>(JsonObject.ToSharedRef(), LoaderConfig.GetMatrix(), LoaderConfig.SceneScale);
+	return FromJsonObject(JsonObject.ToSharedRef(), LoaderConfig, InArchive);
+}
+
+TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromUTF8(const uint8* DataPtr, int64 DataNum, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeArchive> InArchive)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_FromUTF8, FColor::Magenta);
+
+	TSharedPtr<FJsonObject> JsonObject = glTFRuntime::DeserializeUTF8Json(DataPtr, DataNum);
+	if (!JsonObject)
+		return nullptr;
+
+	return FromJsonObject(JsonObject.ToSharedRef(), LoaderConfig, InArchive);
+}
+
+TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromJsonObject(TSharedRef<FJsonObject> JsonObject, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeArchive> InArchive)
+{
+	TSharedPtr<FglTFRuntimeParser> Parser = MakeShared<FglTFRuntimeParser>(JsonObject, LoaderConfig.GetMatrix(), LoaderConfig.SceneScale);
 
 	if (Parser)
 	{
@@ -663,57 +724,131 @@ TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromBinary(const uint8* DataP
 {
 	SCOPED_NAMED_EVENT(FglTFRuntimeParser_FromBinary, FColor::Magenta);
 
-	FString JsonData;
-	TArray64<uint8> BinaryBuffer;
+	int64 JsonOffset, JsonSize, BinaryOffset, BinarySize;
+	if (!glTFRuntime::FindGLBChunks(DataPtr, DataNum, JsonOffset, JsonSize, BinaryOffset, BinarySize))
+	{
+		return nullptr;
+	}
 
-	bool bJsonFound = false;
-	bool bBinaryFound = false;
-	int64 BlobIndex = 12;
+	TSharedPtr<FglTFRuntimeParser> Parser = FromUTF8(&DataPtr[JsonOffset], JsonSize, LoaderConfig, InArchive);
 
-	while (BlobIndex < DataNum)
+	if (Parser)
 	{
-		if (BlobIndex + 8 > DataNum)
+		if (BinarySize > 0)
 		{
-			return nullptr;
+			// we do not own the memory, so a single copy is required
+			TArray64<uint8> BinaryBuffer;
+			BinaryBuffer.Append(&DataPtr[BinaryOffset], BinarySize);
+			Parser->SetBinaryBuffer(MoveTemp(BinaryBuffer));
 		}
+	}
 
-		uint32* ChunkLength = (uint32*)&DataPtr[BlobIndex];
-		uint32* ChunkType = (uint32*)&DataPtr[BlobIndex + 4];
+	return Parser;
+}
+
+TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromBinary(FglTFRuntimeMappedFilePtr MappedFile, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeArchive> InArchive)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_FromBinaryMapped, FColor::Magenta);
 
-		BlobIndex += 8;
+	const uint8* DataPtr = MappedFile->GetData();
+	const int64 DataNum = MappedFile->Num();
 
-		if ((BlobIndex + *ChunkLength) > DataNum)
+	int64 JsonOffset, JsonSize, BinaryOffset, BinarySize;
+	if (!glTFRuntime::FindGLBChunks(DataPtr, DataNum, JsonOffset, JsonSize, BinaryOffset, BinarySize))
+	{
+		return nullptr;
+	}
+
+	TSharedPtr<FglTFRuntimeParser> Parser = FromUTF8(&DataPtr[JsonOffset], JsonSize, LoaderConfig, InArchive);
+
+	if (Parser)
+	{
+		if (BinarySize > 0)
 		{
-			return nullptr;
+			Parser->SetBinaryBuffer(MappedFile, BinaryOffset, BinarySize);
 		}
 
-		if (*ChunkType == 0x4E4F534A && !bJsonFound)
+		// note: hashing touches every page of the file
+		if (LoaderConfig.bCookedMeshCache)
 		{
-			bJsonFound = true;
-			FFileHelper::BufferToString(JsonData, &DataPtr[BlobIndex], *ChunkLength);
+			Parser->ContentHash = FglTFRuntimeCookedMeshCache::HashContent(DataPtr, DataNum, LoaderConfig);
 		}
+	}
+
+	return Parser;
+}
 
-		else if (*ChunkType == 0x004E4942 && !bBinaryFound)
+TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromStream(TSharedRef<FglTFRuntimeGLBStream, ESPMode::ThreadSafe> Stream, const FglTFRuntimeConfig& LoaderConfig)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_FromStream, FColor::Magenta);
+
+	int64 JsonOffset, JsonSize;
+	if (!Stream->GetJsonChunk(JsonOffset, JsonSize))
+	{
+		return nullptr;
+	}
+
+	TSharedPtr<FglTFRuntimeParser> Parser = FromUTF8(Stream->GetData() + JsonOffset, JsonSize, LoaderConfig, nullptr);
+
+	if (Parser)
+	{
+		int64 BinaryOffset, BinarySize;
+		if (Stream->GetBinaryChunk(BinaryOffset, BinarySize))
 		{
-			bBinaryFound = true;
-			BinaryBuffer.Append(&DataPtr[BlobIndex], *ChunkLength);
+			Parser->SetBinaryBuffer(Stream, BinaryOffset, BinarySize);
 		}
+	}
+
+	return Parser;
+}
+
+void FglTFRuntimeParser::SetBinaryBuffer(TSharedPtr<FglTFRuntimeGLBStream, ESPMode::ThreadSafe> InStreamingBinaryBuffer, const int64 InOffset, const int64 InSize)
+{
+	BinaryBuffer.Empty();
+	MappedBinaryBuffer.Reset();
+	StreamingBinaryBuffer = InStreamingBinaryBuffer;
+	const int64 StreamSize = StreamingBinaryBuffer ? StreamingBinaryBuffer->GetTotalSize() : 0;
+	BinaryBufferOffset = FMath::Clamp<int64>(InOffset, 0, StreamSize);
+	BinaryBufferSize = FMath::Clamp<int64>(InSize, 0, StreamSize - BinaryBufferOffset);
+}
 
-		BlobIndex += *ChunkLength;
+bool FglTFRuntimeParser::IsStreaming() const
+{
+	return StreamingBinaryBuffer.IsValid() && !StreamingBinaryBuffer->IsFinished();
+}
+
+void FglTFRuntimeParser::AddAsyncTask(FglTFRuntimeTaskPool::FTask&& Task, const EglTFRuntimeAsyncPriority Priority, FglTFRuntimeCancellationTokenPtr CancellationToken)
+{
+	if (!IsStreaming())
+	{
+		FglTFRuntimeTaskPool::Get().AddTask(MoveTemp(Task), Priority, CancellationToken);
+		return;
 	}
 
-	if (!bJsonFound)
+	StreamingBinaryBuffer->WhenReceived(BinaryBufferOffset + BinaryBufferSize, [Task = MoveTemp(Task), Priority, CancellationToken]() mutable
+		{
+			FglTFRuntimeTaskPool::Get().AddTask(MoveTemp(Task), Priority, CancellationToken);
+		});
+}
+
+TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromBinary(TArray64<uint8>&& Data, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeArchive> InArchive)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_FromBinaryOwned, FColor::Magenta);
+
+	int64 JsonOffset, JsonSize, BinaryOffset, BinarySize;
+	if (!glTFRuntime::FindGLBChunks(Data.GetData(), Data.Num(), JsonOffset, JsonSize, BinaryOffset, BinarySize))
 	{
 		return nullptr;
 	}
 
-	TSharedPtr<FglTFRuntimeParser> Parser = FromString(JsonData, LoaderConfig, InArchive);
+	TSharedPtr<FglTFRuntimeParser> Parser = FromUTF8(&Data[JsonOffset], JsonSize, LoaderConfig, InArchive);
 
 	if (Parser)
 	{
-		if (bBinaryFound)
+		if (BinarySize > 0)
 		{
-			Parser->SetBinaryBuffer(BinaryBuffer);
+			// keep the whole blob alive and just point to the BIN chunk
+			Parser->SetBinaryBuffer(MoveTemp(Data), BinaryOffset, BinarySize);
 		}
 	}
 
@@ -872,6 +1007,8 @@ FglTFRuntimeParser::FglTFRuntimeParser(TSharedRef<FJsonObject> JsonObject, const
 	bAllNodesCached = false;
 	DownloadTime = 0;
 
+	BuildRootIndexTables();
+
 	if (IsInGameThread())
 	{
 		LoadAndFillBaseMaterials();
@@ -1079,13 +1216,90 @@ bool FglTFRuntimeParser::CheckJsonIndex(TSharedRef<FJsonObject> JsonObject, cons
 
 TSharedPtr<FJsonObject> FglTFRuntimeParser::GetJsonObjectFromIndex(TSharedRef<FJsonObject> JsonObject, const FString& FieldName, const int32 Index) const
 {
-	TArray<TSharedRef<FJsonValue>> JsonArray;
-	if (!CheckJsonIndex(JsonObject, FieldName, Index, JsonArray))
+	if (Index < 0)
+	{
+		return nullptr;
+	}
+
+	// do not go through CheckJsonIndex() here, it would copy the whole array for a single item
+	const TArray<TSharedPtr<FJsonValue>>* JsonArray;
+	if (!JsonObject->TryGetArrayField(FieldName, JsonArray))
 	{
 		return nullptr;
 	}
 
-	return JsonArray[Index]->AsObject();
+	if (Index >= JsonArray->Num() || !(*JsonArray)[Index])
+	{
+		return nullptr;
+	}
+
+	return (*JsonArray)[Index]->AsObject();
+}
+
+TSharedPtr<FJsonObject> FglTFRuntimeParser::GetJsonObjectFromRootIndex(const FString& FieldName, const int32 Index) const
+{
+	const TArray<TSharedPtr<FJsonObject>>* RootIndexTable = RootIndexTables.Find(FieldName);
+	if (!RootIndexTable)
+	{
+		// not a glTF top-level collection (or missing), use the slow path
+		return GetJsonObjectFromIndex(Root, FieldName, Index);
+	}
+
+	if (!RootIndexTable->IsValidIndex(Index))
+	{
+		return nullptr;
+	}
+
+	return (*RootIndexTable)[Index];
+}
+
+void FglTFRuntimeParser::BuildRootIndexTables()
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_BuildRootIndexTables, FColor::Magenta);
+
+	static const TCHAR* CollectionsNames[] =
+	{
+		TEXT("accessors"),
+		TEXT("animations"),
+		TEXT("buffers"),
+		TEXT("bufferViews"),
+		TEXT("cameras"),
+		TEXT("images"),
+		TEXT("materials"),
+		TEXT("meshes"),
+		TEXT("nodes"),
+		TEXT("samplers"),
+		TEXT("scenes"),
+		TEXT("skins"),
+		TEXT("textures")
+	};
+
+	RootIndexTables.Empty();
+
+	for (const TCHAR* CollectionName : CollectionsNames)
+	{
+		const TArray<TSharedPtr<FJsonValue>>* JsonArray;
+		if (!Root->TryGetArrayField(CollectionName, JsonArray))
+		{
+			continue;
+		}
+
+		TArray<TSharedPtr<FJsonObject>>& RootIndexTable = RootIndexTables.Add(CollectionName);
+		RootIndexTable.Reserve(JsonArray->Num());
+		for (const TSharedPtr<FJsonValue>& JsonItem : *JsonArray)
+		{
+			const TSharedPtr<FJsonObject>* JsonItemObject = nullptr;
+			if (JsonItem && JsonItem->TryGetObject(JsonItemObject))
+			{
+				RootIndexTable.Add(*JsonItemObject);
+			}
+			else
+			{
+				// keep indices aligned with the json array
+				RootIndexTable.Add(nullptr);
+			}
+		}
+	}
 }
 
 TSharedPtr<FJsonObject> FglTFRuntimeParser::GetJsonObjectFromExtensionIndex(TSharedRef<FJsonObject> JsonObject, const FString& ExtensionName, const FString& FieldName, const int32 Index)
@@ -1499,7 +1713,11 @@ bool FglTFRuntimeParser::LoadJointByName(const int64 RootBoneIndex, const FStrin
 void FglTFRuntimeParser::AddError(const FString& ErrorContext, const FString& ErrorMessage)
 {
 	FString FullMessage = ErrorContext + ": " + ErrorMessage;
-	Errors.Add(FullMessage);
+	{
+		// textures are decoded in parallel
+		FScopeLock Lock(&ErrorsLock);
+		Errors.Add(FullMessage);
+	}
 	if (!GIsAutomationTesting)
 	{
 		UE_LOG(LogGLTFRuntime, Error, TEXT("%s"), *FullMessage);
@@ -1926,6 +2144,7 @@ UglTFRuntimeAnimationCurve* FglTFRuntimeParser::LoadNodeAnimationCurve(const int
 			AnimationCurve->glTFCurveAnimationName = Name;
 			AnimationCurve->glTFCurveAnimationDuration = Duration;
 			AnimationCurve->BasisMatrix = SceneBasis;
+			AnimationCurve->Bake();
 			return AnimationCurve;
 		}
 	}
@@ -2025,6 +2244,7 @@ TArray<UglTFRuntimeAnimationCurve*> FglTFRuntimeParser::LoadAllNodeAnimationCurv
 			AnimationCurve->glTFCurveAnimationName = Name;
 			AnimationCurve->glTFCurveAnimationDuration = Duration;
 			AnimationCurve->BasisMatrix = SceneBasis;
+			AnimationCurve->Bake();
 			AnimationCurves.Add(AnimationCurve);
 		}
 	}
@@ -2924,7 +3144,7 @@ bool FglTFRuntimeParser::TraverseJoints(FReferenceSkeletonModifier& Modifier, co
 	return true;
 }
 
-bool FglTFRuntimeParser::LoadPrimitives(TSharedRef<FJsonObject> JsonMeshObject, TArray<FglTFRuntimePrimitive>& Primitives, const FglTFRuntimeMaterialsConfig& MaterialsConfig, const bool bTriangulatePointsAndLines)
+bool FglTFRuntimeParser::LoadPrimitives(TSharedRef<FJsonObject> JsonMeshObject, TArray<FglTFRuntimePrimitive>& Primitives, const FglTFRuntimeMaterialsConfig& MaterialsConfig, const bool bTriangulatePointsAndLines, const bool bCompact, const bool bHighPrecisionTangents)
 {
 	// get primitives
 	const TArray<TSharedPtr<FJsonValue>>* JsonPrimitives;
@@ -2936,27 +3156,39 @@ bool FglTFRuntimeParser::LoadPrimitives(TSharedRef<FJsonObject> JsonMeshObject,
 
 	int32 FirstPrimitive = Primitives.Num();
 
-	for (TSharedPtr<FJsonValue> JsonPrimitive : *JsonPrimitives)
+	// decode the textures of all the primitives in parallel before building their materials
+	const TArray<FglTFRuntimePrefetchedTextureKey> PrefetchedTextures = PrefetchMeshesTextures({ JsonMeshObject }, MaterialsConfig);
+
+	// merging works on the wide streams, so merged primitives are compacted after it
+	const bool bCompactOnLoad = bCompact && !MaterialsConfig.bMergeSectionsByMaterial;
+
+	for (int32 PrimitiveIndex = 0; PrimitiveIndex < JsonPrimitives->Num(); PrimitiveIndex++)
 	{
-		TSharedPtr<FJsonObject> JsonPrimitiveObject = JsonPrimitive->AsObject();
+		TSharedPtr<FJsonObject> JsonPrimitiveObject = (*JsonPrimitives)[PrimitiveIndex]->AsObject();
 		if (!JsonPrimitiveObject)
 		{
+			DiscardPrefetchedTextures(PrefetchedTextures);
 			return false;
 		}
 
 		FglTFRuntimePrimitive Primitive;
-		if (!LoadPrimitive(JsonPrimitiveObject.ToSharedRef(), Primitive, MaterialsConfig, bTriangulatePointsAndLines))
+		Primitive.PrimitiveIndex = PrimitiveIndex;
+		if (!LoadPrimitive(JsonPrimitiveObject.ToSharedRef(), Primitive, MaterialsConfig, bTriangulatePointsAndLines, bCompactOnLoad, bHighPrecisionTangents))
 		{
+			DiscardPrefetchedTextures(PrefetchedTextures);
 			return false;
 		}
 
 		// add the primitive only if it has at least one index 
 		if (Primitive.Indices.Num() > 0)
 		{
-			Primitives.Add(Primitive);
+			Primitives.Add(MoveTemp(Primitive));
 		}
 	}
 
+	// textures not consumed by any material (e.g. failed ones) are not kept around
+	DiscardPrefetchedTextures(PrefetchedTextures);
+
 	const TSharedPtr<FJsonObject>* JsonExtrasObject;
 	if (JsonMeshObject->TryGetObjectField(TEXT("extras"), JsonExtrasObject))
 	{
@@ -2991,6 +3223,13 @@ bool FglTFRuntimeParser::LoadPrimitives(TSharedRef<FJsonObject> JsonMeshObject,
 	if (MaterialsConfig.bMergeSectionsByMaterial)
 	{
 		MergePrimitivesByMaterial(Primitives);
+		if (bCompact)
+		{
+			for (FglTFRuntimePrimitive& Primitive : Primitives)
+			{
+				glTFRuntime::CompactPrimitive(Primitive, bHighPrecisionTangents);
+			}
+		}
 	}
 
 	return true;
@@ -3049,6 +3288,68 @@ FVector4 FglTFRuntimeParser::TransformVector4(const FVector4 Vector) const
 	return SceneBasis.TransformFVector4(Vector);
 }
 
+void FglTFRuntimeParser::DecodeFloatWithBasis(const FglTFRuntimeBlob& Blob, const int64 Stride, const int64 Count, TArray<FVector>& Data, const bool bPosition) const
+{
+	glTFRuntime::Accessors::DecodeFloat3WithBasis(Blob.Data, Stride, Count, Data.GetData(), SceneBasis, SceneScale, bPosition);
+}
+
+void FglTFRuntimeParser::DecodeFloatWithBasis(const FglTFRuntimeBlob& Blob, const int64 Stride, const int64 Count, TArray<FVector4>& Data, const bool bPosition) const
+{
+	glTFRuntime::Accessors::DecodeFloat4WithBasis(Blob.Data, Stride, Count, Data.GetData(), SceneBasis);
+}
+
+#if ENGINE_MAJOR_VERSION > 4
+void FglTFRuntimeParser::DecodeFloatWithBasis(const FglTFRuntimeBlob& Blob, const int64 Stride, const int64 Count, TArray<FVector3f>& Data, const bool bPosition) const
+{
+	glTFRuntime::Accessors::DecodeFloat3WithBasis(Blob.Data, Stride, Count, Data.GetData(), SceneBasis, SceneScale, bPosition);
+}
+
+void FglTFRuntimeParser::DecodeFloatWithBasis(const FglTFRuntimeBlob& Blob, const int64 Stride, const int64 Count, TArray<FVector4f>& Data, const bool bPosition) const
+{
+	glTFRuntime::Accessors::DecodeFloat4WithBasis(Blob.Data, Stride, Count, Data.GetData(), SceneBasis);
+}
+#endif
+
+bool FglTFRuntimeParser::BuildWeightsFromAccessorField(TSharedRef<FJsonObject> JsonObject, const FString& Name, TArray<FglTFRuntimeUInt16Vector4>& Data, const int64 AdditionalBufferView, int64* ComponentTypePtr)
+{
+	static_assert(sizeof(FglTFRuntimeUInt16Vector4) == sizeof(uint16) * 4, "FglTFRuntimeUInt16Vector4 must be tightly packed");
+
+	int64 AccessorIndex;
+	if (!JsonObject->TryGetNumberField(Name, AccessorIndex))
+	{
+		return false;
+	}
+
+	FglTFRuntimeBlob Blob;
+	int64 ComponentType = 0, Stride = 0, Elements = 0, ElementSize = 0, Count = 0;
+	bool bNormalized = true;
+
+	if (!GetAccessor(AccessorIndex, ComponentType, Stride, Elements, ElementSize, Count, bNormalized, Blob, GetAdditionalBufferView(AdditionalBufferView, Name)))
+	{
+		return false;
+	}
+
+	if (Elements != 4)
+	{
+		return false;
+	}
+
+	if (ComponentTypePtr)
+	{
+		*ComponentTypePtr = ComponentType;
+	}
+
+	Data.AddUninitialized(Count);
+	if (!glTFRuntime::Accessors::DecodeWeights16(ComponentType, Blob.Data, Stride, Elements, Count, reinterpret_cast<uint16*>(Data.GetData())))
+	{
+		UE_LOG(LogGLTFRuntime, Error, TEXT("Unsupported type %d"), ComponentType);
+		Data.Reset();
+		return false;
+	}
+
+	return true;
+}
+
 FTransform FglTFRuntimeParser::TransformTransform(const FTransform& Transform) const
 {
 	FTransform NewTransform = FTransform(SceneBasis.Inverse() * Transform.ToMatrixWithScale() * SceneBasis);
@@ -3057,7 +3358,7 @@ FTransform FglTFRuntimeParser::TransformTransform(const FTransform& Transform) c
 	return NewTransform;
 }
 
-bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObject, FglTFRuntimePrimitive& Primitive, const FglTFRuntimeMaterialsConfig& MaterialsConfig, const bool bTriangulatePointsAndLines)
+bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObject, FglTFRuntimePrimitive& Primitive, const FglTFRuntimeMaterialsConfig& MaterialsConfig, const bool bTriangulatePointsAndLines, const bool bCompact, const bool bHighPrecisionTangents)
 {
 	SCOPED_NAMED_EVENT(FglTFRuntimeParser_LoadPrimitive, FColor::Magenta);
 
@@ -3069,6 +3370,7 @@ bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObje
 	{
 		Primitive.Mode = 4; // triangles
 	}
+	Primitive.SourceMode = Primitive.Mode;
 
 	if (Primitive.Mode == 0 && MaterialsConfig.bSkipPoints)
 	{
@@ -3080,6 +3382,10 @@ bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObje
 		return false;
 	}
 
+	// vertex streams are decoded straight into the compact arrays, points and lines are triangulated in the wide form and compacted at the end
+	const bool bDecodeCompact = bCompact && !(bTriangulatePointsAndLines && Primitive.Mode >= 0 && Primitive.Mode <= 3);
+	Primitive.bCompact = bDecodeCompact;
+
 	const TSharedPtr<FJsonObject>* JsonAttributesObject;
 	if (!JsonPrimitiveObject->TryGetObjectField(TEXT("attributes"), JsonAttributesObject))
 	{
@@ -3109,8 +3415,10 @@ bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObje
 		SupportedTexCoordComponentTypes.Append({ 5120, 5122 });
 	}
 
-	if (!BuildFromAccessorField(JsonAttributesObject->ToSharedRef(), "POSITION", Primitive.Positions,
-		{ 3 }, SupportedPositionComponentTypes, [this](FVector Value) -> FVector {return SceneBasis.TransformPosition(Value) * SceneScale; }, Primitive.AdditionalBufferView, false, nullptr))
+	const bool bPositionsLoaded = bDecodeCompact ?
+		BuildFromAccessorFieldWithBasis(JsonAttributesObject->ToSharedRef(), "POSITION", Primitive.CompactPositions, SupportedPositionComponentTypes, true, Primitive.AdditionalBufferView, false) :
+		BuildFromAccessorFieldWithBasis(JsonAttributesObject->ToSharedRef(), "POSITION", Primitive.Positions, SupportedPositionComponentTypes, true, Primitive.AdditionalBufferView, false);
+	if (!bPositionsLoaded)
 	{
 		AddError("LoadPrimitive()", "Unable to load POSITION attribute");
 		return false;
@@ -3118,18 +3426,36 @@ bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObje
 
 	if ((*JsonAttributesObject)->HasField(TEXT("NORMAL")))
 	{
-		if (!BuildFromAccessorField(JsonAttributesObject->ToSharedRef(), "NORMAL", Primitive.Normals,
-			{ 3 }, SupportedNormalComponentTypes, [this](FVector Value) -> FVector { return SceneBasis.TransformVector(Value); }, Primitive.AdditionalBufferView, true, nullptr))
+		const bool bNormalsLoaded = bDecodeCompact ?
+			BuildFromAccessorFieldWithBasis(JsonAttributesObject->ToSharedRef(), "NORMAL", Primitive.CompactNormals, SupportedNormalComponentTypes, false, Primitive.AdditionalBufferView, true) :
+			BuildFromAccessorFieldWithBasis(JsonAttributesObject->ToSharedRef(), "NORMAL", Primitive.Normals, SupportedNormalComponentTypes, false, Primitive.AdditionalBufferView, true);
+		if (!bNormalsLoaded)
+		{
+			AddError("LoadPrimitive()", "Unable to load NORMAL attribute");
+			return false;
+		}
+	}
+
+	if ((*JsonAttributesObject)->HasField(TEXT("TANGENT")))
+	{
+		bool bTangentsLoaded = false;
+		if (bDecodeCompact && !bHighPrecisionTangents)
+		{
+			// single precision is more than enough for the 8 bit packing
+			TArray<FglTFRuntimeVector4f> Tangents;
+			bTangentsLoaded = BuildFromAccessorFieldWithBasis(JsonAttributesObject->ToSharedRef(), "TANGENT", Tangents, SupportedTangentComponentTypes, false, Primitive.AdditionalBufferView, true);
+			Primitive.CompactTangents.AddUninitialized(Tangents.Num());
+			for (int32 Index = 0; Index < Tangents.Num(); Index++)
+			{
+				Primitive.CompactTangents[Index] = FglTFRuntimePackedTangent(FVector4(Tangents[Index]));
+			}
+		}
+		else
 		{
-			AddError("LoadPrimitive()", "Unable to load NORMAL attribute");
-			return false;
+			bTangentsLoaded = BuildFromAccessorFieldWithBasis(JsonAttributesObject->ToSharedRef(), "TANGENT", Primitive.Tangents, SupportedTangentComponentTypes, false, Primitive.AdditionalBufferView, true);
 		}
-	}
 
-	if ((*JsonAttributesObject)->HasField(TEXT("TANGENT")))
-	{
-		if (!BuildFromAccessorField(JsonAttributesObject->ToSharedRef(), "TANGENT", Primitive.Tangents,
-			{ 4 }, SupportedTangentComponentTypes, [this](FVector4 Value) -> FVector4 { return SceneBasis.TransformFVector4(Value); }, Primitive.AdditionalBufferView, true, nullptr))
+		if (!bTangentsLoaded)
 		{
 			AddError("LoadPrimitive()", "Unable to load TANGENT attribute");
 			return false;
@@ -3138,10 +3464,13 @@ bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObje
 
 	if ((*JsonAttributesObject)->HasField(TEXT("TEXCOORD_0")))
 	{
-		TArray<FVector2D> UV;
 		int64 TexCoordComponentType = 0;
-		if (!BuildFromAccessorField(JsonAttributesObject->ToSharedRef(), "TEXCOORD_0", UV,
-			{ 2 }, SupportedTexCoordComponentTypes, [](FVector2D Value) -> FVector2D {return FVector2D(Value.X, Value.Y); }, Primitive.AdditionalBufferView, !bHasMeshQuantization, &TexCoordComponentType))
+		const bool bUVLoaded = bDecodeCompact ?
+			BuildFromAccessorField(JsonAttributesObject->ToSharedRef(), "TEXCOORD_0", Primitive.CompactUVs.AddDefaulted_GetRef(),
+				{ 2 }, SupportedTexCoordComponentTypes, Primitive.AdditionalBufferView, !bHasMeshQuantization, &TexCoordComponentType) :
+			BuildFromAccessorField(JsonAttributesObject->ToSharedRef(), "TEXCOORD_0", Primitive.UVs.AddDefaulted_GetRef(),
+				{ 2 }, SupportedTexCoordComponentTypes, [](FVector2D Value) -> FVector2D {return FVector2D(Value.X, Value.Y); }, Primitive.AdditionalBufferView, !bHasMeshQuantization, &TexCoordComponentType);
+		if (!bUVLoaded)
 		{
 			AddError("LoadPrimitive()", "Error loading TEXCOORD_0");
 			return false;
@@ -3151,16 +3480,17 @@ bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObje
 		{
 			Primitive.bHighPrecisionUVs = true;
 		}
-
-		Primitive.UVs.Add(UV);
 	}
 
 	if ((*JsonAttributesObject)->HasField(TEXT("TEXCOORD_1")))
 	{
-		TArray<FVector2D> UV;
 		int64 TexCoordComponentType = 0;
-		if (!BuildFromAccessorField(JsonAttributesObject->ToSharedRef(), "TEXCOORD_1", UV,
-			{ 2 }, SupportedTexCoordComponentTypes, [](FVector2D Value) -> FVector2D {return FVector2D(Value.X, Value.Y); }, Primitive.AdditionalBufferView, !bHasMeshQuantization, &TexCoordComponentType))
+		const bool bUVLoaded = bDecodeCompact ?
+			BuildFromAccessorField(JsonAttributesObject->ToSharedRef(), "TEXCOORD_1", Primitive.CompactUVs.AddDefaulted_GetRef(),
+				{ 2 }, SupportedTexCoordComponentTypes, Primitive.AdditionalBufferView, !bHasMeshQuantization, &TexCoordComponentType) :
+			BuildFromAccessorField(JsonAttributesObject->ToSharedRef(), "TEXCOORD_1", Primitive.UVs.AddDefaulted_GetRef(),
+				{ 2 }, SupportedTexCoordComponentTypes, [](FVector2D Value) -> FVector2D {return FVector2D(Value.X, Value.Y); }, Primitive.AdditionalBufferView, !bHasMeshQuantization, &TexCoordComponentType);
+		if (!bUVLoaded)
 		{
 			AddError("LoadPrimitive()", "Error loading TEXCOORD_1");
 			return false;
@@ -3170,8 +3500,6 @@ bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObje
 		{
 			Primitive.bHighPrecisionUVs = true;
 		}
-
-		Primitive.UVs.Add(UV);
 	}
 
 	if ((*JsonAttributesObject)->HasField(TEXT("JOINTS_0")))
@@ -3215,10 +3543,12 @@ bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObje
 
 	if ((*JsonAttributesObject)->HasField(TEXT("WEIGHTS_0")))
 	{
-		TArray<FVector4> Weights;
 		int64 WeightsComponentType = 0;
-		if (!BuildFromAccessorField(JsonAttributesObject->ToSharedRef(), "WEIGHTS_0", Weights,
-			{ 4 }, { 5126, 5121, 5123 }, Primitive.AdditionalBufferView, true, &WeightsComponentType))
+		const bool bWeightsLoaded = bDecodeCompact ?
+			BuildWeightsFromAccessorField(JsonAttributesObject->ToSharedRef(), "WEIGHTS_0", Primitive.CompactWeights.AddDefaulted_GetRef(), Primitive.AdditionalBufferView, &WeightsComponentType) :
+			BuildFromAccessorField(JsonAttributesObject->ToSharedRef(), "WEIGHTS_0", Primitive.Weights.AddDefaulted_GetRef(),
+				{ 4 }, { 5126, 5121, 5123 }, Primitive.AdditionalBufferView, true, &WeightsComponentType);
+		if (!bWeightsLoaded)
 		{
 			AddError("LoadPrimitive()", "Error loading WEIGHTS_0");
 			return false;
@@ -3228,16 +3558,16 @@ bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObje
 		{
 			Primitive.bHighPrecisionWeights = true;
 		}
-
-		Primitive.Weights.Add(Weights);
 	}
 
 	if ((*JsonAttributesObject)->HasField(TEXT("WEIGHTS_1")))
 	{
-		TArray<FVector4> Weights;
 		int64 WeightsComponentType = 0;
-		if (!BuildFromAccessorField(JsonAttributesObject->ToSharedRef(), "WEIGHTS_1", Weights,
-			{ 4 }, { 5126, 5121, 5123 }, Primitive.AdditionalBufferView, true, &WeightsComponentType))
+		const bool bWeightsLoaded = bDecodeCompact ?
+			BuildWeightsFromAccessorField(JsonAttributesObject->ToSharedRef(), "WEIGHTS_1", Primitive.CompactWeights.AddDefaulted_GetRef(), Primitive.AdditionalBufferView, &WeightsComponentType) :
+			BuildFromAccessorField(JsonAttributesObject->ToSharedRef(), "WEIGHTS_1", Primitive.Weights.AddDefaulted_GetRef(),
+				{ 4 }, { 5126, 5121, 5123 }, Primitive.AdditionalBufferView, true, &WeightsComponentType);
+		if (!bWeightsLoaded)
 		{
 			AddError("LoadPrimitive()", "Error loading WEIGHTS_1");
 			return false;
@@ -3247,16 +3577,16 @@ bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObje
 		{
 			Primitive.bHighPrecisionWeights = true;
 		}
-
-		Primitive.Weights.Add(Weights);
 	}
 
 	if ((*JsonAttributesObject)->HasField(TEXT("WEIGHTS_2")))
 	{
-		TArray<FVector4> Weights;
 		int64 WeightsComponentType = 0;
-		if (!BuildFromAccessorField(JsonAttributesObject->ToSharedRef(), "WEIGHTS_2", Weights,
-			{ 4 }, { 5126, 5121, 5123 }, Primitive.AdditionalBufferView, true, &WeightsComponentType))
+		const bool bWeightsLoaded = bDecodeCompact ?
+			BuildWeightsFromAccessorField(JsonAttributesObject->ToSharedRef(), "WEIGHTS_2", Primitive.CompactWeights.AddDefaulted_GetRef(), Primitive.AdditionalBufferView, &WeightsComponentType) :
+			BuildFromAccessorField(JsonAttributesObject->ToSharedRef(), "WEIGHTS_2", Primitive.Weights.AddDefaulted_GetRef(),
+				{ 4 }, { 5126, 5121, 5123 }, Primitive.AdditionalBufferView, true, &WeightsComponentType);
+		if (!bWeightsLoaded)
 		{
 			AddError("LoadPrimitive()", "Error loading WEIGHTS_2");
 			return false;
@@ -3266,14 +3596,30 @@ bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObje
 		{
 			Primitive.bHighPrecisionWeights = true;
 		}
-
-		Primitive.Weights.Add(Weights);
 	}
 
 	if ((*JsonAttributesObject)->HasField(TEXT("COLOR_0")))
 	{
-		if (!BuildFromAccessorField(JsonAttributesObject->ToSharedRef(), "COLOR_0", Primitive.Colors,
-			{ 3, 4 }, { 5126, 5121, 5123 }, Primitive.AdditionalBufferView, true, nullptr))
+		bool bColorsLoaded = false;
+		if (bDecodeCompact)
+		{
+			// W defaults to 1 for RGB colors
+			TArray<FglTFRuntimeVector4f> Colors;
+			bColorsLoaded = BuildFromAccessorField(JsonAttributesObject->ToSharedRef(), "COLOR_0", Colors,
+				{ 3, 4 }, { 5126, 5121, 5123 }, Primitive.AdditionalBufferView, true, nullptr);
+			Primitive.CompactColors.AddUninitialized(Colors.Num());
+			for (int32 Index = 0; Index < Colors.Num(); Index++)
+			{
+				Primitive.CompactColors[Index] = FLinearColor(Colors[Index].X, Colors[Index].Y, Colors[Index].Z, Colors[Index].W);
+			}
+		}
+		else
+		{
+			bColorsLoaded = BuildFromAccessorField(JsonAttributesObject->ToSharedRef(), "COLOR_0", Primitive.Colors,
+				{ 3, 4 }, { 5126, 5121, 5123 }, Primitive.AdditionalBufferView, true, nullptr);
+		}
+
+		if (!bColorsLoaded)
 		{
 			AddError("LoadPrimitive()", "Error loading COLOR_0");
 			return false;
@@ -3318,15 +3664,70 @@ bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObje
 
 			bool bValid = false;
 
-			if (JsonTargetObject->HasField(TEXT("POSITION")))
+			// targets defined only by sparse accessors (the common case for blendshapes) are not expanded to the whole primitive
+			const bool bHasPositions = JsonTargetObject->HasField(TEXT("POSITION"));
+			const bool bHasNormals = JsonTargetObject->HasField(TEXT("NORMAL"));
+			TArray<uint32> SparsePositionsIndices;
+			TArray<uint32> SparseNormalsIndices;
+			TArray<FVector> SparsePositions;
+			TArray<FVector> SparseNormals;
+			bool bSparsePositions = false;
+			bool bSparseNormals = false;
+
+			if (bHasPositions && !LoadSparseMorphTargetAttribute(JsonTargetObject.ToSharedRef(), "POSITION", SupportedPositionComponentTypes, true, SparsePositionsIndices, SparsePositions, bSparsePositions))
+			{
+				AddError("LoadPrimitive()", "Unable to load sparse POSITION attribute for MorphTarget");
+				return false;
+			}
+
+			if (bHasNormals && !LoadSparseMorphTargetAttribute(JsonTargetObject.ToSharedRef(), "NORMAL", SupportedNormalComponentTypes, false, SparseNormalsIndices, SparseNormals, bSparseNormals))
+			{
+				AddError("LoadPrimitive()", "Unable to load sparse NORMAL attribute for MorphTarget");
+				return false;
+			}
+
+			const bool bSparse = (bHasPositions || bHasNormals) && bHasPositions == bSparsePositions && bHasNormals == bSparseNormals;
+			if (bSparse)
+			{
+				MorphTarget.bSparse = true;
+				// sparse indices are strictly increasing, so the two sets can be merged linearly
+				int32 PositionIndex = 0;
+				int32 NormalIndex = 0;
+				MorphTarget.Indices.Reserve(FMath::Max(SparsePositionsIndices.Num(), SparseNormalsIndices.Num()));
+				while (PositionIndex < SparsePositionsIndices.Num() || NormalIndex < SparseNormalsIndices.Num())
+				{
+					const uint32 NextPosition = PositionIndex < SparsePositionsIndices.Num() ? SparsePositionsIndices[PositionIndex] : MAX_uint32;
+					const uint32 NextNormal = NormalIndex < SparseNormalsIndices.Num() ? SparseNormalsIndices[NormalIndex] : MAX_uint32;
+					const uint32 VertexIndex = FMath::Min(NextPosition, NextNormal);
+					if (VertexIndex >= static_cast<uint32>(Primitive.GetNumVertices()))
+					{
+						AddError("LoadPrimitive()", "Invalid sparse index for MorphTarget.");
+						return false;
+					}
+
+					MorphTarget.Indices.Add(static_cast<int32>(VertexIndex));
+					if (bHasPositions)
+					{
+						MorphTarget.Positions.Add(NextPosition == VertexIndex ? SparsePositions[PositionIndex++] : FVector::ZeroVector);
+					}
+					if (bHasNormals)
+					{
+						MorphTarget.Normals.Add(NextNormal == VertexIndex ? SparseNormals[NormalIndex++] : FVector::ZeroVector);
+					}
+				}
+
+				// incomplete sparse sections (all zeros) leave an empty sparse target
+				bValid = true;
+			}
+			else if (bHasPositions)
 			{
-				if (!BuildFromAccessorField(JsonTargetObject.ToSharedRef(), "POSITION", MorphTarget.Positions,
-					{ 3 }, SupportedPositionComponentTypes, [&](FVector Value) -> FVector { return SceneBasis.TransformPosition(Value) * SceneScale; }, INDEX_NONE, false, nullptr))
+				if (!BuildFromAccessorFieldWithBasis(JsonTargetObject.ToSharedRef(), "POSITION", MorphTarget.Positions,
+					SupportedPositionComponentTypes, true, INDEX_NONE, false))
 				{
 					AddError("LoadPrimitive()", "Unable to load POSITION attribute for MorphTarget");
 					return false;
 				}
-				if (MorphTarget.Positions.Num() != Primitive.Positions.Num())
+				if (MorphTarget.Positions.Num() != Primitive.GetNumVertices())
 				{
 					AddError("LoadPrimitive()", "Invalid POSITION attribute size for MorphTarget.");
 					return false;
@@ -3334,15 +3735,15 @@ bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObje
 				bValid = true;
 			}
 
-			if (JsonTargetObject->HasField(TEXT("NORMAL")))
+			if (bHasNormals && !bSparse)
 			{
-				if (!BuildFromAccessorField(JsonTargetObject.ToSharedRef(), "NORMAL", MorphTarget.Normals,
-					{ 3 }, SupportedNormalComponentTypes, [&](FVector Value) -> FVector { return SceneBasis.TransformVector(Value); }, INDEX_NONE, true, nullptr))
+				if (!BuildFromAccessorFieldWithBasis(JsonTargetObject.ToSharedRef(), "NORMAL", MorphTarget.Normals,
+					SupportedNormalComponentTypes, false, INDEX_NONE, true))
 				{
 					AddError("LoadPrimitive()", "Unable to load NORMAL attribute for MorphTarget");
 					return false;
 				}
-				if (MorphTarget.Normals.Num() != Primitive.Normals.Num())
+				if (MorphTarget.Normals.Num() != Primitive.GetNumNormals())
 				{
 					AddError("LoadPrimitive()", "Invalid NORMAL attribute size for MorphTarget.");
 					return false;
@@ -3387,39 +3788,22 @@ bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObje
 		}
 
 		Primitive.Indices.AddUninitialized(Count);
-		ParallelFor(Count, [&](const int32 Index)
-			{
-				int64 IndexIndex = Index * Stride;
-
-				uint32 VertexIndex = 0;
-				if (ComponentType == 5121)
-				{
-					VertexIndex = IndicesBytes.Data[IndexIndex];
-				}
-				else if (ComponentType == 5123)
-				{
-					uint16* IndexPtr = (uint16*)&(IndicesBytes.Data[IndexIndex]);
-					VertexIndex = *IndexPtr;
-				}
-				else if (ComponentType == 5125)
-				{
-					uint32* IndexPtr = (uint32*)&(IndicesBytes.Data[IndexIndex]);
-					VertexIndex = *IndexPtr;
-				}
-
-				Primitive.Indices[Index] = VertexIndex;
-			});
+		if (!glTFRuntime::Accessors::DecodeIndices(ComponentType, IndicesBytes.Data, Stride, Count, Primitive.Indices.GetData()))
+		{
+			AddError("LoadPrimitive()", FString::Printf(TEXT("Unable to decode indices accessor: %lld"), IndicesAccessorIndex));
+			return false;
+		}
 
 		// use indices only if their number is higher than positions (this reduces gpu usage on assets reusing the same POSITION buffer)
-		if (Primitive.Positions.Num() < Primitive.Indices.Num())
+		if (Primitive.GetNumVertices() < Primitive.Indices.Num())
 		{
 			Primitive.bHasIndices = true;
 		}
 	}
 	else
 	{
-		Primitive.Indices.AddUninitialized(Primitive.Positions.Num());
-		ParallelFor(Primitive.Positions.Num(), [&](const int32 VertexIndex)
+		Primitive.Indices.AddUninitialized(Primitive.GetNumVertices());
+		ParallelFor(Primitive.GetNumVertices(), [&](const int32 VertexIndex)
 			{
 				Primitive.Indices[VertexIndex] = VertexIndex;
 			});
@@ -3471,65 +3855,200 @@ bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObje
 		ForceBaseMaterial = TriangulatePointsAndLines(Primitive, MaterialsConfig);
 	}
 
+	if (bCompact && !Primitive.bCompact)
+	{
+		glTFRuntime::CompactPrimitive(Primitive, bHighPrecisionTangents);
+	}
+
+	return LoadPrimitiveMaterial(JsonPrimitiveObject, Primitive, MaterialsConfig, ForceBaseMaterial);
+}
+
+bool FglTFRuntimeParser::LoadPrimitiveMaterial(TSharedRef<FJsonObject> JsonPrimitiveObject, FglTFRuntimePrimitive& Primitive, const FglTFRuntimeMaterialsConfig& MaterialsConfig, UMaterialInterface* ForceBaseMaterial)
+{
 	Primitive.Material = UMaterial::GetDefaultMaterial(MD_Surface);
 
 	if (!MaterialsConfig.bSkipLoad)
 	{
-		int64 MaterialIndex = INDEX_NONE;
-		if (!MaterialsConfig.Variant.IsEmpty() && MaterialsVariants.Contains(MaterialsConfig.Variant))
+		const int64 MaterialIndex = GetPrimitiveMaterialIndex(JsonPrimitiveObject, MaterialsConfig);
+
+		if (MaterialIndex != INDEX_NONE)
+		{
+			Primitive.Material = LoadMaterial(MaterialIndex, MaterialsConfig, Primitive.GetNumColors() > 0, Primitive.MaterialName, ForceBaseMaterial);
+			if (!Primitive.Material)
+			{
+				AddError("LoadPrimitiveMaterial()", FString::Printf(TEXT("Unable to load material %lld"), MaterialIndex));
+				return false;
+			}
+			Primitive.MaterialIndex = static_cast<int32>(MaterialIndex);
+			Primitive.bHasMaterial = true;
+		}
+		// special case for primitives without a material but with a color buffer
+		else if (Primitive.GetNumColors() > 0)
+		{
+			Primitive.Material = BuildVertexColorOnlyMaterial(MaterialsConfig, false);
+		}
+	}
+
+	OnLoadedPrimitive.Broadcast(AsShared(), JsonPrimitiveObject, Primitive);
+
+	return true;
+}
+
+int64 FglTFRuntimeParser::GetPrimitiveMaterialIndex(TSharedRef<FJsonObject> JsonPrimitiveObject, const FglTFRuntimeMaterialsConfig& MaterialsConfig)
+{
+	int64 MaterialIndex = INDEX_NONE;
+	if (!MaterialsConfig.Variant.IsEmpty() && MaterialsVariants.Contains(MaterialsConfig.Variant))
+	{
+		int32 WantedIndex = MaterialsVariants.IndexOfByKey(MaterialsConfig.Variant);
+		TArray<TSharedRef<FJsonObject>> VariantsMappings = GetJsonObjectArrayFromExtension(JsonPrimitiveObject, "KHR_materials_variants", "mappings");
+		bool bMappingFound = false;
+		for (TSharedRef<FJsonObject> VariantsMapping : VariantsMappings)
 		{
-			int32 WantedIndex = MaterialsVariants.IndexOfByKey(MaterialsConfig.Variant);
-			TArray<TSharedRef<FJsonObject>> VariantsMappings = GetJsonObjectArrayFromExtension(JsonPrimitiveObject, "KHR_materials_variants", "mappings");
-			bool bMappingFound = false;
-			for (TSharedRef<FJsonObject> VariantsMapping : VariantsMappings)
+			const TArray<TSharedPtr<FJsonValue>>* Variants;
+			if (VariantsMapping->TryGetArrayField(TEXT("variants"), Variants))
 			{
-				const TArray<TSharedPtr<FJsonValue>>* Variants;
-				if (VariantsMapping->TryGetArrayField(TEXT("variants"), Variants))
+				for (TSharedPtr<FJsonValue> Variant : (*Variants))
 				{
-					for (TSharedPtr<FJsonValue> Variant : (*Variants))
+					int64 VariantIndex;
+					if (Variant->TryGetNumber(VariantIndex) && VariantIndex == WantedIndex)
 					{
-						int64 VariantIndex;
-						if (Variant->TryGetNumber(VariantIndex) && VariantIndex == WantedIndex)
-						{
-							MaterialIndex = VariantsMapping->GetNumberField(TEXT("material"));
-							bMappingFound = true;
-							break;
-						}
+						MaterialIndex = VariantsMapping->GetNumberField(TEXT("material"));
+						bMappingFound = true;
+						break;
 					}
 				}
-				if (bMappingFound)
-				{
-					break;
-				}
+			}
+			if (bMappingFound)
+			{
+				break;
 			}
 		}
+	}
 
-		if (MaterialIndex == INDEX_NONE)
+	if (MaterialIndex == INDEX_NONE)
+	{
+		if (!JsonPrimitiveObject->TryGetNumberField(TEXT("material"), MaterialIndex))
 		{
-			if (!JsonPrimitiveObject->TryGetNumberField(TEXT("material"), MaterialIndex))
-			{
-				MaterialIndex = INDEX_NONE;
-			}
+			MaterialIndex = INDEX_NONE;
 		}
+	}
 
-		if (MaterialIndex != INDEX_NONE)
+	return MaterialIndex;
+}
+
+bool FglTFRuntimeParser::LoadSparseMorphTargetAttribute(TSharedRef<FJsonObject> JsonTargetObject, const FString& Name, const TArray<int64>& SupportedTypes, const bool bPosition, TArray<uint32>& Indices, TArray<FVector>& Values, bool& bSparse)
+{
+	bSparse = false;
+
+	int64 AccessorIndex;
+	if (!JsonTargetObject->TryGetNumberField(Name, AccessorIndex))
+	{
+		return false;
+	}
+
+	TSharedPtr<FJsonObject> JsonAccessorObject = GetJsonObjectFromRootIndex("accessors", AccessorIndex);
+	if (!JsonAccessorObject)
+	{
+		return false;
+	}
+
+	// a bufferView means the sparse section is a patch over dense data
+	const TSharedPtr<FJsonObject>* JsonSparseObject = nullptr;
+	if (JsonAccessorObject->HasField(TEXT("bufferView")) || !JsonAccessorObject->TryGetObjectField(TEXT("sparse"), JsonSparseObject))
+	{
+		return true;
+	}
+
+	int64 ComponentType;
+	int64 Count;
+	FString Type;
+	if (!JsonAccessorObject->TryGetNumberField(TEXT("componentType"), ComponentType) ||
+		!JsonAccessorObject->TryGetNumberField(TEXT("count"), Count) ||
+		!JsonAccessorObject->TryGetStringField(TEXT("type"), Type))
+	{
+		return false;
+	}
+
+	if (GetTypeSize(Type) != 3 || !SupportedTypes.Contains(ComponentType))
+	{
+		return false;
+	}
+
+	bool bNormalized = false;
+	JsonAccessorObject->TryGetBoolField(TEXT("normalized"), bNormalized);
+
+	FglTFRuntimeBlob SparseValues;
+	int64 SparseValuesStride = 0;
+	if (!LoadSparseAccessor(JsonSparseObject->ToSharedRef(), GetComponentTypeSize(ComponentType) * 3, Count, Indices, SparseValues, SparseValuesStride))
+	{
+		return false;
+	}
+
+	bSparse = true;
+
+	// an incomplete sparse section means all zeros
+	if (Indices.Num() == 0)
+	{
+		return true;
+	}
+
+	Values.AddUninitialized(Indices.Num());
+
+	if (ComponentType == 5126)
+	{
+		DecodeFloatWithBasis(SparseValues, SparseValuesStride, Indices.Num(), Values, bPosition);
+		return true;
+	}
+
+	auto Filter = [this, bPosition](FVector Value) -> FVector { return TransformWithBasis(Value, bPosition); };
+	if (!glTFRuntime::Accessors::DecodeVectors(ComponentType, SparseValues.Data, SparseValuesStride, 3, bNormalized, Indices.Num(), Values.GetData(), Filter))
+	{
+		UE_LOG(LogGLTFRuntime, Error, TEXT("Unsupported type %d"), ComponentType);
+		Values.Reset();
+		return false;
+	}
+
+	return true;
+}
+
+bool FglTFRuntimeParser::RebindCookedMaterials(const int32 MeshIndex, FglTFRuntimeMeshLOD& LOD, const FglTFRuntimeMaterialsConfig& MaterialsConfig)
+{
+	TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex("meshes", MeshIndex);
+	const TArray<TSharedPtr<FJsonValue>>* JsonPrimitives;
+	if (!JsonMeshObject || !JsonMeshObject->TryGetArrayField(TEXT("primitives"), JsonPrimitives))
+	{
+		return false;
+	}
+
+	for (FglTFRuntimePrimitive& Primitive : LOD.Primitives)
+	{
+		if (!JsonPrimitives->IsValidIndex(Primitive.PrimitiveIndex))
 		{
-			Primitive.Material = LoadMaterial(MaterialIndex, MaterialsConfig, Primitive.Colors.Num() > 0, Primitive.MaterialName, ForceBaseMaterial);
-			if (!Primitive.Material)
-			{
-				AddError("LoadPrimitive()", FString::Printf(TEXT("Unable to load material %lld"), MaterialIndex));
-				return false;
-			}
-			Primitive.bHasMaterial = true;
+			return false;
 		}
-		// special case for primitives without a material but with a color buffer
-		else if (Primitive.Colors.Num() > 0)
+
+		TSharedPtr<FJsonObject> JsonPrimitiveObject = (*JsonPrimitives)[Primitive.PrimitiveIndex]->AsObject();
+		if (!JsonPrimitiveObject)
 		{
-			Primitive.Material = BuildVertexColorOnlyMaterial(MaterialsConfig, false);
+			return false;
 		}
-	}
 
-	OnLoadedPrimitive.Broadcast(AsShared(), JsonPrimitiveObject, Primitive);
+		// the base material TriangulatePointsAndLines() returned when the primitive was cooked
+		UMaterialInterface* ForceBaseMaterial = nullptr;
+		if (Primitive.Mode == 4 && Primitive.SourceMode == 0)
+		{
+			ForceBaseMaterial = MaterialsConfig.PointsBaseMaterial;
+		}
+		else if (Primitive.Mode == 4 && Primitive.SourceMode >= 1 && Primitive.SourceMode <= 3)
+		{
+			ForceBaseMaterial = MaterialsConfig.LinesBaseMaterial;
+		}
+
+		if (!LoadPrimitiveMaterial(JsonPrimitiveObject.ToSharedRef(), Primitive, MaterialsConfig, ForceBaseMaterial))
+		{
+			return false;
+		}
+	}
 
 	return true;
 }
@@ -4442,10 +4961,18 @@ bool FglTFRuntimeParser::GetBuffer(const int32 Index, FglTFRuntimeBlob& Blob)
 		return false;
 	}
 
-	if (Index == 0 && BinaryBuffer.Num() > 0)
+	if (Index == 0 && BinaryBufferSize > 0)
 	{
-		Blob.Data = BinaryBuffer.GetData();
-		Blob.Num = BinaryBuffer.Num();
+		// the blob is never written, so it can point to read only mapped pages (or to a still incomplete stream)
+		if (StreamingBinaryBuffer)
+		{
+			Blob.Data = const_cast<uint8*>(StreamingBinaryBuffer->GetData()) + BinaryBufferOffset;
+		}
+		else
+		{
+			Blob.Data = (MappedBinaryBuffer ? const_cast<uint8*>(MappedBinaryBuffer->GetData()) : BinaryBuffer.GetData()) + BinaryBufferOffset;
+		}
+		Blob.Num = BinaryBufferSize;
 		return true;
 	}
 
@@ -4457,6 +4984,13 @@ bool FglTFRuntimeParser::GetBuffer(const int32 Index, FglTFRuntimeBlob& Blob)
 		return true;
 	}
 
+	if (MappedBuffersCache.Contains(Index))
+	{
+		Blob.Data = const_cast<uint8*>(MappedBuffersCache[Index]->GetData());
+		Blob.Num = MappedBuffersCache[Index]->Num();
+		return true;
+	}
+
 	const TArray<TSharedPtr<FJsonValue>>* JsonBuffers;
 
 	// no buffers ?
@@ -4491,14 +5025,15 @@ bool FglTFRuntimeParser::GetBuffer(const int32 Index, FglTFRuntimeBlob& Blob)
 	// check it is a valid base64 data uri
 	if (Uri.StartsWith("data:"))
 	{
-		TArray64<uint8> Base64Data;
+		// decode directly in the cache
+		TArray64<uint8>& Base64Data = BuffersCache.Add(Index);
 		if (ParseBase64Uri(Uri, Base64Data))
 		{
-			BuffersCache.Add(Index, Base64Data);
-			Blob.Data = BuffersCache[Index].GetData();
-			Blob.Num = BuffersCache[Index].Num();
+			Blob.Data = Base64Data.GetData();
+			Blob.Num = Base64Data.Num();
 			return true;
 		}
+		BuffersCache.Remove(Index);
 		return false;
 	}
 
@@ -4507,7 +5042,7 @@ bool FglTFRuntimeParser::GetBuffer(const int32 Index, FglTFRuntimeBlob& Blob)
 		TArray64<uint8> ArchiveItemData;
 		if (Archive->GetFileContent(Uri, ArchiveItemData))
 		{
-			BuffersCache.Add(Index, ArchiveItemData);
+			BuffersCache.Add(Index, MoveTemp(ArchiveItemData));
 			Blob.Data = BuffersCache[Index].GetData();
 			Blob.Num = BuffersCache[Index].Num();
 			return true;
@@ -4517,10 +5052,21 @@ bool FglTFRuntimeParser::GetBuffer(const int32 Index, FglTFRuntimeBlob& Blob)
 	// fallback
 	if (!BaseDirectory.IsEmpty())
 	{
+		const FString BufferFilename = FPaths::Combine(BaseDirectory, Uri);
+
+		FglTFRuntimeMappedFilePtr MappedFile = FglTFRuntimeMappedFile::Open(BufferFilename);
+		if (MappedFile)
+		{
+			MappedBuffersCache.Add(Index, MappedFile);
+			Blob.Data = const_cast<uint8*>(MappedFile->GetData());
+			Blob.Num = MappedFile->Num();
+			return true;
+		}
+
 		TArray64<uint8> FileData;
-		if (FFileHelper::LoadFileToArray(FileData, *FPaths::Combine(BaseDirectory, Uri)))
+		if (FFileHelper::LoadFileToArray(FileData, *BufferFilename))
 		{
-			BuffersCache.Add(Index, FileData);
+			BuffersCache.Add(Index, MoveTemp(FileData));
 			Blob.Data = BuffersCache[Index].GetData();
 			Blob.Num = BuffersCache[Index].Num();
 			return true;
@@ -4542,14 +5088,7 @@ bool FglTFRuntimeParser::ParseBase64Uri(const FString& Uri, TArray64<uint8>& Byt
 
 	StringIndex += Base64Signature.Len();
 
-	TArray<uint8> BytesBase64;
-
-	bool bSuccess = FBase64::Decode(Uri.Mid(StringIndex), BytesBase64);
-	if (bSuccess)
-	{
-		Bytes.Append(BytesBase64);
-	}
-	return bSuccess;
+	return FglTFRuntimeBase64::Decode(*Uri + StringIndex, Uri.Len() - StringIndex, Bytes);
 }
 
 bool FglTFRuntimeParser::GetBufferView(const int32 Index, FglTFRuntimeBlob& Blob, int64& Stride)
@@ -4607,6 +5146,13 @@ bool FglTFRuntimeParser::GetBufferView(const int32 Index, FglTFRuntimeBlob& Blob
 		return false;
 	}
 
+	// the BIN chunk may still be downloading, wait for the required range
+	if (BufferIndex == 0 && StreamingBinaryBuffer && !StreamingBinaryBuffer->WaitFor(BinaryBufferOffset + ByteOffset + ByteLength))
+	{
+		AddError("GetBufferView()", FString::Printf(TEXT("BufferView %d has not been received (interrupted stream or sync loading from the game thread)"), Index));
+		return false;
+	}
+
 	Blob.Data = BufferBlob.Data + ByteOffset;
 	Blob.Num = ByteLength;
 
@@ -4801,19 +5347,63 @@ bool FglTFRuntimeParser::GetAccessor(const int32 Index, int64& ComponentType, in
 		return true;
 	}
 
+	TArray<uint32> SparseIndices;
+	FglTFRuntimeBlob SparseBytesValues;
+	int64 SparseBufferViewValuesStride;
+	if (!LoadSparseAccessor(JsonSparseObject->ToSharedRef(), ElementSize * Elements, FinalSize, SparseIndices, SparseBytesValues, SparseBufferViewValuesStride))
+	{
+		return false;
+	}
+
+	// incomplete sparse sections are ignored
+	if (SparseIndices.Num() == 0)
+	{
+		return true;
+	}
+
+	const int64 SparseCount = SparseIndices.Num();
+	Stride = SparseBufferViewValuesStride;
+
+	SparseAccessorsCache.Add(Index);
+	SparseAccessorsStridesCache.Add(Index, Stride);
+	TArray64<uint8>& SparseData = SparseAccessorsCache[Index];
+	SparseData.Append(Blob.Data, Blob.Num);
+
+	for (int32 IndexToChange = 0; IndexToChange < SparseCount; IndexToChange++)
+	{
+		uint32 SparseIndexToChange = SparseIndices[IndexToChange];
+		if (SparseIndexToChange >= (Blob.Num / Stride))
+		{
+			return false;
+		}
+
+		uint8* OriginalValuePtr = (uint8*)(SparseData.GetData() + Stride * SparseIndexToChange);
+		uint8* NewValuePtr = (uint8*)(SparseBytesValues.Data + SparseBufferViewValuesStride * IndexToChange);
+		FMemory::Memcpy(OriginalValuePtr, NewValuePtr, SparseBufferViewValuesStride);
+	}
+
+	Blob.Data = SparseData.GetData();
+
+	return true;
+}
+
+bool FglTFRuntimeParser::LoadSparseAccessor(TSharedRef<FJsonObject> JsonSparseObject, const int64 ValueSize, const int64 MaxCount, TArray<uint32>& SparseIndices, FglTFRuntimeBlob& SparseValues, int64& SparseValuesStride)
+{
+	SparseIndices.Reset();
+
 	int64 SparseCount;
-	if (!(*JsonSparseObject)->TryGetNumberField(TEXT("count"), SparseCount))
+	if (!JsonSparseObject->TryGetNumberField(TEXT("count"), SparseCount))
 	{
 		return false;
 	}
 
-	if ((SparseCount > FinalSize) || (SparseCount < 1))
+	if ((SparseCount > MaxCount) || (SparseCount < 1))
 	{
 		return false;
 	}
 
 	const TSharedPtr<FJsonObject>* JsonSparseIndicesObject = nullptr;
-	if (!(*JsonSparseObject)->TryGetObjectField(TEXT("indices"), JsonSparseIndicesObject))
+	if (!JsonSparseObject->TryGetObjectField(TEXT("indices"), JsonSparseIndicesObject))
 	{
 		return true;
 	}
@@ -4854,7 +5444,8 @@ bool FglTFRuntimeParser::GetAccessor(const int32 Index, int64& ComponentType, in
 		return false;
 	}
 
-	TArray<uint32> SparseIndices;
+	TArray<uint32> Indices;
+	Indices.Reserve(SparseCount);
 	uint8* SparseIndicesBase = &SparseBytesIndices.Data[SparseByteOffset];
 
 	for (int32 SparseIndexOffset = 0; SparseIndexOffset < SparseCount; SparseIndexOffset++)
@@ -4862,19 +5453,19 @@ bool FglTFRuntimeParser::GetAccessor(const int32 Index, int64& ComponentType, in
 		// UNSIGNED_BYTE
 		if (SparseComponentType == 5121)
 		{
-			SparseIndices.Add(*SparseIndicesBase);
+			Indices.Add(*SparseIndicesBase);
 		}
 		// UNSIGNED_SHORT
 		else if (SparseComponentType == 5123)
 		{
 			uint16* SparseIndicesBaseUint16 = (uint16*)SparseIndicesBase;
-			SparseIndices.Add(*SparseIndicesBaseUint16);
+			Indices.Add(*SparseIndicesBaseUint16);
 		}
 		// UNSIGNED_INT
 		else if (SparseComponentType == 5125)
 		{
 			uint32* SparseIndicesBaseUint32 = (uint32*)SparseIndicesBase;
-			SparseIndices.Add(*SparseIndicesBaseUint32);
+			Indices.Add(*SparseIndicesBaseUint32);
 		}
 		else
 		{
@@ -4884,7 +5475,7 @@ bool FglTFRuntimeParser::GetAccessor(const int32 Index, int64& ComponentType, in
 	}
 
 	const TSharedPtr<FJsonObject>* JsonSparseValuesObject = nullptr;
-	if (!(*JsonSparseObject)->TryGetObjectField(TEXT("values"), JsonSparseValuesObject))
+	if (!JsonSparseObject->TryGetObjectField(TEXT("values"), JsonSparseValuesObject))
 	{
 		return true;
 	}
@@ -4901,39 +5492,24 @@ bool FglTFRuntimeParser::GetAccessor(const int32 Index, int64& ComponentType, in
 		SparseValueByteOffset = 0;
 	}
 
-	FglTFRuntimeBlob SparseBytesValues;
-	int64 SparseBufferViewValuesStride;
-	if (!GetBufferView(SparseValueBufferViewIndex, SparseBytesValues, SparseBufferViewValuesStride))
+	if (!GetBufferView(SparseValueBufferViewIndex, SparseValues, SparseValuesStride))
 	{
 		return false;
 	}
 
-	if (SparseBufferViewValuesStride == 0)
+	if (SparseValuesStride == 0)
 	{
-		SparseBufferViewValuesStride = ElementSize * Elements;
+		SparseValuesStride = ValueSize;
 	}
 
-	Stride = SparseBufferViewValuesStride;
-
-	SparseAccessorsCache.Add(Index);
-	SparseAccessorsStridesCache.Add(Index, Stride);
-	TArray64<uint8>& SparseData = SparseAccessorsCache[Index];
-	SparseData.Append(Blob.Data, Blob.Num);
-
-	for (int32 IndexToChange = 0; IndexToChange < SparseCount; IndexToChange++)
-	{
-		uint32 SparseIndexToChange = SparseIndices[IndexToChange];
-		if (SparseIndexToChange >= (Blob.Num / Stride))
-		{
-			return false;
-		}
-
-		uint8* OriginalValuePtr = (uint8*)(SparseData.GetData() + Stride * SparseIndexToChange);
-		uint8* NewValuePtr = (uint8*)(SparseBytesValues.Data + SparseBufferViewValuesStride * IndexToChange);
-		FMemory::Memcpy(OriginalValuePtr, NewValuePtr, SparseBufferViewValuesStride);
+	SparseValues.Data += SparseValueByteOffset;
+	SparseValues.Num -= SparseValueByteOffset;
+	if (SparseValues.Num < 0 || ((SparseValues.Num + SparseValuesStride - ValueSize) / SparseValuesStride) < SparseCount)
+	{
+		return false;
 	}
 
-	Blob.Data = SparseData.GetData();
+	SparseIndices = MoveTemp(Indices);
 
 	return true;
 }
@@ -4987,7 +5563,10 @@ void FglTFRuntimeParser::AddReferencedObjects(FReferenceCollector& Collector)
 	Collector.AddReferencedObjects(MaterialsCache);
 	Collector.AddReferencedObjects(SkeletonsCache);
 	Collector.AddReferencedObjects(SkeletalMeshesCache);
-	Collector.AddReferencedObjects(TexturesCache);
+	{
+		FRWScopeLock Lock(TexturesCacheLock, SLT_ReadOnly);
+		Collector.AddReferencedObjects(TexturesCache);
+	}
 	Collector.AddReferencedObjects(MaterialsNameCache);
 	Collector.AddReferencedObjects(MetallicRoughnessMaterialsMap);
 	Collector.AddReferencedObjects(SpecularGlossinessMaterialsMap);
@@ -5002,7 +5581,10 @@ void FglTFRuntimeParser::ClearCache()
 	MaterialsCache.Empty();
 	SkeletonsCache.Empty();
 	SkeletalMeshesCache.Empty();
-	TexturesCache.Empty();
+	{
+		FRWScopeLock Lock(TexturesCacheLock, SLT_Write);
+		TexturesCache.Empty();
+	}
 	MaterialsNameCache.Empty();
 	MetallicRoughnessMaterialsMap.Empty();
 	SpecularGlossinessMaterialsMap.Empty();
@@ -5011,41 +5593,94 @@ void FglTFRuntimeParser::ClearCache()
 	ClearCoatMaterialsMap.Empty();
 }
 
-float FglTFRuntimeParser::FindBestFrames(const TArray<float>& FramesTimes, float WantedTime, int32& FirstIndex, int32& SecondIndex)
+namespace glTFRuntime
 {
-	SecondIndex = INDEX_NONE;
-	// first search for second (higher value)
-	for (int32 i = 0; i < FramesTimes.Num(); i++)
+	namespace Animation
 	{
-		float TimeValue = FramesTimes[i] - FramesTimes[0];
-		if (FMath::IsNearlyEqual(TimeValue, WantedTime))
+		// a key is passed when it comes before WantedTime (exact matches are never passed)
+		FORCEINLINE bool IsKeyPassed(const float TimeValue, const float WantedTime)
 		{
-			FirstIndex = i;
-			SecondIndex = i;
-			return 0;
+			return TimeValue < WantedTime && !FMath::IsNearlyEqual(TimeValue, WantedTime);
 		}
-		else if (TimeValue > WantedTime)
+
+		// Cursor is the first key not passed, it only moves forward (so a sequence of increasing times walks the timeline once)
+		float FindBestFramesFromCursor(const TArray<float>& FramesTimes, const float WantedTime, int32& FirstIndex, int32& SecondIndex, int32& Cursor)
 		{
-			SecondIndex = i;
-			break;
+			const float BaseTime = FramesTimes[0];
+			while (Cursor < FramesTimes.Num() && IsKeyPassed(FramesTimes[Cursor] - BaseTime, WantedTime))
+			{
+				Cursor++;
+			}
+
+			// not found ? use the last value
+			SecondIndex = FMath::Min(Cursor, FramesTimes.Num() - 1);
+			if (Cursor < FramesTimes.Num() && FMath::IsNearlyEqual(FramesTimes[Cursor] - BaseTime, WantedTime))
+			{
+				FirstIndex = SecondIndex;
+				return 0;
+			}
+
+			if (SecondIndex == 0)
+			{
+				FirstIndex = 0;
+				return 1.f;
+			}
+
+			FirstIndex = SecondIndex - 1;
+
+			return ((WantedTime + BaseTime) - FramesTimes[FirstIndex]) / (FramesTimes[SecondIndex] - FramesTimes[FirstIndex]);
 		}
 	}
+}
 
-	// not found ? use the last value
-	if (SecondIndex == INDEX_NONE)
+float FglTFRuntimeParser::FindBestFrames(const TArray<float>& FramesTimes, float WantedTime, int32& FirstIndex, int32& SecondIndex)
+{
+	if (FramesTimes.Num() == 0)
 	{
-		SecondIndex = FramesTimes.Num() - 1;
+		FirstIndex = INDEX_NONE;
+		SecondIndex = INDEX_NONE;
+		return 0;
 	}
 
-	if (SecondIndex == 0)
+	// binary search for the first key not passed
+	const float BaseTime = FramesTimes[0];
+	int32 Cursor = 0;
+	int32 Size = FramesTimes.Num();
+	while (Size > 0)
 	{
-		FirstIndex = 0;
-		return 1.f;
+		const int32 Half = Size / 2;
+		if (glTFRuntime::Animation::IsKeyPassed(FramesTimes[Cursor + Half] - BaseTime, WantedTime))
+		{
+			Cursor += Half + 1;
+			Size -= Half + 1;
+		}
+		else
+		{
+			Size = Half;
+		}
 	}
 
-	FirstIndex = SecondIndex - 1;
+	return glTFRuntime::Animation::FindBestFramesFromCursor(FramesTimes, WantedTime, FirstIndex, SecondIndex, Cursor);
+}
+
+void FglTFRuntimeParser::SampleTimeline(const TArray<float>& FramesTimes, const int32 NumFrames, const float FrameDelta, TArray<FglTFRuntimeAnimationFrameSample>& Samples)
+{
+	Samples.SetNumUninitialized(FMath::Max(NumFrames, 0));
+	if (FramesTimes.Num() == 0)
+	{
+		for (FglTFRuntimeAnimationFrameSample& Sample : Samples)
+		{
+			Sample = { INDEX_NONE, INDEX_NONE, 0 };
+		}
+		return;
+	}
 
-	return ((WantedTime + FramesTimes[0]) - FramesTimes[FirstIndex]) / (FramesTimes[SecondIndex] - FramesTimes[FirstIndex]);
+	int32 Cursor = 0;
+	for (int32 FrameIndex = 0; FrameIndex < Samples.Num(); FrameIndex++)
+	{
+		FglTFRuntimeAnimationFrameSample& Sample = Samples[FrameIndex];
+		Sample.Alpha = glTFRuntime::Animation::FindBestFramesFromCursor(FramesTimes, FrameDelta * FrameIndex, Sample.FirstIndex, Sample.SecondIndex, Cursor);
+	}
 }
 
 bool FglTFRuntimeParser::MergePrimitives(TArray<FglTFRuntimePrimitive> SourcePrimitives, FglTFRuntimePrimitive& OutPrimitive)
@@ -5142,8 +5777,57 @@ bool FglTFRuntimeParser::MergePrimitives(TArray<FglTFRuntimePrimitive> SourcePri
 
 			for (int32 MorphTargetsIndex = 0; MorphTargetsIndex < OutPrimitive.MorphTargets.Num(); MorphTargetsIndex++)
 			{
-				OutPrimitive.MorphTargets[MorphTargetsIndex].Positions.Append(SourcePrimitive.MorphTargets[MorphTargetsIndex].Positions);
-				OutPrimitive.MorphTargets[MorphTargetsIndex].Normals.Append(SourcePrimitive.MorphTargets[MorphTargetsIndex].Normals);
+				FglTFRuntimeMorphTarget& OutMorphTarget = OutPrimitive.MorphTargets[MorphTargetsIndex];
+				const FglTFRuntimeMorphTarget& SourceMorphTarget = SourcePrimitive.MorphTargets[MorphTargetsIndex];
+				if (!OutMorphTarget.IsSparse() && !SourceMorphTarget.IsSparse())
+				{
+					// a dense target can miss one of the attributes, pad them to keep the deltas aligned with the merged vertices
+					if (OutMorphTarget.Positions.Num() > 0 || SourceMorphTarget.Positions.Num() > 0)
+					{
+						OutMorphTarget.Positions.SetNumZeroed(BaseIndex);
+						OutMorphTarget.Positions.Append(SourceMorphTarget.Positions);
+						OutMorphTarget.Positions.SetNumZeroed(BaseIndex + SourcePrimitive.Positions.Num());
+					}
+					if (OutMorphTarget.Normals.Num() > 0 || SourceMorphTarget.Normals.Num() > 0)
+					{
+						OutMorphTarget.Normals.SetNumZeroed(OutPrimitive.Normals.Num());
+						OutMorphTarget.Normals.Append(SourceMorphTarget.Normals);
+						OutMorphTarget.Normals.SetNumZeroed(OutPrimitive.Normals.Num() + SourcePrimitive.Normals.Num());
+					}
+					continue;
+				}
+
+				// mixed dense/sparse targets are merged as sparse ones
+				auto AppendAsSparse = [&OutMorphTarget](const FglTFRuntimeMorphTarget& MorphTarget, const int32 VertexBase, const int32 NumVertices)
+					{
+						const int32 NumDeltas = MorphTarget.IsSparse() ? MorphTarget.Indices.Num() : NumVertices;
+						for (int32 DeltaIndex = 0; DeltaIndex < NumDeltas; DeltaIndex++)
+						{
+							OutMorphTarget.Indices.Add(VertexBase + (MorphTarget.IsSparse() ? MorphTarget.Indices[DeltaIndex] : DeltaIndex));
+							OutMorphTarget.Positions.Add(MorphTarget.Positions.IsValidIndex(DeltaIndex) ? MorphTarget.Positions[DeltaIndex] : FVector::ZeroVector);
+							OutMorphTarget.Normals.Add(MorphTarget.Normals.IsValidIndex(DeltaIndex) ? MorphTarget.Normals[DeltaIndex] : FVector::ZeroVector);
+						}
+					};
+
+				if (!OutMorphTarget.IsSparse())
+				{
+					const FglTFRuntimeMorphTarget DenseMorphTarget = MoveTemp(OutMorphTarget);
+					OutMorphTarget = FglTFRuntimeMorphTarget();
+					OutMorphTarget.Name = DenseMorphTarget.Name;
+					OutMorphTarget.bSparse = true;
+					AppendAsSparse(DenseMorphTarget, 0, BaseIndex);
+				}
+				else if (OutMorphTarget.Normals.Num() != OutMorphTarget.Indices.Num())
+				{
+					OutMorphTarget.Normals.SetNumZeroed(OutMorphTarget.Indices.Num());
+				}
+
+				if (OutMorphTarget.Positions.Num() != OutMorphTarget.Indices.Num())
+				{
+					OutMorphTarget.Positions.SetNumZeroed(OutMorphTarget.Indices.Num());
+				}
+
+				AppendAsSparse(SourceMorphTarget, BaseIndex, SourcePrimitive.Positions.Num());
 			}
 		}
 
@@ -5282,90 +5966,96 @@ void FglTFRuntimeArchiveZip::SetPassword(const FString& EncryptionKey)
 
 bool FglTFRuntimeArchiveZip::FromData(const uint8* DataPtr, const int64 DataNum)
 {
-	Data.Append(DataPtr, DataNum);
+	OwnedData.Append(DataPtr, DataNum);
+	ArchiveData = OwnedData.GetData();
+	ArchiveDataNum = OwnedData.Num();
+
+	return ParseCentralDirectory();
+}
+
+bool FglTFRuntimeArchiveZip::FromData(TArray64<uint8>&& InData)
+{
+	OwnedData = MoveTemp(InData);
+	ArchiveData = OwnedData.GetData();
+	ArchiveDataNum = OwnedData.Num();
+
+	return ParseCentralDirectory();
+}
 
-	// step0: retrieve the trailer magic
-	TArray<uint8> Magic;
-	bool bIndexFound = false;
-	uint64 Index = 0;
-	for (Index = Data.Num() - 1; Index >= 0; Index--)
+bool FglTFRuntimeArchiveZip::FromMappedFile(FglTFRuntimeMappedFilePtr InMappedFile)
+{
+	if (!InMappedFile)
 	{
-		Magic.Insert(Data[Index], 0);
-		if (Magic.Num() == 4)
-		{
-			if (Magic[0] == 0x50 && Magic[1] == 0x4b && Magic[2] == 0x05 && Magic[3] == 0x06)
-			{
-				bIndexFound = true;
-				break;
-			}
-			Magic.Pop();
-		}
+		return false;
 	}
 
-	if (!bIndexFound)
+	MappedFile = InMappedFile;
+	ArchiveData = MappedFile->GetData();
+	ArchiveDataNum = MappedFile->Num();
+
+	return ParseCentralDirectory();
+}
+
+bool FglTFRuntimeArchiveZip::ParseCentralDirectory()
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeArchiveZip_ParseCentralDirectory, FColor::Magenta);
+
+	constexpr int64 TrailerMinSize = 22;
+	constexpr int64 CentralDirectoryMinSize = 46;
+
+	if (ArchiveDataNum < TrailerMinSize)
 	{
 		return false;
 	}
 
-	uint16 DiskEntries = 0;
-	uint16 TotalEntries = 0;
-	uint32 CentralDirectorySize = 0;
-	uint32 CentralDirectoryOffset = 0;
-	uint16 CommentLen = 0;
-
-	constexpr uint64 TrailerMinSize = 22;
-	constexpr uint64 CentralDirectoryMinSize = 46;
+	// step0: retrieve the trailer magic, the trailer can only be followed by its comment (max 64k)
+	const int64 LowestIndex = FMath::Max<int64>(0, ArchiveDataNum - TrailerMinSize - 0xFFFF);
+	int64 Index = ArchiveDataNum - TrailerMinSize;
+	for (; Index >= LowestIndex; Index--)
+	{
+		if (ArchiveData[Index] == 0x50 && ArchiveData[Index + 1] == 0x4b && ArchiveData[Index + 2] == 0x05 && ArchiveData[Index + 3] == 0x06)
+		{
+			break;
+		}
+	}
 
-	if (Index + TrailerMinSize > Data.Num())
+	if (Index < LowestIndex)
 	{
 		return false;
 	}
 
 	// skip signature and disk data
-	Data.Seek(Index + 8);
-	Data << DiskEntries;
-	Data << TotalEntries;
-	Data << CentralDirectorySize;
-	Data << CentralDirectoryOffset;
-	Data << CommentLen;
+	const uint16 DiskEntries = glTFRuntime::Zip::ReadUInt16(ArchiveData + Index + 8);
+	const uint16 TotalEntries = glTFRuntime::Zip::ReadUInt16(ArchiveData + Index + 10);
+	int64 CentralDirectoryOffset = glTFRuntime::Zip::ReadUInt32(ArchiveData + Index + 16);
 
-	uint16 DirectoryEntries = FMath::Min(DiskEntries, TotalEntries);
+	const uint16 DirectoryEntries = FMath::Min(DiskEntries, TotalEntries);
+
+	OffsetsMap.Reserve(DirectoryEntries);
+	GlobalSizeMap.Reserve(DirectoryEntries);
 
 	for (uint16 DirectoryIndex = 0; DirectoryIndex < DirectoryEntries; DirectoryIndex++)
 	{
-		if (CentralDirectoryOffset + CentralDirectoryMinSize > Data.Num())
+		if (CentralDirectoryOffset + CentralDirectoryMinSize > ArchiveDataNum)
 		{
 			return false;
 		}
 
-		uint32 GlobalCompressedSize = 0;
-		uint32 GlobalUncompressedSize = 0;
-		uint16 FilenameLen = 0;
-		uint16 ExtraFieldLen = 0;
-		uint16 EntryCommentLen = 0;
-		uint32 EntryOffset = 0;
-
-		// seek to CompressedSize
-		Data.Seek(CentralDirectoryOffset + 20);
-		Data << GlobalCompressedSize;
-		Data << GlobalUncompressedSize;
+		const uint8* Entry = ArchiveData + CentralDirectoryOffset;
+		const uint32 GlobalCompressedSize = glTFRuntime::Zip::ReadUInt32(Entry + 20);
+		const uint32 GlobalUncompressedSize = glTFRuntime::Zip::ReadUInt32(Entry + 24);
+		const uint16 FilenameLen = glTFRuntime::Zip::ReadUInt16(Entry + 28);
+		const uint16 ExtraFieldLen = glTFRuntime::Zip::ReadUInt16(Entry + 30);
+		const uint16 EntryCommentLen = glTFRuntime::Zip::ReadUInt16(Entry + 32);
+		const uint32 EntryOffset = glTFRuntime::Zip::ReadUInt32(Entry + 42);
 
-		// seek to FilenameLen
-		Data.Seek(CentralDirectoryOffset + 28);
-		Data << FilenameLen;
-		Data << ExtraFieldLen;
-		Data << EntryCommentLen;
-		// seek to EntryOffset
-		Data.Seek(CentralDirectoryOffset + 42);
-		Data << EntryOffset;
-
-		if (CentralDirectoryOffset + CentralDirectoryMinSize + FilenameLen + ExtraFieldLen + EntryCommentLen > Data.Num())
+		if (CentralDirectoryOffset + CentralDirectoryMinSize + FilenameLen + ExtraFieldLen + EntryCommentLen > ArchiveDataNum)
 		{
 			return false;
 		}
 
-		TArray64<uint8> FilenameBytes;
-		FilenameBytes.Append(Data.GetData() + CentralDirectoryOffset + CentralDirectoryMinSize, FilenameLen);
+		TArray<uint8> FilenameBytes;
+		FilenameBytes.Append(Entry + CentralDirectoryMinSize, FilenameLen);
 		FilenameBytes.Add(0);
 
 		FString Filename = FString(UTF8_TO_TCHAR(FilenameBytes.GetData()));
@@ -5379,45 +6069,117 @@ bool FglTFRuntimeArchiveZip::FromData(const uint8* DataPtr, const int64 DataNum)
 	return true;
 }
 
+int32 FglTFRuntimeArchiveZip::PrefetchFiles(const TArray<FString>& Filenames)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeArchiveZip_PrefetchFiles, FColor::Magenta);
+
+	constexpr int64 LocalEntryMinSize = 30;
+
+	TArray<FString> FilesToPrefetch;
+	{
+		FScopeLock Lock(&PrefetchedFilesLock);
+		for (const FString& Filename : Filenames)
+		{
+			const uint32* Offset = OffsetsMap.Find(Filename);
+			if (!Offset || *Offset + LocalEntryMinSize > ArchiveDataNum || FilesToPrefetch.Contains(Filename) || PrefetchedFiles.Contains(Filename))
+			{
+				continue;
+			}
+
+			// encrypted ?
+			if (glTFRuntime::Zip::ReadUInt16(ArchiveData + *Offset + 6) & 1)
+			{
+				continue;
+			}
+
+			FilesToPrefetch.Add(Filename);
+		}
+	}
+
+	TArray<TArray64<uint8>> Contents;
+	Contents.AddDefaulted(FilesToPrefetch.Num());
+	TArray<bool> Results;
+	Results.AddZeroed(FilesToPrefetch.Num());
+
+	ParallelFor(FilesToPrefetch.Num(), [&](const int32 Index)
+		{
+			Results[Index] = GetFileContent(FilesToPrefetch[Index], Contents[Index]);
+		});
+
+	int32 NumPrefetchedFiles = 0;
+
+	FScopeLock Lock(&PrefetchedFilesLock);
+	for (int32 Index = 0; Index < FilesToPrefetch.Num(); Index++)
+	{
+		// failed entries are decoded again (with errors reporting) by GetFileContent()
+		if (Results[Index])
+		{
+			PrefetchedFiles.Add(FilesToPrefetch[Index], MoveTemp(Contents[Index]));
+			NumPrefetchedFiles++;
+		}
+	}
+
+	return NumPrefetchedFiles;
+}
+
+bool FglTFRuntimeArchiveZip::DecompressEntry(const uint16 Compression, const uint8* CompressedData, const int64 CompressedSize, uint8* UncompressedData, const int64 UncompressedSize) const
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeArchiveZip_DecompressEntry, FColor::Magenta);
+
+	if (DecompressorHook.IsBound())
+	{
+		return DecompressorHook.NativeDecompressor.Execute(Compression, CompressedData, CompressedSize, UncompressedData, UncompressedSize);
+	}
+
+	if (Compression == glTFRuntime::Zip::MethodZstd)
+	{
+		return FglTFRuntimeZstd::Decompress(CompressedData, CompressedSize, UncompressedData, UncompressedSize);
+	}
+
+	return FglTFRuntimeDeflate64::Inflate(CompressedData, CompressedSize, UncompressedData, UncompressedSize);
+}
+
 bool FglTFRuntimeArchiveZip::GetFileContent(const FString& Filename, TArray64<uint8>& OutData)
 {
-	uint32* Offset = OffsetsMap.Find(Filename);
+	{
+		FScopeLock Lock(&PrefetchedFilesLock);
+		TArray64<uint8>* PrefetchedData = PrefetchedFiles.Find(Filename);
+		if (PrefetchedData)
+		{
+			OutData = MoveTemp(*PrefetchedData);
+			PrefetchedFiles.Remove(Filename);
+			return true;
+		}
+	}
+
+	const uint32* Offset = OffsetsMap.Find(Filename);
 	if (!Offset)
 	{
 		return false;
 	}
 
-	constexpr uint64 LocalEntryMinSize = 30;
+	constexpr int64 LocalEntryMinSize = 30;
 
-	if (*Offset + LocalEntryMinSize > Data.Num())
+	if (*Offset + LocalEntryMinSize > ArchiveDataNum)
 	{
 		return false;
 	}
 
-	uint16 Flags = 0;
-	uint16 Compression = 0;
-	uint32 CompressedSize;
-	uint32 UncompressedSize = 0;
-	uint16 FilenameLen = 0;
-	uint16 ExtraFieldLen = 0;
+	// the local header is read in place (no shared reader position), so non encrypted entries can be decoded concurrently
+	const uint8* LocalEntry = ArchiveData + *Offset;
+	const uint16 Flags = glTFRuntime::Zip::ReadUInt16(LocalEntry + 6);
+	uint16 Compression = glTFRuntime::Zip::ReadUInt16(LocalEntry + 8);
+	uint32 CompressedSize = glTFRuntime::Zip::ReadUInt32(LocalEntry + 18);
+	uint32 UncompressedSize = glTFRuntime::Zip::ReadUInt32(LocalEntry + 22);
+	const uint16 FilenameLen = glTFRuntime::Zip::ReadUInt16(LocalEntry + 26);
+	const uint16 ExtraFieldLen = glTFRuntime::Zip::ReadUInt16(LocalEntry + 28);
 
-	// seek to Compression
-	Data.Seek(*Offset + 6);
-	Data << Flags;
-	Data << Compression;
-	// seek to CompressedSize
-	Data.Seek(*Offset + 18);
-	Data << CompressedSize;
-	Data << UncompressedSize;
-	Data << FilenameLen;
-	Data << ExtraFieldLen;
-
-	if (*Offset + LocalEntryMinSize + FilenameLen + ExtraFieldLen + CompressedSize > Data.Num())
+	if (*Offset + LocalEntryMinSize + FilenameLen + ExtraFieldLen + CompressedSize > ArchiveDataNum)
 	{
 		return false;
 	}
 
-	const uint8* CompressedData = Data.GetData() + *Offset + LocalEntryMinSize + FilenameLen + ExtraFieldLen;
+	const uint8* CompressedData = LocalEntry + LocalEntryMinSize + FilenameLen + ExtraFieldLen;
 
 	// for streamed zips
 
@@ -5485,7 +6247,7 @@ bool FglTFRuntimeArchiveZip::GetFileContent(const FString& Filename, TArray64<ui
 
 			// TODO, probably I should generalize it to allow custom fields to be managed by the user
 			TArray64<uint8> ExtraField;
-			ExtraField.Append(Data.GetData() + *Offset + LocalEntryMinSize + FilenameLen, ExtraFieldLen);
+			ExtraField.Append(LocalEntry + LocalEntryMinSize + FilenameLen, ExtraFieldLen);
 			uint32 ExtraFieldsOffset = 0;
 			// 0 is not a valid AES strength so it acts as a marker
 			uint8 AESEncryptionStrength = 0;
@@ -5564,7 +6326,7 @@ bool FglTFRuntimeArchiveZip::GetFileContent(const FString& Filename, TArray64<ui
 		}
 		else // ZipCrypto?
 		{
-			if (*Offset + LocalEntryMinSize + FilenameLen + ExtraFieldLen + CompressedSize + 12 > Data.Num())
+			if (*Offset + LocalEntryMinSize + FilenameLen + ExtraFieldLen + CompressedSize + 12 > ArchiveDataNum)
 			{
 				return false;
 			}
@@ -5621,6 +6383,15 @@ bool FglTFRuntimeArchiveZip::GetFileContent(const FString& Filename, TArray64<ui
 	{
 		OutData.Append(CompressedData, UncompressedSize);
 	}
+	else if (Compression == glTFRuntime::Zip::MethodZstd || Compression == glTFRuntime::Zip::MethodDeflate64)
+	{
+		OutData.AddUninitialized(UncompressedSize);
+		if (!DecompressEntry(Compression, CompressedData, CompressedSize, OutData.GetData(), UncompressedSize))
+		{
+			UE_LOG(LogGLTFRuntime, Error, TEXT("Unable to decompress %s (ZIP Compression method %u)"), *Filename, Compression);
+			return false;
+		}
+	}
 	else
 	{
 		UE_LOG(LogGLTFRuntime, Error, TEXT("Unknown ZIP Compression format"));
@@ -5733,6 +6504,185 @@ FVector glTFRuntime::ComputeTangentYWithW(const FVector Normal, const FVector Ta
 	return (Normal ^ TangetX) * W;
 }
 
+namespace glTFRuntime
+{
+	// bytes saved by the compact streams compared to the wide (double precision) layout
+	int64 GetCompactBytesSaved(const FglTFRuntimePrimitive& Primitive)
+	{
+		if (!Primitive.bCompact)
+		{
+			return 0;
+		}
+
+		int64 BytesSaved = (Primitive.CompactPositions.Num() + Primitive.CompactNormals.Num()) * static_cast<int64>(sizeof(FVector) - sizeof(FglTFRuntimeVector3f));
+		BytesSaved += Primitive.CompactTangents.Num() * static_cast<int64>(sizeof(FVector4) - sizeof(FglTFRuntimePackedTangent));
+		for (const TArray<FglTFRuntimeVector2f>& CompactUV : Primitive.CompactUVs)
+		{
+			BytesSaved += CompactUV.Num() * static_cast<int64>(sizeof(FVector2D) - sizeof(FglTFRuntimeVector2f));
+		}
+		for (const TArray<FglTFRuntimeUInt16Vector4>& CompactWeights : Primitive.CompactWeights)
+		{
+			BytesSaved += CompactWeights.Num() * static_cast<int64>(sizeof(FVector4) - sizeof(FglTFRuntimeUInt16Vector4));
+		}
+		BytesSaved += Primitive.CompactColors.Num() * static_cast<int64>(sizeof(FVector4) - sizeof(FLinearColor));
+		return BytesSaved;
+	}
+}
+
+int64 glTFRuntime::CompactPrimitive(FglTFRuntimePrimitive& Primitive, const bool bHighPrecisionTangents)
+{
+	// primitives loaded in compact mode are already there
+	if (Primitive.bCompact)
+	{
+		return GetCompactBytesSaved(Primitive);
+	}
+
+	Primitive.CompactPositions.AddUninitialized(Primitive.Positions.Num());
+	for (int32 Index = 0; Index < Primitive.Positions.Num(); Index++)
+	{
+		Primitive.CompactPositions[Index] = FglTFRuntimeVector3f(Primitive.Positions[Index]);
+	}
+
+	Primitive.CompactNormals.AddUninitialized(Primitive.Normals.Num());
+	for (int32 Index = 0; Index < Primitive.Normals.Num(); Index++)
+	{
+		Primitive.CompactNormals[Index] = FglTFRuntimeVector3f(Primitive.Normals[Index]);
+	}
+
+	if (!bHighPrecisionTangents)
+	{
+		Primitive.CompactTangents.AddUninitialized(Primitive.Tangents.Num());
+		for (int32 Index = 0; Index < Primitive.Tangents.Num(); Index++)
+		{
+			Primitive.CompactTangents[Index] = FglTFRuntimePackedTangent(Primitive.Tangents[Index]);
+		}
+		Primitive.Tangents.Empty();
+	}
+
+	for (const TArray<FVector2D>& UV : Primitive.UVs)
+	{
+		TArray<FglTFRuntimeVector2f>& CompactUV = Primitive.CompactUVs.AddDefaulted_GetRef();
+		CompactUV.AddUninitialized(UV.Num());
+		for (int32 Index = 0; Index < UV.Num(); Index++)
+		{
+			CompactUV[Index] = FglTFRuntimeVector2f(UV[Index]);
+		}
+	}
+
+	for (const TArray<FVector4>& Weights : Primitive.Weights)
+	{
+		TArray<FglTFRuntimeUInt16Vector4>& CompactWeights = Primitive.CompactWeights.AddDefaulted_GetRef();
+		CompactWeights.AddUninitialized(Weights.Num());
+		for (int32 Index = 0; Index < Weights.Num(); Index++)
+		{
+			for (int32 Influence = 0; Influence < 4; Influence++)
+			{
+				CompactWeights[Index][Influence] = static_cast<uint16>(FMath::Clamp(FMath::RoundToInt(Weights[Index][Influence] * 65535.0), 0, 65535));
+			}
+		}
+	}
+
+	Primitive.CompactColors.AddUninitialized(Primitive.Colors.Num());
+	for (int32 Index = 0; Index < Primitive.Colors.Num(); Index++)
+	{
+		Primitive.CompactColors[Index] = FLinearColor(Primitive.Colors[Index]);
+	}
+
+	Primitive.Positions.Empty();
+	Primitive.Normals.Empty();
+	Primitive.UVs.Empty();
+	Primitive.Weights.Empty();
+	Primitive.Colors.Empty();
+
+	Primitive.bCompact = true;
+
+	return GetCompactBytesSaved(Primitive);
+}
+
+
+void glTFRuntime::ExpandPrimitive(FglTFRuntimePrimitive& Primitive)
+{
+	if (!Primitive.bCompact)
+	{
+		return;
+	}
+
+	Primitive.Positions.AddUninitialized(Primitive.CompactPositions.Num());
+	for (int32 Index = 0; Index < Primitive.CompactPositions.Num(); Index++)
+	{
+		Primitive.Positions[Index] = FVector(Primitive.CompactPositions[Index]);
+	}
+
+	Primitive.Normals.AddUninitialized(Primitive.CompactNormals.Num());
+	for (int32 Index = 0; Index < Primitive.CompactNormals.Num(); Index++)
+	{
+		Primitive.Normals[Index] = FVector(Primitive.CompactNormals[Index]);
+	}
+
+	Primitive.Tangents.AddUninitialized(Primitive.CompactTangents.Num());
+	for (int32 Index = 0; Index < Primitive.CompactTangents.Num(); Index++)
+	{
+		Primitive.Tangents[Index] = FVector4(Primitive.CompactTangents[Index].Unpack());
+	}
+
+	for (const TArray<FglTFRuntimeVector2f>& CompactUV : Primitive.CompactUVs)
+	{
+		TArray<FVector2D>& UV = Primitive.UVs.AddDefaulted_GetRef();
+		UV.AddUninitialized(CompactUV.Num());
+		for (int32 Index = 0; Index < CompactUV.Num(); Index++)
+		{
+			UV[Index] = FVector2D(CompactUV[Index]);
+		}
+	}
+
+	for (const TArray<FglTFRuntimeUInt16Vector4>& CompactWeights : Primitive.CompactWeights)
+	{
+		TArray<FVector4>& Weights = Primitive.Weights.AddDefaulted_GetRef();
+		Weights.AddUninitialized(CompactWeights.Num());
+		for (int32 Index = 0; Index < CompactWeights.Num(); Index++)
+		{
+			for (int32 Influence = 0; Influence < 4; Influence++)
+			{
+				Weights[Index][Influence] = CompactWeights[Index][Influence] / 65535.0;
+			}
+		}
+	}
+
+	Primitive.Colors.AddUninitialized(Primitive.CompactColors.Num());
+	for (int32 Index = 0; Index < Primitive.CompactColors.Num(); Index++)
+	{
+		Primitive.Colors[Index] = FVector4(Primitive.CompactColors[Index]);
+	}
+
+	Primitive.CompactPositions.Empty();
+	Primitive.CompactNormals.Empty();
+	Primitive.CompactTangents.Empty();
+	Primitive.CompactUVs.Empty();
+	Primitive.CompactWeights.Empty();
+	Primitive.CompactColors.Empty();
+
+	Primitive.bCompact = false;
+}
+
+int64 glTFRuntime::CompactMeshLOD(FglTFRuntimeMeshLOD& LOD, const bool bHighPrecisionTangents)
+{
+	LOD.CompactBytesSaved = 0;
+	for (FglTFRuntimePrimitive& Primitive : LOD.Primitives)
+	{
+		LOD.CompactBytesSaved += CompactPrimitive(Primitive, bHighPrecisionTangents);
+	}
+	return LOD.CompactBytesSaved;
+}
+
+void glTFRuntime::ExpandMeshLOD(FglTFRuntimeMeshLOD& LOD)
+{
+	for (FglTFRuntimePrimitive& Primitive : LOD.Primitives)
+	{
+		ExpandPrimitive(Primitive);
+	}
+	LOD.CompactBytesSaved = 0;
+}
+
 TArray<TSharedRef<FJsonObject>> FglTFRuntimeParser::GetMeshes() const
 {
 	TArray<TSharedRef<FJsonObject>> Meshes;
@@ -6662,6 +7612,43 @@ bool FglTFRuntimeParser::GetBlobByName(const FString& Name, TArray64<uint8>& Blo
 	return Archive->GetFileContent(Name, Blob);
 }
 
+int32 FglTFRuntimeParser::PrefetchArchiveEntries()
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_PrefetchArchiveEntries, FColor::Magenta);
+
+	if (!IsArchive())
+	{
+		return 0;
+	}
+
+	// the same uris resolved by GetBuffer() and GetJsonObjectBytes()
+	TArray<FString> Filenames;
+	for (const TCHAR* Field : { TEXT("buffers"), TEXT("images") })
+	{
+		const TArray<TSharedPtr<FJsonValue>>* JsonItems;
+		if (!Root->TryGetArrayField(Field, JsonItems))
+		{
+			continue;
+		}
+
+		for (const TSharedPtr<FJsonValue>& JsonItem : *JsonItems)
+		{
+			const TSharedPtr<FJsonObject>* JsonItemObject;
+			FString Uri;
+			if (JsonItem->TryGetObject(JsonItemObject) && (*JsonItemObject)->TryGetStringField(TEXT("uri"), Uri) && !Uri.StartsWith("data:"))
+			{
+				Filenames.AddUnique(Uri);
+			}
+		}
+	}
+
+	const int32 NumPrefetchedEntries = Archive->PrefetchFiles(Filenames);
+
+	UE_LOG(LogGLTFRuntime, Verbose, TEXT("Prefetched %d/%d archive entries"), NumPrefetchedEntries, Filenames.Num());
+
+	return NumPrefetchedEntries;
+}
+
 void FglTFRuntimeParser::LoadMeshAsRuntimeLODAsync(const int32 MeshIndex, const FglTFRuntimeMeshLODAsync& AsyncCallback, const FglTFRuntimeMaterialsConfig& MaterialsConfig)
 {
 	TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex("meshes", MeshIndex);
@@ -6670,15 +7657,22 @@ void FglTFRuntimeParser::LoadMeshAsRuntimeLODAsync(const int32 MeshIndex, const
 		AsyncCallback.ExecuteIfBound(false, FglTFRuntimeMeshLOD());
 	}
 
-	Async(EAsyncExecution::Thread, [this, JsonMeshObject, MaterialsConfig, AsyncCallback]()
+	AddAsyncTask([this, JsonMeshObject, MaterialsConfig, AsyncCallback](const bool bCancelled)
 		{
 			FglTFRuntimeMeshLOD* LOD;
-			bool bSuccess = LoadMeshIntoMeshLOD(JsonMeshObject.ToSharedRef(), LOD, MaterialsConfig);
-			FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([bSuccess, LOD, AsyncCallback]()
+			bool bSuccess = !bCancelled && LoadMeshIntoMeshLOD(JsonMeshObject.ToSharedRef(), LOD, MaterialsConfig);
+			// copy the cached LOD here, the game thread task can run after the parser is gone
+			FglTFRuntimeMeshLOD RuntimeLOD;
+			if (bSuccess)
+			{
+				RuntimeLOD = *LOD;
+				// runtime LODs are exposed in the wide form (the cached LOD can be compact)
+				glTFRuntime::ExpandMeshLOD(RuntimeLOD);
+			}
+			FFunctionGraphTask::CreateAndDispatchWhenReady([bSuccess, RuntimeLOD = MoveTemp(RuntimeLOD), AsyncCallback]()
 				{
-					AsyncCallback.ExecuteIfBound(bSuccess, bSuccess ? *LOD : FglTFRuntimeMeshLOD());
+					AsyncCallback.ExecuteIfBound(bSuccess, RuntimeLOD);
 				}, TStatId(), nullptr, ENamedThreads::GameThread);
-			FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
 		}
 
 	);
@@ -1,12 +1,17 @@
 // Copyright 2020-2023, Roberto De Ioris.
 
 #include "glTFRuntimeParser.h"
+#include "glTFRuntimeKTX2.h"
+#include "glTFRuntimeMipGenerator.h"
+#include "glTFRuntimeTextureCompressor.h"
 #include "Runtime/Launch/Resources/Version.h"
 #include "Engine/Texture2D.h"
 #include "IImageWrapperModule.h"
 #include "IImageWrapper.h"
 #include "ImageUtils.h"
 #include "Misc/FileHelper.h"
+#include "Misc/ScopeLock.h"
+#include "Misc/ScopeRWLock.h"
 #if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 2
 #include "MaterialDomain.h"
 #else
@@ -167,14 +172,18 @@ UMaterialInterface* FglTFRuntimeParser::LoadMaterial_Internal(const int32 Index,
 				}
 
 				// hack for allowing BC5 compression for plugins
+				FglTFRuntimeImagesConfig& ImagesConfig = const_cast<FglTFRuntimeImagesConfig&>(MaterialsConfig.ImagesConfig);
+				const TEnumAsByte<TextureCompressionSettings> PreviousCompression = ImagesConfig.Compression;
 				if (bForceNormalMapCompression)
 				{
-					FglTFRuntimeImagesConfig& ImagesConfig = const_cast<FglTFRuntimeImagesConfig&>(MaterialsConfig.ImagesConfig);
 					ImagesConfig.Compression = TextureCompressionSettings::TC_Normalmap;
 				}
 
 				ParamTextureCache = LoadTexture(TextureIndex, ParamMips, sRGB, MaterialsConfig, Sampler);
 
+				// the lambda reuses the same MaterialsConfig copy for every slot
+				ImagesConfig.Compression = PreviousCompression;
+
 				return *JsonTextureObject;
 			}
 			return nullptr;
@@ -419,7 +428,7 @@ UTexture2D* FglTFRuntimeParser::BuildTexture(UObject* Outer, const TArray<FglTFR
 		uint8* Data = reinterpret_cast<uint8*>(Mip->BulkData.Realloc(MipMap.Pixels.Num()));
 		// ETargetPlatformFeatures::NormalmapLAEncodingMode has been added in 5.3 for mobile platforms
 #if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 3 && (PLATFORM_ANDROID || PLATFORM_IOS)
-		if (ImagesConfig.Compression == TC_Normalmap)
+		if (ImagesConfig.Compression == TC_Normalmap && MipMap.PixelFormat == EPixelFormat::PF_B8G8R8A8)
 		{
 			for (int32 PIndex = 0; PIndex < MipMap.Pixels.Num(); PIndex += 4)
 			{
@@ -461,6 +470,7 @@ UTexture2D* FglTFRuntimeParser::BuildTexture(UObject* Outer, const TArray<FglTFR
 
 	if (Mips[0].TextureIndex >= 0)
 	{
+		FRWScopeLock Lock(TexturesCacheLock, SLT_Write);
 		TexturesCache.Add(Mips[0].TextureIndex, Texture);
 	}
 
@@ -1022,6 +1032,19 @@ bool FglTFRuntimeParser::LoadImageFromBlob(const TArray64<uint8>& Blob, TSharedR
 				Height = DDSMips[0].Height;
 			}
 		}
+		else if (FglTFRuntimeKTX2::IsKTX2(Blob))
+		{
+			FglTFRuntimeKTX2 KTX2(Blob);
+			TArray<FglTFRuntimeMipMap> KTX2Mips;
+			KTX2.LoadMips(-1, KTX2Mips, 1, ImagesConfig);
+			if (KTX2Mips.Num() > 0)
+			{
+				UncompressedBytes = MoveTemp(KTX2Mips[0].Pixels);
+				PixelFormat = KTX2Mips[0].PixelFormat;
+				Width = KTX2Mips[0].Width;
+				Height = KTX2Mips[0].Height;
+			}
+		}
 
 		if (UncompressedBytes.Num() == 0)
 		{
@@ -1125,6 +1148,262 @@ bool FglTFRuntimeParser::LoadImage(const int32 ImageIndex, TArray64<uint8>& Unco
 	return LoadImageFromBlob(Bytes, JsonImageObject.ToSharedRef(), UncompressedBytes, Width, Height, PixelFormat, ImagesConfig);
 }
 
+bool FglTFRuntimeParser::ResolveTextureImageIndex(TSharedRef<FJsonObject> JsonTextureObject, int64& ImageIndex, int64& FallbackImageIndex)
+{
+	ImageIndex = INDEX_NONE;
+	FallbackImageIndex = INDEX_NONE;
+
+	OnTextureImageIndex.Broadcast(AsShared(), JsonTextureObject, ImageIndex);
+
+	// KHR_texture_basisu, the core source (if any) is the fallback
+	if (ImageIndex <= INDEX_NONE)
+	{
+		ImageIndex = GetJsonExtensionObjectIndex(JsonTextureObject, "KHR_texture_basisu", "source", INDEX_NONE);
+		if (ImageIndex > INDEX_NONE)
+		{
+			JsonTextureObject->TryGetNumberField(TEXT("source"), FallbackImageIndex);
+		}
+	}
+
+	return ImageIndex > INDEX_NONE || JsonTextureObject->TryGetNumberField(TEXT("source"), ImageIndex);
+}
+
+TArray<FglTFRuntimePrefetchedTextureKey> FglTFRuntimeParser::PrefetchMeshesTextures(const TArray<TSharedRef<FJsonObject>>& JsonMeshObjects, const FglTFRuntimeMaterialsConfig& MaterialsConfig)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_PrefetchMeshesTextures, FColor::Magenta);
+
+	TArray<FglTFRuntimePrefetchedTextureKey> Keys;
+
+	if (MaterialsConfig.bSkipLoad || MaterialsConfig.MaterialRemapper.Remapper.IsBound())
+	{
+		return Keys;
+	}
+
+	TSet<int64> MaterialIndices;
+	for (const TSharedRef<FJsonObject>& JsonMeshObject : JsonMeshObjects)
+	{
+		const TArray<TSharedPtr<FJsonValue>>* JsonPrimitives;
+		if (!JsonMeshObject->TryGetArrayField(TEXT("primitives"), JsonPrimitives))
+		{
+			continue;
+		}
+
+		for (const TSharedPtr<FJsonValue>& JsonPrimitive : *JsonPrimitives)
+		{
+			TSharedPtr<FJsonObject> JsonPrimitiveObject = JsonPrimitive->AsObject();
+			if (!JsonPrimitiveObject)
+			{
+				continue;
+			}
+
+			const int64 MaterialIndex = GetPrimitiveMaterialIndex(JsonPrimitiveObject.ToSharedRef(), MaterialsConfig);
+			if (MaterialIndex <= INDEX_NONE || (!MaterialsConfig.bMaterialsOverrideMapInjectParams && MaterialsConfig.MaterialsOverrideMap.Contains(MaterialIndex)))
+			{
+				continue;
+			}
+
+			if (!(CanReadFromCache(MaterialsConfig.CacheMode) && MaterialsCache.Contains(MaterialIndex)))
+			{
+				MaterialIndices.Add(MaterialIndex);
+			}
+		}
+	}
+
+	struct FPrefetchedTexture
+	{
+		FglTFRuntimePrefetchedTextureKey Key;
+		TSharedPtr<FJsonObject> JsonTextureObject;
+		TSharedPtr<FJsonObject> JsonImageObject;
+		TArray64<uint8> Bytes;
+		FglTFRuntimePrefetchedTexture Texture;
+		bool bDecode = false;
+		bool bSuccess = false;
+	};
+
+	// the texture slots read by LoadMaterial_Internal(): extension (empty for the material itself), slot, sRGB, normal map
+	struct FTextureSlot
+	{
+		const TCHAR* Extension;
+		const TCHAR* Slot;
+		bool sRGB;
+		bool bNormalMap;
+	};
+
+	static const FTextureSlot TextureSlots[] =
+	{
+		{ TEXT(""), TEXT("normalTexture"), false, true },
+		{ TEXT(""), TEXT("occlusionTexture"), false, false },
+		{ TEXT(""), TEXT("emissiveTexture"), true, false },
+		{ TEXT("pbrMetallicRoughness"), TEXT("baseColorTexture"), true, false },
+		{ TEXT("pbrMetallicRoughness"), TEXT("metallicRoughnessTexture"), false, false },
+		{ TEXT("KHR_materials_pbrSpecularGlossiness"), TEXT("diffuseTexture"), true, false },
+		{ TEXT("KHR_materials_pbrSpecularGlossiness"), TEXT("specularGlossinessTexture"), true, false },
+		{ TEXT("KHR_materials_transmission"), TEXT("transmissionTexture"), false, false },
+		{ TEXT("KHR_materials_specular"), TEXT("specularTexture"), false, false },
+		{ TEXT("KHR_materials_clearcoat"), TEXT("clearcoatTexture"), false, false },
+		{ TEXT("KHR_materials_clearcoat"), TEXT("clearcoatRoughnessTexture"), false, false },
+		{ TEXT("KHR_materials_clearcoat"), TEXT("clearcoatNormalTexture"), false, true },
+		{ TEXT("KHR_materials_volume"), TEXT("thicknessTexture"), false, false },
+		{ TEXT("KHR_materials_sheen"), TEXT("sheenColorTexture"), true, false },
+		{ TEXT("KHR_materials_sheen"), TEXT("sheenRoughnessTexture"), false, false },
+	};
+
+	TArray<FPrefetchedTexture> Textures;
+	TSet<FglTFRuntimePrefetchedTextureKey> CollectedKeys;
+	// the same texture can be used with different sRGB/normal map settings, but its image is resolved only once
+	TMap<int64, TPair<int64, int64>> ResolvedImageIndices;
+
+	// image bytes are read serially (buffers caches are not thread safe)
+	for (const int64 MaterialIndex : MaterialIndices)
+	{
+		TSharedPtr<FJsonObject> JsonMaterialObject = GetJsonObjectFromRootIndex("materials", MaterialIndex);
+		if (!JsonMaterialObject)
+		{
+			continue;
+		}
+
+		FString MaterialName;
+		if (JsonMaterialObject->TryGetStringField(TEXT("name"), MaterialName) && !MaterialsConfig.bMaterialsOverrideMapInjectParams && MaterialsConfig.MaterialsOverrideByNameMap.Contains(MaterialName))
+		{
+			continue;
+		}
+
+		for (const FTextureSlot& TextureSlot : TextureSlots)
+		{
+			TSharedPtr<FJsonObject> JsonSlotParentObject = JsonMaterialObject;
+			const TSharedPtr<FJsonObject>* JsonExtensionObject = nullptr;
+			if (FCString::Strcmp(TextureSlot.Extension, TEXT("pbrMetallicRoughness")) == 0)
+			{
+				JsonSlotParentObject = JsonMaterialObject->TryGetObjectField(TextureSlot.Extension, JsonExtensionObject) ? *JsonExtensionObject : nullptr;
+			}
+			else if (TextureSlot.Extension[0] != 0)
+			{
+				const TSharedPtr<FJsonObject>* JsonExtensions;
+				JsonSlotParentObject = JsonMaterialObject->TryGetObjectField(TEXT("extensions"), JsonExtensions) && (*JsonExtensions)->TryGetObjectField(TextureSlot.Extension, JsonExtensionObject) ? *JsonExtensionObject : nullptr;
+			}
+
+			const TSharedPtr<FJsonObject>* JsonTextureInfoObject;
+			int64 TextureIndex;
+			if (!JsonSlotParentObject || !JsonSlotParentObject->TryGetObjectField(TextureSlot.Slot, JsonTextureInfoObject) || !(*JsonTextureInfoObject)->TryGetNumberField(TEXT("index"), TextureIndex))
+			{
+				continue;
+			}
+
+			const FglTFRuntimePrefetchedTextureKey Key(static_cast<int32>(TextureIndex), TextureSlot.sRGB, TextureSlot.bNormalMap || MaterialsConfig.ImagesConfig.Compression == TextureCompressionSettings::TC_Normalmap);
+			if (CollectedKeys.Contains(Key) || MaterialsConfig.TexturesOverrideMap.Contains(TextureIndex))
+			{
+				continue;
+			}
+			CollectedKeys.Add(Key);
+
+			{
+				FRWScopeLock Lock(TexturesCacheLock, SLT_ReadOnly);
+				if (TexturesCache.Contains(TextureIndex))
+				{
+					continue;
+				}
+			}
+
+			{
+				FScopeLock Lock(&PrefetchedTexturesLock);
+				if (PrefetchedTextures.Contains(Key))
+				{
+					continue;
+				}
+			}
+
+			FPrefetchedTexture PrefetchedTexture;
+			PrefetchedTexture.Key = Key;
+			PrefetchedTexture.JsonTextureObject = GetJsonObjectFromRootIndex("textures", TextureIndex);
+			if (!PrefetchedTexture.JsonTextureObject)
+			{
+				continue;
+			}
+
+			// LoadTexture() reuses the resolved indices, so OnTextureImageIndex is broadcast once per texture
+			if (const TPair<int64, int64>* ResolvedImageIndex = ResolvedImageIndices.Find(TextureIndex))
+			{
+				PrefetchedTexture.Texture.ImageIndex = ResolvedImageIndex->Key;
+				PrefetchedTexture.Texture.FallbackImageIndex = ResolvedImageIndex->Value;
+			}
+			else
+			{
+				if (!ResolveTextureImageIndex(PrefetchedTexture.JsonTextureObject.ToSharedRef(), PrefetchedTexture.Texture.ImageIndex, PrefetchedTexture.Texture.FallbackImageIndex))
+				{
+					PrefetchedTexture.Texture.ImageIndex = INDEX_NONE;
+				}
+				ResolvedImageIndices.Add(TextureIndex, TPair<int64, int64>(PrefetchedTexture.Texture.ImageIndex, PrefetchedTexture.Texture.FallbackImageIndex));
+			}
+
+			// errors will be reported by LoadTexture()
+			const int64 ImageIndex = PrefetchedTexture.Texture.ImageIndex;
+			if (ImageIndex > INDEX_NONE && !MaterialsConfig.ImagesOverrideMap.Contains(ImageIndex))
+			{
+				PrefetchedTexture.JsonImageObject = GetJsonObjectFromRootIndex("images", ImageIndex);
+				PrefetchedTexture.bDecode = PrefetchedTexture.JsonImageObject && GetJsonObjectBytes(PrefetchedTexture.JsonImageObject.ToSharedRef(), PrefetchedTexture.Bytes);
+			}
+
+			Textures.Add(MoveTemp(PrefetchedTexture));
+		}
+	}
+
+	int32 NumTexturesToDecode = 0;
+	for (const FPrefetchedTexture& PrefetchedTexture : Textures)
+	{
+		NumTexturesToDecode += PrefetchedTexture.bDecode ? 1 : 0;
+	}
+
+	// a single texture is not worth the dispatch
+	if (NumTexturesToDecode > 1)
+	{
+		// loading modules is not thread safe
+		FModuleManager::LoadModuleChecked<IImageWrapperModule>(TEXT("ImageWrapper"));
+
+		FglTFRuntimeMaterialsConfig NormalMapMaterialsConfig = MaterialsConfig;
+		NormalMapMaterialsConfig.ImagesConfig.Compression = TextureCompressionSettings::TC_Normalmap;
+
+		ParallelFor(Textures.Num(), [&](const int32 Index)
+			{
+				FPrefetchedTexture& PrefetchedTexture = Textures[Index];
+				if (!PrefetchedTexture.bDecode)
+				{
+					return;
+				}
+				PrefetchedTexture.bSuccess = LoadBlobToMips(PrefetchedTexture.Key.Get<0>(), PrefetchedTexture.JsonTextureObject.ToSharedRef(), PrefetchedTexture.JsonImageObject.ToSharedRef(),
+					PrefetchedTexture.Bytes, PrefetchedTexture.Texture.Mips, PrefetchedTexture.Key.Get<1>(), PrefetchedTexture.Key.Get<2>() ? NormalMapMaterialsConfig : MaterialsConfig) && PrefetchedTexture.Texture.Mips.Num() > 0;
+				PrefetchedTexture.Bytes.Empty();
+			});
+	}
+
+	FScopeLock Lock(&PrefetchedTexturesLock);
+	for (FPrefetchedTexture& PrefetchedTexture : Textures)
+	{
+		// failed (or not decoded) textures keep only the resolved indices, LoadTexture() decodes them with fallbacks and errors reporting
+		if (!PrefetchedTexture.bSuccess)
+		{
+			PrefetchedTexture.Texture.Mips.Empty();
+		}
+		PrefetchedTextures.Add(PrefetchedTexture.Key, MoveTemp(PrefetchedTexture.Texture));
+		Keys.Add(PrefetchedTexture.Key);
+	}
+
+	return Keys;
+}
+
+void FglTFRuntimeParser::DiscardPrefetchedTextures(const TArray<FglTFRuntimePrefetchedTextureKey>& Keys)
+{
+	if (Keys.Num() == 0)
+	{
+		return;
+	}
+
+	FScopeLock Lock(&PrefetchedTexturesLock);
+	for (const FglTFRuntimePrefetchedTextureKey& Key : Keys)
+	{
+		PrefetchedTextures.Remove(Key);
+	}
+}
+
 UTexture2D* FglTFRuntimeParser::LoadTexture(const int32 TextureIndex, TArray<FglTFRuntimeMipMap>& Mips, const bool sRGB, const FglTFRuntimeMaterialsConfig& MaterialsConfig, FglTFRuntimeTextureSampler& Sampler)
 {
 	SCOPED_NAMED_EVENT(FglTFRuntimeParser_LoadTexture, FColor::Magenta);
@@ -1140,33 +1419,48 @@ UTexture2D* FglTFRuntimeParser::LoadTexture(const int32 TextureIndex, TArray<Fgl
 	}
 
 	// first check cache
-	if (TexturesCache.Contains(TextureIndex))
 	{
-		return TexturesCache[TextureIndex];
+		FRWScopeLock Lock(TexturesCacheLock, SLT_ReadOnly);
+		if (TexturesCache.Contains(TextureIndex))
+		{
+			return TexturesCache[TextureIndex];
+		}
 	}
 
-	const TArray<TSharedPtr<FJsonValue>>* JsonTextures;
-	// no images ?
-	if (!Root->TryGetArrayField(TEXT("textures"), JsonTextures))
+	TSharedPtr<FJsonObject> JsonTextureObject = GetJsonObjectFromRootIndex("textures", TextureIndex);
+	if (!JsonTextureObject)
 	{
 		return nullptr;
 	}
 
-	if (TextureIndex >= JsonTextures->Num())
+	// already resolved (and maybe decoded) by PrefetchMeshesTextures() ?
+	int64 ImageIndex = INDEX_NONE;
+	int64 FallbackImageIndex = INDEX_NONE;
+	bool bResolved = false;
+	bool bPrefetched = false;
 	{
-		return nullptr;
+		FScopeLock Lock(&PrefetchedTexturesLock);
+		const FglTFRuntimePrefetchedTextureKey Key(TextureIndex, sRGB, MaterialsConfig.ImagesConfig.Compression == TextureCompressionSettings::TC_Normalmap);
+		if (FglTFRuntimePrefetchedTexture* PrefetchedTexture = PrefetchedTextures.Find(Key))
+		{
+			ImageIndex = PrefetchedTexture->ImageIndex;
+			FallbackImageIndex = PrefetchedTexture->FallbackImageIndex;
+			bPrefetched = PrefetchedTexture->Mips.Num() > 0;
+			if (bPrefetched)
+			{
+				Mips = MoveTemp(PrefetchedTexture->Mips);
+			}
+			PrefetchedTextures.Remove(Key);
+			bResolved = true;
+		}
 	}
 
-	TSharedPtr<FJsonObject> JsonTextureObject = (*JsonTextures)[TextureIndex]->AsObject();
-	if (!JsonTextureObject)
+	if (!bResolved && !ResolveTextureImageIndex(JsonTextureObject.ToSharedRef(), ImageIndex, FallbackImageIndex))
 	{
 		return nullptr;
 	}
 
-	int64 ImageIndex = INDEX_NONE;
-	OnTextureImageIndex.Broadcast(AsShared(), JsonTextureObject.ToSharedRef(), ImageIndex);
-
-	if (ImageIndex <= INDEX_NONE && !JsonTextureObject->TryGetNumberField(TEXT("source"), ImageIndex))
+	if (ImageIndex <= INDEX_NONE)
 	{
 		return nullptr;
 	}
@@ -1176,16 +1470,29 @@ UTexture2D* FglTFRuntimeParser::LoadTexture(const int32 TextureIndex, TArray<Fgl
 		return MaterialsConfig.ImagesOverrideMap[ImageIndex];
 	}
 
-	TSharedPtr<FJsonObject> JsonImageObject;
-	TArray64<uint8> CompressedBytes;
-	if (!LoadImageBytes(ImageIndex, JsonImageObject, CompressedBytes))
+	if (!bPrefetched)
 	{
-		return nullptr;
-	}
+		TSharedPtr<FJsonObject> JsonImageObject;
+		TArray64<uint8> CompressedBytes;
+		if (!LoadImageBytes(ImageIndex, JsonImageObject, CompressedBytes))
+		{
+			return nullptr;
+		}
 
-	if (!LoadBlobToMips(TextureIndex, JsonTextureObject.ToSharedRef(), JsonImageObject.ToSharedRef(), CompressedBytes, Mips, sRGB, MaterialsConfig))
-	{
-		return nullptr;
+		if (!LoadBlobToMips(TextureIndex, JsonTextureObject.ToSharedRef(), JsonImageObject.ToSharedRef(), CompressedBytes, Mips, sRGB, MaterialsConfig))
+		{
+			if (FallbackImageIndex <= INDEX_NONE)
+			{
+				return nullptr;
+			}
+
+			Mips.Empty();
+			if (!LoadImageBytes(FallbackImageIndex, JsonImageObject, CompressedBytes) ||
+				!LoadBlobToMips(TextureIndex, JsonTextureObject.ToSharedRef(), JsonImageObject.ToSharedRef(), CompressedBytes, Mips, sRGB, MaterialsConfig))
+			{
+				return nullptr;
+			}
+		}
 	}
 
 	int64 SamplerIndex;
@@ -1272,6 +1579,24 @@ bool FglTFRuntimeParser::LoadBlobToMips(const int32 TextureIndex, TSharedRef<FJs
 		}
 	}
 
+	// KTX2 (KHR_texture_basisu) brings its own mips (unless levelCount is 0)
+	if (Mips.Num() == 0 && FglTFRuntimeKTX2::IsKTX2(Blob))
+	{
+		FglTFRuntimeKTX2 KTX2(Blob);
+		KTX2.LoadMips(TextureIndex, Mips, 0, MaterialsConfig.ImagesConfig);
+		// errors are already logged, the caller may still have a fallback image
+		if (Mips.Num() == 0)
+		{
+			return false;
+		}
+
+		// levelCount 0, only the base level is stored
+		if (KTX2.RequiresMipGeneration() && MaterialsConfig.bGeneratesMipMaps && Mips[0].PixelFormat == EPixelFormat::PF_B8G8R8A8)
+		{
+			FglTFRuntimeMipGenerator::GenerateMips(Mips, sRGB);
+		}
+	}
+
 	// if no Mips have been generated, load it as a plain image and (eventually) generate them
 	if (Mips.Num() == 0)
 	{
@@ -1309,71 +1634,31 @@ bool FglTFRuntimeParser::LoadBlobToMips(const int32 TextureIndex, TSharedRef<FJs
 				UncompressedBytes.Append(reinterpret_cast<uint8*>(ResizedPixels.GetData()), ResizedPixels.Num() * 4);
 			}
 
-			int32 NumOfMips = 1;
-
-			TArray64<FColor> UncompressedColors;
+			FglTFRuntimeMipMap MipMap(TextureIndex, PixelFormat, Width, Height);
+			MipMap.Pixels = MoveTemp(UncompressedBytes);
+			Mips.Add(MoveTemp(MipMap));
 
-			if (MaterialsConfig.bGeneratesMipMaps && GPixelFormats[PixelFormat].BlockSizeX == 1 && GPixelFormats[PixelFormat].BlockSizeY == 1 && FMath::IsPowerOfTwo(Width) && FMath::IsPowerOfTwo(Height))
+			// every level is built from the previous one (any size is supported, currently only PF_B8G8R8A8)
+			if (MaterialsConfig.bGeneratesMipMaps && PixelFormat == EPixelFormat::PF_B8G8R8A8)
 			{
-				NumOfMips = FMath::FloorLog2(FMath::Max(Width, Height)) + 1;
-
-				for (int32 MipY = 0; MipY < Height; MipY++)
-				{
-					for (int32 MipX = 0; MipX < Width; MipX++)
-					{
-						int64 MipColorIndex = ((MipY * Width) + MipX) * 4;
-						uint8 MipColorB = UncompressedBytes[MipColorIndex];
-						uint8 MipColorG = UncompressedBytes[MipColorIndex + 1];
-						uint8 MipColorR = UncompressedBytes[MipColorIndex + 2];
-						uint8 MipColorA = UncompressedBytes[MipColorIndex + 3];
-						UncompressedColors.Add(FColor(MipColorR, MipColorG, MipColorB, MipColorA));
-					}
-				}
-			}
-
-			int32 MipWidth = Width;
-			int32 MipHeight = Height;
-
-			for (int32 MipIndex = 0; MipIndex < NumOfMips; MipIndex++)
-			{
-				FglTFRuntimeMipMap MipMap(TextureIndex);
-				MipMap.Width = MipWidth;
-				MipMap.Height = MipHeight;
-				MipMap.PixelFormat = PixelFormat;
-
-				// Resize Image
-				if (MipIndex > 0)
-				{
-					TArray64<FColor> ResizedMipData;
-					ResizedMipData.AddUninitialized(MipWidth * MipHeight);
-#if ENGINE_MAJOR_VERSION >= 5
-					FImageUtils::ImageResize(Width, Height, UncompressedColors, MipWidth, MipHeight, ResizedMipData, sRGB, false);
-#else
-					FImageUtils::ImageResize(Width, Height, UncompressedColors, MipWidth, MipHeight, ResizedMipData, sRGB);
-#endif
-					for (FColor& Color : ResizedMipData)
-					{
-						MipMap.Pixels.Add(Color.B);
-						MipMap.Pixels.Add(Color.G);
-						MipMap.Pixels.Add(Color.R);
-						MipMap.Pixels.Add(Color.A);
-					}
-				}
-				else
-				{
-					MipMap.Pixels = UncompressedBytes;
-				}
-
-				Mips.Add(MipMap);
-
-				MipWidth = FMath::Max(MipWidth / 2, 1);
-				MipHeight = FMath::Max(MipHeight / 2, 1);
+				FglTFRuntimeMipGenerator::GenerateMips(Mips, sRGB);
 			}
 		}
 	}
 
 	OnTextureFilterMips.Broadcast(AsShared(), Mips, MaterialsConfig.ImagesConfig);
 
+	if (MaterialsConfig.ImagesConfig.BlockCompression != EglTFRuntimeBlockCompression::None && Mips.Num() > 0 && (Mips[0].Width % 4) == 0 && (Mips[0].Height % 4) == 0 &&
+		!Mips.ContainsByPredicate([](const FglTFRuntimeMipMap& MipMap) { return MipMap.PixelFormat != EPixelFormat::PF_B8G8R8A8; }))
+	{
+		const bool bNormalMap = MaterialsConfig.ImagesConfig.Compression == TextureCompressionSettings::TC_Normalmap;
+		const EPixelFormat BlockPixelFormat = FglTFRuntimeTextureCompressor::GetPixelFormat(MaterialsConfig.ImagesConfig.BlockCompression, bNormalMap, !bNormalMap && FglTFRuntimeTextureCompressor::HasAlpha(Mips[0]));
+		if (BlockPixelFormat != EPixelFormat::PF_Unknown)
+		{
+			FglTFRuntimeTextureCompressor::CompressMips(Mips, BlockPixelFormat, MaterialsConfig.ImagesConfig.BlockCompressionQuality);
+		}
+	}
+
 	return true;
 }
 
@@ -1,6 +1,9 @@
 // Copyright 2020-2025, Roberto De Ioris.
 
 #include "glTFRuntimeParser.h"
+#include "glTFRuntimeCookedMeshCache.h"
+#include "glTFRuntimeGLBStream.h"
+#include "glTFRuntimeTangentsGenerator.h"
 #include "Runtime/Launch/Resources/Version.h"
 #if ENGINE_MAJOR_VERSION > 4
 #include "Animation/AnimData/AnimDataModel.h"
@@ -72,7 +75,8 @@ struct FglTFRuntimeSkeletalMeshContextFinalizer
 
 	~FglTFRuntimeSkeletalMeshContextFinalizer()
 	{
-		FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([this]()
+		// the game thread task owns its copies, the pool worker does not wait for it
+		FFunctionGraphTask::CreateAndDispatchWhenReady([SkeletalMeshContext = SkeletalMeshContext, AsyncCallback = AsyncCallback]()
 			{
 				if (SkeletalMeshContext->SkeletalMesh)
 				{
@@ -84,7 +88,6 @@ struct FglTFRuntimeSkeletalMeshContextFinalizer
 				SkeletalMeshContext->UnregisterGCObject();
 #endif
 			}, TStatId(), nullptr, ENamedThreads::GameThread);
-		FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
 	}
 };
 
@@ -242,8 +245,8 @@ bool glTFRuntime::FillSkeletalMeshRenderData(FSkeletalMeshRenderData* RenderData
 		int32 NumLODPositions = 0;
 		for (int32 PrimitiveIndex = 0; PrimitiveIndex < LOD->Primitives.Num(); PrimitiveIndex++)
 		{
-			NumLODIndices += LOD->Primitives[PrimitiveIndex].bHasIndices ? LOD->Primitives[PrimitiveIndex].Indices.Num() : LOD->Primitives[PrimitiveIndex].Positions.Num();
-			NumLODPositions += LOD->Primitives[PrimitiveIndex].Positions.Num();
+			NumLODIndices += LOD->Primitives[PrimitiveIndex].bHasIndices ? LOD->Primitives[PrimitiveIndex].Indices.Num() : LOD->Primitives[PrimitiveIndex].GetNumVertices();
+			NumLODPositions += LOD->Primitives[PrimitiveIndex].GetNumVertices();
 
 			if (LOD->Primitives[PrimitiveIndex].bHighPrecisionUVs)
 			{
@@ -253,7 +256,7 @@ bool glTFRuntime::FillSkeletalMeshRenderData(FSkeletalMeshRenderData* RenderData
 			{
 				bUseHighPrecisionWeights = true;
 			}
-			if (LOD->Primitives[PrimitiveIndex].Colors.Num() > 0)
+			if (LOD->Primitives[PrimitiveIndex].GetNumColors() > 0)
 			{
 				LOD->bHasVertexColors = true;
 			}
@@ -292,7 +295,7 @@ bool glTFRuntime::FillSkeletalMeshRenderData(FSkeletalMeshRenderData* RenderData
 
 			MeshSection.MaterialIndex = PrimitiveIndex;
 			MeshSection.BaseIndex = BaseIndex;
-			MeshSection.NumTriangles = (Primitive.bHasIndices ? Primitive.Indices.Num() : Primitive.Positions.Num()) / 3;
+			MeshSection.NumTriangles = (Primitive.bHasIndices ? Primitive.Indices.Num() : Primitive.GetNumVertices()) / 3;
 			MeshSection.BaseVertexIndex = BaseVertexIndex;
 			MeshSection.MaxBoneInfluences = FMath::Min(Primitive.Joints.Num() * 4, MAX_TOTAL_INFLUENCES);
 
@@ -301,9 +304,9 @@ bool glTFRuntime::FillSkeletalMeshRenderData(FSkeletalMeshRenderData* RenderData
 				MaxBoneInfluences = MeshSection.MaxBoneInfluences;
 			}
 
-			MeshSection.NumVertices = Primitive.Positions.Num();
+			MeshSection.NumVertices = Primitive.GetNumVertices();
 
-			BaseIndex += Primitive.bHasIndices ? Primitive.Indices.Num() : Primitive.Positions.Num();
+			BaseIndex += Primitive.bHasIndices ? Primitive.Indices.Num() : Primitive.GetNumVertices();
 
 			TMap<int32, TArray<int32>> OverlappingVertices;
 			MeshSection.DuplicatedVerticesBuffer.Init(MeshSection.NumVertices, OverlappingVertices);
@@ -311,29 +314,29 @@ bool glTFRuntime::FillSkeletalMeshRenderData(FSkeletalMeshRenderData* RenderData
 			// this is used for non-skinned asset loaded as skinned ones
 			int32 OverrideVertexToCheck = 0;
 
-			for (int32 VertexIndex = 0; VertexIndex < Primitive.Positions.Num(); VertexIndex++)
+			for (int32 VertexIndex = 0; VertexIndex < Primitive.GetNumVertices(); VertexIndex++)
 			{
 				FModelVertex ModelVertex;
 
 				float TangentXW = 1;
 
 #if ENGINE_MAJOR_VERSION > 4
-				ModelVertex.Position = FVector3f(Primitive.Positions[VertexIndex]);
+				ModelVertex.Position = Primitive.GetPosition(VertexIndex);
 				BoundingBox += FVector(ModelVertex.Position) * SkeletalMeshConfig.BoundsScale;
 				ModelVertex.TangentX = FVector3f::ZeroVector;
 				ModelVertex.TangentZ = FVector3f::ZeroVector;
 #else
-				ModelVertex.Position = Primitive.Positions[VertexIndex];
+				ModelVertex.Position = Primitive.GetPosition(VertexIndex);
 				BoundingBox += ModelVertex.Position * SkeletalMeshConfig.BoundsScale;
 				ModelVertex.TangentX = FVector::ZeroVector;
 				ModelVertex.TangentZ = FVector::ZeroVector;
 #endif
-				if (VertexIndex < Primitive.Normals.Num())
+				if (VertexIndex < Primitive.GetNumNormals())
 				{
 #if ENGINE_MAJOR_VERSION > 4
-					ModelVertex.TangentZ = FVector3f(FVector(Primitive.Normals[VertexIndex]));
+					ModelVertex.TangentZ = Primitive.GetNormal(VertexIndex);
 #else
-					ModelVertex.TangentZ = Primitive.Normals[VertexIndex];
+					ModelVertex.TangentZ = Primitive.GetNormal(VertexIndex);
 #endif
 				}
 				else
@@ -341,13 +344,14 @@ bool glTFRuntime::FillSkeletalMeshRenderData(FSkeletalMeshRenderData* RenderData
 					LOD->bHasNormals = false;
 				}
 
-				if (VertexIndex < Primitive.Tangents.Num())
+				if (VertexIndex < Primitive.GetNumTangents())
 				{
+					const FglTFRuntimeVector4f Tangent = Primitive.GetTangent(VertexIndex);
 #if ENGINE_MAJOR_VERSION > 4
-					TangentXW = Primitive.Tangents[VertexIndex].W;
-					ModelVertex.TangentX = FVector4f(Primitive.Tangents[VertexIndex]);
+					TangentXW = Tangent.W;
+					ModelVertex.TangentX = Tangent;
 #else
-					ModelVertex.TangentX = Primitive.Tangents[VertexIndex];
+					ModelVertex.TangentX = Tangent;
 #endif
 				}
 				else
@@ -355,13 +359,13 @@ bool glTFRuntime::FillSkeletalMeshRenderData(FSkeletalMeshRenderData* RenderData
 					LOD->bHasTangents = false;
 				}
 
-				if (Primitive.UVs.Num() > 0 && VertexIndex < Primitive.UVs[0].Num())
+				if (VertexIndex < Primitive.GetNumUVs(0))
 				{
 
 #if ENGINE_MAJOR_VERSION > 4
-					ModelVertex.TexCoord = FVector2f(Primitive.UVs[0][VertexIndex]);
+					ModelVertex.TexCoord = Primitive.GetUV(0, VertexIndex);
 #else
-					ModelVertex.TexCoord = Primitive.UVs[0][VertexIndex];
+					ModelVertex.TexCoord = Primitive.GetUV(0, VertexIndex);
 #endif
 					LOD->bHasUV = true;
 				}
@@ -381,9 +385,9 @@ bool glTFRuntime::FillSkeletalMeshRenderData(FSkeletalMeshRenderData* RenderData
 				FVector TangentY = ComputeTangentYWithW(ModelVertex.TangentZ, ModelVertex.TangentX, TangentXW * TangentsDirection);
 #endif
 				FColor Color = FColor::White;
-				if (VertexIndex < Primitive.Colors.Num())
+				if (VertexIndex < Primitive.GetNumColors())
 				{
-					Color = FLinearColor(Primitive.Colors[VertexIndex]).ToFColor(true);
+					Color = Primitive.GetColor(VertexIndex).ToFColor(true);
 				}
 
 				LodRenderData->StaticVertexBuffers.PositionVertexBuffer.VertexPosition(BaseVertexIndex) = ModelVertex.Position;
@@ -404,7 +408,6 @@ bool glTFRuntime::FillSkeletalMeshRenderData(FSkeletalMeshRenderData* RenderData
 					for (int32 JointsIndex = 0; JointsIndex < JointsNum; JointsIndex++)
 					{
 						const FglTFRuntimeUInt16Vector4& Joints = Primitive.Joints[JointsIndex][VertexIndex];
-						const FVector4& Weights = Primitive.Weights[JointsIndex][VertexIndex];
 						for (int32 j = 0; j < 4; j++)
 						{
 							if (BoneMapInUse.Contains(Joints[j]))
@@ -420,7 +423,9 @@ bool glTFRuntime::FillSkeletalMeshRenderData(FSkeletalMeshRenderData* RenderData
 									BonesCacheInUse.Add(Joints[j], BoneIndex);
 								}
 
-								BONE_INFLUENCE_TYPE QuantizedWeight = FMath::Clamp((BONE_INFLUENCE_TYPE)(Weights[j] * ((double)MAX_BONE_INFLUENCE_WEIGHT)), (BONE_INFLUENCE_TYPE)0x00, (BONE_INFLUENCE_TYPE)MAX_BONE_INFLUENCE_WEIGHT);
+								// 16 bit weights are passed through as is, narrower ones are rounded (not truncated)
+								const uint32 Weight16 = Primitive.GetQuantizedWeight(JointsIndex, VertexIndex, j);
+								BONE_INFLUENCE_TYPE QuantizedWeight = static_cast<BONE_INFLUENCE_TYPE>(MAX_BONE_INFLUENCE_WEIGHT == 0xFFFF ? Weight16 : (Weight16 * MAX_BONE_INFLUENCE_WEIGHT + 0x7FFF) / 0xFFFF);
 
 								if (QuantizedWeight + TotalWeight > MAX_BONE_INFLUENCE_WEIGHT)
 								{
@@ -525,7 +530,7 @@ bool glTFRuntime::FillSkeletalMeshRenderData(FSkeletalMeshRenderData* RenderData
 		for (int32 PrimitiveIndex = 0; PrimitiveIndex < LOD->Primitives.Num(); PrimitiveIndex++)
 		{
 			FglTFRuntimePrimitive& Primitive = LOD->Primitives[PrimitiveIndex];
-			const int32 NumVertexInstancesPerSection = Primitive.bHasIndices ? Primitive.Indices.Num() : Primitive.Positions.Num();
+			const int32 NumVertexInstancesPerSection = Primitive.bHasIndices ? Primitive.Indices.Num() : Primitive.GetNumVertices();
 
 			TArray<uint32> CurrentIndices;
 			CurrentIndices.Reserve(NumVertexInstancesPerSection);
@@ -540,7 +545,7 @@ bool glTFRuntime::FillSkeletalMeshRenderData(FSkeletalMeshRenderData* RenderData
 			}
 			else
 			{
-				for (int32 Index = 0; Index < Primitive.Positions.Num(); Index++)
+				for (int32 Index = 0; Index < Primitive.GetNumVertices(); Index++)
 				{
 					LodRenderData->MultiSizeIndexContainer.GetIndexBuffer()->AddItem(LodRenderData->RenderSections[PrimitiveIndex].BaseVertexIndex + Index);
 					CurrentIndices.Add(LodRenderData->RenderSections[PrimitiveIndex].BaseVertexIndex + Index);
@@ -561,188 +566,80 @@ bool glTFRuntime::FillSkeletalMeshRenderData(FSkeletalMeshRenderData* RenderData
 						}
 					};
 
-				TSet<uint32> ProcessedVertices;
-				ProcessedVertices.Reserve(NumVertexInstancesPerSection);
-
-				FCriticalSection TangentsGenerationLock;
+				// shared vertices are resolved independently from the triangles adjacency (no locks)
+				const FglTFRuntimeTangentsGenerator TangentsGenerator(CurrentIndices);
+				const int32 FirstVertex = TangentsGenerator.GetFirstVertex();
+
+				TArray<FVector> Positions;
+				TArray<FVector> Normals;
+				TArray<FVector2D> UVs;
+				TArray<FVector4> Tangents;
+				Positions.AddUninitialized(TangentsGenerator.GetNumVertices());
+				Normals.AddUninitialized(TangentsGenerator.GetNumVertices());
+				if (LOD->bHasUV)
+				{
+					UVs.AddUninitialized(TangentsGenerator.GetNumVertices());
+				}
 
-				ParallelFor(NumVertexInstancesPerSection / 3, [&](const int32 VertexTriangleIndex)
+				ParallelFor(TangentsGenerator.GetNumVertices(), [&](const int32 VertexIndex)
 					{
-						bool bSetVertex0 = false;
-						bool bSetVertex1 = false;
-						bool bSetVertex2 = false;
-
-						const int32 VertexIndex0 = CurrentIndices[VertexTriangleIndex * 3];
-						const int32 VertexIndex1 = CurrentIndices[VertexTriangleIndex * 3 + 1];
-						const int32 VertexIndex2 = CurrentIndices[VertexTriangleIndex * 3 + 2];
-
-						if (Primitive.bHasIndices)
+						Positions[VertexIndex] = FVector(LodRenderData->StaticVertexBuffers.PositionVertexBuffer.VertexPosition(FirstVertex + VertexIndex));
+						Normals[VertexIndex] = FVector(LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentZ(FirstVertex + VertexIndex));
+						if (LOD->bHasUV)
 						{
-							FScopeLock Lock(&TangentsGenerationLock);
-
-							if (!ProcessedVertices.Contains(VertexIndex0))
-							{
-								ProcessedVertices.Add(VertexIndex0);
-								bSetVertex0 = true;
-							}
-
-							if (!ProcessedVertices.Contains(VertexIndex1))
-							{
-								ProcessedVertices.Add(VertexIndex1);
-								bSetVertex1 = true;
-							}
-
-							if (!ProcessedVertices.Contains(VertexIndex2))
-							{
-								ProcessedVertices.Add(VertexIndex2);
-								bSetVertex2 = true;
-							}
-
-							if (!bSetVertex0 && !bSetVertex1 && !bSetVertex2)
-							{
-								return;
-							}
-						}
-						else
-						{
-							bSetVertex0 = true;
-							bSetVertex1 = true;
-							bSetVertex2 = true;
+							UVs[VertexIndex] = FVector2D(LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.GetVertexUV(FirstVertex + VertexIndex, 0));
 						}
+					});
 
-#if ENGINE_MAJOR_VERSION > 4
-						FVector Position0 = FVector(LodRenderData->StaticVertexBuffers.PositionVertexBuffer.VertexPosition(VertexIndex0));
-						FVector4 TangentZ0 = FVector4(LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentZ(VertexIndex0));
-#else
-						FVector Position0 = LodRenderData->StaticVertexBuffers.PositionVertexBuffer.VertexPosition(VertexIndex0);
-						FVector4 TangentZ0 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentZ(VertexIndex0);
-#endif
-
-
-#if ENGINE_MAJOR_VERSION > 4
-						FVector Position1 = FVector(LodRenderData->StaticVertexBuffers.PositionVertexBuffer.VertexPosition(VertexIndex1));
-						FVector4 TangentZ1 = FVector4(LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentZ(VertexIndex1));
-#else
-						FVector Position1 = LodRenderData->StaticVertexBuffers.PositionVertexBuffer.VertexPosition(VertexIndex1);
-						FVector4 TangentZ1 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentZ(VertexIndex1);
-#endif
-
+				if (!LOD->bHasNormals)
+				{
+					TangentsGenerator.GenerateNormals(Positions, Normals, SkeletalMeshConfig.bSmoothNormals, SkeletalMeshConfig.bMikkTSpaceTangents);
+				}
 
-#if ENGINE_MAJOR_VERSION > 4
-						FVector Position2 = FVector(LodRenderData->StaticVertexBuffers.PositionVertexBuffer.VertexPosition(VertexIndex2));
-						FVector4 TangentZ2 = FVector4(LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentZ(VertexIndex2));
-#else
-						FVector Position2 = LodRenderData->StaticVertexBuffers.PositionVertexBuffer.VertexPosition(VertexIndex2);
-						FVector4 TangentZ2 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentZ(VertexIndex2);
-#endif
+				if (!LOD->bHasTangents)
+				{
+					Tangents.AddUninitialized(TangentsGenerator.GetNumVertices());
+					TangentsGenerator.GenerateTangents(Positions, UVs, Normals, Tangents, SkeletalMeshConfig.bMikkTSpaceTangents);
+				}
 
-						if (!LOD->bHasNormals)
+				ParallelFor(TangentsGenerator.GetNumVertices(), [&](const int32 VertexIndex)
+					{
+						if (!TangentsGenerator.IsVertexReferenced(VertexIndex))
 						{
-							const FVector SideA = Position1 - Position0;
-							const FVector SideB = Position2 - Position0;
-
-							const FVector NormalFromCross = FVector::CrossProduct(SideB, SideA).GetSafeNormal();
-
-							TangentZ0 = NormalFromCross;
-							TangentZ1 = NormalFromCross;
-							TangentZ2 = NormalFromCross;
+							return;
 						}
 
-						// if we do not have tangents but we have normals and a UV channel, we can compute them
+						const int32 BufferVertexIndex = FirstVertex + VertexIndex;
+						const FVector TangentZ = Normals[VertexIndex];
+
 						if (!LOD->bHasTangents)
 						{
-							const FVector DeltaPosition0 = Position1 - Position0;
-							const FVector DeltaPosition1 = Position2 - Position0;
-
-							FVector TangentX0;
-							FVector TangentX1;
-							FVector TangentX2;
-
-							if (LOD->bHasUV)
-							{
-#if ENGINE_MAJOR_VERSION > 4
-								const FVector2f& UV0 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.GetVertexUV(VertexIndex0, 0);
-								const FVector2f& UV1 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.GetVertexUV(VertexIndex1, 0);
-								const FVector2f& UV2 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.GetVertexUV(VertexIndex2, 0);
-								const FVector2f DeltaUV0 = UV1 - UV0;
-								const FVector2f DeltaUV1 = UV2 - UV0;
-#else
-								const FVector2D& UV0 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.GetVertexUV(VertexIndex0, 0);
-								const FVector2D& UV1 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.GetVertexUV(VertexIndex1, 0);
-								const FVector2D& UV2 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.GetVertexUV(VertexIndex2, 0);
-								const FVector2D DeltaUV0 = UV1 - UV0;
-								const FVector2D DeltaUV1 = UV2 - UV0;
-#endif
-
-								const float Factor = 1.0f / (DeltaUV0.X * DeltaUV1.Y - DeltaUV0.Y * DeltaUV1.X);
-
-								const FVector TriangleTangentX = ((DeltaPosition0 * DeltaUV1.Y) - (DeltaPosition1 * DeltaUV0.Y)) * Factor;
-								const FVector TriangleTangentY = ((DeltaPosition0 * DeltaUV1.X) - (DeltaPosition1 * DeltaUV0.X)) * Factor;
-
-								TangentX0 = TriangleTangentX - (TangentZ0 * FVector::DotProduct(TangentZ0, TriangleTangentX));
-								TangentX0.Normalize();
-
-								TangentX1 = TriangleTangentX - (TangentZ1 * FVector::DotProduct(TangentZ1, TriangleTangentX));
-								TangentX1.Normalize();
-
-								TangentX2 = TriangleTangentX - (TangentZ2 * FVector::DotProduct(TangentZ2, TriangleTangentX));
-								TangentX2.Normalize();
-							}
-							else
-							{
-								TangentX0 = FVector::CrossProduct(TangentZ0, FVector::UpVector);
-								TangentX1 = FVector::CrossProduct(TangentZ1, FVector::UpVector);
-								TangentX2 = FVector::CrossProduct(TangentZ2, FVector::UpVector);
-							}
-
+							FVector TangentX = FVector(Tangents[VertexIndex]);
 #if PLATFORM_ANDROID
-							FixVectorIfNan(TangentX0, 0);
-							FixVectorIfNan(TangentX1, 0);
-							FixVectorIfNan(TangentX2, 0);
+							FixVectorIfNan(TangentX, 0);
 #endif
 
-							FVector TangentY0 = ComputeTangentY(TangentZ0, TangentX0) * TangentsDirection;
-							FVector TangentY1 = ComputeTangentY(TangentZ1, TangentX1) * TangentsDirection;
-							FVector TangentY2 = ComputeTangentY(TangentZ2, TangentX2) * TangentsDirection;
+							FVector TangentY = SkeletalMeshConfig.bMikkTSpaceTangents ? ComputeTangentYWithW(TangentZ, TangentX, Tangents[VertexIndex].W * TangentsDirection) : ComputeTangentY(TangentZ, TangentX) * TangentsDirection;
 #if PLATFORM_ANDROID
-							FixVectorIfNan(TangentY0, 1);
-							FixVectorIfNan(TangentY1, 1);
-							FixVectorIfNan(TangentY2, 1);
+							FixVectorIfNan(TangentY, 1);
 #endif
 
-
 #if ENGINE_MAJOR_VERSION > 4
-							LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(VertexIndex0, FVector3f(TangentX0), FVector3f(TangentY0), FVector3f(FVector(TangentZ0)));
-							LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(VertexIndex1, FVector3f(TangentX1), FVector3f(TangentY1), FVector3f(FVector(TangentZ1)));
-							LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(VertexIndex2, FVector3f(TangentX2), FVector3f(TangentY2), FVector3f(FVector(TangentZ2)));
+							LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(BufferVertexIndex, FVector3f(TangentX), FVector3f(TangentY), FVector3f(TangentZ));
 #else
-							LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(VertexIndex0, TangentX0, TangentY0, TangentZ0);
-							LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(VertexIndex1, TangentX1, TangentY1, TangentZ1);
-							LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(VertexIndex2, TangentX2, TangentY2, TangentZ2);
+							LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(BufferVertexIndex, TangentX, TangentY, TangentZ);
 #endif
 						}
 						else if (!LOD->bHasNormals) // if we are here we need to reapply normals
 						{
 #if ENGINE_MAJOR_VERSION > 4
-							FVector4f TangentX0 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentX(VertexIndex0);
-							FVector4f TangentX1 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentX(VertexIndex1);
-							FVector4f TangentX2 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentX(VertexIndex2);
-							FVector3f TangentY0 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentY(VertexIndex0);
-							FVector3f TangentY1 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentY(VertexIndex1);
-							FVector3f TangentY2 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentY(VertexIndex2);
-							LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(VertexIndex0, TangentX0, TangentY0, FVector4f(TangentZ0));
-							LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(VertexIndex1, TangentX1, TangentY1, FVector4f(TangentZ1));
-							LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(VertexIndex2, TangentX2, TangentY2, FVector4f(TangentZ2));
+							FVector4f TangentX = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentX(BufferVertexIndex);
+							FVector3f TangentY = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentY(BufferVertexIndex);
+							LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(BufferVertexIndex, TangentX, TangentY, FVector4f(FVector4(TangentZ)));
 #else
-							FVector4 TangentX0 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentX(VertexIndex0);
-							FVector4 TangentX1 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentX(VertexIndex1);
-							FVector4 TangentX2 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentX(VertexIndex2);
-							FVector TangentY0 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentY(VertexIndex0);
-							FVector TangentY1 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentY(VertexIndex1);
-							FVector TangentY2 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentY(VertexIndex2);
-							LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(VertexIndex0, TangentX0, TangentY0, TangentZ0);
-							LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(VertexIndex1, TangentX1, TangentY1, TangentZ1);
-							LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(VertexIndex2, TangentX2, TangentY2, TangentZ2);
+							FVector4 TangentX = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentX(BufferVertexIndex);
+							FVector TangentY = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentY(BufferVertexIndex);
+							LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(BufferVertexIndex, TangentX, TangentY, FVector4(TangentZ));
 #endif
 						}
 					});
@@ -800,7 +697,16 @@ USkeletalMesh* FglTFRuntimeParser::CreateSkeletalMeshFromLODs(TSharedRef<FglTFRu
 #endif
 
 	TMap<int32, FName> MainBoneMap;
-	if (!SkeletalMeshContext->SkeletalMeshConfig.bIgnoreSkin && SkeletalMeshContext->SkinIndex > INDEX_NONE)
+	// the cooked skeleton already went through the skin resolution
+	if (SkeletalMeshContext->bFromCookedMeshCache)
+	{
+		if (!FillLODSkeleton(RefSkeleton, MainBoneMap, SkeletalMeshContext->LODs[0]->Skeleton))
+		{
+			AddError("CreateSkeletalMeshFromLODs()", "Unable to fill RefSkeleton from cooked mesh cache.");
+			return nullptr;
+		}
+	}
+	else if (!SkeletalMeshContext->SkeletalMeshConfig.bIgnoreSkin && SkeletalMeshContext->SkinIndex > INDEX_NONE)
 	{
 		TSharedPtr<FJsonObject>	JsonSkinObject = GetJsonObjectFromRootIndex("skins", SkeletalMeshContext->SkinIndex);
 		if (!JsonSkinObject)
@@ -871,6 +777,26 @@ USkeletalMesh* FglTFRuntimeParser::CreateSkeletalMeshFromLODs(TSharedRef<FglTFRu
 		}
 	}
 
+	// only skin based meshes are cooked, the skeleton is stored before the SkeletonConfig tweaks (they are applied again on load)
+	TArray<FglTFRuntimeBone> CookedSkeleton;
+	const bool bCookMesh = !SkeletalMeshContext->CookedMeshCacheFilename.IsEmpty() &&
+		!SkeletalMeshContext->bFromCookedMeshCache &&
+		!SkeletalMeshContext->SkeletalMeshConfig.bIgnoreSkin &&
+		SkeletalMeshContext->SkinIndex > INDEX_NONE &&
+		SkeletalMeshContext->LODs.Num() == 1;
+	if (bCookMesh)
+	{
+		const TArray<FMeshBoneInfo>& BonesInfo = RefSkeleton.GetRefBoneInfo();
+		const TArray<FTransform>& BonesPose = RefSkeleton.GetRefBonePose();
+		CookedSkeleton.AddDefaulted(BonesInfo.Num());
+		for (int32 BoneIndex = 0; BoneIndex < BonesInfo.Num(); BoneIndex++)
+		{
+			CookedSkeleton[BoneIndex].BoneName = BonesInfo[BoneIndex].Name.ToString();
+			CookedSkeleton[BoneIndex].ParentIndex = BonesInfo[BoneIndex].ParentIndex;
+			CookedSkeleton[BoneIndex].Transform = BonesPose[BoneIndex];
+		}
+	}
+
 	if (SkeletalMeshContext->SkeletalMeshConfig.SkeletonConfig.bNormalizeSkeletonScale)
 	{
 		NormalizeSkeletonScale(RefSkeleton);
@@ -935,6 +861,18 @@ USkeletalMesh* FglTFRuntimeParser::CreateSkeletalMeshFromLODs(TSharedRef<FglTFRu
 		return nullptr;
 	}
 
+	if (bCookMesh)
+	{
+		if (FglTFRuntimeCookedMeshCache::Save(SkeletalMeshContext->CookedMeshCacheFilename, *SkeletalMeshContext->LODs[0], CookedSkeleton, MainBoneMap))
+		{
+			FglTFRuntimeCookedMeshCache::Trim();
+		}
+		else
+		{
+			UE_LOG(LogGLTFRuntime, Warning, TEXT("Unable to write cooked mesh cache %s"), *SkeletalMeshContext->CookedMeshCacheFilename);
+		}
+	}
+
 	FillAssetUserData(SkeletalMeshContext->MeshIndex, SkeletalMeshContext->SkeletalMesh);
 
 	return SkeletalMeshContext->SkeletalMesh;
@@ -1020,47 +958,55 @@ USkeletalMesh* FglTFRuntimeParser::FinalizeSkeletalMeshWithLODs(TSharedRef<FglTF
 
 				for (FglTFRuntimeMorphTarget& MorphTargetData : Primitive.MorphTargets)
 				{
-					bool bSkip = true;
 					FMorphTargetLODModel MorphTargetLODModel;
 					MorphTargetLODModel.NumBaseMeshVerts = Primitive.Indices.Num();
 					MorphTargetLODModel.SectionIndices.Add(PrimitiveIndex);
 
-					for (int32 VertexIndex = 0; VertexIndex < Primitive.Positions.Num(); VertexIndex++)
-					{
-						FMorphTargetDelta Delta;
-						if (VertexIndex < MorphTargetData.Positions.Num())
+					// only the deltas above the threshold are stored (sparse targets are never expanded)
+					const int32 NumDeltas = MorphTargetData.IsSparse() ? MorphTargetData.Indices.Num() : Primitive.GetNumVertices();
+					const float DeltaThreshold = SkeletalMeshContext->SkeletalMeshConfig.MorphTargetsDeltaThreshold;
+					auto IsDeltaRelevant = [&MorphTargetData, DeltaThreshold](const int32 DeltaIndex)
 						{
-#if ENGINE_MAJOR_VERSION > 4
-							Delta.PositionDelta = FVector3f(MorphTargetData.Positions[VertexIndex]);
-#else
-							Delta.PositionDelta = MorphTargetData.Positions[VertexIndex];
-#endif
-						}
-						else
+							return (MorphTargetData.Positions.IsValidIndex(DeltaIndex) && !MorphTargetData.Positions[DeltaIndex].IsNearlyZero(DeltaThreshold)) ||
+								(MorphTargetData.Normals.IsValidIndex(DeltaIndex) && !MorphTargetData.Normals[DeltaIndex].IsNearlyZero(DeltaThreshold));
+						};
+
+					int32 NumRelevantDeltas = 0;
+					for (int32 DeltaIndex = 0; DeltaIndex < NumDeltas; DeltaIndex++)
+					{
+						if (IsDeltaRelevant(DeltaIndex))
 						{
-#if ENGINE_MAJOR_VERSION > 4
-							Delta.PositionDelta = FVector3f::ZeroVector;
-#else
-							Delta.PositionDelta = FVector::ZeroVector;
-#endif
+							NumRelevantDeltas++;
 						}
+					}
 
-						if (!Delta.PositionDelta.IsNearlyZero())
+					MorphTargetLODModel.Vertices.Reserve(NumRelevantDeltas);
+					for (int32 DeltaIndex = 0; DeltaIndex < NumDeltas; DeltaIndex++)
+					{
+						if (!IsDeltaRelevant(DeltaIndex))
 						{
-							bSkip = false;
+							continue;
 						}
 
-						Delta.SourceIdx = BaseIndex + VertexIndex;
+						const FVector PositionDelta = MorphTargetData.Positions.IsValidIndex(DeltaIndex) ? MorphTargetData.Positions[DeltaIndex] : FVector::ZeroVector;
+						const FVector NormalDelta = MorphTargetData.Normals.IsValidIndex(DeltaIndex) ? MorphTargetData.Normals[DeltaIndex] : FVector::ZeroVector;
+
+						FMorphTargetDelta Delta;
 #if ENGINE_MAJOR_VERSION > 4
-						Delta.TangentZDelta = FVector3f::ZeroVector;
+						Delta.PositionDelta = FVector3f(PositionDelta);
+						Delta.TangentZDelta = FVector3f(NormalDelta);
 #else
-						Delta.TangentZDelta = FVector::ZeroVector;
+						Delta.PositionDelta = PositionDelta;
+						Delta.TangentZDelta = NormalDelta;
 #endif
+						Delta.SourceIdx = BaseIndex + (MorphTargetData.IsSparse() ? MorphTargetData.Indices[DeltaIndex] : DeltaIndex);
 						MorphTargetLODModel.Vertices.Add(Delta);
+					}
 #if ENGINE_MAJOR_VERSION > 4
-						MorphTargetLODModel.NumVertices = MorphTargetLODModel.Vertices.Num();
+					MorphTargetLODModel.NumVertices = MorphTargetLODModel.Vertices.Num();
 #endif
-					}
+
+					const bool bSkip = MorphTargetLODModel.Vertices.Num() == 0;
 
 					if (SkeletalMeshContext->SkeletalMeshConfig.bIgnoreEmptyMorphTargets && bSkip)
 					{
@@ -1229,6 +1175,14 @@ USkeletalMesh* FglTFRuntimeParser::FinalizeSkeletalMeshWithLODs(TSharedRef<FglTF
 			SkeletalMeshContext->GetSkeleton()->MergeAllBonesToBoneTree(SkeletalMeshContext->SkeletalMesh);
 		}
 	}
+	else if (SkeletalMeshContext->SharedSkeleton && SkeletalMeshContext->SharedSkeleton->MergeAllBonesToBoneTree(SkeletalMeshContext->SkeletalMesh))
+	{
+#if ENGINE_MAJOR_VERSION > 4 || ENGINE_MINOR_VERSION > 26
+		SkeletalMeshContext->SkeletalMesh->SetSkeleton(SkeletalMeshContext->SharedSkeleton);
+#else
+		SkeletalMeshContext->SkeletalMesh->Skeleton = SkeletalMeshContext->SharedSkeleton;
+#endif
+	}
 	else
 	{
 		if (CanReadFromCache(SkeletalMeshContext->SkeletalMeshConfig.SkeletonConfig.CacheMode) && SkeletalMeshContext->SkinIndex > -1 && SkeletonsCache.Contains(SkeletalMeshContext->SkinIndex))
@@ -1354,6 +1308,12 @@ void FglTFRuntimeParser::GeneratePhysicsAsset_Internal(FglTFRuntimeSkeletalMeshC
 		TMap<int32, FBox> ValidBoneBoxes;
 
 		const float MinBoneSize = SkeletalMeshContext->SkeletalMeshConfig.PhysicsAssetAutoBodyConfig.MinBoneSize;
+		const bool bFitCapsules = SkeletalMeshContext->SkeletalMeshConfig.PhysicsAssetAutoBodyConfig.bFitCapsules &&
+			SkeletalMeshContext->SkeletalMeshConfig.PhysicsAssetAutoBodyConfig.CollisionType == EglTFRuntimePhysicsAssetAutoBodyCollisionType::Capsule &&
+			!SkeletalMeshContext->SkeletalMeshConfig.BoneBoundsFilter.Filter.IsBound();
+
+		// all of the bones in a single pass
+		SkeletalMeshContext->CacheBonesBounds(bFitCapsules);
 
 		for (int32 BoneIndex = 0; BoneIndex < NumBones; BoneIndex++)
 		{
@@ -1394,8 +1354,16 @@ void FglTFRuntimeParser::GeneratePhysicsAsset_Internal(FglTFRuntimeSkeletalMeshC
 			if (SkeletalMeshContext->SkeletalMeshConfig.PhysicsAssetAutoBodyConfig.CollisionType == EglTFRuntimePhysicsAssetAutoBodyCollisionType::Capsule)
 			{
 				FKSphylElem Capsule;
+				FglTFRuntimeCapsule FittedCapsule;
+				if (bFitCapsules && SkeletalMeshContext->GetBoneCapsule(BoneIndex, FittedCapsule))
+				{
+					Capsule.Center = FittedCapsule.Center;
+					Capsule.Rotation = FittedCapsule.Rotation;
+					Capsule.Radius = FittedCapsule.Radius * CollisionScale;
+					Capsule.Length = FittedCapsule.Length * CollisionScale;
+				}
 				// orient the capsule based on the longest axis
-				if (BoxExtent.X > BoxExtent.Z && BoxExtent.X > BoxExtent.Y)
+				else if (BoxExtent.X > BoxExtent.Z && BoxExtent.X > BoxExtent.Y)
 				{
 					Capsule.SetTransform(FTransform(FQuat(FVector(0, 1, 0), -PI * 0.5f)) * BoneTransform);
 					Capsule.Radius = FMath::Max(BoxExtent.Y, BoxExtent.Z) * CollisionScale;
@@ -1740,30 +1708,60 @@ void FglTFRuntimeParser::GeneratePhysicsAsset_Internal(FglTFRuntimeSkeletalMeshC
 #endif
 }
 
-USkeletalMesh* FglTFRuntimeParser::LoadSkeletalMesh(const int32 MeshIndex, const int32 SkinIndex, const FglTFRuntimeSkeletalMeshConfig& SkeletalMeshConfig)
+bool FglTFRuntimeParser::LoadSkeletalMeshContextLOD(TSharedRef<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe> SkeletalMeshContext, const FString& ErrorContext)
 {
-	// first check cache
-	if (CanReadFromCache(SkeletalMeshConfig.CacheMode) && SkeletalMeshesCache.Contains(MeshIndex))
+	const FglTFRuntimeSkeletalMeshConfig& SkeletalMeshConfig = SkeletalMeshContext->SkeletalMeshConfig;
+
+	// streamed assets are keyed by url, ETag, size and JSON chunk, so the lookup does not wait for the BIN chunk
+	const FString CookedContentHash = (ContentHash.IsEmpty() && StreamingBinaryBuffer) ? StreamingBinaryBuffer->GetContentHash() : ContentHash;
+
+	if (!CookedContentHash.IsEmpty())
 	{
-		return SkeletalMeshesCache[MeshIndex];
+		SkeletalMeshContext->CookedMeshCacheFilename = FglTFRuntimeCookedMeshCache::GetFilename(CookedContentHash, SkeletalMeshContext->MeshIndex, SkeletalMeshContext->SkinIndex, SkeletalMeshConfig);
+
+		FglTFRuntimeMeshLOD CookedLOD;
+		if (!SkeletalMeshContext->CookedMeshCacheFilename.IsEmpty() && FglTFRuntimeCookedMeshCache::Load(SkeletalMeshContext->CookedMeshCacheFilename, CookedLOD) && RebindCookedMaterials(SkeletalMeshContext->MeshIndex, CookedLOD, SkeletalMeshConfig.MaterialsConfig))
+		{
+			UE_LOG(LogGLTFRuntime, Verbose, TEXT("Mesh %d loaded from cooked mesh cache %s"), SkeletalMeshContext->MeshIndex, *SkeletalMeshContext->CookedMeshCacheFilename);
+			SkeletalMeshContext->CachedRuntimeMeshLODs.Add(MoveTemp(CookedLOD));
+			SkeletalMeshContext->LODs.Add(&SkeletalMeshContext->CachedRuntimeMeshLODs.Last());
+			SkeletalMeshContext->bFromCookedMeshCache = true;
+			return true;
+		}
 	}
 
-	TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex("meshes", MeshIndex);
+	TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex("meshes", SkeletalMeshContext->MeshIndex);
 	if (!JsonMeshObject)
 	{
-		AddError("LoadSkeletalMesh()", FString::Printf(TEXT("Unable to find Mesh with index %d"), MeshIndex));
-		return nullptr;
+		AddError(ErrorContext, FString::Printf(TEXT("Unable to find Mesh with index %d"), SkeletalMeshContext->MeshIndex));
+		return false;
 	}
 
 	FglTFRuntimeMeshLOD* LOD = nullptr;
-	if (!LoadMeshIntoMeshLOD(JsonMeshObject.ToSharedRef(), LOD, SkeletalMeshConfig.MaterialsConfig))
+	if (!LoadMeshIntoMeshLOD(JsonMeshObject.ToSharedRef(), LOD, SkeletalMeshConfig.MaterialsConfig, SkeletalMeshConfig.bCompactPrimitives, SkeletalMeshConfig.bUseHighPrecisionTangentBasis))
 	{
-		return nullptr;
+		return false;
+	}
+
+	SkeletalMeshContext->LODs.Add(LOD);
+	return true;
+}
+
+USkeletalMesh* FglTFRuntimeParser::LoadSkeletalMesh(const int32 MeshIndex, const int32 SkinIndex, const FglTFRuntimeSkeletalMeshConfig& SkeletalMeshConfig)
+{
+	// first check cache
+	if (CanReadFromCache(SkeletalMeshConfig.CacheMode) && SkeletalMeshesCache.Contains(MeshIndex))
+	{
+		return SkeletalMeshesCache[MeshIndex];
 	}
 
 	TSharedRef<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe> SkeletalMeshContext = MakeShared<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe>(AsShared(), MeshIndex, SkeletalMeshConfig);
 	SkeletalMeshContext->SkinIndex = SkinIndex;
-	SkeletalMeshContext->LODs.Add(LOD);
+
+	if (!LoadSkeletalMeshContextLOD(SkeletalMeshContext, "LoadSkeletalMesh()"))
+	{
+		return nullptr;
+	}
 
 	if (!CreateSkeletalMeshFromLODs(SkeletalMeshContext))
 	{
@@ -1791,27 +1789,157 @@ void FglTFRuntimeParser::LoadSkeletalMeshAsync(const int32 MeshIndex, const int3
 	TSharedRef<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe> SkeletalMeshContext = MakeShared<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe>(AsShared(), MeshIndex, SkeletalMeshConfig);
 	SkeletalMeshContext->SkinIndex = SkinIndex;
 
-	Async(EAsyncExecution::Thread, [this, SkeletalMeshContext, MeshIndex, AsyncCallback]()
+	AddAsyncTask([this, SkeletalMeshContext, MeshIndex, AsyncCallback](const bool bCancelled)
 		{
 			FglTFRuntimeSkeletalMeshContextFinalizer AsyncFinalizer(SkeletalMeshContext, AsyncCallback);
 
-			TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex("meshes", MeshIndex);
-			if (!JsonMeshObject)
+			// the finalizer reports the (null) SkeletalMesh to the callback
+			if (bCancelled)
 			{
-				AddError("LoadSkeletalMeshAsync()", FString::Printf(TEXT("Unable to find Mesh with index %d"), MeshIndex));
 				return;
 			}
 
-			FglTFRuntimeMeshLOD* LOD = nullptr;
-			if (!LoadMeshIntoMeshLOD(JsonMeshObject.ToSharedRef(), LOD, SkeletalMeshContext->SkeletalMeshConfig.MaterialsConfig))
+			if (!LoadSkeletalMeshContextLOD(SkeletalMeshContext, "LoadSkeletalMeshAsync()"))
 			{
 				return;
 			}
 
-			SkeletalMeshContext->LODs.Add(LOD);
-
 			SkeletalMeshContext->SkeletalMesh = CreateSkeletalMeshFromLODs(SkeletalMeshContext);
-		});
+		}, SkeletalMeshConfig.AsyncPriority, SkeletalMeshConfig.AsyncCancellationToken);
+}
+
+bool FglTFRuntimeParser::GetSkinnedMeshNodes(TArray<FglTFRuntimeNode>& SkinnedMeshNodes)
+{
+	TArray<FglTFRuntimeNode> Nodes;
+
+	const int32 SceneIndex = GetDefaultSceneIndex();
+	FglTFRuntimeScene Scene;
+	if (LoadScene(SceneIndex > INDEX_NONE ? SceneIndex : 0, Scene))
+	{
+		for (const int32 NodeIndex : Scene.RootNodesIndices)
+		{
+			if (!LoadNodesRecursive(NodeIndex, Nodes))
+			{
+				return false;
+			}
+		}
+	}
+	// no scenes, consider every node
+	else if (!GetAllNodes(Nodes))
+	{
+		return false;
+	}
+
+	for (const FglTFRuntimeNode& Node : Nodes)
+	{
+		if (Node.MeshIndex > INDEX_NONE && Node.SkinIndex > INDEX_NONE)
+		{
+			SkinnedMeshNodes.Add(Node);
+		}
+	}
+
+	return true;
+}
+
+void FglTFRuntimeParser::LoadSkinnedMeshNodesAsync(const TArray<FglTFRuntimeNode>& SkinnedMeshNodes, const FglTFRuntimeSkeletalMeshesAsync& AsyncCallback, const FglTFRuntimeSkeletalMeshConfig& SkeletalMeshConfig)
+{
+	TArray<FglTFRuntimeSkeletalMeshContextRef> SkeletalMeshContexts;
+	TSet<TPair<int32, int32>> MeshesAndSkins;
+	for (const FglTFRuntimeNode& Node : SkinnedMeshNodes)
+	{
+		// the same mesh can be instanced by multiple nodes
+		bool bAlreadyInSet = false;
+		MeshesAndSkins.Add(TPair<int32, int32>(Node.MeshIndex, Node.SkinIndex), &bAlreadyInSet);
+		if (bAlreadyInSet)
+		{
+			continue;
+		}
+
+		FglTFRuntimeSkeletalMeshContextRef SkeletalMeshContext = MakeShared<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe>(AsShared(), Node.MeshIndex, SkeletalMeshConfig);
+		SkeletalMeshContext->SkinIndex = Node.SkinIndex;
+		SkeletalMeshContexts.Add(SkeletalMeshContext);
+	}
+
+	AddAsyncTask([this, SkeletalMeshContexts, AsyncCallback, SkeletalMeshConfig](const bool bCancelled)
+		{
+			// decode the textures of the whole batch at once, instead of mesh by mesh
+			TArray<FglTFRuntimePrefetchedTextureKey> PrefetchedTextures;
+			if (!bCancelled)
+			{
+				TArray<TSharedRef<FJsonObject>> JsonMeshObjects;
+				for (const FglTFRuntimeSkeletalMeshContextRef& SkeletalMeshContext : SkeletalMeshContexts)
+				{
+					TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex("meshes", SkeletalMeshContext->MeshIndex);
+					if (JsonMeshObject)
+					{
+						JsonMeshObjects.Add(JsonMeshObject.ToSharedRef());
+					}
+				}
+				PrefetchedTextures = PrefetchMeshesTextures(JsonMeshObjects, SkeletalMeshConfig.MaterialsConfig);
+			}
+
+			// LODsCache is not thread safe, so the meshes are built in sequence (each build is internally parallel)
+			for (const FglTFRuntimeSkeletalMeshContextRef& SkeletalMeshContext : SkeletalMeshContexts)
+			{
+				if (bCancelled)
+				{
+					SkeletalMeshContext->SkeletalMesh = nullptr;
+					continue;
+				}
+
+				if (!LoadSkeletalMeshContextLOD(SkeletalMeshContext, "LoadSkinnedMeshNodesAsync()"))
+				{
+					SkeletalMeshContext->SkeletalMesh = nullptr;
+					continue;
+				}
+
+				SkeletalMeshContext->SkeletalMesh = CreateSkeletalMeshFromLODs(SkeletalMeshContext);
+			}
+
+			// textures of cached materials (or of failed meshes) are never consumed
+			DiscardPrefetchedTextures(PrefetchedTextures);
+
+			// a single game thread hop finalizes the whole batch
+			FFunctionGraphTask::CreateAndDispatchWhenReady([this, SkeletalMeshContexts, AsyncCallback]()
+				{
+					TArray<USkeletalMesh*> SkeletalMeshes;
+					USkeleton* SharedSkeleton = nullptr;
+
+					for (const FglTFRuntimeSkeletalMeshContextRef& SkeletalMeshContext : SkeletalMeshContexts)
+					{
+						if (SkeletalMeshContext->SkeletalMesh)
+						{
+							SkeletalMeshContext->SharedSkeleton = SharedSkeleton;
+							SkeletalMeshContext->SkeletalMesh = FinalizeSkeletalMeshWithLODs(SkeletalMeshContext);
+						}
+
+						if (SkeletalMeshContext->SkeletalMesh)
+						{
+							if (!SharedSkeleton)
+							{
+								SharedSkeleton = SkeletalMeshContext->GetSkeleton();
+							}
+
+							if (CanWriteToCache(SkeletalMeshContext->SkeletalMeshConfig.CacheMode))
+							{
+								SkeletalMeshesCache.Add(SkeletalMeshContext->MeshIndex, SkeletalMeshContext->SkeletalMesh);
+							}
+
+							SkeletalMeshes.Add(SkeletalMeshContext->SkeletalMesh);
+						}
+					}
+
+					AsyncCallback.ExecuteIfBound(SkeletalMeshes);
+
+#if (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 2) || ENGINE_MAJOR_VERSION > 5
+					for (const FglTFRuntimeSkeletalMeshContextRef& SkeletalMeshContext : SkeletalMeshContexts)
+					{
+						// this is ugly, but we need to avoid at all costs to have the FGCObject dtor to be run out of the game thread
+						SkeletalMeshContext->UnregisterGCObject();
+					}
+#endif
+				}, TStatId(), nullptr, ENamedThreads::GameThread);
+		}, SkeletalMeshConfig.AsyncPriority, SkeletalMeshConfig.AsyncCancellationToken);
 }
 
 USkeletalMesh* FglTFRuntimeParser::LoadSkeletalMeshLODs(const TArray<int32>& MeshIndices, const int32 SkinIndex, const FglTFRuntimeSkeletalMeshConfig& SkeletalMeshConfig)
@@ -1829,7 +1957,7 @@ USkeletalMesh* FglTFRuntimeParser::LoadSkeletalMeshLODs(const TArray<int32>& Mes
 		}
 
 		FglTFRuntimeMeshLOD* LOD = nullptr;
-		if (!LoadMeshIntoMeshLOD(JsonMeshObject.ToSharedRef(), LOD, SkeletalMeshConfig.MaterialsConfig))
+		if (!LoadMeshIntoMeshLOD(JsonMeshObject.ToSharedRef(), LOD, SkeletalMeshConfig.MaterialsConfig, SkeletalMeshConfig.bCompactPrimitives, SkeletalMeshConfig.bUseHighPrecisionTangentBasis))
 		{
 			return nullptr;
 		}
@@ -1871,9 +1999,15 @@ void FglTFRuntimeParser::LoadSkeletalMeshRecursiveAsync(const FString& NodeName,
 {
 	TSharedRef<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe> SkeletalMeshContext = MakeShared<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe>(AsShared(), -1, SkeletalMeshConfig);
 
-	Async(EAsyncExecution::Thread, [this, SkeletalMeshContext, ExcludeNodes, NodeName, SkinIndex, AsyncCallback, TransformApplyRecursiveMode]()
+	AddAsyncTask([this, SkeletalMeshContext, ExcludeNodes, NodeName, SkinIndex, AsyncCallback, TransformApplyRecursiveMode](const bool bCancelled)
 		{
 			FglTFRuntimeSkeletalMeshContextFinalizer AsyncFinalizer(SkeletalMeshContext, AsyncCallback);
+
+			if (bCancelled)
+			{
+				return;
+			}
+
 			// ensure to cache it as the finalizer requires LOD access
 			FglTFRuntimeMeshLOD& CombinedLOD = SkeletalMeshContext->CachedRuntimeMeshLODs.AddDefaulted_GetRef();
 			int32 NewSkinIndex = SkinIndex;
@@ -1886,7 +2020,7 @@ void FglTFRuntimeParser::LoadSkeletalMeshRecursiveAsync(const FString& NodeName,
 			SkeletalMeshContext->LODs.Add(&CombinedLOD);
 
 			SkeletalMeshContext->SkeletalMesh = CreateSkeletalMeshFromLODs(SkeletalMeshContext);
-		});
+		}, SkeletalMeshConfig.AsyncPriority, SkeletalMeshConfig.AsyncCancellationToken);
 }
 
 UAnimSequence* FglTFRuntimeParser::LoadSkeletalAnimationByName(USkeletalMesh* SkeletalMesh, const FString& AnimationName, const FglTFRuntimeSkeletalAnimationConfig& SkeletalAnimationConfig, const bool bCaseSensitive)
@@ -2485,6 +2619,13 @@ UAnimSequence* FglTFRuntimeParser::LoadSkeletalAnimationFromTracksAndMorphTarget
 	AnimSequence->PostProcessSequence();
 #endif
 #else
+	if (SkeletalAnimationConfig.bCompressTracks)
+	{
+		if (CompressionCodec->CompressTracks(SkeletalAnimationConfig.CompressionTranslationTolerance, SkeletalAnimationConfig.CompressionRotationTolerance, SkeletalAnimationConfig.CompressionScaleTolerance))
+		{
+			UE_LOG(LogGLTFRuntime, Log, TEXT("Compressed animation tracks: %lld bytes (%.2f:1)"), CompressionCodec->GetCompressedSize(), CompressionCodec->GetCompressedSize() > 0 ? static_cast<double>(CompressionCodec->GetRawSize()) / CompressionCodec->GetCompressedSize() : 0.0);
+		}
+	}
 #if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 6
 	PRAGMA_DISABLE_DEPRECATION_WARNINGS
 		AnimSequence->CompressedData.CompressedDataStructure = MakeUnique<FUECompressedAnimData>();
@@ -2919,6 +3060,13 @@ UAnimSequence* FglTFRuntimeParser::CreateAnimationFromPose(USkeletalMesh* Skelet
 	AnimSequence->PostProcessSequence();
 #endif
 #else
+	if (SkeletalAnimationConfig.bCompressTracks)
+	{
+		if (CompressionCodec->CompressTracks(SkeletalAnimationConfig.CompressionTranslationTolerance, SkeletalAnimationConfig.CompressionRotationTolerance, SkeletalAnimationConfig.CompressionScaleTolerance))
+		{
+			UE_LOG(LogGLTFRuntime, Log, TEXT("Compressed animation tracks: %lld bytes (%.2f:1)"), CompressionCodec->GetCompressedSize(), CompressionCodec->GetCompressedSize() > 0 ? static_cast<double>(CompressionCodec->GetRawSize()) / CompressionCodec->GetCompressedSize() : 0.0);
+		}
+	}
 #if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 6
 	PRAGMA_DISABLE_DEPRECATION_WARNINGS
 		AnimSequence->CompressedData.CompressedDataStructure = MakeUnique<FUECompressedAnimData>();
@@ -3575,6 +3723,8 @@ bool FglTFRuntimeParser::LoadSkeletalAnimation_Internal(TSharedRef<FJsonObject>
 			return FTransform(WorldRetargetMatrix * WorldRetargetParentPoseTransform.ToMatrixWithScale().Inverse());
 		};
 
+	const FMatrix SceneBasisInverse = SceneBasis.Inverse();
+
 	auto Callback = [&](const FglTFRuntimeNode& Node, const FString& Path, const FglTFRuntimeAnimationCurve& Curve)
 		{
 			FString TrackName = Node.Name;
@@ -3603,6 +3753,8 @@ bool FglTFRuntimeParser::LoadSkeletalAnimation_Internal(TSharedRef<FJsonObject>
 
 			float FrameDelta = 1.f / SkeletalAnimationConfig.FramesPerSecond;
 
+			const bool bCubicSpline = Curve.Values.Num() == Curve.InTangents.Num() && Curve.InTangents.Num() == Curve.OutTangents.Num();
+
 			if (Path == "rotation" && !SkeletalAnimationConfig.bRemoveRotations)
 			{
 				if (Curve.Timeline.Num() != Curve.Values.Num())
@@ -3622,43 +3774,55 @@ bool FglTFRuntimeParser::LoadSkeletalAnimation_Internal(TSharedRef<FJsonObject>
 
 				Track.RotKeys.AddUninitialized(NumFrames);
 
+				TArray<FglTFRuntimeAnimationFrameSample> Samples;
+				SampleTimeline(Curve.Timeline, NumFrames, FrameDelta, Samples);
+
+				// convert the keys to the Unreal basis only once (the cubic spline needs to be evaluated in the glTF one)
+				TArray<FQuat> Keys;
+				if (!bCubicSpline)
+				{
+					Keys.AddUninitialized(Curve.Values.Num());
+					ParallelFor(Keys.Num(), [&](const int32 KeyIndex)
+						{
+							const FVector4& QuatV = Curve.Values[KeyIndex];
+							Keys[KeyIndex] = (SceneBasisInverse * FQuatRotationMatrix(FQuat(QuatV.X, QuatV.Y, QuatV.Z, QuatV.W).GetNormalized()) * SceneBasis).ToQuat();
+						});
+				}
+
 				ParallelFor(NumFrames, [&](int32 FrameIndex)
 					{
 						const float FrameBase = FrameDelta * FrameIndex;
 						FQuat AnimQuat;
-						int32 FirstIndex;
-						int32 SecondIndex;
-						const float Alpha = FindBestFrames(Curve.Timeline, FrameBase, FirstIndex, SecondIndex);
-						FVector4 FirstQuatV = Curve.Values[FirstIndex];
-						FVector4 SecondQuatV = Curve.Values[SecondIndex];
-						FQuat FirstQuat = FQuat(FirstQuatV.X, FirstQuatV.Y, FirstQuatV.Z, FirstQuatV.W).GetNormalized();
-						FQuat SecondQuat = FQuat(SecondQuatV.X, SecondQuatV.Y, SecondQuatV.Z, SecondQuatV.W).GetNormalized();
+						const int32 FirstIndex = Samples[FrameIndex].FirstIndex;
+						const int32 SecondIndex = Samples[FrameIndex].SecondIndex;
+						const float Alpha = Samples[FrameIndex].Alpha;
 
 						// cubic spline ?
-						if (FirstIndex != SecondIndex && Curve.Values.Num() == Curve.InTangents.Num() && Curve.InTangents.Num() == Curve.OutTangents.Num())
+						if (bCubicSpline)
 						{
-							FVector4 CubicValue = CubicSpline(FrameBase, Curve.Timeline[FirstIndex], Curve.Timeline[SecondIndex], FirstQuatV, Curve.OutTangents[FirstIndex], SecondQuatV, Curve.InTangents[SecondIndex]);
+							const FVector4& FirstQuatV = Curve.Values[FirstIndex];
+							if (FirstIndex != SecondIndex)
+							{
+								FVector4 CubicValue = CubicSpline(FrameBase, Curve.Timeline[FirstIndex], Curve.Timeline[SecondIndex], FirstQuatV, Curve.OutTangents[FirstIndex], Curve.Values[SecondIndex], Curve.InTangents[SecondIndex]);
 
-							AnimQuat = { CubicValue.X, CubicValue.Y, CubicValue.Z, CubicValue.W };
+								AnimQuat = { CubicValue.X, CubicValue.Y, CubicValue.Z, CubicValue.W };
+							}
+							else
+							{
+								AnimQuat = { FirstQuatV.X, FirstQuatV.Y, FirstQuatV.Z, FirstQuatV.W };
+							}
 
-							FMatrix RotationMatrix = SceneBasis.Inverse() * FQuatRotationMatrix(AnimQuat.GetNormalized()) * SceneBasis;
+							FMatrix RotationMatrix = SceneBasisInverse * FQuatRotationMatrix(AnimQuat.GetNormalized()) * SceneBasis;
 
 							AnimQuat = RotationMatrix.ToQuat();
 						}
 						else if (FirstIndex == SecondIndex)
 						{
-							FMatrix RotationMatrix = SceneBasis.Inverse() * FQuatRotationMatrix(FirstQuat) * SceneBasis;
-
-							AnimQuat = RotationMatrix.ToQuat();
+							AnimQuat = Keys[FirstIndex];
 						}
 						else
 						{
-
-							FMatrix FirstMatrix = SceneBasis.Inverse() * FQuatRotationMatrix(FirstQuat) * SceneBasis;
-							FMatrix SecondMatrix = SceneBasis.Inverse() * FQuatRotationMatrix(SecondQuat) * SceneBasis;
-							FirstQuat = FirstMatrix.ToQuat();
-							SecondQuat = SecondMatrix.ToQuat();
-							AnimQuat = FQuat::Slerp(FirstQuat, SecondQuat, Alpha);
+							AnimQuat = FQuat::Slerp(Keys[FirstIndex], Keys[SecondIndex], Alpha);
 						}
 
 						if (SkeletalAnimationConfig.RetargetTo || SkeletalAnimationConfig.RetargetToSkeletalMesh)
@@ -3738,18 +3902,21 @@ bool FglTFRuntimeParser::LoadSkeletalAnimation_Internal(TSharedRef<FJsonObject>
 
 				Track.PosKeys.AddUninitialized(NumFrames);
 
+				TArray<FglTFRuntimeAnimationFrameSample> Samples;
+				SampleTimeline(Curve.Timeline, NumFrames, FrameDelta, Samples);
+
 				ParallelFor(NumFrames, [&](int32 FrameIndex)
 					{
 						const float FrameBase = FrameDelta * FrameIndex;
 						FVector AnimLocation;
-						int32 FirstIndex;
-						int32 SecondIndex;
-						const float Alpha = FindBestFrames(Curve.Timeline, FrameBase, FirstIndex, SecondIndex);
-						FVector4 First = Curve.Values[FirstIndex];
-						FVector4 Second = Curve.Values[SecondIndex];
+						const int32 FirstIndex = Samples[FrameIndex].FirstIndex;
+						const int32 SecondIndex = Samples[FrameIndex].SecondIndex;
+						const float Alpha = Samples[FrameIndex].Alpha;
+						const FVector4& First = Curve.Values[FirstIndex];
+						const FVector4& Second = Curve.Values[SecondIndex];
 
 						// cubic spline ?
-						if (FirstIndex != SecondIndex && Curve.Values.Num() == Curve.InTangents.Num() && Curve.InTangents.Num() == Curve.OutTangents.Num())
+						if (FirstIndex != SecondIndex && bCubicSpline)
 						{
 							FVector4 CubicValue = CubicSpline(FrameBase, Curve.Timeline[FirstIndex], Curve.Timeline[SecondIndex], First, Curve.OutTangents[FirstIndex], Second, Curve.InTangents[SecondIndex]);
 
@@ -3843,18 +4010,18 @@ bool FglTFRuntimeParser::LoadSkeletalAnimation_Internal(TSharedRef<FJsonObject>
 
 				Track.ScaleKeys.AddUninitialized(NumFrames);
 
+				TArray<FglTFRuntimeAnimationFrameSample> Samples;
+				SampleTimeline(Curve.Timeline, NumFrames, FrameDelta, Samples);
+
 				ParallelFor(NumFrames, [&](int32 FrameIndex)
 					{
-						const float FrameBase = FrameDelta * FrameIndex;
-						int32 FirstIndex;
-						int32 SecondIndex;
-						const float Alpha = FindBestFrames(Curve.Timeline, FrameBase, FirstIndex, SecondIndex);
-						FVector4 First = Curve.Values[FirstIndex];
-						FVector4 Second = Curve.Values[SecondIndex];
+						const FVector4& First = Curve.Values[Samples[FrameIndex].FirstIndex];
+						const FVector4& Second = Curve.Values[Samples[FrameIndex].SecondIndex];
+						const float Alpha = Samples[FrameIndex].Alpha;
 #if ENGINE_MAJOR_VERSION > 4
-						Track.ScaleKeys[ScaleKeysFirstIndex + FrameIndex] = FVector3f((SceneBasis.Inverse() * FScaleMatrix(FMath::Lerp(First, Second, Alpha)) * SceneBasis).ExtractScaling());
+						Track.ScaleKeys[ScaleKeysFirstIndex + FrameIndex] = FVector3f((SceneBasisInverse * FScaleMatrix(FMath::Lerp(First, Second, Alpha)) * SceneBasis).ExtractScaling());
 #else
-						Track.ScaleKeys[ScaleKeysFirstIndex + FrameIndex] = (SceneBasis.Inverse() * FScaleMatrix(FMath::Lerp(First, Second, Alpha)) * SceneBasis).ExtractScaling();
+						Track.ScaleKeys[ScaleKeysFirstIndex + FrameIndex] = (SceneBasisInverse * FScaleMatrix(FMath::Lerp(First, Second, Alpha)) * SceneBasis).ExtractScaling();
 #endif
 					});
 			}
@@ -3908,17 +4075,16 @@ bool FglTFRuntimeParser::LoadSkeletalAnimation_Internal(TSharedRef<FJsonObject>
 
 void FglTFRuntimeParser::LoadSkinnedMeshRecursiveAsRuntimeLODAsync(const FString& NodeName, int32& SkinIndex, const TArray<FString>& ExcludeNodes, const FglTFRuntimeMeshLODAsync& AsyncCallback, const FglTFRuntimeMaterialsConfig& MaterialsConfig, const FglTFRuntimeSkeletonConfig& SkeletonConfig, const EglTFRuntimeRecursiveMode TransformApplyRecursiveMode)
 {
-	Async(EAsyncExecution::Thread, [this, ExcludeNodes, NodeName, SkinIndex, AsyncCallback, MaterialsConfig, SkeletonConfig, TransformApplyRecursiveMode]()
+	AddAsyncTask([this, ExcludeNodes, NodeName, SkinIndex, AsyncCallback, MaterialsConfig, SkeletonConfig, TransformApplyRecursiveMode](const bool bCancelled)
 		{
 			FglTFRuntimeMeshLOD LOD;
 			int32 NewSkinIndex = SkinIndex;
-			const bool bSuccess = LoadSkinnedMeshRecursiveAsRuntimeLOD(NodeName, NewSkinIndex, ExcludeNodes, LOD, MaterialsConfig, SkeletonConfig, TransformApplyRecursiveMode);
+			const bool bSuccess = !bCancelled && LoadSkinnedMeshRecursiveAsRuntimeLOD(NodeName, NewSkinIndex, ExcludeNodes, LOD, MaterialsConfig, SkeletonConfig, TransformApplyRecursiveMode);
 
-			FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([&]()
+			FFunctionGraphTask::CreateAndDispatchWhenReady([bSuccess, LOD = MoveTemp(LOD), AsyncCallback]()
 				{
-					AsyncCallback.ExecuteIfBound(bSuccess, MoveTemp(LOD));
+					AsyncCallback.ExecuteIfBound(bSuccess, LOD);
 				}, TStatId(), nullptr, ENamedThreads::GameThread);
-			FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
 		});
 }
 
@@ -4021,6 +4187,11 @@ bool FglTFRuntimeParser::LoadSkinnedMeshRecursiveAsRuntimeLOD(const FString& Nod
 			}
 
 			RuntimeLOD.Primitives.Append(LOD->Primitives);
+			// runtime LODs are exposed (and transformed below) in the wide form, the cached LOD can be compact
+			for (int32 PrimitiveIndex = PrimitiveFirstIndex; PrimitiveIndex < RuntimeLOD.Primitives.Num(); PrimitiveIndex++)
+			{
+				glTFRuntime::ExpandPrimitive(RuntimeLOD.Primitives[PrimitiveIndex]);
+			}
 
 			// Always build an override map, to have a cache of the bone/index mapping
 			TMap<int32, FName> BoneMap;
@@ -4309,10 +4480,18 @@ void FglTFRuntimeParser::LoadSkeletalMeshFromRuntimeLODsAsync(const TArray<FglTF
 {
 	TSharedRef<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe> SkeletalMeshContext = MakeShared<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe>(AsShared(), -1, SkeletalMeshConfig);
 	SkeletalMeshContext->SkinIndex = SkinIndex;
+	// the finalizer runs after this task is gone, so the context owns the LODs
+	SkeletalMeshContext->CachedRuntimeMeshLODs = RuntimeLODs;
 
-	Async(EAsyncExecution::Thread, [this, SkeletalMeshContext, RuntimeLODs, AsyncCallback]()
+	AddAsyncTask([this, SkeletalMeshContext, AsyncCallback](const bool bCancelled)
 		{
 			FglTFRuntimeSkeletalMeshContextFinalizer AsyncFinalizer(SkeletalMeshContext, AsyncCallback);
+			const TArray<FglTFRuntimeMeshLOD>& RuntimeLODs = SkeletalMeshContext->CachedRuntimeMeshLODs;
+
+			if (bCancelled)
+			{
+				return;
+			}
 
 			if (RuntimeLODs.Num() < 1)
 			{
@@ -4368,55 +4547,314 @@ void FglTFRuntimeParser::LoadSkeletalMeshFromRuntimeLODsAsync(const TArray<FglTF
 			}
 
 			SkeletalMeshContext->SkeletalMesh = CreateSkeletalMeshFromLODs(SkeletalMeshContext);
-		});
+		}, SkeletalMeshConfig.AsyncPriority, SkeletalMeshConfig.AsyncCancellationToken);
 }
 
 const FBox& FglTFRuntimeSkeletalMeshContext::GetBoneBox(const int32 BoneIndex)
 {
-	// unfortunately we need access to SkinWeightVertexBuffer.GetBoneIndex (and it is not available in 4.25)
-#if ENGINE_MAJOR_VERSION >= 5 || ENGINE_MINOR_VERSION >= 26
-	if (PerBoneBoundingBoxCache.Contains(BoneIndex))
+	if (!PerBoneBoundingBoxCache.Contains(BoneIndex))
 	{
-		return PerBoneBoundingBoxCache[BoneIndex];
+		CacheBonesBounds(false);
 	}
 
-	FBox& Box = PerBoneBoundingBoxCache.Add(BoneIndex);
+	// bones out of the skeleton
+	if (!PerBoneBoundingBoxCache.Contains(BoneIndex))
+	{
+		PerBoneBoundingBoxCache.Add(BoneIndex).Init();
+	}
+
+	return PerBoneBoundingBoxCache[BoneIndex];
+}
+
+bool FglTFRuntimeSkeletalMeshContext::GetBoneCapsule(const int32 BoneIndex, FglTFRuntimeCapsule& Capsule)
+{
+	CacheBonesBounds(true);
+
+	if (const FglTFRuntimeCapsule* CachedCapsule = PerBoneCapsuleCache.Find(BoneIndex))
+	{
+		Capsule = *CachedCapsule;
+		return true;
+	}
+
+	return false;
+}
+
+void FglTFRuntimeCapsuleFitter::Add(const FVector& Position)
+{
+	Count++;
+	Sum += Position;
+	SumSquared[0] += Position.X * Position.X;
+	SumSquared[1] += Position.X * Position.Y;
+	SumSquared[2] += Position.X * Position.Z;
+	SumSquared[3] += Position.Y * Position.Y;
+	SumSquared[4] += Position.Y * Position.Z;
+	SumSquared[5] += Position.Z * Position.Z;
+}
+
+void FglTFRuntimeCapsuleFitter::Merge(const FglTFRuntimeCapsuleFitter& Other)
+{
+	Count += Other.Count;
+	Sum += Other.Sum;
+	for (int32 Index = 0; Index < 6; Index++)
+	{
+		SumSquared[Index] += Other.SumSquared[Index];
+	}
+}
+
+bool FglTFRuntimeCapsuleFitter::ComputeAxis(const FVector& InitialAxis)
+{
+	Axis = FVector::ZeroVector;
+	if (Count < 2)
+	{
+		return false;
+	}
+
+	// principal axis of the covariance matrix
+	const double InvCount = 1.0 / Count;
+	Mean = Sum * InvCount;
+	const double XX = SumSquared[0] * InvCount - Mean.X * Mean.X;
+	const double XY = SumSquared[1] * InvCount - Mean.X * Mean.Y;
+	const double XZ = SumSquared[2] * InvCount - Mean.X * Mean.Z;
+	const double YY = SumSquared[3] * InvCount - Mean.Y * Mean.Y;
+	const double YZ = SumSquared[4] * InvCount - Mean.Y * Mean.Z;
+	const double ZZ = SumSquared[5] * InvCount - Mean.Z * Mean.Z;
+
+	Axis = InitialAxis.GetSafeNormal();
+	if (Axis.IsZero())
+	{
+		Axis = FVector::UpVector;
+	}
+
+	for (int32 Iteration = 0; Iteration < 16; Iteration++)
+	{
+		const FVector NewAxis = FVector(XX * Axis.X + XY * Axis.Y + XZ * Axis.Z,
+			XY * Axis.X + YY * Axis.Y + YZ * Axis.Z,
+			XZ * Axis.X + YZ * Axis.Y + ZZ * Axis.Z).GetSafeNormal();
+		if (NewAxis.IsNearlyZero())
+		{
+			break;
+		}
+		Axis = NewAxis;
+	}
+
+	return true;
+}
+
+void FglTFRuntimeCapsuleFitter::AddExtent(const FVector& Position)
+{
+	const FVector Delta = Position - Mean;
+	const double T = FVector::DotProduct(Delta, Axis);
+	const double Radius = (Delta - Axis * T).Size();
+	MinBottom = FMath::Min(MinBottom, T - Radius);
+	MaxTop = FMath::Max(MaxTop, T + Radius);
+	MaxRadius = FMath::Max(MaxRadius, Radius);
+}
+
+void FglTFRuntimeCapsuleFitter::MergeExtents(const FglTFRuntimeCapsuleFitter& Other)
+{
+	MinBottom = FMath::Min(MinBottom, Other.MinBottom);
+	MaxTop = FMath::Max(MaxTop, Other.MaxTop);
+	MaxRadius = FMath::Max(MaxRadius, Other.MaxRadius);
+}
+
+FglTFRuntimeCapsule FglTFRuntimeCapsuleFitter::GetCapsule() const
+{
+	// a position at distance R from the axis is inside the cap as long as it is at most MaxRadius - R past the cap center
+	// (sqrt(MaxRadius^2 - R^2) >= MaxRadius - R), when the caps centers cross a sphere at their middle still contains everything
+	const double Bottom = MinBottom + MaxRadius;
+	const double Top = MaxTop - MaxRadius;
+
+	FglTFRuntimeCapsule Capsule;
+	Capsule.Radius = static_cast<float>(MaxRadius);
+	Capsule.Length = static_cast<float>(FMath::Max(Top - Bottom, 0.0));
+	Capsule.Center = Mean + Axis * ((Bottom + Top) * 0.5);
+	Capsule.Rotation = FRotationMatrix::MakeFromZ(Axis).Rotator();
+	return Capsule;
+}
+
+bool FglTFRuntimeCapsuleFitter::Fit(TArrayView<const FVector> Positions, FglTFRuntimeCapsule& Capsule)
+{
+	FglTFRuntimeCapsuleFitter Fitter;
+	FBox Box;
 	Box.Init();
+	for (const FVector& Position : Positions)
+	{
+		Fitter.Add(Position);
+		Box += Position;
+	}
 
-	const FSkeletalMeshLODRenderData& LOD0 = SkeletalMesh->GetResourceForRendering()->LODRenderData[0];
-	const uint32 NumVertices = LOD0.GetNumVertices();
-	for (uint32 Index = 0; Index < NumVertices; Index++)
+	const FVector Extent = Box.GetExtent();
+	if (!Fitter.ComputeAxis(Extent.X >= Extent.Y && Extent.X >= Extent.Z ? FVector::ForwardVector : (Extent.Y >= Extent.Z ? FVector::RightVector : FVector::UpVector)))
 	{
-		const uint32 VertexIndex = LOD0.MultiSizeIndexContainer.GetIndexBuffer()->Get(Index);
+		return false;
+	}
+
+	for (const FVector& Position : Positions)
+	{
+		Fitter.AddExtent(Position);
+	}
+
+	Capsule = Fitter.GetCapsule();
+	return true;
+}
 
-		const uint32 MaxBoneInfluences = LOD0.SkinWeightVertexBuffer.GetMaxBoneInfluences();
+void FglTFRuntimeSkeletalMeshContext::CacheBonesBounds(const bool bFitCapsules)
+{
+	const int32 NumBones = GetNumBones();
+	if (PerBoneBoundingBoxCache.Num() >= NumBones && (!bFitCapsules || bCapsulesCached))
+	{
+		return;
+	}
 
-		int32 BestBoneIndex = INDEX_NONE;
-		uint16 BestWeight = 0;
-		for (uint32 InfluenceIndex = 0; InfluenceIndex < MaxBoneInfluences; InfluenceIndex++)
+	SCOPED_NAMED_EVENT(FglTFRuntimeSkeletalMeshContext_CacheBonesBounds, FColor::Magenta);
+
+	TArray<FBox> Boxes;
+	Boxes.AddUninitialized(NumBones);
+	for (FBox& Box : Boxes)
+	{
+		Box.Init();
+	}
+
+	// unfortunately we need access to SkinWeightVertexBuffer.GetBoneIndex (and it is not available in 4.25)
+#if ENGINE_MAJOR_VERSION >= 5 || ENGINE_MINOR_VERSION >= 26
+	const FSkeletalMeshLODRenderData& LOD0 = SkeletalMesh->GetResourceForRendering()->LODRenderData[0];
+	const auto& RefBasesInvMatrix = SkeletalMesh->GetRefBasesInvMatrix();
+	const int32 NumVertices = static_cast<int32>(LOD0.GetNumVertices());
+	const uint32 MaxBoneInfluences = LOD0.SkinWeightVertexBuffer.GetMaxBoneInfluences();
+
+	// per chunk accumulators (merged at the end) instead of a shared state
+	const int32 NumChunks = FMath::Clamp(NumVertices / 4096, 1, FPlatformMisc::NumberOfCoresIncludingHyperthreads());
+	const int32 VerticesPerChunk = FMath::DivideAndRoundUp(NumVertices, NumChunks);
+
+	TArray<int32> VerticesBones;
+	VerticesBones.AddUninitialized(NumVertices);
+
+	TArray<TArray<FBox>> ChunksBoxes;
+	TArray<TArray<FglTFRuntimeCapsuleFitter>> ChunksFitters;
+	ChunksBoxes.SetNum(NumChunks);
+	ChunksFitters.SetNum(NumChunks);
+
+	auto GetBoneSpacePosition = [&](const int32 VertexIndex, const int32 BoneIndex)
+		{
+			return FVector(RefBasesInvMatrix[BoneIndex].TransformPosition(LOD0.StaticVertexBuffers.PositionVertexBuffer.VertexPosition(VertexIndex)));
+		};
+
+	ParallelFor(NumChunks, [&](const int32 ChunkIndex)
 		{
-			const uint32 VertexBoneIndex = LOD0.SkinWeightVertexBuffer.GetBoneIndex(VertexIndex, InfluenceIndex);
-			const uint16 VertexBoneWeight = LOD0.SkinWeightVertexBuffer.GetBoneWeight(VertexIndex, InfluenceIndex);
-			if (VertexBoneWeight > BestWeight)
+			TArray<FBox>& ChunkBoxes = ChunksBoxes[ChunkIndex];
+			ChunkBoxes = Boxes;
+			TArray<FglTFRuntimeCapsuleFitter>& ChunkFitters = ChunksFitters[ChunkIndex];
+			if (bFitCapsules)
 			{
-				BestBoneIndex = VertexBoneIndex;
-				BestWeight = VertexBoneWeight;
+				ChunkFitters.SetNum(NumBones);
 			}
-		}
 
-		if (BestBoneIndex == BoneIndex)
+			const int32 LastVertex = FMath::Min((ChunkIndex + 1) * VerticesPerChunk, NumVertices);
+			for (int32 VertexIndex = ChunkIndex * VerticesPerChunk; VertexIndex < LastVertex; VertexIndex++)
+			{
+				int32 BestBoneIndex = INDEX_NONE;
+				uint16 BestWeight = 0;
+				for (uint32 InfluenceIndex = 0; InfluenceIndex < MaxBoneInfluences; InfluenceIndex++)
+				{
+					const uint16 VertexBoneWeight = LOD0.SkinWeightVertexBuffer.GetBoneWeight(VertexIndex, InfluenceIndex);
+					if (VertexBoneWeight > BestWeight)
+					{
+						BestBoneIndex = LOD0.SkinWeightVertexBuffer.GetBoneIndex(VertexIndex, InfluenceIndex);
+						BestWeight = VertexBoneWeight;
+					}
+				}
+
+				if (BestBoneIndex < 0 || BestBoneIndex >= NumBones || !RefBasesInvMatrix.IsValidIndex(BestBoneIndex))
+				{
+					VerticesBones[VertexIndex] = INDEX_NONE;
+					continue;
+				}
+
+				VerticesBones[VertexIndex] = BestBoneIndex;
+
+				const FVector Position = GetBoneSpacePosition(VertexIndex, BestBoneIndex);
+				ChunkBoxes[BestBoneIndex] += Position;
+
+				if (bFitCapsules)
+				{
+					ChunkFitters[BestBoneIndex].Add(Position);
+				}
+			}
+		}, NumChunks == 1);
+
+	TArray<FglTFRuntimeCapsuleFitter> Fitters;
+	if (bFitCapsules)
+	{
+		Fitters.SetNum(NumBones);
+	}
+
+	for (int32 ChunkIndex = 0; ChunkIndex < NumChunks; ChunkIndex++)
+	{
+		for (int32 BoneIndex = 0; BoneIndex < NumBones; BoneIndex++)
 		{
-			Box += FVector(SkeletalMesh->GetRefBasesInvMatrix()[BoneIndex].TransformPosition(LOD0.StaticVertexBuffers.PositionVertexBuffer.VertexPosition(VertexIndex)));
+			Boxes[BoneIndex] += ChunksBoxes[ChunkIndex][BoneIndex];
+			if (bFitCapsules)
+			{
+				Fitters[BoneIndex].Merge(ChunksFitters[ChunkIndex][BoneIndex]);
+			}
 		}
 	}
 
-	return PerBoneBoundingBoxCache[BoneIndex];
-#else
-	// dummy logic
-	FBox& Box = PerBoneBoundingBoxCache.Add(BoneIndex);
-	Box.Init();
-	return PerBoneBoundingBoxCache[BoneIndex];
+	if (bFitCapsules)
+	{
+		// the power iteration starts from the longest box axis
+		for (int32 BoneIndex = 0; BoneIndex < NumBones; BoneIndex++)
+		{
+			const FVector Extent = Boxes[BoneIndex].GetExtent();
+			Fitters[BoneIndex].ComputeAxis(Extent.X >= Extent.Y && Extent.X >= Extent.Z ? FVector::ForwardVector : (Extent.Y >= Extent.Z ? FVector::RightVector : FVector::UpVector));
+		}
+
+		// second pass for the extents along (and around) the axis
+		ParallelFor(NumChunks, [&](const int32 ChunkIndex)
+			{
+				TArray<FglTFRuntimeCapsuleFitter>& ChunkFitters = ChunksFitters[ChunkIndex];
+				ChunkFitters = Fitters;
+
+				const int32 LastVertex = FMath::Min((ChunkIndex + 1) * VerticesPerChunk, NumVertices);
+				for (int32 VertexIndex = ChunkIndex * VerticesPerChunk; VertexIndex < LastVertex; VertexIndex++)
+				{
+					const int32 BoneIndex = VerticesBones[VertexIndex];
+					if (BoneIndex == INDEX_NONE || Fitters[BoneIndex].Axis.IsZero())
+					{
+						continue;
+					}
+
+					ChunkFitters[BoneIndex].AddExtent(GetBoneSpacePosition(VertexIndex, BoneIndex));
+				}
+			}, NumChunks == 1);
+
+		for (int32 BoneIndex = 0; BoneIndex < NumBones; BoneIndex++)
+		{
+			FglTFRuntimeCapsuleFitter& Fitter = Fitters[BoneIndex];
+			if (Fitter.Axis.IsZero())
+			{
+				continue;
+			}
+
+			for (int32 ChunkIndex = 0; ChunkIndex < NumChunks; ChunkIndex++)
+			{
+				Fitter.MergeExtents(ChunksFitters[ChunkIndex][BoneIndex]);
+			}
+
+			PerBoneCapsuleCache.Add(BoneIndex, Fitter.GetCapsule());
+		}
+	}
 #endif
+
+	if (bFitCapsules)
+	{
+		bCapsulesCached = true;
+	}
+
+	for (int32 BoneIndex = 0; BoneIndex < NumBones; BoneIndex++)
+	{
+		PerBoneBoundingBoxCache.Add(BoneIndex, Boxes[BoneIndex]);
+	}
 }
 
 bool FglTFRuntimeParser::SanitizeBoneTrack(const FReferenceSkeleton& RefSkeleton, const FString& BoneName, const int32 NumFrames, FRawAnimSequenceTrack& Track, const FglTFRuntimeSkeletalAnimationConfig& SkeletalAnimationConfig)
@@ -1,6 +1,7 @@
 // Copyright 2020-2022, Roberto De Ioris.
 
 #include "glTFRuntimeParser.h"
+#include "glTFRuntimeTangentsGenerator.h"
 #include "MeshDescription.h"
 #include "StaticMeshAttributes.h"
 #include "StaticMeshOperations.h"
@@ -67,7 +68,7 @@ void FglTFRuntimeParser::LoadStaticMeshAsync(const int32 MeshIndex, const FglTFR
 	if (CanReadFromCache(StaticMeshConfig.CacheMode) && StaticMeshesCache.Contains(MeshIndex))
 	{
 		UStaticMesh* StaticMesh = StaticMeshesCache[MeshIndex];
-		FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([StaticMesh, AsyncCallback]()
+		FFunctionGraphTask::CreateAndDispatchWhenReady([StaticMesh, AsyncCallback]()
 			{
 				AsyncCallback.ExecuteIfBound(StaticMesh);
 			}, TStatId(), nullptr, ENamedThreads::GameThread);
@@ -76,13 +77,13 @@ void FglTFRuntimeParser::LoadStaticMeshAsync(const int32 MeshIndex, const FglTFR
 
 	TSharedRef<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe> StaticMeshContext = MakeShared<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe>(AsShared(), MeshIndex, StaticMeshConfig);
 
-	Async(EAsyncExecution::Thread, [this, StaticMeshContext, MeshIndex, AsyncCallback]()
+	AddAsyncTask([this, StaticMeshContext, MeshIndex, AsyncCallback](const bool bCancelled)
 		{
 			TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex("meshes", MeshIndex);
-			if (JsonMeshObject)
+			if (!bCancelled && JsonMeshObject)
 			{
 				FglTFRuntimeMeshLOD* LOD = nullptr;
-				if (LoadMeshIntoMeshLOD(JsonMeshObject.ToSharedRef(), LOD, StaticMeshContext->StaticMeshConfig.MaterialsConfig))
+				if (LoadMeshIntoMeshLOD(JsonMeshObject.ToSharedRef(), LOD, StaticMeshContext->StaticMeshConfig.MaterialsConfig, StaticMeshContext->StaticMeshConfig.bCompactPrimitives, StaticMeshContext->StaticMeshConfig.bUseHighPrecisionTangentBasis))
 				{
 					StaticMeshContext->LODs.Add(LOD);
 
@@ -90,7 +91,7 @@ void FglTFRuntimeParser::LoadStaticMeshAsync(const int32 MeshIndex, const FglTFR
 				}
 			}
 
-			FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([MeshIndex, StaticMeshContext, AsyncCallback]()
+			FFunctionGraphTask::CreateAndDispatchWhenReady([MeshIndex, StaticMeshContext, AsyncCallback]()
 				{
 					if (StaticMeshContext->StaticMesh)
 					{
@@ -111,8 +112,7 @@ void FglTFRuntimeParser::LoadStaticMeshAsync(const int32 MeshIndex, const FglTFR
 					StaticMeshContext->UnregisterGCObject();
 #endif
 				}, TStatId(), nullptr, ENamedThreads::GameThread);
-			FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
-		});
+		}, StaticMeshConfig.AsyncPriority, StaticMeshConfig.AsyncCancellationToken);
 }
 
 UStaticMesh* FglTFRuntimeParser::LoadStaticMesh_Internal(TSharedRef<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe> StaticMeshContext)
@@ -136,6 +136,19 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMesh_Internal(TSharedRef<FglTFRuntime
 
 	const FVector4 WhiteColor = FVector4(1, 1, 1, 1);
 
+	// flat normals (the default when they are generated) need a vertex for every triangle corner, so indexed primitives are unwelded
+	auto HasSharedVertices = [&StaticMeshConfig](const FglTFRuntimePrimitive& Primitive)
+	{
+		if (!Primitive.bHasIndices)
+		{
+			return false;
+		}
+
+		const bool bGenerateNormals = (Primitive.GetNumNormals() < Primitive.GetNumVertices() && StaticMeshConfig.NormalsGenerationStrategy == EglTFRuntimeNormalsGenerationStrategy::IfMissing) ||
+			StaticMeshConfig.NormalsGenerationStrategy == EglTFRuntimeNormalsGenerationStrategy::Always;
+		return !bGenerateNormals || StaticMeshConfig.bSmoothNormals || (Primitive.Indices.Num() % 3) != 0;
+	};
+
 	// this is used for inheriting materials while in multi LOD mode
 	TMap<int32, int32> SectionMaterialMap;
 
@@ -157,17 +170,17 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMesh_Internal(TSharedRef<FglTFRuntime
 
 		for (const FglTFRuntimePrimitive& Primitive : LOD->Primitives)
 		{
-			if (Primitive.UVs.Num() > NumUVs)
+			if (Primitive.GetNumUVChannels() > NumUVs)
 			{
-				NumUVs = Primitive.UVs.Num();
+				NumUVs = Primitive.GetNumUVChannels();
 			}
 
-			if (Primitive.Colors.Num() > 0)
+			if (Primitive.GetNumColors() > 0)
 			{
 				bHasVertexColors = true;
 			}
 
-			NumVerticesToBuildPerLOD += Primitive.bHasIndices ? Primitive.Positions.Num() : Primitive.Indices.Num();
+			NumVerticesToBuildPerLOD += HasSharedVertices(Primitive) ? Primitive.GetNumVertices() : Primitive.Indices.Num();
 		}
 
 		TArray<FStaticMeshBuildVertex> StaticMeshBuildVertices;
@@ -248,74 +261,96 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMesh_Internal(TSharedRef<FglTFRuntime
 
 			bool bMissingNormals = false;
 			bool bMissingTangents = false;
-			bool bMissingIgnore = false;
 
 			LODIndices.AddUninitialized(NumVertexInstancesPerSection);
 
-			// Geometry generation
-			if (Primitive.bHasIndices)
-			{
-				ParallelFor(Primitive.Positions.Num(), [&](const int32 VertexIndex)
+			// Geometry generation (through the layout agnostic accessors, cached primitives can be compact)
+			const int32 NumPositions = Primitive.GetNumVertices();
+			const int32 NumNormals = Primitive.GetNumNormals();
+			const int32 NumTangents = Primitive.GetNumTangents();
+			const int32 NumColors = Primitive.GetNumColors();
+			const int32 NumUVChannels = Primitive.GetNumUVChannels();
+
+			auto BuildVertex = [&](FStaticMeshBuildVertex& StaticMeshVertex, const uint32 VertexIndex)
+				{
+					const int32 Index = static_cast<int32>(VertexIndex);
+					if (Index < NumPositions)
+					{
+						StaticMeshVertex.Position = Primitive.GetPosition(Index);
+					}
+					else
 					{
-						FStaticMeshBuildVertex& StaticMeshVertex = StaticMeshBuildVertices[VertexBaseIndex + VertexIndex];
+						StaticMeshVertex.Position = FglTFRuntimeVector3f::ZeroVector;
+					}
 
-#if ENGINE_MAJOR_VERSION > 4
-						StaticMeshVertex.Position = FVector3f(GetSafeValue(Primitive.Positions, VertexIndex, FVector::ZeroVector, bMissingIgnore));
-#else
-						StaticMeshVertex.Position = GetSafeValue(Primitive.Positions, VertexIndex, FVector::ZeroVector, bMissingIgnore);
-#endif
+					FVector4 TangentX = FVector4(0, 0, 0, 1);
+					if (Index < NumTangents)
+					{
+						TangentX = FVector4(Primitive.GetTangent(Index));
+					}
+					else
+					{
+						bMissingTangents = true;
+					}
+
+					if (Index < NumNormals)
+					{
+						StaticMeshVertex.TangentZ = Primitive.GetNormal(Index);
+					}
+					else
+					{
+						StaticMeshVertex.TangentZ = FglTFRuntimeVector3f::ZeroVector;
+						bMissingNormals = true;
+					}
 
-						FVector4 TangentX = GetSafeValue(Primitive.Tangents, VertexIndex, FVector4(0, 0, 0, 1), bMissingTangents);
 #if ENGINE_MAJOR_VERSION > 4
-						StaticMeshVertex.TangentX = FVector4f(TangentX);
-						StaticMeshVertex.TangentZ = FVector3f(GetSafeValue(Primitive.Normals, VertexIndex, FVector::ZeroVector, bMissingNormals));
-						StaticMeshVertex.TangentY = FVector3f(glTFRuntime::ComputeTangentYWithW(FVector(StaticMeshVertex.TangentZ), FVector(StaticMeshVertex.TangentX), TangentX.W * TangentsDirection));
+					StaticMeshVertex.TangentX = FVector4f(TangentX);
+					StaticMeshVertex.TangentY = FVector3f(glTFRuntime::ComputeTangentYWithW(FVector(StaticMeshVertex.TangentZ), FVector(StaticMeshVertex.TangentX), TangentX.W * TangentsDirection));
 #else
-						StaticMeshVertex.TangentX = TangentX;
-						StaticMeshVertex.TangentZ = GetSafeValue(Primitive.Normals, VertexIndex, FVector::ZeroVector, bMissingNormals);
-						StaticMeshVertex.TangentY = glTFRuntime::ComputeTangentYWithW(StaticMeshVertex.TangentZ, StaticMeshVertex.TangentX, TangentX.W * TangentsDirection);
+					StaticMeshVertex.TangentX = TangentX;
+					StaticMeshVertex.TangentY = glTFRuntime::ComputeTangentYWithW(StaticMeshVertex.TangentZ, StaticMeshVertex.TangentX, TangentX.W * TangentsDirection);
 #endif
 
-						for (int32 UVIndex = 0; UVIndex < NumUVs; UVIndex++)
+					for (int32 UVIndex = 0; UVIndex < NumUVs; UVIndex++)
+					{
+						// no UVs specified, let's set them to 0
+						if (UVIndex < NumUVChannels && Index < Primitive.GetNumUVs(UVIndex))
 						{
-							if (UVIndex < Primitive.UVs.Num())
-							{
-#if ENGINE_MAJOR_VERSION > 4
-								StaticMeshVertex.UVs[UVIndex] = FVector2f(GetSafeValue(Primitive.UVs[UVIndex], VertexIndex, FVector2D::ZeroVector, bMissingIgnore));
-#else
-								StaticMeshVertex.UVs[UVIndex] = GetSafeValue(Primitive.UVs[UVIndex], VertexIndex, FVector2D::ZeroVector, bMissingIgnore);
-#endif
-							}
-							// no UVs specified, let's set them to 0
-							else
-							{
-#if ENGINE_MAJOR_VERSION > 4
-								StaticMeshVertex.UVs[UVIndex] = FVector2f::ZeroVector;
-#else
-								StaticMeshVertex.UVs[UVIndex] = FVector2D::ZeroVector;
-#endif
-							}
+							StaticMeshVertex.UVs[UVIndex] = Primitive.GetUV(UVIndex, Index);
 						}
-
-						if (bHasVertexColors)
+						else
 						{
-							StaticMeshVertex.Color = FLinearColor(GetSafeValue(Primitive.Colors, VertexIndex, WhiteColor, bMissingIgnore)).ToFColor(true);
+							StaticMeshVertex.UVs[UVIndex] = FglTFRuntimeVector2f::ZeroVector;
 						}
+					}
 
-						if (bApplyAdditionalTransforms)
-						{
+					if (bHasVertexColors)
+					{
+						StaticMeshVertex.Color = (Index < NumColors ? Primitive.GetColor(Index) : FLinearColor(WhiteColor)).ToFColor(true);
+					}
+
+					if (bApplyAdditionalTransforms)
+					{
 #if ENGINE_MAJOR_VERSION > 4
-							StaticMeshVertex.Position = FVector3f(LOD->AdditionalTransforms[AdditionalTransformsPrimitiveIndex].TransformPosition(FVector3d(StaticMeshVertex.Position)));
-							StaticMeshVertex.TangentX = FVector3f(LOD->AdditionalTransforms[AdditionalTransformsPrimitiveIndex].TransformVectorNoScale(FVector3d(StaticMeshVertex.TangentX)));
-							StaticMeshVertex.TangentY = FVector3f(LOD->AdditionalTransforms[AdditionalTransformsPrimitiveIndex].TransformVectorNoScale(FVector3d(StaticMeshVertex.TangentY)));
-							StaticMeshVertex.TangentZ = FVector3f(LOD->AdditionalTransforms[AdditionalTransformsPrimitiveIndex].TransformVectorNoScale(FVector3d(StaticMeshVertex.TangentZ)));
+						StaticMeshVertex.Position = FVector3f(LOD->AdditionalTransforms[AdditionalTransformsPrimitiveIndex].TransformPosition(FVector3d(StaticMeshVertex.Position)));
+						StaticMeshVertex.TangentX = FVector3f(LOD->AdditionalTransforms[AdditionalTransformsPrimitiveIndex].TransformVectorNoScale(FVector3d(StaticMeshVertex.TangentX)));
+						StaticMeshVertex.TangentY = FVector3f(LOD->AdditionalTransforms[AdditionalTransformsPrimitiveIndex].TransformVectorNoScale(FVector3d(StaticMeshVertex.TangentY)));
+						StaticMeshVertex.TangentZ = FVector3f(LOD->AdditionalTransforms[AdditionalTransformsPrimitiveIndex].TransformVectorNoScale(FVector3d(StaticMeshVertex.TangentZ)));
 #else
-							StaticMeshVertex.Position = LOD->AdditionalTransforms[AdditionalTransformsPrimitiveIndex].TransformPosition(StaticMeshVertex.Position);
-							StaticMeshVertex.TangentX = LOD->AdditionalTransforms[AdditionalTransformsPrimitiveIndex].TransformVectorNoScale(StaticMeshVertex.TangentX);
-							StaticMeshVertex.TangentY = LOD->AdditionalTransforms[AdditionalTransformsPrimitiveIndex].TransformVectorNoScale(StaticMeshVertex.TangentY);
-							StaticMeshVertex.TangentZ = LOD->AdditionalTransforms[AdditionalTransformsPrimitiveIndex].TransformVectorNoScale(StaticMeshVertex.TangentZ);
+						StaticMeshVertex.Position = LOD->AdditionalTransforms[AdditionalTransformsPrimitiveIndex].TransformPosition(StaticMeshVertex.Position);
+						StaticMeshVertex.TangentX = LOD->AdditionalTransforms[AdditionalTransformsPrimitiveIndex].TransformVectorNoScale(StaticMeshVertex.TangentX);
+						StaticMeshVertex.TangentY = LOD->AdditionalTransforms[AdditionalTransformsPrimitiveIndex].TransformVectorNoScale(StaticMeshVertex.TangentY);
+						StaticMeshVertex.TangentZ = LOD->AdditionalTransforms[AdditionalTransformsPrimitiveIndex].TransformVectorNoScale(StaticMeshVertex.TangentZ);
 #endif
-						}
+					}
+				};
+
+			const bool bSharedVertices = HasSharedVertices(Primitive);
+			if (bSharedVertices)
+			{
+				ParallelFor(NumPositions, [&](const int32 VertexIndex)
+					{
+						BuildVertex(StaticMeshBuildVertices[VertexBaseIndex + VertexIndex], VertexIndex);
 					});
 
 				ParallelFor(NumVertexInstancesPerSection, [&](const int32 VertexInstanceSectionIndex)
@@ -328,68 +363,10 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMesh_Internal(TSharedRef<FglTFRuntime
 			{
 				ParallelFor(NumVertexInstancesPerSection, [&](const int32 VertexInstanceSectionIndex)
 					{
-						uint32 VertexIndex = Primitive.Indices[VertexInstanceSectionIndex];
+						const uint32 VertexIndex = Primitive.Indices[VertexInstanceSectionIndex];
 						LODIndices[VertexInstanceBaseIndex + VertexInstanceSectionIndex] = VertexBaseIndex + VertexInstanceSectionIndex;
 
-						FStaticMeshBuildVertex& StaticMeshVertex = StaticMeshBuildVertices[VertexBaseIndex + VertexInstanceSectionIndex];
-
-#if ENGINE_MAJOR_VERSION > 4
-						StaticMeshVertex.Position = FVector3f(GetSafeValue(Primitive.Positions, VertexIndex, FVector::ZeroVector, bMissingIgnore));
-#else
-						StaticMeshVertex.Position = GetSafeValue(Primitive.Positions, VertexIndex, FVector::ZeroVector, bMissingIgnore);
-#endif
-
-						FVector4 TangentX = GetSafeValue(Primitive.Tangents, VertexIndex, FVector4(0, 0, 0, 1), bMissingTangents);
-#if ENGINE_MAJOR_VERSION > 4
-						StaticMeshVertex.TangentX = FVector4f(TangentX);
-						StaticMeshVertex.TangentZ = FVector3f(GetSafeValue(Primitive.Normals, VertexIndex, FVector::ZeroVector, bMissingNormals));
-						StaticMeshVertex.TangentY = FVector3f(glTFRuntime::ComputeTangentYWithW(FVector(StaticMeshVertex.TangentZ), FVector(StaticMeshVertex.TangentX), TangentX.W * TangentsDirection));
-#else
-						StaticMeshVertex.TangentX = TangentX;
-						StaticMeshVertex.TangentZ = GetSafeValue(Primitive.Normals, VertexIndex, FVector::ZeroVector, bMissingNormals);
-						StaticMeshVertex.TangentY = glTFRuntime::ComputeTangentYWithW(StaticMeshVertex.TangentZ, StaticMeshVertex.TangentX, TangentX.W * TangentsDirection);
-#endif
-
-						for (int32 UVIndex = 0; UVIndex < NumUVs; UVIndex++)
-						{
-							if (UVIndex < Primitive.UVs.Num())
-							{
-#if ENGINE_MAJOR_VERSION > 4
-								StaticMeshVertex.UVs[UVIndex] = FVector2f(GetSafeValue(Primitive.UVs[UVIndex], VertexIndex, FVector2D::ZeroVector, bMissingIgnore));
-#else
-								StaticMeshVertex.UVs[UVIndex] = GetSafeValue(Primitive.UVs[UVIndex], VertexIndex, FVector2D::ZeroVector, bMissingIgnore);
-#endif
-							}
-							// no UVs specified, let's set them to 0
-							else
-							{
-#if ENGINE_MAJOR_VERSION > 4
-								StaticMeshVertex.UVs[UVIndex] = FVector2f::ZeroVector;
-#else
-								StaticMeshVertex.UVs[UVIndex] = FVector2D::ZeroVector;
-#endif
-							}
-						}
-
-						if (bHasVertexColors)
-						{
-							StaticMeshVertex.Color = FLinearColor(GetSafeValue(Primitive.Colors, VertexIndex, WhiteColor, bMissingIgnore)).ToFColor(true);
-						}
-
-						if (bApplyAdditionalTransforms)
-						{
-#if ENGINE_MAJOR_VERSION > 4
-							StaticMeshVertex.Position = FVector3f(LOD->AdditionalTransforms[AdditionalTransformsPrimitiveIndex].TransformPosition(FVector3d(StaticMeshVertex.Position)));
-							StaticMeshVertex.TangentX = FVector3f(LOD->AdditionalTransforms[AdditionalTransformsPrimitiveIndex].TransformVectorNoScale(FVector3d(StaticMeshVertex.TangentX)));
-							StaticMeshVertex.TangentY = FVector3f(LOD->AdditionalTransforms[AdditionalTransformsPrimitiveIndex].TransformVectorNoScale(FVector3d(StaticMeshVertex.TangentY)));
-							StaticMeshVertex.TangentZ = FVector3f(LOD->AdditionalTransforms[AdditionalTransformsPrimitiveIndex].TransformVectorNoScale(FVector3d(StaticMeshVertex.TangentZ)));
-#else
-							StaticMeshVertex.Position = LOD->AdditionalTransforms[AdditionalTransformsPrimitiveIndex].TransformPosition(StaticMeshVertex.Position);
-							StaticMeshVertex.TangentX = LOD->AdditionalTransforms[AdditionalTransformsPrimitiveIndex].TransformVectorNoScale(StaticMeshVertex.TangentX);
-							StaticMeshVertex.TangentY = LOD->AdditionalTransforms[AdditionalTransformsPrimitiveIndex].TransformVectorNoScale(StaticMeshVertex.TangentY);
-							StaticMeshVertex.TangentZ = LOD->AdditionalTransforms[AdditionalTransformsPrimitiveIndex].TransformVectorNoScale(StaticMeshVertex.TangentZ);
-#endif
-						}
+						BuildVertex(StaticMeshBuildVertices[VertexBaseIndex + VertexInstanceSectionIndex], VertexIndex);
 					});
 			}
 			// End of Geometry generation
@@ -405,250 +382,88 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMesh_Internal(TSharedRef<FglTFRuntime
 				}
 			}
 
-			const bool bCanGenerateNormals = (bMissingNormals && StaticMeshConfig.NormalsGenerationStrategy == EglTFRuntimeNormalsGenerationStrategy::IfMissing) ||
-				StaticMeshConfig.NormalsGenerationStrategy == EglTFRuntimeNormalsGenerationStrategy::Always;
-			if (bCanGenerateNormals && (NumVertexInstancesPerSection % 3) == 0)
-			{
-				TSet<uint32> ProcessedVertices;
-				ProcessedVertices.Reserve(NumVertexInstancesPerSection);
-
-				FCriticalSection NormalsGenerationLock;
-
-				ParallelFor(NumVertexInstancesPerSection / 3, [&](const int32 VertexInstanceSectionTriangleIndex)
-					{
-						const int32 VertexInstanceSectionIndex = VertexInstanceBaseIndex + VertexInstanceSectionTriangleIndex * 3;
-						bool bSetVertex0 = false;
-						bool bSetVertex1 = false;
-						bool bSetVertex2 = false;
-
-						const uint32 VertexIndex0 = LODIndices[VertexInstanceSectionIndex];
-						const uint32 VertexIndex1 = LODIndices[VertexInstanceSectionIndex + 1];
-						const uint32 VertexIndex2 = LODIndices[VertexInstanceSectionIndex + 2];
-
-						if (Primitive.bHasIndices)
-						{
-							FScopeLock Lock(&NormalsGenerationLock);
-
-							if (!ProcessedVertices.Contains(VertexIndex0))
-							{
-								ProcessedVertices.Add(VertexIndex0);
-								bSetVertex0 = true;
-							}
-
-							if (!ProcessedVertices.Contains(VertexIndex1))
-							{
-								ProcessedVertices.Add(VertexIndex1);
-								bSetVertex1 = true;
-							}
-
-							if (!ProcessedVertices.Contains(VertexIndex2))
-							{
-								ProcessedVertices.Add(VertexIndex2);
-								bSetVertex2 = true;
-							}
-
-							if (!bSetVertex0 && !bSetVertex1 && !bSetVertex2)
-							{
-								return;
-							}
-						}
-						else
-						{
-							bSetVertex0 = true;
-							bSetVertex1 = true;
-							bSetVertex2 = true;
-						}
-
-						if (!StaticMeshBuildVertices.IsValidIndex(VertexIndex0) || !StaticMeshBuildVertices.IsValidIndex(VertexIndex1) || !StaticMeshBuildVertices.IsValidIndex(VertexIndex2))
-						{
-							return;
-						}
-
-						FStaticMeshBuildVertex& StaticMeshVertex0 = StaticMeshBuildVertices[VertexIndex0];
-						FStaticMeshBuildVertex& StaticMeshVertex1 = StaticMeshBuildVertices[VertexIndex1];
-						FStaticMeshBuildVertex& StaticMeshVertex2 = StaticMeshBuildVertices[VertexIndex2];
-
-#if ENGINE_MAJOR_VERSION > 4
-						FVector SideA = FVector(StaticMeshVertex1.Position - StaticMeshVertex0.Position);
-						FVector SideB = FVector(StaticMeshVertex2.Position - StaticMeshVertex0.Position);
-						FVector NormalFromCross = FVector::CrossProduct(SideB, SideA).GetSafeNormal();
-
-						StaticMeshVertex0.TangentZ = FVector3f(NormalFromCross);
-						StaticMeshVertex1.TangentZ = FVector3f(NormalFromCross);
-						StaticMeshVertex2.TangentZ = FVector3f(NormalFromCross);
-#else
-						FVector SideA = StaticMeshVertex1.Position - StaticMeshVertex0.Position;
-						FVector SideB = StaticMeshVertex2.Position - StaticMeshVertex0.Position;
-						FVector NormalFromCross = FVector::CrossProduct(SideB, SideA).GetSafeNormal();
-
-						if (bSetVertex0)
-						{
-							StaticMeshVertex0.TangentZ = NormalFromCross;
-						}
-
-						if (bSetVertex1)
-						{
-							StaticMeshVertex1.TangentZ = NormalFromCross;
-						}
-
-						if (bSetVertex2)
-						{
-							StaticMeshVertex2.TangentZ = NormalFromCross;
-						}
-#endif
-					});
-				bMissingNormals = false;
-			}
-
+			const bool bCanGenerateNormals = ((bMissingNormals && StaticMeshConfig.NormalsGenerationStrategy == EglTFRuntimeNormalsGenerationStrategy::IfMissing) ||
+				StaticMeshConfig.NormalsGenerationStrategy == EglTFRuntimeNormalsGenerationStrategy::Always) && (NumVertexInstancesPerSection % 3) == 0;
 			const bool bCanGenerateTangents = (bMissingTangents && StaticMeshConfig.TangentsGenerationStrategy == EglTFRuntimeTangentsGenerationStrategy::IfMissing) ||
 				StaticMeshConfig.TangentsGenerationStrategy == EglTFRuntimeTangentsGenerationStrategy::Always;
 			// recompute tangents if required (need normals and uvs)
-			if (bCanGenerateTangents && !bMissingNormals && Primitive.UVs.Num() > 0 && (NumVertexInstancesPerSection % 3) == 0)
-			{
-				TSet<uint32> ProcessedVertices;
-				ProcessedVertices.Reserve(NumVertexInstancesPerSection);
+			const bool bGenerateTangents = bCanGenerateTangents && (!bMissingNormals || bCanGenerateNormals) && Primitive.GetNumUVChannels() > 0 && (NumVertexInstancesPerSection % 3) == 0;
 
-				FCriticalSection TangentsGenerationLock;
+			if (bCanGenerateNormals || bGenerateTangents)
+			{
+				// shared vertices are resolved independently from the triangles adjacency (no locks)
+				const FglTFRuntimeTangentsGenerator TangentsGenerator(TArrayView<const uint32>(LODIndices.GetData() + VertexInstanceBaseIndex, NumVertexInstancesPerSection));
+				const int32 FirstVertex = TangentsGenerator.GetFirstVertex();
 
-				ParallelFor(NumVertexInstancesPerSection / 3, [&](const int32 VertexInstanceSectionTriangleIndex)
+				if (StaticMeshBuildVertices.IsValidIndex(FirstVertex) && StaticMeshBuildVertices.IsValidIndex(FirstVertex + TangentsGenerator.GetNumVertices() - 1))
+				{
+					TArray<FVector> Positions;
+					TArray<FVector> Normals;
+					TArray<FVector2D> UVs;
+					Positions.AddUninitialized(TangentsGenerator.GetNumVertices());
+					Normals.AddUninitialized(TangentsGenerator.GetNumVertices());
+					if (bGenerateTangents)
 					{
-						const int32 VertexInstanceSectionIndex = VertexInstanceBaseIndex + VertexInstanceSectionTriangleIndex * 3;
-						bool bSetVertex0 = false;
-						bool bSetVertex1 = false;
-						bool bSetVertex2 = false;
-
-						const uint32 VertexIndex0 = LODIndices[VertexInstanceSectionIndex];
-						const uint32 VertexIndex1 = LODIndices[VertexInstanceSectionIndex + 1];
-						const uint32 VertexIndex2 = LODIndices[VertexInstanceSectionIndex + 2];
+						UVs.AddUninitialized(TangentsGenerator.GetNumVertices());
+					}
 
-						if (Primitive.bHasIndices)
+					ParallelFor(TangentsGenerator.GetNumVertices(), [&](const int32 VertexIndex)
 						{
-							FScopeLock Lock(&TangentsGenerationLock);
-
-							if (!ProcessedVertices.Contains(VertexIndex0))
+							const FStaticMeshBuildVertex& StaticMeshVertex = StaticMeshBuildVertices[FirstVertex + VertexIndex];
+							Positions[VertexIndex] = FVector(StaticMeshVertex.Position);
+							Normals[VertexIndex] = FVector(StaticMeshVertex.TangentZ);
+							if (bGenerateTangents)
 							{
-								ProcessedVertices.Add(VertexIndex0);
-								bSetVertex0 = true;
+								UVs[VertexIndex] = FVector2D(StaticMeshVertex.UVs[0]);
 							}
+						});
 
-							if (!ProcessedVertices.Contains(VertexIndex1))
-							{
-								ProcessedVertices.Add(VertexIndex1);
-								bSetVertex1 = true;
-							}
+					if (bCanGenerateNormals)
+					{
+						TangentsGenerator.GenerateNormals(Positions, Normals, StaticMeshConfig.bSmoothNormals, StaticMeshConfig.bMikkTSpaceTangents);
+						bMissingNormals = false;
+					}
 
-							if (!ProcessedVertices.Contains(VertexIndex2))
-							{
-								ProcessedVertices.Add(VertexIndex2);
-								bSetVertex2 = true;
-							}
+					TArray<FVector4> Tangents;
+					if (bGenerateTangents)
+					{
+						Tangents.AddUninitialized(TangentsGenerator.GetNumVertices());
+						TangentsGenerator.GenerateTangents(Positions, UVs, Normals, Tangents, StaticMeshConfig.bMikkTSpaceTangents);
+					}
 
-							if (!bSetVertex0 && !bSetVertex1 && !bSetVertex2)
+					ParallelFor(TangentsGenerator.GetNumVertices(), [&](const int32 VertexIndex)
+						{
+							if (!TangentsGenerator.IsVertexReferenced(VertexIndex))
 							{
 								return;
 							}
-						}
-						else
-						{
-							bSetVertex0 = true;
-							bSetVertex1 = true;
-							bSetVertex2 = true;
-						}
-
-						if (!StaticMeshBuildVertices.IsValidIndex(VertexIndex0) || !StaticMeshBuildVertices.IsValidIndex(VertexIndex1) || !StaticMeshBuildVertices.IsValidIndex(VertexIndex2))
-						{
-							return;
-						}
-
-						FStaticMeshBuildVertex& StaticMeshVertex0 = StaticMeshBuildVertices[VertexIndex0];
-						FStaticMeshBuildVertex& StaticMeshVertex1 = StaticMeshBuildVertices[VertexIndex1];
-						FStaticMeshBuildVertex& StaticMeshVertex2 = StaticMeshBuildVertices[VertexIndex2];
-
-#if ENGINE_MAJOR_VERSION > 4
-						const FVector Position0 = FVector(StaticMeshVertex0.Position);
-						const FVector4 TangentZ0 = FVector(StaticMeshVertex0.TangentZ);
-						const FVector2D UV0 = FVector2D(StaticMeshVertex0.UVs[0]);
-#else
-						const FVector Position0 = StaticMeshVertex0.Position;
-						const FVector4 TangentZ0 = StaticMeshVertex0.TangentZ;
-						const FVector2D UV0 = StaticMeshVertex0.UVs[0];
-#endif
-
-#if ENGINE_MAJOR_VERSION > 4
-						const FVector Position1 = FVector(StaticMeshVertex1.Position);
-						const FVector4 TangentZ1 = FVector(StaticMeshVertex1.TangentZ);
-						const FVector2D UV1 = FVector2D(StaticMeshVertex1.UVs[0]);
-#else
-						const FVector Position1 = StaticMeshVertex1.Position;
-						const FVector4 TangentZ1 = StaticMeshVertex1.TangentZ;
-						const FVector2D UV1 = StaticMeshVertex1.UVs[0];
-#endif
-
-#if ENGINE_MAJOR_VERSION > 4
-						const FVector Position2 = FVector(StaticMeshVertex2.Position);
-						const FVector4 TangentZ2 = FVector(StaticMeshVertex2.TangentZ);
-						const FVector2D UV2 = FVector2D(StaticMeshVertex2.UVs[0]);
-#else
-						const FVector Position2 = StaticMeshVertex2.Position;
-						const FVector4 TangentZ2 = StaticMeshVertex2.TangentZ;
-						const FVector2D UV2 = StaticMeshVertex2.UVs[0];
-#endif
-
-						const FVector DeltaPosition0 = Position1 - Position0;
-						const FVector DeltaPosition1 = Position2 - Position0;
-
-						const FVector2D DeltaUV0 = UV1 - UV0;
-						const FVector2D DeltaUV1 = UV2 - UV0;
 
-						const float Factor = 1.0f / (DeltaUV0.X * DeltaUV1.Y - DeltaUV0.Y * DeltaUV1.X);
-
-						const FVector TriangleTangentX = ((DeltaPosition0 * DeltaUV1.Y) - (DeltaPosition1 * DeltaUV0.Y)) * Factor;
-						//const FVector TriangleTangentY = ((DeltaPosition0 * DeltaUV1.X) - (DeltaPosition1 * DeltaUV0.X)) * Factor;
-
-						if (bSetVertex0)
-						{
-							FVector TangentX0 = TriangleTangentX - (TangentZ0 * FVector::DotProduct(TangentZ0, TriangleTangentX));
-							TangentX0.Normalize();
+							FStaticMeshBuildVertex& StaticMeshVertex = StaticMeshBuildVertices[FirstVertex + VertexIndex];
+							const FVector TangentZ = Normals[VertexIndex];
 #if ENGINE_MAJOR_VERSION > 4
-							StaticMeshVertex0.TangentX = FVector3f(TangentX0);
-							StaticMeshVertex0.TangentY = FVector3f(glTFRuntime::ComputeTangentY(FVector(StaticMeshVertex0.TangentZ), FVector(StaticMeshVertex0.TangentX)) * TangentsDirection);
+							StaticMeshVertex.TangentZ = FVector3f(TangentZ);
 #else
-							StaticMeshVertex0.TangentX = TangentX0;
-							StaticMeshVertex0.TangentY = glTFRuntime::ComputeTangentY(StaticMeshVertex0.TangentZ, StaticMeshVertex0.TangentX) * TangentsDirection;
+							StaticMeshVertex.TangentZ = TangentZ;
 #endif
-						}
 
-						if (bSetVertex1)
-						{
-							FVector TangentX1 = TriangleTangentX - (TangentZ1 * FVector::DotProduct(TangentZ1, TriangleTangentX));
-							TangentX1.Normalize();
-
-#if ENGINE_MAJOR_VERSION > 4
-							StaticMeshVertex1.TangentX = FVector3f(TangentX1);
-							StaticMeshVertex1.TangentY = FVector3f(glTFRuntime::ComputeTangentY(FVector(StaticMeshVertex1.TangentZ), FVector(StaticMeshVertex1.TangentX)) * TangentsDirection);
-#else
-							StaticMeshVertex1.TangentX = TangentX1;
-							StaticMeshVertex1.TangentY = glTFRuntime::ComputeTangentY(StaticMeshVertex1.TangentZ, StaticMeshVertex1.TangentX) * TangentsDirection;
-#endif
-						}
-
-						if (bSetVertex2)
-						{
-							FVector TangentX2 = TriangleTangentX - (TangentZ2 * FVector::DotProduct(TangentZ2, TriangleTangentX));
-							TangentX2.Normalize();
+							if (bGenerateTangents)
+							{
+								const FVector TangentX = FVector(Tangents[VertexIndex]);
+								const FVector TangentY = StaticMeshConfig.bMikkTSpaceTangents ? glTFRuntime::ComputeTangentYWithW(TangentZ, TangentX, Tangents[VertexIndex].W * TangentsDirection) : glTFRuntime::ComputeTangentY(TangentZ, TangentX) * TangentsDirection;
 #if ENGINE_MAJOR_VERSION > 4
-							StaticMeshVertex2.TangentX = FVector3f(TangentX2);
-							StaticMeshVertex2.TangentY = FVector3f(glTFRuntime::ComputeTangentY(FVector(StaticMeshVertex2.TangentZ), FVector(StaticMeshVertex2.TangentX)) * TangentsDirection);
+								StaticMeshVertex.TangentX = FVector3f(TangentX);
+								StaticMeshVertex.TangentY = FVector3f(TangentY);
 #else
-							StaticMeshVertex2.TangentX = TangentX2;
-							StaticMeshVertex2.TangentY = glTFRuntime::ComputeTangentY(StaticMeshVertex2.TangentZ, StaticMeshVertex2.TangentX) * TangentsDirection;
+								StaticMeshVertex.TangentX = TangentX;
+								StaticMeshVertex.TangentY = TangentY;
 #endif
-						}
-					});
+							}
+						});
+				}
 			}
 
 			VertexInstanceBaseIndex += NumVertexInstancesPerSection;
-			VertexBaseIndex += Primitive.bHasIndices ? Primitive.Positions.Num() : Primitive.Indices.Num();
+			VertexBaseIndex += bSharedVertices ? Primitive.GetNumVertices() : Primitive.Indices.Num();
 		}
 
 		// this is way more fast than doing it in the ParalellFor with a lock
@@ -1113,25 +928,28 @@ bool FglTFRuntimeParser::LoadStaticMeshes(TArray<UStaticMesh*>& StaticMeshes, co
 	return true;
 }
 
-bool FglTFRuntimeParser::LoadMeshIntoMeshLOD(TSharedRef<FJsonObject> JsonMeshObject, FglTFRuntimeMeshLOD*& LOD, const FglTFRuntimeMaterialsConfig& MaterialsConfig)
+bool FglTFRuntimeParser::LoadMeshIntoMeshLOD(TSharedRef<FJsonObject> JsonMeshObject, FglTFRuntimeMeshLOD*& LOD, const FglTFRuntimeMaterialsConfig& MaterialsConfig, const bool bCompact, const bool bHighPrecisionTangents)
 {
+	// a single LOD is cached per mesh, in the representation of the first request (the renderers read it through the layout agnostic accessors)
 	if (LODsCache.Contains(JsonMeshObject))
 	{
 		LOD = &LODsCache[JsonMeshObject];
 		return true;
 	}
 
-	TArray<FglTFRuntimePrimitive> Primitives;
-	if (!LoadPrimitives(JsonMeshObject, Primitives, MaterialsConfig, true))
+	FglTFRuntimeMeshLOD NewLOD;
+	if (!LoadPrimitives(JsonMeshObject, NewLOD.Primitives, MaterialsConfig, true, bCompact, bHighPrecisionTangents))
 	{
 		return false;
 	}
 
-	FglTFRuntimeMeshLOD NewLOD;
-	NewLOD.Primitives = MoveTemp(Primitives);
+	if (bCompact)
+	{
+		const int64 BytesSaved = glTFRuntime::CompactMeshLOD(NewLOD, bHighPrecisionTangents);
+		UE_LOG(LogGLTFRuntime, Log, TEXT("Loaded compact mesh primitives: %lld bytes saved"), BytesSaved);
+	}
 
-	FglTFRuntimeMeshLOD& CachedLOD = LODsCache.Add(JsonMeshObject, MoveTemp(NewLOD));
-	LOD = &CachedLOD;
+	LOD = &LODsCache.Add(JsonMeshObject, MoveTemp(NewLOD));
 	return true;
 }
 
@@ -1151,7 +969,7 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMesh(const int32 MeshIndex, const Fgl
 
 	TSharedRef<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe> StaticMeshContext = MakeShared<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe>(AsShared(), MeshIndex, StaticMeshConfig);
 	FglTFRuntimeMeshLOD* LOD = nullptr;
-	if (!LoadMeshIntoMeshLOD(JsonMeshObject.ToSharedRef(), LOD, StaticMeshConfig.MaterialsConfig))
+	if (!LoadMeshIntoMeshLOD(JsonMeshObject.ToSharedRef(), LOD, StaticMeshConfig.MaterialsConfig, StaticMeshConfig.bCompactPrimitives, StaticMeshConfig.bUseHighPrecisionTangentBasis))
 	{
 		return nullptr;
 	}
@@ -1188,7 +1006,7 @@ TArray<UStaticMesh*> FglTFRuntimeParser::LoadStaticMeshesFromPrimitives(const in
 	}
 
 	FglTFRuntimeMeshLOD* LOD = nullptr;
-	if (!LoadMeshIntoMeshLOD(JsonMeshObject.ToSharedRef(), LOD, StaticMeshConfig.MaterialsConfig))
+	if (!LoadMeshIntoMeshLOD(JsonMeshObject.ToSharedRef(), LOD, StaticMeshConfig.MaterialsConfig, StaticMeshConfig.bCompactPrimitives, StaticMeshConfig.bUseHighPrecisionTangentBasis))
 	{
 		return StaticMeshes;
 	}
@@ -1235,7 +1053,7 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMeshLODs(const TArray<int32>& MeshInd
 
 		FglTFRuntimeMeshLOD* LOD = nullptr;
 
-		if (!LoadMeshIntoMeshLOD(JsonMeshObject.ToSharedRef(), LOD, StaticMeshConfig.MaterialsConfig))
+		if (!LoadMeshIntoMeshLOD(JsonMeshObject.ToSharedRef(), LOD, StaticMeshConfig.MaterialsConfig, StaticMeshConfig.bCompactPrimitives, StaticMeshConfig.bUseHighPrecisionTangentBasis))
 		{
 			return nullptr;
 		}
@@ -1255,11 +1073,16 @@ void FglTFRuntimeParser::LoadStaticMeshLODsAsync(const TArray<int32>& MeshIndice
 {
 	TSharedRef<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe> StaticMeshContext = MakeShared<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe>(AsShared(), -1, StaticMeshConfig);
 
-	Async(EAsyncExecution::Thread, [this, StaticMeshContext, MeshIndices, AsyncCallback]()
+	AddAsyncTask([this, StaticMeshContext, MeshIndices, AsyncCallback](const bool bCancelled)
 		{
-			bool bSuccess = true;
+			bool bSuccess = !bCancelled;
 			for (const int32 MeshIndex : MeshIndices)
 			{
+				if (!bSuccess)
+				{
+					break;
+				}
+
 				TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex("meshes", MeshIndex);
 				if (!JsonMeshObject)
 				{
@@ -1269,7 +1092,7 @@ void FglTFRuntimeParser::LoadStaticMeshLODsAsync(const TArray<int32>& MeshIndice
 
 				FglTFRuntimeMeshLOD* LOD = nullptr;
 
-				if (!LoadMeshIntoMeshLOD(JsonMeshObject.ToSharedRef(), LOD, StaticMeshContext->StaticMeshConfig.MaterialsConfig))
+				if (!LoadMeshIntoMeshLOD(JsonMeshObject.ToSharedRef(), LOD, StaticMeshContext->StaticMeshConfig.MaterialsConfig, StaticMeshContext->StaticMeshConfig.bCompactPrimitives, StaticMeshContext->StaticMeshConfig.bUseHighPrecisionTangentBasis))
 				{
 					bSuccess = false;
 					break;
@@ -1283,7 +1106,7 @@ void FglTFRuntimeParser::LoadStaticMeshLODsAsync(const TArray<int32>& MeshIndice
 				StaticMeshContext->StaticMesh = LoadStaticMesh_Internal(StaticMeshContext);
 			}
 
-			FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([StaticMeshContext, AsyncCallback]()
+			FFunctionGraphTask::CreateAndDispatchWhenReady([StaticMeshContext, AsyncCallback]()
 				{
 					if (StaticMeshContext->StaticMesh)
 					{
@@ -1296,8 +1119,7 @@ void FglTFRuntimeParser::LoadStaticMeshLODsAsync(const TArray<int32>& MeshIndice
 					StaticMeshContext->UnregisterGCObject();
 #endif
 				}, TStatId(), nullptr, ENamedThreads::GameThread);
-			FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
-		});
+		}, StaticMeshConfig.AsyncPriority, StaticMeshConfig.AsyncCancellationToken);
 }
 
 bool FglTFRuntimeParser::LoadStaticMeshIntoProceduralMeshComponent(const int32 MeshIndex, UProceduralMeshComponent* ProceduralMeshComponent, const FglTFRuntimeProceduralMeshConfig& ProceduralMeshConfig)
@@ -1442,7 +1264,7 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMeshRecursive(const FString& NodeName
 			}
 
 			FglTFRuntimeMeshLOD* LOD = nullptr;
-			if (!LoadMeshIntoMeshLOD(JsonMeshObject.ToSharedRef(), LOD, StaticMeshConfig.MaterialsConfig))
+			if (!LoadMeshIntoMeshLOD(JsonMeshObject.ToSharedRef(), LOD, StaticMeshConfig.MaterialsConfig, StaticMeshConfig.bCompactPrimitives, StaticMeshConfig.bUseHighPrecisionTangentBasis))
 			{
 				return nullptr;
 			}
@@ -1488,8 +1310,19 @@ void FglTFRuntimeParser::LoadStaticMeshRecursiveAsync(const FString& NodeName, c
 	TSharedRef<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe> StaticMeshContext = MakeShared<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe>(AsShared(), -1, StaticMeshConfig);
 
 
-	Async(EAsyncExecution::Thread, [this, StaticMeshContext, StaticMeshConfig, ExcludeNodes, NodeName, AsyncCallback]()
+	AddAsyncTask([this, StaticMeshContext, StaticMeshConfig, ExcludeNodes, NodeName, AsyncCallback](const bool bCancelled)
 		{
+			if (bCancelled)
+			{
+				FFunctionGraphTask::CreateAndDispatchWhenReady([StaticMeshContext, AsyncCallback]()
+					{
+						AsyncCallback.ExecuteIfBound(nullptr);
+#if (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 2) || ENGINE_MAJOR_VERSION > 5
+						StaticMeshContext->UnregisterGCObject();
+#endif
+					}, TStatId(), nullptr, ENamedThreads::GameThread);
+				return;
+			}
 
 			FglTFRuntimeNode Node;
 			TArray<FglTFRuntimeNode> Nodes;
@@ -1545,7 +1378,7 @@ void FglTFRuntimeParser::LoadStaticMeshRecursiveAsync(const FString& NodeName, c
 					}
 
 					FglTFRuntimeMeshLOD* LOD = nullptr;
-					if (!LoadMeshIntoMeshLOD(JsonMeshObject.ToSharedRef(), LOD, StaticMeshConfig.MaterialsConfig))
+					if (!LoadMeshIntoMeshLOD(JsonMeshObject.ToSharedRef(), LOD, StaticMeshConfig.MaterialsConfig, StaticMeshConfig.bCompactPrimitives, StaticMeshConfig.bUseHighPrecisionTangentBasis))
 					{
 						return;
 					}
@@ -1578,7 +1411,7 @@ void FglTFRuntimeParser::LoadStaticMeshRecursiveAsync(const FString& NodeName, c
 
 			StaticMeshContext->StaticMesh = LoadStaticMesh_Internal(StaticMeshContext);
 
-			FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([StaticMeshContext, AsyncCallback]()
+			FFunctionGraphTask::CreateAndDispatchWhenReady([StaticMeshContext, AsyncCallback]()
 				{
 					if (StaticMeshContext->StaticMesh)
 					{
@@ -1591,8 +1424,7 @@ void FglTFRuntimeParser::LoadStaticMeshRecursiveAsync(const FString& NodeName, c
 					StaticMeshContext->UnregisterGCObject();
 #endif
 				}, TStatId(), nullptr, ENamedThreads::GameThread);
-			FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
-		});
+		}, StaticMeshConfig.AsyncPriority, StaticMeshConfig.AsyncCancellationToken);
 }
 
 bool FglTFRuntimeParser::LoadMeshAsRuntimeLOD(const int32 MeshIndex, FglTFRuntimeMeshLOD& RuntimeLOD, const FglTFRuntimeMaterialsConfig& MaterialsConfig)
@@ -1607,6 +1439,8 @@ bool FglTFRuntimeParser::LoadMeshAsRuntimeLOD(const int32 MeshIndex, FglTFRuntim
 	if (LoadMeshIntoMeshLOD(JsonMeshObject.ToSharedRef(), LOD, MaterialsConfig))
 	{
 		RuntimeLOD = MoveTemp(*LOD);
+		// runtime LODs are exposed in the wide form (the cached LOD can be compact)
+		glTFRuntime::ExpandMeshLOD(RuntimeLOD);
 		return true;
 	}
 
@@ -1635,16 +1469,19 @@ void FglTFRuntimeParser::LoadStaticMeshFromRuntimeLODsAsync(const TArray<FglTFRu
 {
 	TSharedRef<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe> StaticMeshContext = MakeShared<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe>(AsShared(), -1, StaticMeshConfig);
 
-	Async(EAsyncExecution::Thread, [this, StaticMeshContext, StaticMeshConfig, RuntimeLODs, AsyncCallback]()
+	AddAsyncTask([this, StaticMeshContext, StaticMeshConfig, RuntimeLODs, AsyncCallback](const bool bCancelled)
 		{
-			for (const FglTFRuntimeMeshLOD& RuntimeLOD : RuntimeLODs)
+			if (!bCancelled)
 			{
-				StaticMeshContext->LODs.Add(&RuntimeLOD);
-			}
+				for (const FglTFRuntimeMeshLOD& RuntimeLOD : RuntimeLODs)
+				{
+					StaticMeshContext->LODs.Add(&RuntimeLOD);
+				}
 
-			StaticMeshContext->StaticMesh = LoadStaticMesh_Internal(StaticMeshContext);
+				StaticMeshContext->StaticMesh = LoadStaticMesh_Internal(StaticMeshContext);
+			}
 
-			FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([StaticMeshContext, AsyncCallback]()
+			FFunctionGraphTask::CreateAndDispatchWhenReady([StaticMeshContext, AsyncCallback]()
 				{
 					if (StaticMeshContext->StaticMesh)
 					{
@@ -1657,7 +1494,5 @@ void FglTFRuntimeParser::LoadStaticMeshFromRuntimeLODsAsync(const TArray<FglTFRu
 					StaticMeshContext->UnregisterGCObject();
 #endif
 				}, TStatId(), nullptr, ENamedThreads::GameThread);
-			FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
-		}
-	);
+		}, StaticMeshConfig.AsyncPriority, StaticMeshConfig.AsyncCancellationToken);
 }
\ No newline at end of file
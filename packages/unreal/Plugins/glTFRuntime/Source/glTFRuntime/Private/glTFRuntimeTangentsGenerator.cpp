@@ -0,0 +1,205 @@
+// Copyright 2020-2025, Roberto De Ioris.
+
+#include "glTFRuntimeTangentsGenerator.h"
+#include "Async/ParallelFor.h"
+
+namespace glTFRuntime
+{
+	namespace TangentsGenerator
+	{
+		// orthogonal fallback for vertices without a valid uv mapping
+		FVector GetOrthogonalTangent(const FVector& Normal)
+		{
+			FVector Tangent = FVector::CrossProduct(Normal, FVector::UpVector);
+			if (Tangent.IsNearlyZero())
+			{
+				Tangent = FVector::CrossProduct(Normal, FVector::ForwardVector);
+			}
+			return Tangent.GetSafeNormal();
+		}
+	}
+}
+
+FglTFRuntimeTangentsGenerator::FglTFRuntimeTangentsGenerator(TArrayView<const uint32> InIndices) : Indices(InIndices), FirstVertex(0), NumVertices(0)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeTangentsGenerator_BuildAdjacency, FColor::Magenta);
+
+	const int32 NumCorners = (Indices.Num() / 3) * 3;
+	if (NumCorners == 0)
+	{
+		CornersOffsets.Add(0);
+		return;
+	}
+
+	uint32 MinIndex = MAX_uint32;
+	uint32 MaxIndex = 0;
+	for (int32 Corner = 0; Corner < NumCorners; Corner++)
+	{
+		MinIndex = FMath::Min(MinIndex, Indices[Corner]);
+		MaxIndex = FMath::Max(MaxIndex, Indices[Corner]);
+	}
+
+	FirstVertex = static_cast<int32>(MinIndex);
+	NumVertices = static_cast<int32>(MaxIndex - MinIndex) + 1;
+
+	// counting sort of the corners by vertex
+	CornersOffsets.SetNumZeroed(NumVertices + 1);
+	for (int32 Corner = 0; Corner < NumCorners; Corner++)
+	{
+		CornersOffsets[Indices[Corner] - MinIndex + 1]++;
+	}
+
+	for (int32 VertexIndex = 0; VertexIndex < NumVertices; VertexIndex++)
+	{
+		CornersOffsets[VertexIndex + 1] += CornersOffsets[VertexIndex];
+	}
+
+	TArray<int32> Cursors(CornersOffsets.GetData(), NumVertices);
+	Corners.AddUninitialized(NumCorners);
+	for (int32 Corner = 0; Corner < NumCorners; Corner++)
+	{
+		Corners[Cursors[Indices[Corner] - MinIndex]++] = Corner;
+	}
+}
+
+float FglTFRuntimeTangentsGenerator::GetCornerAngle(TArrayView<const FVector> Positions, const int32 Corner) const
+{
+	const int32 TriangleBase = Corner - (Corner % 3);
+	const FVector& Position = Positions[Indices[Corner] - FirstVertex];
+	const FVector EdgeA = (Positions[Indices[TriangleBase + (Corner + 1) % 3] - FirstVertex] - Position).GetSafeNormal();
+	const FVector EdgeB = (Positions[Indices[TriangleBase + (Corner + 2) % 3] - FirstVertex] - Position).GetSafeNormal();
+	return FMath::Acos(FMath::Clamp(static_cast<float>(FVector::DotProduct(EdgeA, EdgeB)), -1.0f, 1.0f));
+}
+
+void FglTFRuntimeTangentsGenerator::GenerateNormals(TArrayView<const FVector> Positions, TArrayView<FVector> Normals, const bool bSmooth, const bool bMikkTSpace) const
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeTangentsGenerator_GenerateNormals, FColor::Magenta);
+
+	const int32 NumTriangles = Corners.Num() / 3;
+
+	// the cross product length is proportional to the triangle area
+	TArray<FVector> FaceNormals;
+	FaceNormals.AddUninitialized(NumTriangles);
+	ParallelFor(NumTriangles, [&](const int32 TriangleIndex)
+		{
+			const FVector& Position0 = Positions[Indices[TriangleIndex * 3] - FirstVertex];
+			const FVector& Position1 = Positions[Indices[TriangleIndex * 3 + 1] - FirstVertex];
+			const FVector& Position2 = Positions[Indices[TriangleIndex * 3 + 2] - FirstVertex];
+			const FVector FaceNormal = FVector::CrossProduct(Position2 - Position0, Position1 - Position0);
+			FaceNormals[TriangleIndex] = bMikkTSpace ? FaceNormal.GetSafeNormal() : FaceNormal;
+		});
+
+	ParallelFor(NumVertices, [&](const int32 VertexIndex)
+		{
+			if (!IsVertexReferenced(VertexIndex))
+			{
+				return;
+			}
+
+			// corners are sorted, so the first one belongs to the lowest triangle
+			if (!bSmooth)
+			{
+				Normals[VertexIndex] = FaceNormals[Corners[CornersOffsets[VertexIndex]] / 3].GetSafeNormal();
+				return;
+			}
+
+			FVector Normal = FVector::ZeroVector;
+			for (int32 CornerIndex = CornersOffsets[VertexIndex]; CornerIndex < CornersOffsets[VertexIndex + 1]; CornerIndex++)
+			{
+				const int32 Corner = Corners[CornerIndex];
+				Normal += bMikkTSpace ? FaceNormals[Corner / 3] * GetCornerAngle(Positions, Corner) : FaceNormals[Corner / 3];
+			}
+
+			Normals[VertexIndex] = Normal.GetSafeNormal();
+		});
+}
+
+void FglTFRuntimeTangentsGenerator::GenerateTangents(TArrayView<const FVector> Positions, TArrayView<const FVector2D> UVs, TArrayView<const FVector> Normals, TArrayView<FVector4> Tangents, const bool bMikkTSpace) const
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeTangentsGenerator_GenerateTangents, FColor::Magenta);
+
+	using namespace glTFRuntime::TangentsGenerator;
+
+	const int32 NumTriangles = Corners.Num() / 3;
+	const bool bHasUVs = UVs.Num() >= NumVertices;
+
+	// per triangle uv derivatives (zero for degenerate mappings)
+	TArray<FVector> FaceTangents;
+	TArray<FVector> FaceBitangents;
+	if (bHasUVs)
+	{
+		FaceTangents.AddUninitialized(NumTriangles);
+		FaceBitangents.AddUninitialized(NumTriangles);
+		ParallelFor(NumTriangles, [&](const int32 TriangleIndex)
+			{
+				const int32 VertexIndex0 = Indices[TriangleIndex * 3] - FirstVertex;
+				const int32 VertexIndex1 = Indices[TriangleIndex * 3 + 1] - FirstVertex;
+				const int32 VertexIndex2 = Indices[TriangleIndex * 3 + 2] - FirstVertex;
+
+				const FVector DeltaPosition0 = Positions[VertexIndex1] - Positions[VertexIndex0];
+				const FVector DeltaPosition1 = Positions[VertexIndex2] - Positions[VertexIndex0];
+				const FVector2D DeltaUV0 = UVs[VertexIndex1] - UVs[VertexIndex0];
+				const FVector2D DeltaUV1 = UVs[VertexIndex2] - UVs[VertexIndex0];
+
+				const float Determinant = DeltaUV0.X * DeltaUV1.Y - DeltaUV0.Y * DeltaUV1.X;
+				if (FMath::Abs(Determinant) <= SMALL_NUMBER)
+				{
+					FaceTangents[TriangleIndex] = FVector::ZeroVector;
+					FaceBitangents[TriangleIndex] = FVector::ZeroVector;
+					return;
+				}
+
+				const float Factor = 1.0f / Determinant;
+				FaceTangents[TriangleIndex] = ((DeltaPosition0 * DeltaUV1.Y) - (DeltaPosition1 * DeltaUV0.Y)) * Factor;
+				FaceBitangents[TriangleIndex] = ((DeltaPosition1 * DeltaUV0.X) - (DeltaPosition0 * DeltaUV1.X)) * Factor;
+			});
+	}
+
+	ParallelFor(NumVertices, [&](const int32 VertexIndex)
+		{
+			if (!IsVertexReferenced(VertexIndex))
+			{
+				return;
+			}
+
+			const FVector& Normal = Normals[VertexIndex];
+			FVector Tangent = FVector::ZeroVector;
+			FVector Bitangent = FVector::ZeroVector;
+
+			if (bHasUVs)
+			{
+				for (int32 CornerIndex = CornersOffsets[VertexIndex]; CornerIndex < CornersOffsets[VertexIndex + 1]; CornerIndex++)
+				{
+					const int32 Corner = Corners[CornerIndex];
+					const FVector& FaceTangent = FaceTangents[Corner / 3];
+					const FVector& FaceBitangent = FaceBitangents[Corner / 3];
+					if (bMikkTSpace)
+					{
+						const float Angle = GetCornerAngle(Positions, Corner);
+						Tangent += (FaceTangent - Normal * FVector::DotProduct(Normal, FaceTangent)).GetSafeNormal() * Angle;
+						Bitangent += (FaceBitangent - Normal * FVector::DotProduct(Normal, FaceBitangent)).GetSafeNormal() * Angle;
+					}
+					else
+					{
+						Tangent += FaceTangent;
+						Bitangent += FaceBitangent;
+					}
+				}
+			}
+
+			Tangent = (Tangent - Normal * FVector::DotProduct(Normal, Tangent)).GetSafeNormal();
+			if (Tangent.IsNearlyZero())
+			{
+				Tangent = GetOrthogonalTangent(Normal);
+			}
+
+			float W = 1;
+			if (bMikkTSpace)
+			{
+				// the glTF to Unreal basis change flips the handedness
+				W = FVector::DotProduct(FVector::CrossProduct(Normal, Tangent), Bitangent) < 0 ? 1 : -1;
+			}
+
+			Tangents[VertexIndex] = FVector4(Tangent, W);
+		});
+}
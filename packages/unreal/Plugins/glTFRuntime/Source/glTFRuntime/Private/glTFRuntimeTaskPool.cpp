@@ -0,0 +1,156 @@
+// Copyright 2020-2025, Roberto De Ioris.
+
+#include "glTFRuntimeTaskPool.h"
+#include "HAL/PlatformMisc.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/ScopeLock.h"
+
+namespace glTFRuntime
+{
+	namespace TaskPool
+	{
+		static TUniquePtr<FglTFRuntimeTaskPool> Instance;
+		static FCriticalSection InstanceLock;
+	}
+}
+
+FglTFRuntimeTaskPool& FglTFRuntimeTaskPool::Get()
+{
+	FScopeLock Lock(&glTFRuntime::TaskPool::InstanceLock);
+	if (!glTFRuntime::TaskPool::Instance)
+	{
+		glTFRuntime::TaskPool::Instance = TUniquePtr<FglTFRuntimeTaskPool>(new FglTFRuntimeTaskPool());
+	}
+	return *glTFRuntime::TaskPool::Instance;
+}
+
+void FglTFRuntimeTaskPool::Shutdown()
+{
+	FScopeLock Lock(&glTFRuntime::TaskPool::InstanceLock);
+	glTFRuntime::TaskPool::Instance.Reset();
+}
+
+FglTFRuntimeTaskPool::FglTFRuntimeTaskPool()
+{
+	// leave room for the game thread, the render thread and the task graph workers used by ParallelFor
+	NumThreads = FMath::Clamp(FPlatformMisc::NumberOfCoresIncludingHyperthreads() / 2, 2, 8);
+
+	ThreadPool = FQueuedThreadPool::Allocate();
+	ThreadPool->Create(NumThreads, 128 * 1024, TPri_BelowNormal, TEXT("glTFRuntimeTaskPool"));
+
+	for (int32 PriorityIndex = 0; PriorityIndex < NumPriorities; PriorityIndex++)
+	{
+		QueueDepth[PriorityIndex] = 0;
+	}
+
+	NumRunning = 0;
+	NumCompleted = 0;
+	NumCancelled = 0;
+	TotalWaitTime = 0;
+	MaxWaitTime = 0;
+}
+
+FglTFRuntimeTaskPool::~FglTFRuntimeTaskPool()
+{
+	// queued pumps are abandoned (discarding their tasks), running ones are waited for
+	ThreadPool->Destroy();
+	delete ThreadPool;
+}
+
+void FglTFRuntimeTaskPool::AddTask(FTask&& Task, const EglTFRuntimeAsyncPriority Priority, FglTFRuntimeCancellationTokenPtr CancellationToken)
+{
+	const int32 PriorityIndex = FMath::Clamp(static_cast<int32>(Priority), 0, NumPriorities - 1);
+
+	FPendingTask PendingTask;
+	PendingTask.Task = MoveTemp(Task);
+	PendingTask.CancellationToken = CancellationToken;
+	PendingTask.EnqueueTime = FPlatformTime::Seconds();
+
+	{
+		FScopeLock Lock(&QueuesLock);
+		Queues[PriorityIndex].Enqueue(MoveTemp(PendingTask));
+		QueueDepth[PriorityIndex]++;
+	}
+
+	// every pump runs the best task available when a worker picks it up, not the one it was queued for
+	ThreadPool->AddQueuedWork(new FPumpWork(*this));
+}
+
+bool FglTFRuntimeTaskPool::Dequeue(FPendingTask& PendingTask)
+{
+	FScopeLock Lock(&QueuesLock);
+	for (int32 PriorityIndex = 0; PriorityIndex < NumPriorities; PriorityIndex++)
+	{
+		if (Queues[PriorityIndex].Dequeue(PendingTask))
+		{
+			QueueDepth[PriorityIndex]--;
+			return true;
+		}
+	}
+	return false;
+}
+
+void FglTFRuntimeTaskPool::RunNext()
+{
+	FPendingTask PendingTask;
+	if (!Dequeue(PendingTask))
+	{
+		return;
+	}
+
+	const double WaitTime = FPlatformTime::Seconds() - PendingTask.EnqueueTime;
+	const bool bCancelled = PendingTask.CancellationToken.IsValid() && PendingTask.CancellationToken->IsCancelled();
+
+	{
+		FScopeLock Lock(&QueuesLock);
+		NumRunning++;
+		TotalWaitTime += WaitTime;
+		MaxWaitTime = FMath::Max(MaxWaitTime, WaitTime);
+	}
+
+	PendingTask.Task(bCancelled);
+
+	{
+		FScopeLock Lock(&QueuesLock);
+		NumRunning--;
+		if (bCancelled)
+		{
+			NumCancelled++;
+		}
+		else
+		{
+			NumCompleted++;
+		}
+	}
+}
+
+FglTFRuntimeTaskPoolStats FglTFRuntimeTaskPool::GetStats() const
+{
+	FScopeLock Lock(&QueuesLock);
+
+	FglTFRuntimeTaskPoolStats Stats;
+	Stats.NumThreads = NumThreads;
+	Stats.QueueDepthHigh = QueueDepth[static_cast<int32>(EglTFRuntimeAsyncPriority::High)];
+	Stats.QueueDepthNormal = QueueDepth[static_cast<int32>(EglTFRuntimeAsyncPriority::Normal)];
+	Stats.QueueDepthLow = QueueDepth[static_cast<int32>(EglTFRuntimeAsyncPriority::Low)];
+	Stats.NumRunning = NumRunning;
+	Stats.NumCompleted = NumCompleted;
+	Stats.NumCancelled = NumCancelled;
+	const int32 NumStarted = NumCompleted + NumCancelled + NumRunning;
+	Stats.AverageWaitTime = NumStarted > 0 ? TotalWaitTime / NumStarted : 0;
+	Stats.MaxWaitTime = MaxWaitTime;
+	return Stats;
+}
+
+void FglTFRuntimeTaskPool::FPumpWork::DoThreadedWork()
+{
+	TaskPool.RunNext();
+	delete this;
+}
+
+void FglTFRuntimeTaskPool::FPumpWork::Abandon()
+{
+	FPendingTask PendingTask;
+	TaskPool.Dequeue(PendingTask);
+	delete this;
+}
@@ -0,0 +1,695 @@
+// Copyright 2020-2025, Roberto De Ioris.
+
+#include "glTFRuntimeTextureCompressor.h"
+#include "Async/ParallelFor.h"
+
+namespace glTFRuntime
+{
+	namespace TextureCompressor
+	{
+		// number of block rows encoded by a single parallel job
+		constexpr int32 TileBlockRows = 8;
+
+		constexpr int32 BC7Weights[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+		typedef float FTexels[16][4];
+
+		// B8G8R8A8 to RGBA floats
+		void LoadTexels(const uint8* Pixels, FTexels& Texels)
+		{
+			for (int32 Index = 0; Index < 16; Index++)
+			{
+				Texels[Index][0] = Pixels[Index * 4 + 2];
+				Texels[Index][1] = Pixels[Index * 4 + 1];
+				Texels[Index][2] = Pixels[Index * 4 + 0];
+				Texels[Index][3] = Pixels[Index * 4 + 3];
+			}
+		}
+
+		template<int32 Channels>
+		float Distance(const float* A, const float* B)
+		{
+			float Sum = 0;
+			for (int32 Channel = 0; Channel < Channels; Channel++)
+			{
+				const float Delta = A[Channel] - B[Channel];
+				Sum += Delta * Delta;
+			}
+			return Sum;
+		}
+
+		template<int32 Channels>
+		void FitEndpoints(const FTexels& Texels, float (&Endpoint0)[4], float (&Endpoint1)[4], const EglTFRuntimeBlockCompressionQuality Quality)
+		{
+			float Mean[4] = { 0, 0, 0, 0 };
+			float Min[4] = { 255, 255, 255, 255 };
+			float Max[4] = { 0, 0, 0, 0 };
+
+			for (int32 Index = 0; Index < 16; Index++)
+			{
+				for (int32 Channel = 0; Channel < Channels; Channel++)
+				{
+					Mean[Channel] += Texels[Index][Channel] / 16.0f;
+					Min[Channel] = FMath::Min(Min[Channel], Texels[Index][Channel]);
+					Max[Channel] = FMath::Max(Max[Channel], Texels[Index][Channel]);
+				}
+			}
+
+			if (Quality == EglTFRuntimeBlockCompressionQuality::Fast)
+			{
+				// bounding box diagonal, flipped on the channels anti-correlated with the first one
+				for (int32 Channel = 1; Channel < Channels; Channel++)
+				{
+					float Covariance = 0;
+					for (int32 Index = 0; Index < 16; Index++)
+					{
+						Covariance += (Texels[Index][0] - Mean[0]) * (Texels[Index][Channel] - Mean[Channel]);
+					}
+					if (Covariance < 0)
+					{
+						Swap(Min[Channel], Max[Channel]);
+					}
+				}
+
+				for (int32 Channel = 0; Channel < Channels; Channel++)
+				{
+					const float Inset = (Max[Channel] - Min[Channel]) / 16.0f;
+					Endpoint0[Channel] = Max[Channel] - Inset;
+					Endpoint1[Channel] = Min[Channel] + Inset;
+				}
+				return;
+			}
+
+			float Covariance[4][4] = {};
+			for (int32 Index = 0; Index < 16; Index++)
+			{
+				for (int32 Row = 0; Row < Channels; Row++)
+				{
+					for (int32 Column = 0; Column < Channels; Column++)
+					{
+						Covariance[Row][Column] += (Texels[Index][Row] - Mean[Row]) * (Texels[Index][Column] - Mean[Column]);
+					}
+				}
+			}
+
+			// principal axis with power iterations, starting from the bounding box diagonal
+			float Axis[4] = { 0, 0, 0, 0 };
+			for (int32 Channel = 0; Channel < Channels; Channel++)
+			{
+				Axis[Channel] = Max[Channel] - Min[Channel];
+			}
+
+			for (int32 Iteration = 0; Iteration < 8; Iteration++)
+			{
+				float NewAxis[4] = { 0, 0, 0, 0 };
+				float Length = 0;
+				for (int32 Row = 0; Row < Channels; Row++)
+				{
+					for (int32 Column = 0; Column < Channels; Column++)
+					{
+						NewAxis[Row] += Covariance[Row][Column] * Axis[Column];
+					}
+					Length = FMath::Max(Length, FMath::Abs(NewAxis[Row]));
+				}
+
+				if (Length < KINDA_SMALL_NUMBER)
+				{
+					break;
+				}
+
+				for (int32 Channel = 0; Channel < Channels; Channel++)
+				{
+					Axis[Channel] = NewAxis[Channel] / Length;
+				}
+			}
+
+			float AxisLengthSquared = 0;
+			for (int32 Channel = 0; Channel < Channels; Channel++)
+			{
+				AxisLengthSquared += Axis[Channel] * Axis[Channel];
+			}
+
+			if (AxisLengthSquared < KINDA_SMALL_NUMBER)
+			{
+				for (int32 Channel = 0; Channel < Channels; Channel++)
+				{
+					Endpoint0[Channel] = Mean[Channel];
+					Endpoint1[Channel] = Mean[Channel];
+				}
+				return;
+			}
+
+			float MinProjection = MAX_flt;
+			float MaxProjection = -MAX_flt;
+			for (int32 Index = 0; Index < 16; Index++)
+			{
+				float Projection = 0;
+				for (int32 Channel = 0; Channel < Channels; Channel++)
+				{
+					Projection += (Texels[Index][Channel] - Mean[Channel]) * Axis[Channel];
+				}
+				Projection /= AxisLengthSquared;
+				MinProjection = FMath::Min(MinProjection, Projection);
+				MaxProjection = FMath::Max(MaxProjection, Projection);
+			}
+
+			for (int32 Channel = 0; Channel < Channels; Channel++)
+			{
+				Endpoint0[Channel] = FMath::Clamp(Mean[Channel] + Axis[Channel] * MaxProjection, 0.0f, 255.0f);
+				Endpoint1[Channel] = FMath::Clamp(Mean[Channel] + Axis[Channel] * MinProjection, 0.0f, 255.0f);
+			}
+		}
+
+		// least squares endpoints for the given interpolation factors (0 = Endpoint0, 1 = Endpoint1)
+		template<int32 Channels>
+		bool RefineEndpoints(const FTexels& Texels, const float (&Factors)[16], float (&Endpoint0)[4], float (&Endpoint1)[4])
+		{
+			float A = 0, B = 0, C = 0;
+			float X0[4] = { 0, 0, 0, 0 };
+			float X1[4] = { 0, 0, 0, 0 };
+
+			for (int32 Index = 0; Index < 16; Index++)
+			{
+				const float T = Factors[Index];
+				const float InvT = 1 - T;
+				A += InvT * InvT;
+				B += InvT * T;
+				C += T * T;
+				for (int32 Channel = 0; Channel < Channels; Channel++)
+				{
+					X0[Channel] += InvT * Texels[Index][Channel];
+					X1[Channel] += T * Texels[Index][Channel];
+				}
+			}
+
+			const float Determinant = A * C - B * B;
+			if (FMath::Abs(Determinant) < KINDA_SMALL_NUMBER)
+			{
+				return false;
+			}
+
+			for (int32 Channel = 0; Channel < Channels; Channel++)
+			{
+				Endpoint0[Channel] = FMath::Clamp((C * X0[Channel] - B * X1[Channel]) / Determinant, 0.0f, 255.0f);
+				Endpoint1[Channel] = FMath::Clamp((A * X1[Channel] - B * X0[Channel]) / Determinant, 0.0f, 255.0f);
+			}
+
+			return true;
+		}
+
+		uint16 QuantizeRGB565(const float (&Color)[4])
+		{
+			const uint16 R = static_cast<uint16>(FMath::Clamp(FMath::RoundToInt(Color[0] * 31.0f / 255.0f), 0, 31));
+			const uint16 G = static_cast<uint16>(FMath::Clamp(FMath::RoundToInt(Color[1] * 63.0f / 255.0f), 0, 63));
+			const uint16 B = static_cast<uint16>(FMath::Clamp(FMath::RoundToInt(Color[2] * 31.0f / 255.0f), 0, 31));
+			return (R << 11) | (G << 5) | B;
+		}
+
+		void DequantizeRGB565(const uint16 Value, float (&Color)[4])
+		{
+			const uint32 R = (Value >> 11) & 0x1F;
+			const uint32 G = (Value >> 5) & 0x3F;
+			const uint32 B = Value & 0x1F;
+			Color[0] = (R << 3) | (R >> 2);
+			Color[1] = (G << 2) | (G >> 4);
+			Color[2] = (B << 3) | (B >> 2);
+			Color[3] = 255;
+		}
+
+		// 4 colors palette indices, returns the squared error
+		float SelectBC1Indices(const FTexels& Texels, const uint16 Color0, const uint16 Color1, uint8 (&Indices)[16])
+		{
+			float Palette[4][4];
+			DequantizeRGB565(Color0, Palette[0]);
+			DequantizeRGB565(Color1, Palette[1]);
+			for (int32 Channel = 0; Channel < 3; Channel++)
+			{
+				Palette[2][Channel] = (2 * Palette[0][Channel] + Palette[1][Channel]) / 3.0f;
+				Palette[3][Channel] = (Palette[0][Channel] + 2 * Palette[1][Channel]) / 3.0f;
+			}
+
+			float Error = 0;
+			for (int32 Index = 0; Index < 16; Index++)
+			{
+				float BestDistance = MAX_flt;
+				for (int32 PaletteIndex = 0; PaletteIndex < 4; PaletteIndex++)
+				{
+					const float PaletteDistance = Distance<3>(Texels[Index], Palette[PaletteIndex]);
+					if (PaletteDistance < BestDistance)
+					{
+						BestDistance = PaletteDistance;
+						Indices[Index] = PaletteIndex;
+					}
+				}
+				Error += BestDistance;
+			}
+
+			return Error;
+		}
+
+		// 8 bytes color block, always in 4 colors mode
+		void EncodeColorBlock(const FTexels& Texels, uint8* Block, const EglTFRuntimeBlockCompressionQuality Quality)
+		{
+			float Endpoint0[4], Endpoint1[4];
+			FitEndpoints<3>(Texels, Endpoint0, Endpoint1, Quality);
+
+			uint16 Color0 = QuantizeRGB565(Endpoint0);
+			uint16 Color1 = QuantizeRGB565(Endpoint1);
+			uint8 Indices[16];
+			float Error = SelectBC1Indices(Texels, Color0, Color1, Indices);
+
+			if (Quality == EglTFRuntimeBlockCompressionQuality::Best)
+			{
+				constexpr float IndexFactors[4] = { 0, 1, 1.0f / 3.0f, 2.0f / 3.0f };
+				float Factors[16];
+				for (int32 Index = 0; Index < 16; Index++)
+				{
+					Factors[Index] = IndexFactors[Indices[Index]];
+				}
+
+				if (RefineEndpoints<3>(Texels, Factors, Endpoint0, Endpoint1))
+				{
+					const uint16 RefinedColor0 = QuantizeRGB565(Endpoint0);
+					const uint16 RefinedColor1 = QuantizeRGB565(Endpoint1);
+					uint8 RefinedIndices[16];
+					const float RefinedError = SelectBC1Indices(Texels, RefinedColor0, RefinedColor1, RefinedIndices);
+					if (RefinedError < Error)
+					{
+						Color0 = RefinedColor0;
+						Color1 = RefinedColor1;
+						FMemory::Memcpy(Indices, RefinedIndices, 16);
+					}
+				}
+			}
+
+			if (Color0 == Color1)
+			{
+				FMemory::Memzero(Indices, 16);
+			}
+			else if (Color0 < Color1)
+			{
+				// Color0 > Color1 selects the 4 colors mode
+				constexpr uint8 SwappedIndices[4] = { 1, 0, 3, 2 };
+				Swap(Color0, Color1);
+				for (int32 Index = 0; Index < 16; Index++)
+				{
+					Indices[Index] = SwappedIndices[Indices[Index]];
+				}
+			}
+
+			uint32 PackedIndices = 0;
+			for (int32 Index = 0; Index < 16; Index++)
+			{
+				PackedIndices |= static_cast<uint32>(Indices[Index]) << (Index * 2);
+			}
+
+			FMemory::Memcpy(Block, &Color0, 2);
+			FMemory::Memcpy(Block + 2, &Color1, 2);
+			FMemory::Memcpy(Block + 4, &PackedIndices, 4);
+		}
+
+		// 8 bytes single channel block, always in 8 values mode
+		void EncodeBC4Block(const FTexels& Texels, const int32 Channel, uint8* Block)
+		{
+			float Min = 255;
+			float Max = 0;
+			for (int32 Index = 0; Index < 16; Index++)
+			{
+				Min = FMath::Min(Min, Texels[Index][Channel]);
+				Max = FMath::Max(Max, Texels[Index][Channel]);
+			}
+
+			const uint8 Value0 = static_cast<uint8>(FMath::RoundToInt(Max));
+			const uint8 Value1 = static_cast<uint8>(FMath::RoundToInt(Min));
+
+			Block[0] = Value0;
+			Block[1] = Value1;
+
+			uint64 PackedIndices = 0;
+			if (Value0 > Value1)
+			{
+				float Palette[8];
+				Palette[0] = Value0;
+				Palette[1] = Value1;
+				for (int32 PaletteIndex = 2; PaletteIndex < 8; PaletteIndex++)
+				{
+					Palette[PaletteIndex] = ((8 - PaletteIndex) * Value0 + (PaletteIndex - 1) * Value1) / 7.0f;
+				}
+
+				for (int32 Index = 0; Index < 16; Index++)
+				{
+					uint64 BestIndex = 0;
+					float BestDistance = MAX_flt;
+					for (int32 PaletteIndex = 0; PaletteIndex < 8; PaletteIndex++)
+					{
+						const float PaletteDistance = FMath::Abs(Texels[Index][Channel] - Palette[PaletteIndex]);
+						if (PaletteDistance < BestDistance)
+						{
+							BestDistance = PaletteDistance;
+							BestIndex = PaletteIndex;
+						}
+					}
+					PackedIndices |= BestIndex << (Index * 3);
+				}
+			}
+
+			for (int32 Byte = 0; Byte < 6; Byte++)
+			{
+				Block[2 + Byte] = static_cast<uint8>(PackedIndices >> (Byte * 8));
+			}
+		}
+
+		struct FBitWriter
+		{
+			uint64 Low = 0;
+			uint64 High = 0;
+			int32 Position = 0;
+
+			void Write(const uint32 Value, const int32 Bits)
+			{
+				for (int32 Bit = 0; Bit < Bits; Bit++, Position++)
+				{
+					const uint64 BitValue = (Value >> Bit) & 0x01;
+					if (Position < 64)
+					{
+						Low |= BitValue << Position;
+					}
+					else
+					{
+						High |= BitValue << (Position - 64);
+					}
+				}
+			}
+		};
+
+		// 7 bits per channel + shared p-bit, returns the squared error of the dequantized endpoint
+		float QuantizeBC7Endpoint(const float (&Endpoint)[4], const uint32 PBit, uint32 (&Quantized)[4])
+		{
+			float Error = 0;
+			for (int32 Channel = 0; Channel < 4; Channel++)
+			{
+				Quantized[Channel] = static_cast<uint32>(FMath::Clamp(FMath::RoundToInt((Endpoint[Channel] - PBit) / 2.0f), 0, 127));
+				const float Delta = static_cast<float>((Quantized[Channel] << 1) | PBit) - Endpoint[Channel];
+				Error += Delta * Delta;
+			}
+			return Error;
+		}
+
+		float SelectBC7Indices(const FTexels& Texels, const uint32 (&Quantized0)[4], const uint32 PBit0, const uint32 (&Quantized1)[4], const uint32 PBit1, uint8 (&Indices)[16])
+		{
+			float Palette[16][4];
+			for (int32 Channel = 0; Channel < 4; Channel++)
+			{
+				const int32 Value0 = (Quantized0[Channel] << 1) | PBit0;
+				const int32 Value1 = (Quantized1[Channel] << 1) | PBit1;
+				for (int32 PaletteIndex = 0; PaletteIndex < 16; PaletteIndex++)
+				{
+					Palette[PaletteIndex][Channel] = ((64 - BC7Weights[PaletteIndex]) * Value0 + BC7Weights[PaletteIndex] * Value1 + 32) >> 6;
+				}
+			}
+
+			float Error = 0;
+			for (int32 Index = 0; Index < 16; Index++)
+			{
+				float BestDistance = MAX_flt;
+				for (int32 PaletteIndex = 0; PaletteIndex < 16; PaletteIndex++)
+				{
+					const float PaletteDistance = Distance<4>(Texels[Index], Palette[PaletteIndex]);
+					if (PaletteDistance < BestDistance)
+					{
+						BestDistance = PaletteDistance;
+						Indices[Index] = PaletteIndex;
+					}
+				}
+				Error += BestDistance;
+			}
+
+			return Error;
+		}
+
+		struct FBC7Mode6
+		{
+			uint32 Quantized0[4];
+			uint32 Quantized1[4];
+			uint32 PBit0;
+			uint32 PBit1;
+			uint8 Indices[16];
+			float Error;
+		};
+
+		void QuantizeBC7Mode6(const FTexels& Texels, const float (&Endpoint0)[4], const float (&Endpoint1)[4], const EglTFRuntimeBlockCompressionQuality Quality, FBC7Mode6& Mode6)
+		{
+			Mode6.Error = MAX_flt;
+
+			if (Quality == EglTFRuntimeBlockCompressionQuality::Best)
+			{
+				// exhaustive p-bits search
+				for (uint32 PBit0 = 0; PBit0 < 2; PBit0++)
+				{
+					for (uint32 PBit1 = 0; PBit1 < 2; PBit1++)
+					{
+						FBC7Mode6 Candidate;
+						Candidate.PBit0 = PBit0;
+						Candidate.PBit1 = PBit1;
+						QuantizeBC7Endpoint(Endpoint0, PBit0, Candidate.Quantized0);
+						QuantizeBC7Endpoint(Endpoint1, PBit1, Candidate.Quantized1);
+						Candidate.Error = SelectBC7Indices(Texels, Candidate.Quantized0, PBit0, Candidate.Quantized1, PBit1, Candidate.Indices);
+						if (Candidate.Error < Mode6.Error)
+						{
+							Mode6 = Candidate;
+						}
+					}
+				}
+				return;
+			}
+
+			// best p-bit for each endpoint independently
+			uint32 Quantized[2][4];
+			const float Error0 = QuantizeBC7Endpoint(Endpoint0, 0, Quantized[0]);
+			const float Error1 = QuantizeBC7Endpoint(Endpoint0, 1, Quantized[1]);
+			Mode6.PBit0 = Error1 < Error0 ? 1 : 0;
+			FMemory::Memcpy(Mode6.Quantized0, Quantized[Mode6.PBit0], sizeof(Mode6.Quantized0));
+
+			const float Error2 = QuantizeBC7Endpoint(Endpoint1, 0, Quantized[0]);
+			const float Error3 = QuantizeBC7Endpoint(Endpoint1, 1, Quantized[1]);
+			Mode6.PBit1 = Error3 < Error2 ? 1 : 0;
+			FMemory::Memcpy(Mode6.Quantized1, Quantized[Mode6.PBit1], sizeof(Mode6.Quantized1));
+
+			Mode6.Error = SelectBC7Indices(Texels, Mode6.Quantized0, Mode6.PBit0, Mode6.Quantized1, Mode6.PBit1, Mode6.Indices);
+		}
+
+		template<void(*Encoder)(const uint8*, uint8*, const EglTFRuntimeBlockCompressionQuality)>
+		void EncodeTile(const FglTFRuntimeMipMap& MipMap, TArray64<uint8>& Output, const int32 BlockBytes, const int32 FirstBlockRow, const int32 LastBlockRow, const EglTFRuntimeBlockCompressionQuality Quality)
+		{
+			const int32 BlocksX = FMath::DivideAndRoundUp(MipMap.Width, 4);
+			uint8 Pixels[16 * 4];
+
+			for (int32 BlockY = FirstBlockRow; BlockY < LastBlockRow; BlockY++)
+			{
+				for (int32 BlockX = 0; BlockX < BlocksX; BlockX++)
+				{
+					// clamp to the edges for mips smaller than a block
+					for (int32 Y = 0; Y < 4; Y++)
+					{
+						const int64 PixelY = FMath::Min(BlockY * 4 + Y, MipMap.Height - 1);
+						for (int32 X = 0; X < 4; X++)
+						{
+							const int64 PixelX = FMath::Min(BlockX * 4 + X, MipMap.Width - 1);
+							FMemory::Memcpy(&Pixels[(Y * 4 + X) * 4], &MipMap.Pixels[(PixelY * MipMap.Width + PixelX) * 4], 4);
+						}
+					}
+
+					Encoder(Pixels, Output.GetData() + (static_cast<int64>(BlockY) * BlocksX + BlockX) * BlockBytes, Quality);
+				}
+			}
+		}
+	}
+}
+
+void FglTFRuntimeTextureCompressor::EncodeBC1(const uint8* Pixels, uint8* Block, const EglTFRuntimeBlockCompressionQuality Quality)
+{
+	glTFRuntime::TextureCompressor::FTexels Texels;
+	glTFRuntime::TextureCompressor::LoadTexels(Pixels, Texels);
+	glTFRuntime::TextureCompressor::EncodeColorBlock(Texels, Block, Quality);
+}
+
+void FglTFRuntimeTextureCompressor::EncodeBC3(const uint8* Pixels, uint8* Block, const EglTFRuntimeBlockCompressionQuality Quality)
+{
+	glTFRuntime::TextureCompressor::FTexels Texels;
+	glTFRuntime::TextureCompressor::LoadTexels(Pixels, Texels);
+	glTFRuntime::TextureCompressor::EncodeBC4Block(Texels, 3, Block);
+	glTFRuntime::TextureCompressor::EncodeColorBlock(Texels, Block + 8, Quality);
+}
+
+void FglTFRuntimeTextureCompressor::EncodeBC5(const uint8* Pixels, uint8* Block, const EglTFRuntimeBlockCompressionQuality Quality)
+{
+	glTFRuntime::TextureCompressor::FTexels Texels;
+	glTFRuntime::TextureCompressor::LoadTexels(Pixels, Texels);
+	glTFRuntime::TextureCompressor::EncodeBC4Block(Texels, 0, Block);
+	glTFRuntime::TextureCompressor::EncodeBC4Block(Texels, 1, Block + 8);
+}
+
+void FglTFRuntimeTextureCompressor::EncodeBC7(const uint8* Pixels, uint8* Block, const EglTFRuntimeBlockCompressionQuality Quality)
+{
+	using namespace glTFRuntime::TextureCompressor;
+
+	FTexels Texels;
+	LoadTexels(Pixels, Texels);
+
+	float Endpoint0[4], Endpoint1[4];
+	FitEndpoints<4>(Texels, Endpoint0, Endpoint1, Quality);
+
+	FBC7Mode6 Mode6;
+	QuantizeBC7Mode6(Texels, Endpoint0, Endpoint1, Quality, Mode6);
+
+	if (Quality == EglTFRuntimeBlockCompressionQuality::Best)
+	{
+		float Factors[16];
+		for (int32 Index = 0; Index < 16; Index++)
+		{
+			Factors[Index] = BC7Weights[Mode6.Indices[Index]] / 64.0f;
+		}
+
+		if (RefineEndpoints<4>(Texels, Factors, Endpoint0, Endpoint1))
+		{
+			FBC7Mode6 RefinedMode6;
+			QuantizeBC7Mode6(Texels, Endpoint0, Endpoint1, Quality, RefinedMode6);
+			if (RefinedMode6.Error < Mode6.Error)
+			{
+				Mode6 = RefinedMode6;
+			}
+		}
+	}
+
+	// the most significant bit of the first index is implicitly 0
+	if (Mode6.Indices[0] >= 8)
+	{
+		Swap(Mode6.Quantized0, Mode6.Quantized1);
+		Swap(Mode6.PBit0, Mode6.PBit1);
+		for (int32 Index = 0; Index < 16; Index++)
+		{
+			Mode6.Indices[Index] = 15 - Mode6.Indices[Index];
+		}
+	}
+
+	FBitWriter Writer;
+	Writer.Write(1 << 6, 7);
+	for (int32 Channel = 0; Channel < 4; Channel++)
+	{
+		Writer.Write(Mode6.Quantized0[Channel], 7);
+		Writer.Write(Mode6.Quantized1[Channel], 7);
+	}
+	Writer.Write(Mode6.PBit0, 1);
+	Writer.Write(Mode6.PBit1, 1);
+	for (int32 Index = 0; Index < 16; Index++)
+	{
+		Writer.Write(Mode6.Indices[Index], Index == 0 ? 3 : 4);
+	}
+
+	FMemory::Memcpy(Block, &Writer.Low, 8);
+	FMemory::Memcpy(Block + 8, &Writer.High, 8);
+}
+
+EPixelFormat FglTFRuntimeTextureCompressor::GetPixelFormat(const EglTFRuntimeBlockCompression BlockCompression, const bool bNormalMap, const bool bHasAlpha)
+{
+	if (BlockCompression == EglTFRuntimeBlockCompression::None)
+	{
+		return EPixelFormat::PF_Unknown;
+	}
+
+	EPixelFormat PixelFormat = EPixelFormat::PF_BC7;
+	if (bNormalMap)
+	{
+		PixelFormat = EPixelFormat::PF_BC5;
+	}
+	else if (BlockCompression == EglTFRuntimeBlockCompression::BC1BC3)
+	{
+		PixelFormat = bHasAlpha ? EPixelFormat::PF_DXT5 : EPixelFormat::PF_DXT1;
+	}
+
+	return GPixelFormats[PixelFormat].Supported ? PixelFormat : EPixelFormat::PF_Unknown;
+}
+
+bool FglTFRuntimeTextureCompressor::HasAlpha(const FglTFRuntimeMipMap& MipMap)
+{
+	for (int64 Index = 3; Index < MipMap.Pixels.Num(); Index += 4)
+	{
+		if (MipMap.Pixels[Index] < 255)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+bool FglTFRuntimeTextureCompressor::CompressMips(TArray<FglTFRuntimeMipMap>& Mips, const EPixelFormat PixelFormat, const EglTFRuntimeBlockCompressionQuality Quality)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeTextureCompressor_CompressMips, FColor::Magenta);
+
+	using namespace glTFRuntime::TextureCompressor;
+
+	if (Mips.Num() == 0 || (Mips[0].Width % 4) != 0 || (Mips[0].Height % 4) != 0)
+	{
+		return false;
+	}
+
+	for (const FglTFRuntimeMipMap& MipMap : Mips)
+	{
+		if (MipMap.PixelFormat != EPixelFormat::PF_B8G8R8A8 || MipMap.Width <= 0 || MipMap.Height <= 0 || MipMap.Pixels.Num() < static_cast<int64>(MipMap.Width) * MipMap.Height * 4)
+		{
+			return false;
+		}
+	}
+
+	void(*TileEncoder)(const FglTFRuntimeMipMap&, TArray64<uint8>&, const int32, const int32, const int32, const EglTFRuntimeBlockCompressionQuality) = nullptr;
+	switch (PixelFormat)
+	{
+	case EPixelFormat::PF_DXT1:
+		TileEncoder = EncodeTile<&FglTFRuntimeTextureCompressor::EncodeBC1>;
+		break;
+	case EPixelFormat::PF_DXT5:
+		TileEncoder = EncodeTile<&FglTFRuntimeTextureCompressor::EncodeBC3>;
+		break;
+	case EPixelFormat::PF_BC5:
+		TileEncoder = EncodeTile<&FglTFRuntimeTextureCompressor::EncodeBC5>;
+		break;
+	case EPixelFormat::PF_BC7:
+		TileEncoder = EncodeTile<&FglTFRuntimeTextureCompressor::EncodeBC7>;
+		break;
+	default:
+		return false;
+	}
+
+	const int32 BlockBytes = GPixelFormats[PixelFormat].BlockBytes;
+
+	// (mip, first block row) of every tile of every mip
+	TArray<TPair<int32, int32>> Tiles;
+	TArray<TArray64<uint8>> CompressedMips;
+	CompressedMips.AddDefaulted(Mips.Num());
+	for (int32 MipIndex = 0; MipIndex < Mips.Num(); MipIndex++)
+	{
+		const int32 BlocksX = FMath::DivideAndRoundUp(Mips[MipIndex].Width, 4);
+		const int32 BlocksY = FMath::DivideAndRoundUp(Mips[MipIndex].Height, 4);
+		CompressedMips[MipIndex].AddUninitialized(static_cast<int64>(BlocksX) * BlocksY * BlockBytes);
+		for (int32 BlockRow = 0; BlockRow < BlocksY; BlockRow += TileBlockRows)
+		{
+			Tiles.Add(TPair<int32, int32>(MipIndex, BlockRow));
+		}
+	}
+
+	ParallelFor(Tiles.Num(), [&](const int32 TileIndex)
+		{
+			const int32 MipIndex = Tiles[TileIndex].Key;
+			const int32 FirstBlockRow = Tiles[TileIndex].Value;
+			const int32 BlocksY = FMath::DivideAndRoundUp(Mips[MipIndex].Height, 4);
+			TileEncoder(Mips[MipIndex], CompressedMips[MipIndex], BlockBytes, FirstBlockRow, FMath::Min(FirstBlockRow + TileBlockRows, BlocksY), Quality);
+		});
+
+	for (int32 MipIndex = 0; MipIndex < Mips.Num(); MipIndex++)
+	{
+		Mips[MipIndex].Pixels = MoveTemp(CompressedMips[MipIndex]);
+		Mips[MipIndex].PixelFormat = PixelFormat;
+	}
+
+	return true;
+}
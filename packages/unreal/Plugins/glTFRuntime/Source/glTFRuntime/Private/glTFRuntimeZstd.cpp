@@ -0,0 +1,181 @@
+// Copyright 2020-2025, Roberto De Ioris.
+
+#include "glTFRuntimeZstd.h"
+#include "glTFRuntimeParser.h"
+#include "Async/ParallelFor.h"
+
+// zstd defines its own branch hints
+#pragma push_macro("LIKELY")
+#pragma push_macro("UNLIKELY")
+#undef LIKELY
+#undef UNLIKELY
+
+THIRD_PARTY_INCLUDES_START
+// zstd aliases some of the renamed error checks to its internal ones
+#if defined(_MSC_VER) && !defined(__clang__)
+#pragma warning(push)
+#pragma warning(disable: 4005)
+#elif defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wmacro-redefined"
+#endif
+#include "zstddeclib_glTFRuntime.h"
+#include "zstddeclib.c"
+#if defined(_MSC_VER) && !defined(__clang__)
+#pragma warning(pop)
+#elif defined(__clang__)
+#pragma clang diagnostic pop
+#endif
+THIRD_PARTY_INCLUDES_END
+
+#undef LIKELY
+#undef UNLIKELY
+#pragma pop_macro("LIKELY")
+#pragma pop_macro("UNLIKELY")
+
+namespace glTFRuntime
+{
+	namespace Zstd
+	{
+		// smaller streams are not worth the frames dispatch
+		constexpr int64 MinParallelSize = 1024 * 1024;
+
+		bool DecompressFrames(const uint8* DataPtr, const int64 DataNum, uint8* Output, const int64 OutputNum)
+		{
+			ZSTD_DCtx* Context = ZSTD_createDCtx();
+			if (!Context)
+			{
+				return false;
+			}
+
+			const size_t Result = ZSTD_decompressDCtx(Context, Output, static_cast<size_t>(OutputNum), DataPtr, static_cast<size_t>(DataNum));
+			ZSTD_freeDCtx(Context);
+
+			if (ZSTD_isError(Result))
+			{
+				// error strings are stripped from the decoder
+				UE_LOG(LogGLTFRuntime, Error, TEXT("Unable to decompress Zstandard data (error %d)"), static_cast<int32>(ZSTD_getErrorCode(Result)));
+				return false;
+			}
+
+			return static_cast<int64>(Result) == OutputNum;
+		}
+	}
+}
+
+bool FglTFRuntimeZstd::IsFrame(const uint8* DataPtr, const int64 DataNum)
+{
+	return DataNum > 4 && DataPtr[0] == 0x28 && DataPtr[1] == 0xB5 && DataPtr[2] == 0x2F && DataPtr[3] == 0xFD;
+}
+
+bool FglTFRuntimeZstd::GetFrames(const uint8* DataPtr, const int64 DataNum, TArray<FglTFRuntimeZstdFrame>& Frames)
+{
+	int64 Offset = 0;
+	while (Offset < DataNum)
+	{
+		const size_t FrameSize = ZSTD_findFrameCompressedSize(DataPtr + Offset, static_cast<size_t>(DataNum - Offset));
+		if (ZSTD_isError(FrameSize))
+		{
+			return false;
+		}
+
+		if (!ZSTD_isSkippableFrame(DataPtr + Offset, FrameSize))
+		{
+			FglTFRuntimeZstdFrame Frame;
+			Frame.Offset = Offset;
+			Frame.Size = static_cast<int64>(FrameSize);
+
+			const unsigned long long ContentSize = ZSTD_getFrameContentSize(DataPtr + Offset, FrameSize);
+			if (ContentSize == ZSTD_CONTENTSIZE_ERROR)
+			{
+				return false;
+			}
+			if (ContentSize != ZSTD_CONTENTSIZE_UNKNOWN && ContentSize <= static_cast<unsigned long long>(MAX_int64))
+			{
+				Frame.ContentSize = static_cast<int64>(ContentSize);
+			}
+
+			Frames.Add(Frame);
+		}
+
+		Offset += static_cast<int64>(FrameSize);
+	}
+
+	return true;
+}
+
+int64 FglTFRuntimeZstd::GetContentSize(const uint8* DataPtr, const int64 DataNum)
+{
+	TArray<FglTFRuntimeZstdFrame> Frames;
+	if (!GetFrames(DataPtr, DataNum, Frames))
+	{
+		return INDEX_NONE;
+	}
+
+	int64 ContentSize = 0;
+	for (const FglTFRuntimeZstdFrame& Frame : Frames)
+	{
+		if (Frame.ContentSize < 0 || Frame.ContentSize > MAX_int64 - ContentSize)
+		{
+			return INDEX_NONE;
+		}
+		ContentSize += Frame.ContentSize;
+	}
+
+	return ContentSize;
+}
+
+bool FglTFRuntimeZstd::Decompress(const uint8* DataPtr, const int64 DataNum, uint8* Output, const int64 OutputNum)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeZstd_Decompress, FColor::Magenta);
+
+	// zstd frames are independent (multithreaded zstd encoders emit one per job), so their content can be decoded concurrently
+	if (OutputNum >= glTFRuntime::Zstd::MinParallelSize)
+	{
+		TArray<FglTFRuntimeZstdFrame> Frames;
+		if (GetFrames(DataPtr, DataNum, Frames) && Frames.Num() > 1)
+		{
+			TArray<int64> ContentOffsets;
+			int64 ContentSize = 0;
+			for (const FglTFRuntimeZstdFrame& Frame : Frames)
+			{
+				if (Frame.ContentSize < 0 || Frame.ContentSize > OutputNum - ContentSize)
+				{
+					ContentSize = INDEX_NONE;
+					break;
+				}
+				ContentOffsets.Add(ContentSize);
+				ContentSize += Frame.ContentSize;
+			}
+
+			if (ContentSize == OutputNum)
+			{
+				TArray<bool> Results;
+				Results.AddZeroed(Frames.Num());
+
+				ParallelFor(Frames.Num(), [&](const int32 FrameIndex)
+					{
+						const FglTFRuntimeZstdFrame& Frame = Frames[FrameIndex];
+						Results[FrameIndex] = glTFRuntime::Zstd::DecompressFrames(DataPtr + Frame.Offset, Frame.Size, Output + ContentOffsets[FrameIndex], Frame.ContentSize);
+					});
+
+				return !Results.Contains(false);
+			}
+		}
+	}
+
+	return glTFRuntime::Zstd::DecompressFrames(DataPtr, DataNum, Output, OutputNum);
+}
+
+bool FglTFRuntimeZstd::Decompress(const uint8* DataPtr, const int64 DataNum, TArray64<uint8>& Output)
+{
+	const int64 ContentSize = GetContentSize(DataPtr, DataNum);
+	if (ContentSize < 0)
+	{
+		UE_LOG(LogGLTFRuntime, Error, TEXT("Zstandard data without content size"));
+		return false;
+	}
+
+	Output.SetNumUninitialized(ContentSize);
+	return Decompress(DataPtr, DataNum, Output.GetData(), ContentSize);
+}
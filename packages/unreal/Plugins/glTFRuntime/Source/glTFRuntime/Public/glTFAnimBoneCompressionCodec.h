@@ -6,8 +6,37 @@
 #include "Animation/AnimBoneCompressionCodec.h"
 #include "glTFAnimBoneCompressionCodec.generated.h"
 
+/*
+* A keyframe-reduced channel: only the keys that cannot be linearly predicted (within the tolerance) from their neighbours are retained.
+* Every key is quantized in 48 bits (3 uint16): smallest-three for rotations, 16 bits per component against the channel range otherwise.
+* Channels whose quantization error alone exceeds the tolerance (e.g. translations spanning a very large range) keep their keys as raw floats in FloatValues.
+* A single key means a constant channel.
+*/
+struct FglTFRuntimeCompressedAnimChannel
+{
+	// number of frames of the source channel
+	int32 NumFrames = 0;
+	TArray<uint16> Frames;
+	TArray<uint16> Values;
+	// 4 floats per rotation key, 3 otherwise (Values is empty when used)
+	TArray<float> FloatValues;
+	FVector RangeMin = FVector::ZeroVector;
+	FVector RangeExtent = FVector::ZeroVector;
+
+	bool IsQuantized() const { return FloatValues.Num() == 0; }
+
+	int64 GetAllocatedSize() const { return Frames.GetAllocatedSize() + Values.GetAllocatedSize() + FloatValues.GetAllocatedSize(); }
+};
+
+struct FglTFRuntimeCompressedAnimTrack
+{
+	FglTFRuntimeCompressedAnimChannel Rotations;
+	FglTFRuntimeCompressedAnimChannel Translations;
+	FglTFRuntimeCompressedAnimChannel Scales;
+};
+
 /**
- * 
+ *
  */
 UCLASS()
 class GLTFRUNTIME_API UglTFAnimBoneCompressionCodec : public UAnimBoneCompressionCodec
@@ -17,9 +46,31 @@ class GLTFRUNTIME_API UglTFAnimBoneCompressionCodec : public UAnimBoneCompressio
 public:
 	virtual void DecompressBone(FAnimSequenceDecompressionContext& DecompContext, int32 TrackIndex, FTransform& OutAtom) const;
 	virtual void DecompressPose(FAnimSequenceDecompressionContext& DecompContext, const BoneTrackArray& RotationPairs, const BoneTrackArray& TranslationPairs, const BoneTrackArray& ScalePairs, TArrayView<FTransform>& OutAtoms) const;
-	
+
 	TArray<FRawAnimSequenceTrack> Tracks;
 
+	/*
+	* Replaces the raw Tracks with keyframe-reduced and quantized ones.
+	* Tolerances are the max error of every frame (translation units, degrees and scale factor), quantization included
+	* (channels that would break them just by being quantized keep float keys).
+	* Returns false (leaving the raw Tracks untouched) if a channel has more than 65536 frames.
+	*/
+	bool CompressTracks(const float TranslationTolerance, const float RotationTolerance, const float ScaleTolerance);
+
+	bool IsCompressed() const { return bCompressed; }
+	int64 GetRawSize() const { return RawSize; }
+	int64 GetCompressedSize() const { return CompressedSize; }
+
+	/*
+	* Pose decompression at a relative position: the frames pair (or the frame position of compressed tracks) is computed once for all of the tracks
+	* and raw rotations are blended with a SIMD normalized lerp.
+	*/
+	void DecompressPose(const float RelativePos, const EAnimInterpolationType Interpolation, const BoneTrackArray& RotationPairs, const BoneTrackArray& TranslationPairs, const BoneTrackArray& ScalePairs, TArrayView<FTransform>& OutAtoms) const;
+
+	FQuat GetTrackRotation(const int32 TrackIndex, const float RelativePos, const EAnimInterpolationType Interpolation) const;
+	FVector GetTrackLocation(const int32 TrackIndex, const float RelativePos, const EAnimInterpolationType Interpolation) const;
+	FVector GetTrackScale(const int32 TrackIndex, const float RelativePos, const EAnimInterpolationType Interpolation) const;
+
 protected:
 	float TimeToIndex(
 		float SequenceLength,
@@ -29,7 +80,14 @@ protected:
 		int32& PosIndex0Out,
 		int32& PosIndex1Out) const;
 
+	float GetRelativePosition(FAnimSequenceDecompressionContext& DecompContext) const;
+
 	FQuat GetTrackRotation(FAnimSequenceDecompressionContext& DecompContext, const int32 TrackIndex) const;
 	FVector GetTrackLocation(FAnimSequenceDecompressionContext& DecompContext, const int32 TrackIndex) const;
 	FVector GetTrackScale(FAnimSequenceDecompressionContext& DecompContext, const int32 TrackIndex) const;
+
+	bool bCompressed = false;
+	int64 RawSize = 0;
+	int64 CompressedSize = 0;
+	TArray<FglTFRuntimeCompressedAnimTrack> CompressedTracks;
 };
@@ -0,0 +1,351 @@
+// Copyright 2020-2025, Roberto De Ioris.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/ParallelFor.h"
+#include "Runtime/Launch/Resources/Version.h"
+
+/*
+* Accessor decoding kernels.
+* Every (component type, elements, normalized) combination gets its own fully inlined loop,
+* the parallelism is block based (instead of per-element) to amortize the scheduling cost.
+*/
+namespace glTFRuntime
+{
+	namespace Accessors
+	{
+		// number of elements processed by a single ParallelFor task
+		constexpr int64 BlockSize = 4096;
+
+		template<typename ComponentType, bool bNormalized>
+		struct TComponentDecoder
+		{
+			static FORCEINLINE ComponentType Decode(const uint8* Ptr)
+			{
+				return *((const ComponentType*)Ptr);
+			}
+		};
+
+		template<>
+		struct TComponentDecoder<float, true>
+		{
+			static FORCEINLINE float Decode(const uint8* Ptr)
+			{
+				return *((const float*)Ptr);
+			}
+		};
+
+		template<>
+		struct TComponentDecoder<int8, true>
+		{
+			static FORCEINLINE float Decode(const uint8* Ptr)
+			{
+				return FMath::Max(((float)(*((const int8*)Ptr))) / 127.f, -1.f);
+			}
+		};
+
+		template<>
+		struct TComponentDecoder<uint8, true>
+		{
+			static FORCEINLINE float Decode(const uint8* Ptr)
+			{
+				return ((float)(*Ptr)) / 255.f;
+			}
+		};
+
+		template<>
+		struct TComponentDecoder<int16, true>
+		{
+			static FORCEINLINE float Decode(const uint8* Ptr)
+			{
+				return FMath::Max(((float)(*((const int16*)Ptr))) / 32767.f, -1.f);
+			}
+		};
+
+		template<>
+		struct TComponentDecoder<uint16, true>
+		{
+			static FORCEINLINE float Decode(const uint8* Ptr)
+			{
+				return ((float)(*((const uint16*)Ptr))) / 65535.f;
+			}
+		};
+
+		template<typename Function>
+		FORCEINLINE void ForEachBlock(const int64 Count, Function&& BlockFunction)
+		{
+			const int64 NumBlocks = FMath::DivideAndRoundUp<int64>(Count, BlockSize);
+			ParallelFor(static_cast<int32>(NumBlocks), [&](const int32 BlockIndex)
+				{
+					const int64 Start = BlockIndex * BlockSize;
+					BlockFunction(Start, FMath::Min<int64>(Start + BlockSize, Count));
+				});
+		}
+
+		template<typename T, typename ComponentType, int32 Elements, bool bNormalized, typename Callback>
+		void DecodeVectorsFixed(const uint8* Data, const int64 Stride, const int64 Count, T* Out, Callback& Filter)
+		{
+			ForEachBlock(Count, [&](const int64 Start, const int64 End)
+				{
+					const uint8* Ptr = Data + Start * Stride;
+					for (int64 ElementIndex = Start; ElementIndex < End; ElementIndex++)
+					{
+						T Value;
+						for (int32 i = 0; i < Elements; i++)
+						{
+							Value[i] = TComponentDecoder<ComponentType, bNormalized>::Decode(Ptr + i * sizeof(ComponentType));
+						}
+						Out[ElementIndex] = Filter(Value);
+						Ptr += Stride;
+					}
+				});
+		}
+
+		// generic (non-specialized) number of elements
+		template<typename T, typename ComponentType, bool bNormalized, typename Callback>
+		void DecodeVectorsDynamic(const uint8* Data, const int64 Stride, const int64 Elements, const int64 Count, T* Out, Callback& Filter)
+		{
+			ForEachBlock(Count, [&](const int64 Start, const int64 End)
+				{
+					const uint8* Ptr = Data + Start * Stride;
+					for (int64 ElementIndex = Start; ElementIndex < End; ElementIndex++)
+					{
+						T Value;
+						for (int32 i = 0; i < Elements; i++)
+						{
+							Value[i] = TComponentDecoder<ComponentType, bNormalized>::Decode(Ptr + i * sizeof(ComponentType));
+						}
+						Out[ElementIndex] = Filter(Value);
+						Ptr += Stride;
+					}
+				});
+		}
+
+		// number of elements converted at once by the normalized unsigned kernel (bounds the stack buffers)
+		constexpr int64 NormalizedChunkSize = 256;
+
+		/*
+		* Normalized UNSIGNED_BYTE/UNSIGNED_SHORT vectors: the components of a chunk are gathered (or read in place when packed)
+		* and converted by a plain loop the compiler can vectorize, results are the same of TComponentDecoder.
+		*/
+		template<typename T, typename ComponentType, int32 Elements, typename Callback>
+		void DecodeNormalizedVectorsFixed(const uint8* Data, const int64 Stride, const int64 Count, T* Out, Callback& Filter)
+		{
+			const float MaxValue = static_cast<float>(TNumericLimits<ComponentType>::Max());
+			const bool bPacked = Stride == static_cast<int64>(Elements * sizeof(ComponentType));
+
+			ForEachBlock(Count, [&](const int64 Start, const int64 End)
+				{
+					ComponentType Gathered[NormalizedChunkSize * Elements];
+					float Normalized[NormalizedChunkSize * Elements];
+					for (int64 ChunkStart = Start; ChunkStart < End; ChunkStart += NormalizedChunkSize)
+					{
+						const int64 ChunkEnd = FMath::Min<int64>(ChunkStart + NormalizedChunkSize, End);
+						const int64 NumComponents = (ChunkEnd - ChunkStart) * Elements;
+
+						const ComponentType* Components = reinterpret_cast<const ComponentType*>(Data + ChunkStart * Stride);
+						if (!bPacked)
+						{
+							const uint8* Ptr = Data + ChunkStart * Stride;
+							for (int64 ElementIndex = ChunkStart; ElementIndex < ChunkEnd; ElementIndex++)
+							{
+								FMemory::Memcpy(&Gathered[(ElementIndex - ChunkStart) * Elements], Ptr, Elements * sizeof(ComponentType));
+								Ptr += Stride;
+							}
+							Components = Gathered;
+						}
+
+						for (int64 ComponentIndex = 0; ComponentIndex < NumComponents; ComponentIndex++)
+						{
+							Normalized[ComponentIndex] = static_cast<float>(Components[ComponentIndex]) / MaxValue;
+						}
+
+						for (int64 ElementIndex = ChunkStart; ElementIndex < ChunkEnd; ElementIndex++)
+						{
+							const float* Values = &Normalized[(ElementIndex - ChunkStart) * Elements];
+							T Value;
+							for (int32 i = 0; i < Elements; i++)
+							{
+								Value[i] = Values[i];
+							}
+							Out[ElementIndex] = Filter(Value);
+						}
+					}
+				});
+		}
+
+		template<typename T, typename ComponentType, typename Callback>
+		void DecodeNormalizedVectorsByElements(const uint8* Data, const int64 Stride, const int64 Elements, const int64 Count, T* Out, Callback& Filter)
+		{
+			switch (Elements)
+			{
+			case(2):
+				DecodeNormalizedVectorsFixed<T, ComponentType, 2>(Data, Stride, Count, Out, Filter);
+				break;
+			case(3):
+				DecodeNormalizedVectorsFixed<T, ComponentType, 3>(Data, Stride, Count, Out, Filter);
+				break;
+			case(4):
+				DecodeNormalizedVectorsFixed<T, ComponentType, 4>(Data, Stride, Count, Out, Filter);
+				break;
+			default:
+				DecodeVectorsDynamic<T, ComponentType, true>(Data, Stride, Elements, Count, Out, Filter);
+				break;
+			}
+		}
+
+		template<typename T, typename ComponentType, bool bNormalized, typename Callback>
+		void DecodeVectorsByElements(const uint8* Data, const int64 Stride, const int64 Elements, const int64 Count, T* Out, Callback& Filter)
+		{
+			switch (Elements)
+			{
+			case(2):
+				DecodeVectorsFixed<T, ComponentType, 2, bNormalized>(Data, Stride, Count, Out, Filter);
+				break;
+			case(3):
+				DecodeVectorsFixed<T, ComponentType, 3, bNormalized>(Data, Stride, Count, Out, Filter);
+				break;
+			case(4):
+				DecodeVectorsFixed<T, ComponentType, 4, bNormalized>(Data, Stride, Count, Out, Filter);
+				break;
+			default:
+				DecodeVectorsDynamic<T, ComponentType, bNormalized>(Data, Stride, Elements, Count, Out, Filter);
+				break;
+			}
+		}
+
+		template<typename T, typename ComponentType, typename Callback>
+		FORCEINLINE void DecodeVectorsByNormalized(const uint8* Data, const int64 Stride, const int64 Elements, const bool bNormalized, const int64 Count, T* Out, Callback& Filter)
+		{
+			if (bNormalized)
+			{
+				DecodeVectorsByElements<T, ComponentType, true>(Data, Stride, Elements, Count, Out, Filter);
+			}
+			else
+			{
+				DecodeVectorsByElements<T, ComponentType, false>(Data, Stride, Elements, Count, Out, Filter);
+			}
+		}
+
+		// returns false for unsupported component types
+		template<typename T, typename Callback>
+		bool DecodeVectors(const int64 ComponentType, const uint8* Data, const int64 Stride, const int64 Elements, const bool bNormalized, const int64 Count, T* Out, Callback& Filter)
+		{
+			switch (ComponentType)
+			{
+			case(5126):// FLOAT
+				DecodeVectorsByElements<T, float, true>(Data, Stride, Elements, Count, Out, Filter);
+				return true;
+			case(5120):// BYTE
+				DecodeVectorsByNormalized<T, int8>(Data, Stride, Elements, bNormalized, Count, Out, Filter);
+				return true;
+			case(5121):// UNSIGNED_BYTE
+				if (bNormalized)
+				{
+					DecodeNormalizedVectorsByElements<T, uint8>(Data, Stride, Elements, Count, Out, Filter);
+				}
+				else
+				{
+					DecodeVectorsByElements<T, uint8, false>(Data, Stride, Elements, Count, Out, Filter);
+				}
+				return true;
+			case(5122):// SHORT
+				DecodeVectorsByNormalized<T, int16>(Data, Stride, Elements, bNormalized, Count, Out, Filter);
+				return true;
+			case(5123):// UNSIGNED_SHORT
+				if (bNormalized)
+				{
+					DecodeNormalizedVectorsByElements<T, uint16>(Data, Stride, Elements, Count, Out, Filter);
+				}
+				else
+				{
+					DecodeVectorsByElements<T, uint16, false>(Data, Stride, Elements, Count, Out, Filter);
+				}
+				return true;
+			default:
+				break;
+			}
+			return false;
+		}
+
+		template<typename T, typename ComponentType, bool bNormalized, typename Callback>
+		void DecodeScalarsKernel(const uint8* Data, const int64 Stride, const int64 Count, T* Out, Callback& Filter)
+		{
+			ForEachBlock(Count, [&](const int64 Start, const int64 End)
+				{
+					const uint8* Ptr = Data + Start * Stride;
+					for (int64 ElementIndex = Start; ElementIndex < End; ElementIndex++)
+					{
+						T Value = TComponentDecoder<ComponentType, bNormalized>::Decode(Ptr);
+						Out[ElementIndex] = Filter(Value);
+						Ptr += Stride;
+					}
+				});
+		}
+
+		template<typename T, typename ComponentType, typename Callback>
+		FORCEINLINE void DecodeScalarsByNormalized(const uint8* Data, const int64 Stride, const bool bNormalized, const int64 Count, T* Out, Callback& Filter)
+		{
+			if (bNormalized)
+			{
+				DecodeScalarsKernel<T, ComponentType, true>(Data, Stride, Count, Out, Filter);
+			}
+			else
+			{
+				DecodeScalarsKernel<T, ComponentType, false>(Data, Stride, Count, Out, Filter);
+			}
+		}
+
+		// returns false for unsupported component types
+		template<typename T, typename Callback>
+		bool DecodeScalars(const int64 ComponentType, const uint8* Data, const int64 Stride, const bool bNormalized, const int64 Count, T* Out, Callback& Filter)
+		{
+			switch (ComponentType)
+			{
+			case(5126):// FLOAT
+				DecodeScalarsKernel<T, float, true>(Data, Stride, Count, Out, Filter);
+				return true;
+			case(5120):// BYTE
+				DecodeScalarsByNormalized<T, int8>(Data, Stride, bNormalized, Count, Out, Filter);
+				return true;
+			case(5121):// UNSIGNED_BYTE
+				DecodeScalarsByNormalized<T, uint8>(Data, Stride, bNormalized, Count, Out, Filter);
+				return true;
+			case(5122):// SHORT
+				DecodeScalarsByNormalized<T, int16>(Data, Stride, bNormalized, Count, Out, Filter);
+				return true;
+			case(5123):// UNSIGNED_SHORT
+				DecodeScalarsByNormalized<T, uint16>(Data, Stride, bNormalized, Count, Out, Filter);
+				return true;
+			default:
+				break;
+			}
+			return false;
+		}
+
+		/*
+		* SIMD kernels for FLOAT attributes with the basis (and scale) conversion folded in.
+		* Position: (V * Basis + Basis.Translation) * Scale
+		* Vector: V * Basis
+		* Vector4: V * Basis (W included, as FMatrix::TransformFVector4)
+		*/
+		GLTFRUNTIME_API void DecodeFloat3WithBasis(const uint8* Data, const int64 Stride, const int64 Count, FVector* Out, const FMatrix& Basis, const float Scale, const bool bPosition);
+		GLTFRUNTIME_API void DecodeFloat4WithBasis(const uint8* Data, const int64 Stride, const int64 Count, FVector4* Out, const FMatrix& Basis);
+#if ENGINE_MAJOR_VERSION > 4
+		// single precision output (compact streams)
+		GLTFRUNTIME_API void DecodeFloat3WithBasis(const uint8* Data, const int64 Stride, const int64 Count, FVector3f* Out, const FMatrix& Basis, const float Scale, const bool bPosition);
+		GLTFRUNTIME_API void DecodeFloat4WithBasis(const uint8* Data, const int64 Stride, const int64 Count, FVector4f* Out, const FMatrix& Basis);
+#endif
+
+		/*
+		* Normalized weights as 0-65535 integers (Count * Elements values):
+		* UNSIGNED_SHORT is copied as is, UNSIGNED_BYTE is rescaled exactly (x * 257), FLOAT is clamped and rounded.
+		* Returns false for unsupported component types.
+		*/
+		GLTFRUNTIME_API bool DecodeWeights16(const int64 ComponentType, const uint8* Data, const int64 Stride, const int64 Elements, const int64 Count, uint16* Out);
+
+		// UNSIGNED_BYTE, UNSIGNED_SHORT and UNSIGNED_INT indices, returns false for unsupported component types
+		GLTFRUNTIME_API bool DecodeIndices(const int64 ComponentType, const uint8* Data, const int64 Stride, const int64 Count, uint32* Out);
+	}
+}
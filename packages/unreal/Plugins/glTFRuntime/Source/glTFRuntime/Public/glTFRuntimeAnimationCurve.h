@@ -6,6 +6,46 @@
 #include "Curves/CurveBase.h"
 #include "glTFRuntimeAnimationCurve.generated.h"
 
+/*
+* Structure of arrays copy of a channel (location, rotation or scale) of a node animation curve.
+* Values are already converted to the Unreal basis, a single key is a constant channel.
+*/
+struct GLTFRUNTIME_API FglTFRuntimeBakedAnimationChannel
+{
+	TArray<float> Times;
+	TArray<float> X;
+	TArray<float> Y;
+	TArray<float> Z;
+	TArray<float> W;
+	bool bStep = false;
+
+	void AddKey(const float Time, const float InX, const float InY, const float InZ, const float InW = 0);
+
+	// returns the last key <= Time (0 before the first one), Cursor (the key of the previous evaluation) avoids the search on forward playback
+	int32 FindKey(const float Time, int32& Cursor) const;
+	float GetAlpha(const int32 KeyIndex, const float Time) const;
+	FVector GetVector(const float Time, int32& Cursor) const;
+	FQuat GetQuat(const float Time, int32& Cursor) const;
+};
+
+struct FglTFRuntimeBakedAnimationCursor
+{
+	int32 Location = 0;
+	int32 Rotation = 0;
+	int32 Scale = 0;
+};
+
+struct GLTFRUNTIME_API FglTFRuntimeBakedAnimationCurve
+{
+	FglTFRuntimeBakedAnimationChannel Locations;
+	FglTFRuntimeBakedAnimationChannel Rotations;
+	FglTFRuntimeBakedAnimationChannel Scales;
+	float MinTime = 0;
+	float Duration = 0;
+
+	FTransform Evaluate(const float Time, FglTFRuntimeBakedAnimationCursor& Cursor) const;
+};
+
 /**
  * 
  */
@@ -29,6 +69,9 @@ class GLTFRUNTIME_API UglTFRuntimeAnimationCurve : public UCurveBase
     TArray<TPair<float, FQuat>> ConvertedQuaternions;
     bool bIsStepped;
 
+    FglTFRuntimeBakedAnimationCurve BakedCurve;
+    bool bBaked;
+
     // Begin FCurveOwnerInterface
     virtual TArray<FRichCurveEditInfoConst> GetCurves() const override;
     virtual TArray<FRichCurveEditInfo> GetCurves() override;
@@ -62,4 +105,12 @@ public:
     void AddScaleValue(const float InTime, const FVector InScale, const ERichCurveInterpMode InterpolationMode);
     void SetDefaultValues(const FVector Location, const FQuat Quat, const FRotator Rotator, const FVector Scale);
     void AddConvertedQuaternion(const float InTime, const FQuat InQuat, const bool bStep);
+
+    /*
+    * Bakes the curves (basis conversion included) into flat keyframe arrays, evaluated by UglTFRuntimeNodeAnimationSubsystem.
+    * Adding values invalidates the baked curve.
+    */
+    void Bake();
+    bool IsBaked() const { return bBaked; }
+    const FglTFRuntimeBakedAnimationCurve& GetBakedCurve() const { return BakedCurve; }
 };
@@ -20,9 +20,9 @@ protected:
 	// Called when the game starts or when spawned
 	virtual void BeginPlay() override;
 
-	virtual void ProcessNode(USceneComponent* NodeParentComponent, const FName SocketName, FglTFRuntimeNode& Node);
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
-	TMap<USceneComponent*, float>  CurveBasedAnimationsTimeTracker;
+	virtual void ProcessNode(USceneComponent* NodeParentComponent, const FName SocketName, FglTFRuntimeNode& Node);
 
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "glTFRuntime")
 	TSet<FString> DiscoveredCurveAnimationsNames;
@@ -63,6 +63,7 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Meta = (ExposeOnSpawn = true), Category = "glTFRuntime")
 	FglTFRuntimeLightConfig LightConfig;
 
+	// Registered to UglTFRuntimeNodeAnimationSubsystem in BeginPlay and SetCurveAnimationByName
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
 	TMap<USceneComponent*, UglTFRuntimeAnimationCurve*> CurveBasedAnimations;
 
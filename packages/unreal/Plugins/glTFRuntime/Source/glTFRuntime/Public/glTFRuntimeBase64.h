@@ -0,0 +1,23 @@
+// Copyright 2020-2025, Roberto De Ioris.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/*
+* Base64 (standard alphabet, padding optional) decoder working in place on the string characters.
+* Groups of 16/32 characters are validated and decoded with SSE4.1/AVX2 nibble lookups (when the platform always has them),
+* large payloads are split in chunks decoded in parallel directly into the output.
+*/
+class GLTFRUNTIME_API FglTFRuntimeBase64
+{
+public:
+	// returns the number of decoded bytes, or -1 if NumChars cannot be a valid Base64 string
+	static int64 GetDecodedSize(const TCHAR* Chars, const int64 NumChars);
+
+	// Output must have room for GetDecodedSize() bytes
+	static bool Decode(const TCHAR* Chars, const int64 NumChars, uint8* Output);
+
+	// appends the decoded bytes to Output (left untouched on error)
+	static bool Decode(const TCHAR* Chars, const int64 NumChars, TArray64<uint8>& Output);
+};
@@ -0,0 +1,47 @@
+// Copyright 2020-2025, Roberto De Ioris.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+struct FglTFRuntimeConfig;
+struct FglTFRuntimeSkeletalMeshConfig;
+struct FglTFRuntimeMeshLOD;
+struct FglTFRuntimeBone;
+
+/*
+* On-disk cache of cooked skeletal mesh LODs (see FglTFRuntimeConfig::bCookedMeshCache).
+* Entries are keyed by the hash of the asset content plus the hash of the loader and skeletal mesh config fields that change the cooked data,
+* and store the decoded vertex/index/skin-weight streams, the morph targets, the reference skeleton and the material bindings,
+* so a repeated load of the same asset skips the accessors decoding and the skin resolution.
+* The files are memory mapped when the platform supports it.
+*/
+class GLTFRUNTIME_API FglTFRuntimeCookedMeshCache
+{
+public:
+	// bump it whenever the serialization changes
+	static constexpr uint32 Version = 4;
+
+	// the cache is trimmed (least recently used entries first) to this size after every write, 0 disables the limit
+	static std::atomic<int64> MaxSize;
+
+	static FString GetDirectory();
+
+	static FString HashContent(const uint8* DataPtr, const int64 DataNum, const FglTFRuntimeConfig& LoaderConfig);
+
+	// empty when the config cannot be cached (e.g. a bound bone remapper)
+	static FString GetFilename(const FString& ContentHash, const int32 MeshIndex, const int32 SkinIndex, const FglTFRuntimeSkeletalMeshConfig& SkeletalMeshConfig);
+
+	// BoneMap is stored as the bone map of the primitives without an OverrideBoneMap
+	static bool Save(const FString& Filename, const FglTFRuntimeMeshLOD& LOD, const TArray<FglTFRuntimeBone>& Skeleton, const TMap<int32, FName>& BoneMap);
+
+	// Material pointers are not restored, use the MaterialIndex of the primitives for rebinding them
+	static bool Load(const FString& Filename, FglTFRuntimeMeshLOD& LOD);
+
+	// removes every cached entry
+	static void Purge();
+
+	// removes the least recently used (written or loaded) entries until the cache fits in MaxSize
+	static void Trim();
+};
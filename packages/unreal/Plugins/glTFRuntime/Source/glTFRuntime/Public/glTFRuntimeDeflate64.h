@@ -0,0 +1,17 @@
+// Copyright 2020-2025, Roberto De Ioris.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/*
+* Deflate64 (zip compression method 9) inflater.
+* Same bitstream of Deflate, with a 64K window, distance codes 30/31 and length code 285 (16 extra bits) for matches up to 65538 bytes.
+* The engine zlib does not support it, so it is implemented here; the output buffer is the window (entries are always inflated in one shot).
+*/
+class GLTFRUNTIME_API FglTFRuntimeDeflate64
+{
+public:
+	// fails on malformed data or if the inflated size is not exactly OutputNum
+	static bool Inflate(const uint8* DataPtr, const int64 DataNum, uint8* Output, const int64 OutputNum);
+};
@@ -48,6 +48,14 @@ public:
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "glTF Load Asset from Url with Progress", AutoCreateRefTerm = "LoaderConfig, Headers"), Category = "glTFRuntime")
 	static void glTFLoadAssetFromUrlWithProgress(const FString& Url, const TMap<FString, FString>& Headers, FglTFRuntimeHttpResponse Completed, FglTFRuntimeHttpProgress Progress, const FglTFRuntimeConfig& LoaderConfig);
 
+	/*
+	* GLB files are parsed while downloading: AssetReady is triggered as soon as the JSON chunk is received,
+	* and the Async loaders of the asset wait only for the BIN ranges they need. Sync loaders fail until Completed is triggered.
+	* Non-GLB files trigger AssetReady together with Completed.
+	*/
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "glTF Load Asset from Url with Streaming", AutoCreateRefTerm = "LoaderConfig, Headers"), Category = "glTFRuntime")
+	static void glTFLoadAssetFromUrlWithStreaming(const FString& Url, const TMap<FString, FString>& Headers, FglTFRuntimeHttpResponse AssetReady, FglTFRuntimeHttpResponse Completed, FglTFRuntimeHttpProgress Progress, const FglTFRuntimeConfig& LoaderConfig);
+
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "glTF Load Asset from Data", AutoCreateRefTerm = "LoaderConfig"), Category = "glTFRuntime")
 	static UglTFRuntimeAsset* glTFLoadAssetFromData(const TArray<uint8>& Data, const FglTFRuntimeConfig& LoaderConfig);
 
@@ -101,4 +109,14 @@ public:
 
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Create 1D BlendSpace"), Category = "glTFRuntime")
 	static UBlendSpace1D* CreateRuntimeBlendSpace1D(const FString& ParameterName, const float Min, const float Max, const TArray<FglTFRuntimeBlendSpaceSample>& Samples);
+
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "glTF Get Async Task Pool Stats"), Category = "glTFRuntime")
+	static FglTFRuntimeTaskPoolStats glTFGetAsyncTaskPoolStats();
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "glTF Purge Cooked Mesh Cache"), Category = "glTFRuntime")
+	static void glTFPurgeCookedMeshCache();
+
+	// least recently used entries are evicted when the cooked mesh cache grows over this size (0 disables the limit)
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "glTF Set Cooked Mesh Cache Max Size"), Category = "glTFRuntime")
+	static void glTFSetCookedMeshCacheMaxSize(const int32 MaxSizeMB);
 };
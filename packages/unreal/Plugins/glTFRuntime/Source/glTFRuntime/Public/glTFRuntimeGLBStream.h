@@ -0,0 +1,115 @@
+// Copyright 2020-2025, Roberto De Ioris.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/ThreadSafeBool.h"
+#include "HAL/ThreadSafeCounter64.h"
+#include "HAL/Event.h"
+#include "glTFRuntimeParser.h"
+
+/*
+* Incrementally received GLB blob (single producer, multiple consumers).
+* As soon as the GLB header is received the whole blob is preallocated (and never resized again), so the pointers returned by GetData()
+* are stable and a parser can be created (and start loading) as soon as the JSON chunk is complete.
+* Readers of the BIN chunk must call WaitFor() with the end of the range they are going to access,
+* task pool work should instead be scheduled with WhenReceived() so that no worker sleeps on the network.
+* Non-GLB content is just accumulated and can be retrieved with GetContent() after Finish().
+*/
+class GLTFRUNTIME_API FglTFRuntimeGLBStream
+{
+public:
+	FglTFRuntimeGLBStream(const FglTFRuntimeConfig& InLoaderConfig);
+
+	// producer side
+	void Append(const uint8* DataPtr, const int64 DataNum);
+	void Finish(const bool bSuccess);
+
+	// triggered (once, from the producer thread) when the JSON chunk and the BIN chunk header are available
+	TFunction<void()> OnJsonChunkReceived;
+
+	// consumer side
+	bool IsGLB() const { return TotalSize > 0; }
+	bool IsFinished() const { return bFinished; }
+	bool IsFailed() const { return bFailed; }
+	int64 GetReceivedBytes() const { return ReceivedBytes.GetValue(); }
+	int64 GetTotalSize() const { return TotalSize; }
+
+	/*
+	* Blocks (on an event signalled by the producer) until the first Bytes of the stream are available.
+	* Returns false if the stream ended before, or (to avoid deadlocks with the http ticking)
+	* when called from the game thread on a range not yet received.
+	*/
+	bool WaitFor(const int64 Bytes) const;
+
+	/*
+	* Non blocking version of WaitFor(): Continuation is run (once) as soon as the first Bytes of the stream
+	* are available or the stream ended, immediately (on the calling thread) if that already happened.
+	* Otherwise it runs on the producer thread, so it should just schedule the real work.
+	*/
+	void WhenReceived(const int64 Bytes, TUniqueFunction<void()>&& Continuation) const;
+
+	const uint8* GetData() const { return Data.GetData(); }
+
+	// valid only after Finish()
+	TArray64<uint8>& GetContent() { return Data; }
+
+	bool GetJsonChunk(int64& Offset, int64& Size) const;
+	bool GetBinaryChunk(int64& Offset, int64& Size) const;
+
+	// source identity used for the cooked mesh cache key, ignored once the JSON chunk has been received
+	void SetUrl(const FString& InUrl);
+	void SetETag(const FString& InETag);
+
+	/*
+	* Key for the cooked mesh cache (empty when disabled or when there is no strong ETag).
+	* It is built from what is known as soon as the JSON chunk is received (url, ETag, declared size and JSON chunk),
+	* so it never waits for the BIN chunk.
+	*/
+	FString GetContentHash();
+
+	const FglTFRuntimeConfig& GetLoaderConfig() const { return LoaderConfig; }
+
+protected:
+	TArray64<uint8> Data;
+	FThreadSafeCounter64 ReceivedBytes;
+	int64 TotalSize;
+	FThreadSafeBool bFinished;
+	FThreadSafeBool bFailed;
+	FThreadSafeBool bJsonChunkReceived;
+
+	int64 JsonOffset;
+	int64 JsonSize;
+	int64 BinaryOffset;
+	int64 BinarySize;
+
+	FCriticalSection ContentHashLock;
+	FString ContentHash;
+	bool bContentHashComputed;
+	bool bSourceFrozen;
+	FString Url;
+	FString ETag;
+
+	struct FWaiter
+	{
+		int64 Bytes;
+		FEvent* Event;
+	};
+
+	struct FContinuation
+	{
+		int64 Bytes;
+		TUniqueFunction<void()> Function;
+	};
+
+	mutable FCriticalSection WaitersLock;
+	mutable TArray<FWaiter> Waiters;
+	mutable TArray<FContinuation> Continuations;
+
+	// triggers the waiters (and runs the continuations) whose range has been received (all of them once finished)
+	void WakeWaiters() const;
+
+	FglTFRuntimeConfig LoaderConfig;
+};
+
+typedef TSharedPtr<FglTFRuntimeGLBStream, ESPMode::ThreadSafe> FglTFRuntimeGLBStreamPtr;
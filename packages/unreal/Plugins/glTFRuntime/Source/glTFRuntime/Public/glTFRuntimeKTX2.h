@@ -0,0 +1,52 @@
+// Copyright 2020-2025, Roberto De Ioris.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "glTFRuntimeParser.h"
+
+/*
+* Transcoder for Basis Universal payloads (ETC1S/BasisLZ and UASTC), they require an external library (e.g. a plugin wrapping basisu_transcoder).
+* It receives the whole KTX2 blob (BasisLZ or Zstandard supercompressed) and the preferred block compressed format
+* (PF_B8G8R8A8 when the RHI does not support any), and must fill Mips starting from the base level.
+* When it is not bound, Basis Universal textures fail with an error and the core source fallback (KHR_texture_basisu), if any, is loaded instead.
+*/
+DECLARE_DELEGATE_RetVal_FourParams(bool, FglTFRuntimeKTX2Transcoder, const TArray64<uint8>&, const EPixelFormat, const int32, TArray<FglTFRuntimeMipMap>&);
+
+/*
+* KTX2 container (https://registry.khronos.org/KTX/specs/2.0/ktxspec.v2.html), used by KHR_texture_basisu.
+* BC1/BC3/BC5/BC7 and 8 bit RGBA payloads are loaded natively (with no, Zstandard or zlib supercompression), every level of the container becomes a mip.
+* Only the first layer/face of array and cubemap textures is loaded.
+* A levelCount of 0 stores only the base level, RequiresMipGeneration() tells the caller to build the chain (bGeneratesMipMaps).
+*/
+class GLTFRUNTIME_API FglTFRuntimeKTX2
+{
+public:
+	FglTFRuntimeKTX2() = delete;
+	FglTFRuntimeKTX2(const FglTFRuntimeKTX2&) = delete;
+	FglTFRuntimeKTX2& operator=(const FglTFRuntimeKTX2&) = delete;
+
+	FglTFRuntimeKTX2(const TArray64<uint8>& InData);
+	void LoadMips(const int32 TextureIndex, TArray<FglTFRuntimeMipMap>& Mips, const int32 MaxMip, const FglTFRuntimeImagesConfig& ImagesConfig);
+
+	bool IsBasisUniversal() const;
+	bool HasAlpha() const;
+	bool RequiresMipGeneration() const;
+
+	static bool IsKTX2(const TArray64<uint8>& Data);
+
+	static FglTFRuntimeKTX2Transcoder Transcoder;
+protected:
+	bool ParseHeader();
+
+	const TArray64<uint8>& Data;
+
+	uint32 VkFormat;
+	uint32 Width;
+	uint32 Height;
+	uint32 NumLevels;
+	uint32 SupercompressionScheme;
+	uint8 ColorModel;
+	TArray<uint8> ChannelIds;
+	bool bRequiresMipGeneration;
+};
@@ -0,0 +1,27 @@
+// Copyright 2020-2025, Roberto De Ioris.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/*
+* LZ4 frame decoder (https://github.com/lz4/lz4/blob/dev/doc/lz4_Frame_format.md)
+* Unreal includes the classic LZ4 c library, unfortunately it is exposed in a pretty annoying way, so the decoding is reimplemented here.
+* The output is allocated once (from the content size field when available), independent blocks are decompressed in parallel
+* and the header, block and content checksums are verified when present.
+*/
+class GLTFRUNTIME_API FglTFRuntimeLZ4
+{
+public:
+	static bool IsFrame(const uint8* DataPtr, const int64 DataNum);
+
+	static bool DecompressFrame(const uint8* DataPtr, const int64 DataNum, TArray64<uint8>& Output);
+
+	/*
+	* Decompresses a raw LZ4 block into Dst, matches can reference bytes up to WindowStart (Dst for independent blocks).
+	* Returns the number of decompressed bytes, or -1 on malformed data or if DstCapacity is not enough.
+	*/
+	static int64 DecompressBlock(const uint8* Src, const int64 SrcSize, uint8* Dst, const int64 DstCapacity, const uint8* WindowStart);
+
+	static uint32 XXH32(const uint8* DataPtr, const int64 DataNum, const uint32 Seed = 0);
+};
@@ -0,0 +1,35 @@
+// Copyright 2020-2025, Roberto De Ioris.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/MappedFileHandle.h"
+
+/*
+* Read only memory mapping of a whole file.
+* The pages are faulted in only when accessed, so the resident memory tracks what is actually read
+* instead of the file size.
+*/
+class GLTFRUNTIME_API FglTFRuntimeMappedFile
+{
+public:
+	// returns nullptr if the file cannot be mapped (missing file or platform without memory mapping support)
+	static TSharedPtr<FglTFRuntimeMappedFile, ESPMode::ThreadSafe> Open(const FString& Filename);
+
+	const uint8* GetData() const
+	{
+		return MappedFileRegion->GetMappedPtr();
+	}
+
+	int64 Num() const
+	{
+		return MappedFileRegion->GetMappedSize();
+	}
+
+private:
+	// the region must be released before the handle
+	TUniquePtr<IMappedFileHandle> MappedFileHandle;
+	TUniquePtr<IMappedFileRegion> MappedFileRegion;
+};
+
+typedef TSharedPtr<FglTFRuntimeMappedFile, ESPMode::ThreadSafe> FglTFRuntimeMappedFilePtr;
@@ -0,0 +1,23 @@
+// Copyright 2020-2025, Roberto De Ioris.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "glTFRuntimeParser.h"
+
+/*
+* Builds the mip chain of a B8G8R8A8 image, every level is filtered from the previous one (not from the full resolution source).
+* Even sizes use a 2x2 box filter, odd (non power of two) sizes use the 3 taps polyphase box filter, so any size is supported.
+* sRGB images are filtered in linear space (alpha is always linear).
+* Rows are processed in parallel and every level is written to a preallocated buffer.
+*/
+class GLTFRUNTIME_API FglTFRuntimeMipGenerator
+{
+public:
+	static int32 GetNumMips(const int32 Width, const int32 Height);
+
+	// appends the missing levels (down to 1x1) to Mips, Mips.Last() must be a valid PF_B8G8R8A8 level
+	static bool GenerateMips(TArray<FglTFRuntimeMipMap>& Mips, const bool sRGB);
+
+	static void Downsample(const uint8* Source, const int32 SourceWidth, const int32 SourceHeight, uint8* Destination, const int32 DestinationWidth, const int32 DestinationHeight, const bool sRGB);
+};
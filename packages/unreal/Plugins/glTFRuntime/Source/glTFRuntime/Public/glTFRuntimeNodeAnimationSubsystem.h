@@ -0,0 +1,49 @@
+// Copyright 2020-2024, Roberto De Ioris.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Tickable.h"
+#include "glTFRuntimeAnimationCurve.h"
+#include "glTFRuntimeNodeAnimationSubsystem.generated.h"
+
+/**
+ * Evaluates the node (curve based) animations of every glTFRuntime asset actor of the world in a single (parallel) batch.
+ * Only the components whose transform changed since the previous update are moved.
+ */
+UCLASS()
+class GLTFRUNTIME_API UglTFRuntimeNodeAnimationSubsystem : public UWorldSubsystem, public FTickableGameObject
+{
+	GENERATED_BODY()
+
+public:
+	// Replaces the node animations of Owner, every animation restarts from 0 (null curves are skipped)
+	void RegisterNodeAnimations(AActor* Owner, const TMap<USceneComponent*, UglTFRuntimeAnimationCurve*>& NodeAnimations);
+	void UnregisterNodeAnimations(AActor* Owner);
+
+	int32 GetNumNodeAnimations() const { return Instances.Num(); }
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual ETickableTickType GetTickableTickType() const override;
+	virtual bool IsTickable() const override;
+	virtual UWorld* GetTickableGameObjectWorld() const override;
+
+protected:
+	struct FglTFRuntimeNodeAnimationInstance
+	{
+		TWeakObjectPtr<AActor> Owner;
+		TWeakObjectPtr<USceneComponent> Component;
+		TWeakObjectPtr<UglTFRuntimeAnimationCurve> Curve;
+		const FglTFRuntimeBakedAnimationCurve* BakedCurve = nullptr;
+		FglTFRuntimeBakedAnimationCursor Cursor;
+		float Time = 0;
+		float DeltaTime = 0;
+		FTransform Transform;
+		bool bApplied = false;
+		bool bChanged = false;
+	};
+
+	TArray<FglTFRuntimeNodeAnimationInstance> Instances;
+};
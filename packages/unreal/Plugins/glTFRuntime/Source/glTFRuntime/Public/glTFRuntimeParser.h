@@ -24,7 +24,10 @@
 #include "Camera/CameraComponent.h"
 #include "Components/AudioComponent.h"
 #include "Components/LightComponent.h"
+#include "glTFRuntimeAccessorDecoders.h"
 #include "glTFRuntimeAnimationCurve.h"
+#include "glTFRuntimeMappedFile.h"
+#include "glTFRuntimeTaskPool.h"
 #include "ProceduralMeshComponent.h"
 #if WITH_EDITOR
 #include "Rendering/SkeletalMeshLODImporterData.h"
@@ -175,6 +178,22 @@ struct FglTFRuntimePasswordPromptHook
 DECLARE_DYNAMIC_DELEGATE_RetVal_FourParams(TArray<uint8>, FglTFRuntimeAESDecrypter, const uint8, AESEncryptionStrength, const TArray<uint8>&, EncryptedBytes, const TArray<uint8>&, Password, UObject*, Context);
 DECLARE_DELEGATE_RetVal_FourParams(TArray<uint8>, FglTFRuntimeNativeAESDecrypter, const uint8, const TArray<uint8>&, const TArray<uint8>&, UObject*);
 
+// decompresses an entry into the preallocated UncompressedData, it must be thread safe (it is called by the prefetch workers)
+DECLARE_DELEGATE_RetVal_FiveParams(bool, FglTFRuntimeNativeZipDecompressor, const uint16, const uint8*, const int64, uint8*, const int64);
+
+/*
+* Optional override of the builtin decoders for the zip compression methods not available in the engine: Deflate64 (9) and Zstandard (93).
+*/
+struct FglTFRuntimeZipDecompressorHook
+{
+	FglTFRuntimeNativeZipDecompressor NativeDecompressor;
+
+	bool IsBound() const
+	{
+		return NativeDecompressor.IsBound();
+	}
+};
+
 USTRUCT(BlueprintType)
 struct FglTFRuntimeAESDecrypterHook
 {
@@ -261,6 +280,23 @@ struct FglTFRuntimeConfig
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
 	FglTFRuntimeAESDecrypterHook AESDecrypterHook;
 
+	// native only, replaces the builtin Deflate64/Zstandard decoders when bound
+	FglTFRuntimeZipDecompressorHook ZipDecompressorHook;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	EglTFRuntimeAsyncPriority AsyncPriority;
+
+	// optional, allows discarding the async load if it did not start yet
+	FglTFRuntimeCancellationTokenPtr AsyncCancellationToken;
+
+	// hash the asset content so skeletal meshes can be stored into (and loaded from) the on-disk cooked mesh cache
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bCookedMeshCache;
+
+	// decompress (in parallel) every archive entry referenced by the buffers and the images while loading the asset
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bPrefetchArchiveEntries;
+
 	FglTFRuntimeConfig()
 	{
 		TransformBaseType = EglTFRuntimeTransformBaseType::Default;
@@ -275,6 +311,9 @@ struct FglTFRuntimeConfig
 		bAsBlob = false;
 		PrefixForUnnamedNodes = "node";
 		bNoArchive = false;
+		AsyncPriority = EglTFRuntimeAsyncPriority::Normal;
+		bCookedMeshCache = false;
+		bPrefetchArchiveEntries = false;
 	}
 
 	FMatrix GetMatrix() const
@@ -479,6 +518,37 @@ struct FglTFRuntimeMorphTarget
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
 	TArray<FVector> Normals;
+
+	// sparse morph targets store in Positions and Normals (if not empty) only the deltas of the Indices vertices (none for an empty target)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bSparse = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	TArray<int32> Indices;
+
+	bool IsSparse() const { return bSparse; }
+};
+
+UENUM()
+enum class EglTFRuntimeBlockCompression : uint8
+{
+	// upload the decoded images as uncompressed B8G8R8A8
+	None,
+	// BC1 (opaque) or BC3 (with alpha) for color, BC5 for normal maps
+	BC1BC3,
+	// BC7 for color, BC5 for normal maps
+	BC7
+};
+
+UENUM()
+enum class EglTFRuntimeBlockCompressionQuality : uint8
+{
+	// bounding box endpoints
+	Fast,
+	// principal axis endpoints
+	Balanced,
+	// principal axis endpoints with least squares refinement (and BC7 p-bits search)
+	Best
 };
 
 USTRUCT(BlueprintType)
@@ -522,6 +592,18 @@ struct FglTFRuntimeImagesConfig
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
 	TEnumAsByte<EPixelFormat> ForcePixelFormat;
 
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	EglTFRuntimeAsyncPriority AsyncPriority;
+
+	// encode PNG/JPEG (and any other B8G8R8A8 source) to GPU block compressed formats on the CPU
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	EglTFRuntimeBlockCompression BlockCompression;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	EglTFRuntimeBlockCompressionQuality BlockCompressionQuality;
+
+	FglTFRuntimeCancellationTokenPtr AsyncCancellationToken;
+
 	FglTFRuntimeImagesConfig()
 	{
 		Compression = TextureCompressionSettings::TC_Default;
@@ -536,6 +618,9 @@ struct FglTFRuntimeImagesConfig
 		LODBias = 0;
 		bForceAutoDetect = false;
 		ForcePixelFormat = EPixelFormat::PF_Unknown;
+		AsyncPriority = EglTFRuntimeAsyncPriority::Normal;
+		BlockCompression = EglTFRuntimeBlockCompression::None;
+		BlockCompressionQuality = EglTFRuntimeBlockCompressionQuality::Balanced;
 	}
 };
 
@@ -843,6 +928,14 @@ struct FglTFRuntimeStaticMeshConfig
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
 	bool bReverseTangents;
 
+	// generated tangents (and smooth normals) are angle weighted and tangents get their handedness from the uv mapping (as MikkTSpace)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bMikkTSpaceTangents;
+
+	// generated normals are smooth (averaged over the triangles sharing a vertex) instead of flat (as the glTF specification requires)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bSmoothNormals;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
 	bool bUseHighPrecisionUVs;
 
@@ -883,6 +976,15 @@ struct FglTFRuntimeStaticMeshConfig
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
 	bool bUseHighPrecisionTangentBasis;
 
+	// keep the (cached) primitives in single precision/packed form, halving the CPU memory of the vertex data
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bCompactPrimitives;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	EglTFRuntimeAsyncPriority AsyncPriority;
+
+	FglTFRuntimeCancellationTokenPtr AsyncCancellationToken;
+
 	FglTFRuntimeStaticMeshConfig()
 	{
 		CacheMode = EglTFRuntimeCacheMode::ReadWrite;
@@ -896,12 +998,16 @@ struct FglTFRuntimeStaticMeshConfig
 		NormalsGenerationStrategy = EglTFRuntimeNormalsGenerationStrategy::IfMissing;
 		TangentsGenerationStrategy = EglTFRuntimeTangentsGenerationStrategy::IfMissing;
 		bReverseTangents = false;
+		bMikkTSpaceTangents = false;
+		bSmoothNormals = false;
 		bUseHighPrecisionUVs = false;
 		bGenerateStaticMeshDescription = false;
 		bBuildNavCollision = false;
 		LODScreenSizeMultiplier = 2;
 		bBuildLumenCards = false;
 		bUseHighPrecisionTangentBasis = false;
+		bCompactPrimitives = false;
+		AsyncPriority = EglTFRuntimeAsyncPriority::Normal;
 	}
 };
 
@@ -1088,6 +1194,43 @@ struct FglTFRuntimeCapsule
 	}
 };
 
+/*
+* Fits a capsule along the principal axis (PCA) of a set of positions with two passes:
+* Add() every position (partial fitters can be combined with Merge()) and call ComputeAxis(),
+* then AddExtent() every position again (partial fitters can be combined with MergeExtents()) and call GetCapsule().
+*/
+struct GLTFRUNTIME_API FglTFRuntimeCapsuleFitter
+{
+	int64 Count = 0;
+	FVector Sum = FVector::ZeroVector;
+	// XX, XY, XZ, YY, YZ, ZZ
+	double SumSquared[6] = { 0, 0, 0, 0, 0, 0 };
+
+	FVector Mean = FVector::ZeroVector;
+	// zero until ComputeAxis() succeeds
+	FVector Axis = FVector::ZeroVector;
+
+	// min(T - R) and max(T + R) of every position (T along the axis, R distance from it):
+	// the caps centers at MinBottom + Radius and MaxTop - Radius always contain the position
+	double MinBottom = TNumericLimits<double>::Max();
+	double MaxTop = TNumericLimits<double>::Lowest();
+	double MaxRadius = 0;
+
+	void Add(const FVector& Position);
+	void Merge(const FglTFRuntimeCapsuleFitter& Other);
+
+	// power iteration starting from InitialAxis (the longest bounding box axis is a good guess), false with less than 2 positions
+	bool ComputeAxis(const FVector& InitialAxis);
+
+	void AddExtent(const FVector& Position);
+	void MergeExtents(const FglTFRuntimeCapsuleFitter& Other);
+
+	// FKSphylElem compatible (aligned to Z, Length does not include the caps)
+	FglTFRuntimeCapsule GetCapsule() const;
+
+	static bool Fit(TArrayView<const FVector> Positions, FglTFRuntimeCapsule& Capsule);
+};
+
 USTRUCT(BlueprintType)
 struct FglTFRuntimeSphere
 {
@@ -1210,6 +1353,10 @@ struct FglTFRuntimePhysicsAssetAutoBodyConfig
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
 	float CollisionScale;
 
+	// capsules follow the principal axis of the bone vertices instead of the longest axis of their box
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bFitCapsules;
+
 	FglTFRuntimePhysicsAssetAutoBodyConfig()
 	{
 		CollisionType = EglTFRuntimePhysicsAssetAutoBodyCollisionType::Capsule;
@@ -1220,6 +1367,7 @@ struct FglTFRuntimePhysicsAssetAutoBodyConfig
 		PhysicsType = EPhysicsType::PhysType_Default;
 		bConsiderForBounds = true;
 		CollisionScale = 1.01;
+		bFitCapsules = false;
 	}
 };
 
@@ -1313,6 +1461,10 @@ struct FglTFRuntimeSkeletalMeshConfig
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
 	bool bIgnoreEmptyMorphTargets;
 
+	// position and normal deltas smaller than this are not stored in the morph targets
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	float MorphTargetsDeltaThreshold;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
 	EglTFRuntimeMorphTargetsDuplicateStrategy MorphTargetsDuplicateStrategy;
 
@@ -1337,6 +1489,14 @@ struct FglTFRuntimeSkeletalMeshConfig
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
 	bool bReverseTangents;
 
+	// generated tangents (and smooth normals) are angle weighted and tangents get their handedness from the uv mapping (as MikkTSpace)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bMikkTSpaceTangents;
+
+	// generated normals are smooth (averaged over the triangles sharing a vertex) instead of flat (as the glTF specification requires)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bSmoothNormals;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
 	bool bAutoGeneratePhysicsAssetBodies;
 
@@ -1361,6 +1521,15 @@ struct FglTFRuntimeSkeletalMeshConfig
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
 	FglTFRuntimeMorphTargetRemapperHook MorphTargetRemapper;
 
+	// keep the (cached) primitives in single precision/packed form, halving the CPU memory of the vertex data
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bCompactPrimitives;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	EglTFRuntimeAsyncPriority AsyncPriority;
+
+	FglTFRuntimeCancellationTokenPtr AsyncCancellationToken;
+
 	FglTFRuntimeSkeletalMeshConfig()
 	{
 		CacheMode = EglTFRuntimeCacheMode::ReadWrite;
@@ -1376,6 +1545,7 @@ struct FglTFRuntimeSkeletalMeshConfig
 		bPerPolyCollision = false;
 		bDisableMorphTargets = false;
 		bIgnoreEmptyMorphTargets = true;
+		MorphTargetsDeltaThreshold = 0.0001f;
 		MorphTargetsDuplicateStrategy = EglTFRuntimeMorphTargetsDuplicateStrategy::Ignore;
 		ShiftBounds = FVector::ZeroVector;
 		bUseHighPrecisionUVs = false;
@@ -1384,10 +1554,14 @@ struct FglTFRuntimeSkeletalMeshConfig
 		NormalsGenerationStrategy = EglTFRuntimeNormalsGenerationStrategy::IfMissing;
 		TangentsGenerationStrategy = EglTFRuntimeTangentsGenerationStrategy::IfMissing;
 		bReverseTangents = false;
+		bMikkTSpaceTangents = false;
+		bSmoothNormals = false;
 		bAutoGeneratePhysicsAssetBodies = false;
 		bAutoGeneratePhysicsAssetConstraints = false;
 		bAllowCPUAccess = false;
 		bUseHighPrecisionTangentBasis = false;
+		bCompactPrimitives = false;
+		AsyncPriority = EglTFRuntimeAsyncPriority::Normal;
 	}
 };
 
@@ -1536,6 +1710,20 @@ struct FglTFRuntimeSkeletalAnimationConfig
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
 	FglTFRuntimeSkeletalAnimationFrameMorphTargetWeightRemapperHook FrameMorphTargetWeightRemapper;
 
+	// keyframe reduction and quantization of the bone tracks (only for non-editor builds, the editor keeps the raw tracks in the data model)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bCompressTracks;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	float CompressionTranslationTolerance;
+
+	// in degrees
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	float CompressionRotationTolerance;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	float CompressionScaleTolerance;
+
 	FglTFRuntimeSkeletalAnimationConfig()
 	{
 		RootNodeIndex = INDEX_NONE;
@@ -1553,6 +1741,10 @@ struct FglTFRuntimeSkeletalAnimationConfig
 		RetargetToSkeletalMesh = nullptr;
 		RetargetSkinIndex = INDEX_NONE;
 		PoseForRetargeting = nullptr;
+		bCompressTracks = false;
+		CompressionTranslationTolerance = 0.01f;
+		CompressionRotationTolerance = 0.05f;
+		CompressionScaleTolerance = 0.0001f;
 	}
 };
 
@@ -1606,6 +1798,46 @@ struct FglTFRuntimeUInt16Vector4
 	}
 };
 
+#if ENGINE_MAJOR_VERSION > 4
+typedef FVector3f FglTFRuntimeVector3f;
+typedef FVector2f FglTFRuntimeVector2f;
+typedef FVector4f FglTFRuntimeVector4f;
+#else
+typedef FVector FglTFRuntimeVector3f;
+typedef FVector2D FglTFRuntimeVector2f;
+typedef FVector4 FglTFRuntimeVector4f;
+#endif
+
+// signed normalized 8 bit tangent (W is the bitangent sign)
+struct FglTFRuntimePackedTangent
+{
+	int8 X;
+	int8 Y;
+	int8 Z;
+	int8 W;
+
+	FglTFRuntimePackedTangent()
+	{
+		X = 0;
+		Y = 0;
+		Z = 0;
+		W = 127;
+	}
+
+	FglTFRuntimePackedTangent(const FVector4& Tangent)
+	{
+		X = static_cast<int8>(FMath::Clamp(FMath::RoundToInt(Tangent.X * 127.0), -127, 127));
+		Y = static_cast<int8>(FMath::Clamp(FMath::RoundToInt(Tangent.Y * 127.0), -127, 127));
+		Z = static_cast<int8>(FMath::Clamp(FMath::RoundToInt(Tangent.Z * 127.0), -127, 127));
+		W = Tangent.W < 0 ? -127 : 127;
+	}
+
+	FglTFRuntimeVector4f Unpack() const
+	{
+		return FglTFRuntimeVector4f(X / 127.f, Y / 127.f, Z / 127.f, W / 127.f);
+	}
+};
+
 struct FglTFRuntimePrimitive
 {
 	TArray<FVector> Positions;
@@ -1621,8 +1853,12 @@ struct FglTFRuntimePrimitive
 	TMap<int32, FName> OverrideBoneMap;
 	TMap<int32, int32> BonesCache;
 	FString MaterialName;
+	int32 MaterialIndex;
 	int64 AdditionalBufferView;
 	int32 Mode;
+	// index in the primitives array of the glTF mesh and mode before points/lines triangulation (used for rebinding cooked primitives)
+	int32 PrimitiveIndex;
+	int32 SourceMode;
 	bool bHasMaterial;
 	bool bHighPrecisionUVs;
 	bool bHighPrecisionWeights;
@@ -1632,16 +1868,66 @@ struct FglTFRuntimePrimitive
 
 	TMap<FString, TArray<float>> WeightMaps;
 
+	/*
+	* Compact vertex streams (filled by LoadPrimitive() in compact mode or by glTFRuntime::CompactPrimitive()).
+	* When bCompact is true Positions, Normals, Tangents, UVs, Weights and Colors are empty
+	* and the data lives in single precision/packed arrays (the same precision used by the GPU buffers).
+	* Tangents stay in the wide array (and CompactTangents is empty) when compacted for a high precision tangent basis.
+	*/
+	bool bCompact;
+	TArray<FglTFRuntimeVector3f> CompactPositions;
+	TArray<FglTFRuntimeVector3f> CompactNormals;
+	TArray<FglTFRuntimePackedTangent> CompactTangents;
+	TArray<TArray<FglTFRuntimeVector2f>> CompactUVs;
+	// normalized (0-65535) weights
+	TArray<TArray<FglTFRuntimeUInt16Vector4>> CompactWeights;
+	TArray<FLinearColor> CompactColors;
+
 	FglTFRuntimePrimitive()
 	{
 		AdditionalBufferView = INDEX_NONE;
+		MaterialIndex = INDEX_NONE;
 		bHasMaterial = false;
 		bHighPrecisionUVs = false;
 		bHighPrecisionWeights = false;
 		Material = nullptr;
 		Mode = 4;
+		PrimitiveIndex = INDEX_NONE;
+		SourceMode = 4;
 		bDisableShadows = false;
 		bHasIndices = false;
+		bCompact = false;
+	}
+
+	// layout agnostic accessors
+
+	int32 GetNumVertices() const { return bCompact ? CompactPositions.Num() : Positions.Num(); }
+	int32 GetNumNormals() const { return bCompact ? CompactNormals.Num() : Normals.Num(); }
+	int32 GetNumTangents() const { return CompactTangents.Num() > 0 ? CompactTangents.Num() : Tangents.Num(); }
+	int32 GetNumUVs(const int32 Channel) const
+	{
+		if (bCompact)
+		{
+			return CompactUVs.IsValidIndex(Channel) ? CompactUVs[Channel].Num() : 0;
+		}
+		return UVs.IsValidIndex(Channel) ? UVs[Channel].Num() : 0;
+	}
+	int32 GetNumUVChannels() const { return bCompact ? CompactUVs.Num() : UVs.Num(); }
+	int32 GetNumColors() const { return bCompact ? CompactColors.Num() : Colors.Num(); }
+
+	FglTFRuntimeVector3f GetPosition(const int32 Index) const { return bCompact ? CompactPositions[Index] : FglTFRuntimeVector3f(Positions[Index]); }
+	FglTFRuntimeVector3f GetNormal(const int32 Index) const { return bCompact ? CompactNormals[Index] : FglTFRuntimeVector3f(Normals[Index]); }
+	FglTFRuntimeVector4f GetTangent(const int32 Index) const { return CompactTangents.Num() > 0 ? CompactTangents[Index].Unpack() : FglTFRuntimeVector4f(Tangents[Index]); }
+	FglTFRuntimeVector2f GetUV(const int32 Channel, const int32 Index) const { return bCompact ? CompactUVs[Channel][Index] : FglTFRuntimeVector2f(UVs[Channel][Index]); }
+	FLinearColor GetColor(const int32 Index) const { return bCompact ? CompactColors[Index] : FLinearColor(Colors[Index]); }
+	float GetWeight(const int32 JointsIndex, const int32 Index, const int32 Influence) const
+	{
+		return bCompact ? CompactWeights[JointsIndex][Index][Influence] / 65535.f : static_cast<float>(Weights[JointsIndex][Index][Influence]);
+	}
+	// normalized (0-65535) weight, compact weights are returned as is (no float round trip)
+	uint16 GetQuantizedWeight(const int32 JointsIndex, const int32 Index, const int32 Influence) const
+	{
+		return bCompact ? CompactWeights[JointsIndex][Index][Influence] : static_cast<uint16>(FMath::Clamp(FMath::RoundToInt(Weights[JointsIndex][Index][Influence] * 65535.0), 0, 65535));
 	}
 };
 
@@ -1661,9 +1947,23 @@ struct FglTFRuntimeSkeletalMeshContext : public FGCObject
 
 	int32 SkinIndex;
 
+	// set by the batched loaders, the mesh merges its bones into it instead of getting a new USkeleton
+#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 4
+	TObjectPtr<USkeleton> SharedSkeleton;
+#else
+	USkeleton* SharedSkeleton;
+#endif
+
 	FBox BoundingBox;
 
+	// non empty when the parser has a content hash, the LOD is loaded from/saved to this file
+	FString CookedMeshCacheFilename;
+	bool bFromCookedMeshCache;
+
 	TMap<int32, FBox> PerBoneBoundingBoxCache;
+	TMap<int32, FglTFRuntimeCapsule> PerBoneCapsuleCache;
+	// bones can have no capsule, so the cache can be empty after fitting
+	bool bCapsulesCached;
 
 	// here we cache per-context LODs
 	TArray<FglTFRuntimeMeshLOD> CachedRuntimeMeshLODs;
@@ -1711,6 +2011,9 @@ struct FglTFRuntimeSkeletalMeshContext : public FGCObject
 		SkeletalMesh->NeverStream = true;
 		BoundingBox = FBox(EForceInit::ForceInitToZero);
 		SkinIndex = -1;
+		SharedSkeleton = nullptr;
+		bFromCookedMeshCache = false;
+		bCapsulesCached = false;
 	}
 
 	FString GetReferencerName() const override
@@ -1721,6 +2024,7 @@ struct FglTFRuntimeSkeletalMeshContext : public FGCObject
 	void AddReferencedObjects(FReferenceCollector& Collector) override
 	{
 		Collector.AddReferencedObject(SkeletalMesh);
+		Collector.AddReferencedObject(SharedSkeleton);
 	}
 
 	const FReferenceSkeleton& GetRefSkeleton() const
@@ -1836,6 +2140,13 @@ struct FglTFRuntimeSkeletalMeshContext : public FGCObject
 	}
 
 	const FBox& GetBoneBox(const int32 BoneIndex);
+	bool GetBoneCapsule(const int32 BoneIndex, FglTFRuntimeCapsule& Capsule);
+
+	/*
+	* Computes the bone space boxes of all the bones (every LOD0 vertex is assigned to its most influencing bone) with a single parallel pass,
+	* and optionally the capsules fitted along the principal axis (PCA) of the vertices of each bone (with a second pass).
+	*/
+	void CacheBonesBounds(const bool bFitCapsules);
 };
 
 USTRUCT(BlueprintType)
@@ -1852,12 +2163,16 @@ struct FglTFRuntimeMeshLOD
 	bool bHasUV;
 	bool bHasVertexColors;
 
+	// bytes saved by the compact streams, compared to the wide layout (set by glTFRuntime::CompactMeshLOD())
+	int64 CompactBytesSaved;
+
 	FglTFRuntimeMeshLOD()
 	{
 		bHasNormals = false;
 		bHasTangents = false;
 		bHasUV = false;
 		bHasVertexColors = false;
+		CompactBytesSaved = 0;
 	}
 
 	void Empty()
@@ -2231,6 +2546,9 @@ public:
 
 	virtual bool GetFileContent(const FString& Filename, TArray64<uint8>& OutData) = 0;
 
+	// decodes the files in advance, the results are consumed by GetFileContent(); returns the number of prefetched files
+	virtual int32 PrefetchFiles(const TArray<FString>& Filenames) { return 0; }
+
 	bool FileExists(const FString& Filename) const;
 
 	FString GetFirstFilenameByExtension(const FString& Extension) const;
@@ -2248,18 +2566,42 @@ protected:
 class GLTFRUNTIME_API FglTFRuntimeArchiveZip : public FglTFRuntimeArchive
 {
 public:
+	// the archive bytes are copied
 	bool FromData(const uint8* DataPtr, const int64 DataNum);
+	// zero-copy: the archive takes ownership of the buffer (or keeps the mapping alive) and reads the entries in place
+	bool FromData(TArray64<uint8>&& InData);
+	bool FromMappedFile(FglTFRuntimeMappedFilePtr InMappedFile);
 
+	// safe to call from multiple threads for non encrypted entries
 	bool GetFileContent(const FString& Filename, TArray64<uint8>& OutData) override;
 
+	// decompresses the entries in parallel, encrypted entries (they may need the password prompt) are skipped
+	int32 PrefetchFiles(const TArray<FString>& Filenames) override;
+
 	void SetPassword(const FString& EncryptionKey);
 
+	const uint8* GetData() const { return ArchiveData; }
+	int64 Num() const { return ArchiveDataNum; }
+
 	FglTFRuntimePasswordPromptHook PromptHook;
 	FglTFRuntimeAESDecrypterHook AESDecrypterHook;
+	FglTFRuntimeZipDecompressorHook DecompressorHook;
 
 protected:
-	FArrayReader Data;
+	bool ParseCentralDirectory();
+
+	// Deflate64 and Zstandard (multi frame zstd entries are decoded in parallel) unless overridden by DecompressorHook
+	bool DecompressEntry(const uint16 Compression, const uint8* CompressedData, const int64 CompressedSize, uint8* UncompressedData, const int64 UncompressedSize) const;
+
+	TArray64<uint8> OwnedData;
+	FglTFRuntimeMappedFilePtr MappedFile;
+	const uint8* ArchiveData = nullptr;
+	int64 ArchiveDataNum = 0;
+
 	TArray<uint8> Password;
+
+	TMap<FString, TArray64<uint8>> PrefetchedFiles;
+	FCriticalSection PrefetchedFilesLock;
 };
 
 class FglTFRuntimeArchiveMap : public FglTFRuntimeArchive
@@ -2303,6 +2645,14 @@ struct FglTFRuntimeAnimationCurve
 	bool bStep;
 };
 
+// the two keys (and the interpolation alpha between them) of a resampled frame
+struct FglTFRuntimeAnimationFrameSample
+{
+	int32 FirstIndex;
+	int32 SecondIndex;
+	float Alpha;
+};
+
 USTRUCT(BlueprintType)
 struct FglTFRuntimeAudioConfig
 {
@@ -2344,6 +2694,7 @@ struct FglTFRuntimePluginCacheData
 
 DECLARE_DYNAMIC_DELEGATE_OneParam(FglTFRuntimeStaticMeshAsync, UStaticMesh*, StaticMesh);
 DECLARE_DYNAMIC_DELEGATE_OneParam(FglTFRuntimeSkeletalMeshAsync, USkeletalMesh*, SkeletalMesh);
+DECLARE_DYNAMIC_DELEGATE_OneParam(FglTFRuntimeSkeletalMeshesAsync, const TArray<USkeletalMesh*>&, SkeletalMeshes);
 DECLARE_DYNAMIC_DELEGATE_TwoParams(FglTFRuntimeMeshLODAsync, const bool, bValid, const FglTFRuntimeMeshLOD&, MeshLOD);
 DECLARE_DYNAMIC_DELEGATE_OneParam(FglTFRuntimeTextureCubeAsync, UTextureCube*, TextureCube);
 DECLARE_DYNAMIC_DELEGATE_OneParam(FglTFRuntimeTexture2DAsync, UTexture2D*, Texture);
@@ -2388,8 +2739,28 @@ namespace glTFRuntime
 	GLTFRUNTIME_API bool FillSkeletalMeshRenderData(FSkeletalMeshRenderData* RenderData, const TArray<FglTFRuntimeMeshLOD*>& LODs, const FReferenceSkeleton& RefSkeleton, const int32 SkinIndex, const TMap<int32, FName>& MainBoneMap, FBox& BoundingBox, const FglTFRuntimeSkeletalMeshConfig& SkeletalMeshConfig, TFunction<void(const FString& ErrorContext, const FString& ErrorMessage)> ErrorCallback);
 	GLTFRUNTIME_API FVector ComputeTangentY(const FVector Normal, const FVector TangetX);
 	GLTFRUNTIME_API FVector ComputeTangentYWithW(const FVector Normal, const FVector TangetX, const float W);
+	// move the vertex data into the compact streams (returns the bytes saved compared to the wide layout), tangents are not packed when bHighPrecisionTangents is true
+	GLTFRUNTIME_API int64 CompactPrimitive(FglTFRuntimePrimitive& Primitive, const bool bHighPrecisionTangents = false);
+	// restore the double precision arrays (tangents and weights come back quantized)
+	GLTFRUNTIME_API void ExpandPrimitive(FglTFRuntimePrimitive& Primitive);
+	GLTFRUNTIME_API int64 CompactMeshLOD(FglTFRuntimeMeshLOD& LOD, const bool bHighPrecisionTangents = false);
+	GLTFRUNTIME_API void ExpandMeshLOD(FglTFRuntimeMeshLOD& LOD);
 }
 
+class FglTFRuntimeGLBStream;
+
+// texture index, sRGB, normal map compression
+typedef TTuple<int32, bool, bool> FglTFRuntimePrefetchedTextureKey;
+
+struct FglTFRuntimePrefetchedTexture
+{
+	// resolved (and broadcast to OnTextureImageIndex) only by the prefetch, INDEX_NONE if the texture has no image
+	int64 ImageIndex = INDEX_NONE;
+	int64 FallbackImageIndex = INDEX_NONE;
+	// empty if not decoded by the prefetch (LoadTexture() decodes it with fallbacks and errors reporting)
+	TArray<FglTFRuntimeMipMap> Mips;
+};
+
 /**
  *
  */
@@ -2400,16 +2771,26 @@ public:
 
 	static TSharedPtr<FglTFRuntimeParser> FromFilename(const FString& Filename, const FglTFRuntimeConfig& LoaderConfig);
 	static TSharedPtr<FglTFRuntimeParser> FromBinary(const uint8* DataPtr, int64 DataNum, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeArchive> InArchive = nullptr);
+	// takes ownership of the GLB blob, the BIN chunk is referenced in place instead of being copied
+	static TSharedPtr<FglTFRuntimeParser> FromBinary(TArray64<uint8>&& Data, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeArchive> InArchive = nullptr);
+	// the BIN chunk is referenced straight from the mapped pages
+	static TSharedPtr<FglTFRuntimeParser> FromBinary(FglTFRuntimeMappedFilePtr MappedFile, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeArchive> InArchive = nullptr);
+	// requires the JSON chunk of the stream, accessors wait for their BIN ranges to be received
+	static TSharedPtr<FglTFRuntimeParser> FromStream(TSharedRef<FglTFRuntimeGLBStream, ESPMode::ThreadSafe> Stream, const FglTFRuntimeConfig& LoaderConfig);
 	static TSharedPtr<FglTFRuntimeParser> FromString(const FString& JsonData, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeArchive> InArchive = nullptr);
+	// parses the json directly from its UTF-8 representation (no intermediate FString)
+	static TSharedPtr<FglTFRuntimeParser> FromUTF8(const uint8* DataPtr, int64 DataNum, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeArchive> InArchive = nullptr);
 	static TSharedPtr<FglTFRuntimeParser> FromData(const uint8* DataPtr, int64 DataNum, const FglTFRuntimeConfig& LoaderConfig);
+	// like FromData() but allows the parser (or the zip archive) to take ownership of plain (uncompressed) GLB and zip blobs
+	static TSharedPtr<FglTFRuntimeParser> FromData(TArray64<uint8>&& Data, const FglTFRuntimeConfig& LoaderConfig);
 	static TSharedPtr<FglTFRuntimeParser> FromMap(const TMap<FString, TArray64<uint8>> Map, const FglTFRuntimeConfig& LoaderConfig);
 
 	static TSharedPtr<FglTFRuntimeParser> FromRawDataAndArchive(const uint8* DataPtr, int64 DataNum, TSharedPtr<FglTFRuntimeArchive> InArchive, const FglTFRuntimeConfig& LoaderConfig);
 
-	static FORCEINLINE TSharedPtr<FglTFRuntimeParser> FromBinary(const TArray<uint8> Data, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeArchive> InArchive = nullptr) { return FromBinary(Data.GetData(), Data.Num(), LoaderConfig, InArchive); }
-	static FORCEINLINE TSharedPtr<FglTFRuntimeParser> FromBinary(const TArray64<uint8> Data, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeArchive> InArchive = nullptr) { return FromBinary(Data.GetData(), Data.Num(), LoaderConfig, InArchive); }
-	static FORCEINLINE TSharedPtr<FglTFRuntimeParser> FromData(const TArray<uint8> Data, const FglTFRuntimeConfig& LoaderConfig) { return FromData(Data.GetData(), Data.Num(), LoaderConfig); }
-	static FORCEINLINE TSharedPtr<FglTFRuntimeParser> FromData(const TArray64<uint8> Data, const FglTFRuntimeConfig& LoaderConfig) { return FromData(Data.GetData(), Data.Num(), LoaderConfig); }
+	static FORCEINLINE TSharedPtr<FglTFRuntimeParser> FromBinary(const TArray<uint8>& Data, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeArchive> InArchive = nullptr) { return FromBinary(Data.GetData(), Data.Num(), LoaderConfig, InArchive); }
+	static FORCEINLINE TSharedPtr<FglTFRuntimeParser> FromBinary(const TArray64<uint8>& Data, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeArchive> InArchive = nullptr) { return FromBinary(Data.GetData(), Data.Num(), LoaderConfig, InArchive); }
+	static FORCEINLINE TSharedPtr<FglTFRuntimeParser> FromData(const TArray<uint8>& Data, const FglTFRuntimeConfig& LoaderConfig) { return FromData(Data.GetData(), Data.Num(), LoaderConfig); }
+	static FORCEINLINE TSharedPtr<FglTFRuntimeParser> FromData(const TArray64<uint8>& Data, const FglTFRuntimeConfig& LoaderConfig) { return FromData(Data.GetData(), Data.Num(), LoaderConfig); }
 
 	bool LoadMeshAsRuntimeLOD(const int32 MeshIndex, FglTFRuntimeMeshLOD& RuntimeLOD, const FglTFRuntimeMaterialsConfig& MaterialsConfig);
 	bool LoadSkinnedMeshRecursiveAsRuntimeLOD(const FString& NodeName, int32& SkinIndex, const TArray<FString>& ExcludeNodes, FglTFRuntimeMeshLOD& RuntimeLOD, const FglTFRuntimeMaterialsConfig& MaterialsConfig, const FglTFRuntimeSkeletonConfig& SkeletonConfig, const EglTFRuntimeRecursiveMode TransformApplyRecursiveMode);
@@ -2432,6 +2813,13 @@ public:
 	UMaterialInterface* LoadMaterial(const int32 MaterialIndex, const FglTFRuntimeMaterialsConfig& MaterialsConfig, const bool bUseVertexColors, FString& MaterialName, UMaterialInterface* ForceBaseMaterial);
 	UTexture2D* LoadTexture(const int32 TextureIndex, TArray<FglTFRuntimeMipMap>& Mips, const bool sRGB, const FglTFRuntimeMaterialsConfig& MaterialsConfig, FglTFRuntimeTextureSampler& Sampler);
 
+	/*
+	* Decodes in parallel every texture referenced by the materials of the given meshes, LoadTexture() consumes the results.
+	* Returns the keys of the newly prefetched textures, they should be passed to DiscardPrefetchedTextures() once the meshes are loaded.
+	*/
+	TArray<FglTFRuntimePrefetchedTextureKey> PrefetchMeshesTextures(const TArray<TSharedRef<FJsonObject>>& JsonMeshObjects, const FglTFRuntimeMaterialsConfig& MaterialsConfig);
+	void DiscardPrefetchedTextures(const TArray<FglTFRuntimePrefetchedTextureKey>& Keys);
+
 	bool LoadNodes();
 	bool LoadNode(const int32 NodeIndex, FglTFRuntimeNode& Node);
 	bool LoadNodeByName(const FString& NodeName, FglTFRuntimeNode& Node);
@@ -2475,6 +2863,8 @@ public:
 	FglTFRuntimePoseTracksMap FixupAnimationTracks(const FglTFRuntimePoseTracksMap& Tracks, const TMap<FString, FTransform>& RestTransforms, const FglTFRuntimeSkeletalAnimationConfig& SkeletalAnimationConfig);
 
 	void LoadSkeletalMeshAsync(const int32 MeshIndex, const int32 SkinIndex, const FglTFRuntimeSkeletalMeshAsync& AsyncCallback, const FglTFRuntimeSkeletalMeshConfig& SkeletalMeshConfig);
+	bool GetSkinnedMeshNodes(TArray<FglTFRuntimeNode>& SkinnedMeshNodes);
+	void LoadSkinnedMeshNodesAsync(const TArray<FglTFRuntimeNode>& SkinnedMeshNodes, const FglTFRuntimeSkeletalMeshesAsync& AsyncCallback, const FglTFRuntimeSkeletalMeshConfig& SkeletalMeshConfig);
 	void LoadStaticMeshAsync(const int32 MeshIndex, const FglTFRuntimeStaticMeshAsync& AsyncCallback, const FglTFRuntimeStaticMeshConfig& StaticMeshConfig);
 
 	void LoadStaticMeshLODsAsync(const TArray<int32>& MeshIndices, const FglTFRuntimeStaticMeshAsync& AsyncCallback, const FglTFRuntimeStaticMeshConfig& StaticMeshConfig);
@@ -2492,6 +2882,8 @@ public:
 	bool GetBuffer(const int32 BufferIndex, FglTFRuntimeBlob& Blob);
 	bool GetBufferView(const int32 BufferViewIndex, FglTFRuntimeBlob& Blob, int64& Stride);
 	bool GetAccessor(const int32 AccessorIndex, int64& ComponentType, int64& Stride, int64& Elements, int64& ElementSize, int64& Count, bool& bNormalized, FglTFRuntimeBlob& Blob, const FglTFRuntimeBlob* AdditionalBufferView);
+	// reads the indices and the values buffer view of an accessor sparse section (SparseIndices is empty if the section is incomplete)
+	bool LoadSparseAccessor(TSharedRef<FJsonObject> JsonSparseObject, const int64 ValueSize, const int64 MaxCount, TArray<uint32>& SparseIndices, FglTFRuntimeBlob& SparseValues, int64& SparseValuesStride);
 
 	bool GetAllNodes(TArray<FglTFRuntimeNode>& Nodes);
 
@@ -2513,8 +2905,14 @@ public:
 
 	void AddReferencedObjects(FReferenceCollector& Collector);
 
-	bool LoadPrimitives(TSharedRef<FJsonObject> JsonMeshObject, TArray<FglTFRuntimePrimitive>& Primitives, const FglTFRuntimeMaterialsConfig& MaterialsConfig, const bool bTriangulatePointsAndLines);
-	bool LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObject, FglTFRuntimePrimitive& Primitive, const FglTFRuntimeMaterialsConfig& MaterialsConfig, const bool bTriangulatePointsAndLines);
+	// with bCompact the vertex streams are decoded straight into the compact arrays (see FglTFRuntimePrimitive::bCompact)
+	bool LoadPrimitives(TSharedRef<FJsonObject> JsonMeshObject, TArray<FglTFRuntimePrimitive>& Primitives, const FglTFRuntimeMaterialsConfig& MaterialsConfig, const bool bTriangulatePointsAndLines, const bool bCompact = false, const bool bHighPrecisionTangents = false);
+	bool LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObject, FglTFRuntimePrimitive& Primitive, const FglTFRuntimeMaterialsConfig& MaterialsConfig, const bool bTriangulatePointsAndLines, const bool bCompact = false, const bool bHighPrecisionTangents = false);
+	// material selection (and OnLoadedPrimitive broadcast) shared by LoadPrimitive() and the cooked mesh cache
+	bool LoadPrimitiveMaterial(TSharedRef<FJsonObject> JsonPrimitiveObject, FglTFRuntimePrimitive& Primitive, const FglTFRuntimeMaterialsConfig& MaterialsConfig, UMaterialInterface* ForceBaseMaterial);
+	int64 GetPrimitiveMaterialIndex(TSharedRef<FJsonObject> JsonPrimitiveObject, const FglTFRuntimeMaterialsConfig& MaterialsConfig);
+	// bSparse is false (and nothing is loaded) when the accessor is not defined only by its sparse section
+	bool LoadSparseMorphTargetAttribute(TSharedRef<FJsonObject> JsonTargetObject, const FString& Name, const TArray<int64>& SupportedTypes, const bool bPosition, TArray<uint32>& Indices, TArray<FVector>& Values, bool& bSparse);
 	UMaterialInterface* TriangulatePoints(FglTFRuntimePrimitive& Primitive, const FglTFRuntimeMaterialsConfig& MaterialsConfig);
 	UMaterialInterface* TriangulateLines(FglTFRuntimePrimitive& Primitive, const FglTFRuntimeMaterialsConfig& MaterialsConfig);
 	UMaterialInterface* TriangulatePointsAndLines(FglTFRuntimePrimitive& Primitive, const FglTFRuntimeMaterialsConfig& MaterialsConfig);
@@ -2539,9 +2937,41 @@ public:
 
 	void SetBinaryBuffer(const TArray64<uint8>& InBinaryBuffer)
 	{
+		MappedBinaryBuffer.Reset();
+		StreamingBinaryBuffer.Reset();
 		BinaryBuffer = InBinaryBuffer;
+		BinaryBufferOffset = 0;
+		BinaryBufferSize = BinaryBuffer.Num();
+	}
+
+	// InOffset/InSize allow to keep a whole GLB blob alive and expose only its BIN chunk
+	void SetBinaryBuffer(TArray64<uint8>&& InBinaryBuffer, const int64 InOffset = 0, const int64 InSize = -1)
+	{
+		MappedBinaryBuffer.Reset();
+		StreamingBinaryBuffer.Reset();
+		BinaryBuffer = MoveTemp(InBinaryBuffer);
+		BinaryBufferOffset = FMath::Clamp<int64>(InOffset, 0, BinaryBuffer.Num());
+		BinaryBufferSize = InSize < 0 ? BinaryBuffer.Num() - BinaryBufferOffset : FMath::Min<int64>(InSize, BinaryBuffer.Num() - BinaryBufferOffset);
 	}
 
+	void SetBinaryBuffer(FglTFRuntimeMappedFilePtr InMappedBinaryBuffer, const int64 InOffset = 0, const int64 InSize = -1)
+	{
+		BinaryBuffer.Empty();
+		StreamingBinaryBuffer.Reset();
+		MappedBinaryBuffer = InMappedBinaryBuffer;
+		const int64 MappedSize = MappedBinaryBuffer ? MappedBinaryBuffer->Num() : 0;
+		BinaryBufferOffset = FMath::Clamp<int64>(InOffset, 0, MappedSize);
+		BinaryBufferSize = InSize < 0 ? MappedSize - BinaryBufferOffset : FMath::Min<int64>(InSize, MappedSize - BinaryBufferOffset);
+	}
+
+	// the BIN chunk is (still) being received, InOffset/InSize are relative to the whole GLB blob
+	void SetBinaryBuffer(TSharedPtr<FglTFRuntimeGLBStream, ESPMode::ThreadSafe> InStreamingBinaryBuffer, const int64 InOffset, const int64 InSize);
+
+	bool IsStreaming() const;
+
+	// queues an async load in the task pool, while streaming only once the BIN chunk has been fully received (so no worker waits for it)
+	void AddAsyncTask(FglTFRuntimeTaskPool::FTask&& Task, const EglTFRuntimeAsyncPriority Priority = EglTFRuntimeAsyncPriority::Normal, FglTFRuntimeCancellationTokenPtr CancellationToken = nullptr);
+
 	bool LoadStaticMeshIntoProceduralMeshComponent(const int32 MeshIndex, UProceduralMeshComponent* ProceduralMeshComponent, const FglTFRuntimeProceduralMeshConfig& ProceduralMeshConfig);
 
 	USkeletalMesh* FinalizeSkeletalMeshWithLODs(TSharedRef<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe> SkeletalMeshContext);
@@ -2595,6 +3025,9 @@ public:
 
 	static FVector4 CubicSpline(const float TC, const float T0, const float T1, const FVector4 Value0, const FVector4 OutTangent, const FVector4 Value1, const FVector4 InTangent);
 
+	// resamples a (sorted) timeline at a fixed rate with a single forward walk, every sample matches FindBestFrames() for the same time
+	static void SampleTimeline(const TArray<float>& FramesTimes, const int32 NumFrames, const float FrameDelta, TArray<FglTFRuntimeAnimationFrameSample>& Samples);
+
 	UAnimSequence* CreateAnimationFromPose(USkeletalMesh* SkeletalMesh, const int32 SkinIndex, const FglTFRuntimeSkeletalAnimationConfig& SkeletalAnimationConfig);
 
 	UAnimSequence* CreateSkeletalAnimationFromPath(USkeletalMesh* SkeletalMesh, const TArray<FglTFRuntimePathItem>& BonesPath, const TArray<FglTFRuntimePathItem>& MorphTargetsPath, const FglTFRuntimeSkeletalAnimationConfig& SkeletalAnimationConfig);
@@ -2709,6 +3142,10 @@ protected:
 	void LoadAndFillBaseMaterials();
 	TSharedRef<FJsonObject> Root;
 
+	// pre-resolved top-level collections ("accessors", "nodes", "bufferViews", ...) for O(1) index lookups
+	TMap<FString, TArray<TSharedPtr<FJsonObject>>> RootIndexTables;
+	void BuildRootIndexTables();
+
 #if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 4
 	TMap<int32, TObjectPtr<UStaticMesh>> StaticMeshesCache;
 	TMap<int32, TObjectPtr<UMaterialInterface>> MaterialsCache;
@@ -2722,8 +3159,17 @@ protected:
 	TMap<int32, USkeletalMesh*> SkeletalMeshesCache;
 	TMap<int32, UTexture2D*> TexturesCache;
 #endif
+	// textures are looked up from the loading threads and added from the game thread
+	FRWLock TexturesCacheLock;
+
+	TMap<FglTFRuntimePrefetchedTextureKey, FglTFRuntimePrefetchedTexture> PrefetchedTextures;
+	FCriticalSection PrefetchedTexturesLock;
+
+	bool ResolveTextureImageIndex(TSharedRef<FJsonObject> JsonTextureObject, int64& ImageIndex, int64& FallbackImageIndex);
 
 	TMap<int32, TArray64<uint8>> BuffersCache;
+	// external buffers files are mapped instead of being loaded
+	TMap<int32, FglTFRuntimeMappedFilePtr> MappedBuffersCache;
 	TMap<int32, TArray64<uint8>> CompressedBufferViewsCache;
 	TMap<int32, int64> CompressedBufferViewsStridesCache;
 
@@ -2736,11 +3182,22 @@ protected:
 	TArray<FglTFRuntimeNode> AllNodesCache;
 	bool bAllNodesCached;
 
+	// a single (wide or compact) LOD per mesh, the first load decides the representation; cached LODs are never converted in place as other contexts may reference them
 	TMap<TSharedRef<FJsonObject>, FglTFRuntimeMeshLOD> LODsCache;
 
 	TArray64<uint8> BinaryBuffer;
+	// when set, it replaces BinaryBuffer as the storage of the BIN chunk
+	FglTFRuntimeMappedFilePtr MappedBinaryBuffer;
+	// when set, the BIN chunk lives in a GLB blob still being downloaded
+	TSharedPtr<FglTFRuntimeGLBStream, ESPMode::ThreadSafe> StreamingBinaryBuffer;
+	int64 BinaryBufferOffset = 0;
+	int64 BinaryBufferSize = 0;
+
+	static TSharedPtr<FglTFRuntimeParser> FromJsonObject(TSharedRef<FJsonObject> JsonObject, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeArchive> InArchive);
+	// the zip archive owns (or maps) its bytes, so it can be parsed without copying them
+	static TSharedPtr<FglTFRuntimeParser> FromZipArchive(TSharedRef<FglTFRuntimeArchiveZip> ZipArchive, const FString& ContentHash, const FglTFRuntimeConfig& LoaderConfig);
 
-	bool LoadMeshIntoMeshLOD(TSharedRef<FJsonObject> JsonMeshObject, FglTFRuntimeMeshLOD*& LOD, const FglTFRuntimeMaterialsConfig& MaterialsConfig);
+	bool LoadMeshIntoMeshLOD(TSharedRef<FJsonObject> JsonMeshObject, FglTFRuntimeMeshLOD*& LOD, const FglTFRuntimeMaterialsConfig& MaterialsConfig, const bool bCompact = false, const bool bHighPrecisionTangents = false);
 
 	UStaticMesh* LoadStaticMesh_Internal(TSharedRef<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe> StaticMeshContext);
 	UMaterialInterface* LoadMaterial_Internal(const int32 Index, const FString& MaterialName, TSharedRef<FJsonObject> JsonMaterialObject, const FglTFRuntimeMaterialsConfig& MaterialsConfig, const bool bUseVertexColors, UMaterialInterface* ForceBaseMaterial);
@@ -2750,6 +3207,9 @@ protected:
 
 	bool LoadAnimation_Internal(TSharedRef<FJsonObject> JsonAnimationObject, float& Duration, FString& Name, TFunctionRef<void(const FglTFRuntimeNode& Node, const FString& Path, const FglTFRuntimeAnimationCurve& Curve)> Callback, TFunctionRef<bool(const FglTFRuntimeNode& Node)> NodeFilter, const TArray<FglTFRuntimePathItem>& OverrideTrackNameFromExtension);
 
+	// fills the first LOD of the context, from the cooked mesh cache when possible
+	bool LoadSkeletalMeshContextLOD(TSharedRef<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe> SkeletalMeshContext, const FString& ErrorContext);
+	bool RebindCookedMaterials(const int32 MeshIndex, FglTFRuntimeMeshLOD& LOD, const FglTFRuntimeMaterialsConfig& MaterialsConfig);
 	USkeletalMesh* CreateSkeletalMeshFromLODs(TSharedRef<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe> SkeletalMeshContext);
 
 	bool FillReferenceSkeleton(TSharedRef<FJsonObject> JsonSkinObject, FReferenceSkeleton& RefSkeleton, TMap<int32, FName>& BoneMap, const FglTFRuntimeSkeletonConfig& SkeletonConfig);
@@ -2777,7 +3237,7 @@ public:
 	bool CheckJsonIndex(TSharedRef<FJsonObject> JsonObject, const FString& FieldName, const int32 Index, TArray<TSharedRef<FJsonValue>>& JsonItems) const;
 	bool CheckJsonRootIndex(const FString FieldName, const int32 Index, TArray<TSharedRef<FJsonValue>>& JsonItems) const { return CheckJsonIndex(Root, FieldName, Index, JsonItems); }
 	TSharedPtr<FJsonObject> GetJsonObjectFromIndex(TSharedRef<FJsonObject> JsonObject, const FString& FieldName, const int32 Index) const;
-	TSharedPtr<FJsonObject> GetJsonObjectFromRootIndex(const FString& FieldName, const int32 Index) const { return GetJsonObjectFromIndex(Root, FieldName, Index); }
+	TSharedPtr<FJsonObject> GetJsonObjectFromRootIndex(const FString& FieldName, const int32 Index) const;
 	TSharedPtr<FJsonObject> GetJsonObjectFromExtensionIndex(TSharedRef<FJsonObject> JsonObject, const FString& ExtensionName, const FString& FieldName, const int32 Index);
 	TSharedPtr<FJsonObject> GetJsonObjectFromRootExtensionIndex(const FString& ExtensionName, const FString& FieldName, const int32 Index) { return GetJsonObjectFromExtensionIndex(Root, ExtensionName, FieldName, Index); }
 	TArray<TSharedRef<FJsonObject>> GetJsonObjectArrayFromExtension(TSharedRef<FJsonObject> JsonObject, const FString& ExtensionName, const FString& FieldName);
@@ -2846,10 +3306,14 @@ protected:
 #endif
 
 	TArray<FString> Errors;
+	FCriticalSection ErrorsLock;
 
 	FString BaseDirectory;
 	FString BaseFilename;
 
+	// SHA1 of the source data and loader config (only when FglTFRuntimeConfig::bCookedMeshCache is enabled)
+	FString ContentHash;
+
 	TArray64<uint8> AsBlob;
 
 public:
@@ -2857,6 +3321,23 @@ public:
 	FVector TransformVector(const FVector Vector) const;
 	FVector TransformPosition(const FVector Position) const;
 	FVector4 TransformVector4(const FVector4 Vector) const;
+
+	// BuildFromAccessorFieldWithBasis() helpers
+	static int64 GetBasisElements(const TArray<FVector>& Data) { return 3; }
+	static int64 GetBasisElements(const TArray<FVector4>& Data) { return 4; }
+	FVector TransformWithBasis(const FVector Value, const bool bPosition) const { return bPosition ? TransformPosition(Value) : TransformVector(Value); }
+	FVector4 TransformWithBasis(const FVector4 Value, const bool bPosition) const { return TransformVector4(Value); }
+	void DecodeFloatWithBasis(const FglTFRuntimeBlob& Blob, const int64 Stride, const int64 Count, TArray<FVector>& Data, const bool bPosition) const;
+	void DecodeFloatWithBasis(const FglTFRuntimeBlob& Blob, const int64 Stride, const int64 Count, TArray<FVector4>& Data, const bool bPosition) const;
+#if ENGINE_MAJOR_VERSION > 4
+	// single precision variants, used for decoding straight into the compact streams
+	static int64 GetBasisElements(const TArray<FVector3f>& Data) { return 3; }
+	static int64 GetBasisElements(const TArray<FVector4f>& Data) { return 4; }
+	FVector3f TransformWithBasis(const FVector3f Value, const bool bPosition) const { return FVector3f(TransformWithBasis(FVector(Value), bPosition)); }
+	FVector4f TransformWithBasis(const FVector4f Value, const bool bPosition) const { return FVector4f(TransformVector4(FVector4(Value))); }
+	void DecodeFloatWithBasis(const FglTFRuntimeBlob& Blob, const int64 Stride, const int64 Count, TArray<FVector3f>& Data, const bool bPosition) const;
+	void DecodeFloatWithBasis(const FglTFRuntimeBlob& Blob, const int64 Stride, const int64 Count, TArray<FVector4f>& Data, const bool bPosition) const;
+#endif
 	FTransform TransformTransform(const FTransform& Transform) const;
 
 	const TArray64<uint8>& GetBlob() const { return AsBlob; }
@@ -2902,84 +3383,14 @@ public:
 			*ComponentTypePtr = ComponentType;
 		}
 
-		auto ComponentFloat = [](const int64 Elements, const int64 Index, const FglTFRuntimeBlob& Blob, T& Value, const bool bNormalized)
-			{
-				float* Ptr = (float*)&(Blob.Data[Index]);
-				for (int32 i = 0; i < Elements; i++)
-				{
-					Value[i] = Ptr[i];
-				}
-			};
-
-		auto ComponentByte = [](const int64 Elements, const int64 Index, const FglTFRuntimeBlob& Blob, T& Value, const bool bNormalized)
-			{
-				int8* Ptr = (int8*)&(Blob.Data[Index]);
-				for (int32 i = 0; i < Elements; i++)
-				{
-					Value[i] = bNormalized ? FMath::Max(((float)Ptr[i]) / 127.f, -1.f) : Ptr[i];
-				}
-			};
-
-		auto ComponentUnsignedByte = [](const int64 Elements, const int64 Index, const FglTFRuntimeBlob& Blob, T& Value, const bool bNormalized)
-			{
-				uint8* Ptr = (uint8*)&(Blob.Data[Index]);
-				for (int32 i = 0; i < Elements; i++)
-				{
-					Value[i] = bNormalized ? ((float)Ptr[i]) / 255.f : Ptr[i];
-				}
-			};
-
-		auto ComponentShort = [](const int64 Elements, const int64 Index, const FglTFRuntimeBlob& Blob, T& Value, const bool bNormalized)
-			{
-				int16* Ptr = (int16*)&(Blob.Data[Index]);
-				for (int32 i = 0; i < Elements; i++)
-				{
-					Value[i] = bNormalized ? FMath::Max(((float)Ptr[i]) / 32767.f, -1.f) : Ptr[i];
-				}
-			};
-
-		auto ComponentUnsignedShort = [](const int64 Elements, const int64 Index, const FglTFRuntimeBlob& Blob, T& Value, const bool bNormalized)
-			{
-				uint16* Ptr = (uint16*)&(Blob.Data[Index]);
-				for (int32 i = 0; i < Elements; i++)
-				{
-					Value[i] = bNormalized ? ((float)Ptr[i]) / 65535.f : Ptr[i];
-				}
-			};
-
-		TFunction<void(const int64 Elements, const int64 Index, const FglTFRuntimeBlob& Blob, T& Value, const bool bNormalized)> ComponentFunction = nullptr;
-
-		switch (ComponentType)
+		Data.AddUninitialized(Count);
+		if (!glTFRuntime::Accessors::DecodeVectors(ComponentType, Blob.Data, Stride, Elements, bNormalized, Count, Data.GetData(), Filter))
 		{
-		case(5126):// FLOAT
-			ComponentFunction = ComponentFloat;
-			break;
-		case(5120):// BYTE
-			ComponentFunction = ComponentByte;
-			break;
-		case(5121):// UNSIGNED_BYTE
-			ComponentFunction = ComponentUnsignedByte;
-			break;
-		case(5122):// SHORT
-			ComponentFunction = ComponentShort;
-			break;
-		case(5123):// UNSIGNED_SHORT
-			ComponentFunction = ComponentUnsignedShort;
-			break;
-		default:
 			UE_LOG(LogGLTFRuntime, Error, TEXT("Unsupported type %d"), ComponentType);
+			Data.Reset();
 			return false;
 		}
 
-		Data.AddUninitialized(Count);
-		ParallelFor(Count, [&](const int64 ElementIndex)
-			{
-				int64 Index = ElementIndex * Stride;
-				T Value;
-				ComponentFunction(Elements, Index, Blob, Value, bNormalized);
-				Data[ElementIndex] = Filter(Value);
-			});
-
 		return true;
 	}
 
@@ -3016,69 +3427,14 @@ public:
 			*ComponentTypePtr = ComponentType;
 		}
 
-		auto ComponentFloat = [](const int64 Index, const FglTFRuntimeBlob& Blob, T& Value, const bool bNormalized)
-			{
-				float* Ptr = (float*)&(Blob.Data[Index]);
-				Value = *Ptr;
-			};
-
-		auto ComponentByte = [](const int64 Index, const FglTFRuntimeBlob& Blob, T& Value, const bool bNormalized)
-			{
-				int8* Ptr = (int8*)&(Blob.Data[Index]);
-				Value = bNormalized ? FMath::Max(((float)(*Ptr)) / 127.f, -1.f) : *Ptr;
-			};
-
-		auto ComponentUnsignedByte = [](const int64 Index, const FglTFRuntimeBlob& Blob, T& Value, const bool bNormalized)
-			{
-				uint8* Ptr = (uint8*)&(Blob.Data[Index]);
-				Value = bNormalized ? ((float)(*Ptr)) / 255.f : *Ptr;
-			};
-
-		auto ComponentShort = [](const int64 Index, const FglTFRuntimeBlob& Blob, T& Value, const bool bNormalized)
-			{
-				int16* Ptr = (int16*)&(Blob.Data[Index]);
-				Value = bNormalized ? FMath::Max(((float)(*Ptr)) / 32767.f, -1.f) : *Ptr;
-			};
-
-		auto ComponentUnsignedShort = [](const int64 Index, const FglTFRuntimeBlob& Blob, T& Value, const bool bNormalized)
-			{
-				uint16* Ptr = (uint16*)&(Blob.Data[Index]);
-				Value = bNormalized ? ((float)(*Ptr)) / 65535.f : *Ptr;
-			};
-
-		TFunction<void(const int64 Index, const FglTFRuntimeBlob& Blob, T& Value, const bool bNormalized)> ComponentFunction = nullptr;
-
-		switch (ComponentType)
+		Data.AddUninitialized(Count);
+		if (!glTFRuntime::Accessors::DecodeScalars(ComponentType, Blob.Data, Stride, bNormalized, Count, Data.GetData(), Filter))
 		{
-		case(5126):// FLOAT
-			ComponentFunction = ComponentFloat;
-			break;
-		case(5120):// BYTE
-			ComponentFunction = ComponentByte;
-			break;
-		case(5121):// UNSIGNED_BYTE
-			ComponentFunction = ComponentUnsignedByte;
-			break;
-		case(5122):// SHORT
-			ComponentFunction = ComponentShort;
-			break;
-		case(5123):// UNSIGNED_SHORT
-			ComponentFunction = ComponentUnsignedShort;
-			break;
-		default:
 			UE_LOG(LogGLTFRuntime, Error, TEXT("Unsupported type %d"), ComponentType);
+			Data.Reset();
 			return false;
 		}
 
-		Data.AddUninitialized(Count);
-		ParallelFor(Count, [&](const int64 ElementIndex)
-			{
-				int64 Index = ElementIndex * Stride;
-				T Value;
-				ComponentFunction(Index, Blob, Value, bNormalized);
-				Data[ElementIndex] = Filter(Value);
-			});
-
 		return true;
 	}
 
@@ -3094,6 +3450,61 @@ public:
 		return BuildFromAccessorField(JsonObject, Name, Data, SupportedTypes, [&](T InValue) -> T {return InValue; }, AdditionalBufferView, bDefaultNormalized, ComponentTypePtr);
 	}
 
+	/*
+	* Specialized version for attributes living in the scene basis (POSITION, NORMAL, TANGENT):
+	* FLOAT accessors are decoded with the SceneBasis (and SceneScale for positions) conversion folded in the SIMD kernel,
+	* quantized ones fall back to the generic decoders.
+	*/
+	template<typename T>
+	bool BuildFromAccessorFieldWithBasis(TSharedRef<FJsonObject> JsonObject, const FString& Name, TArray<T>& Data, const TArray<int64>& SupportedTypes, const bool bPosition, const int64 AdditionalBufferView, const bool bDefaultNormalized)
+	{
+		int64 AccessorIndex;
+		if (!JsonObject->TryGetNumberField(Name, AccessorIndex))
+		{
+			return false;
+		}
+
+		FglTFRuntimeBlob Blob;
+		int64 ComponentType = 0, Stride = 0, Elements = 0, ElementSize = 0, Count = 0;
+		bool bNormalized = bDefaultNormalized;
+
+		if (!GetAccessor(AccessorIndex, ComponentType, Stride, Elements, ElementSize, Count, bNormalized, Blob, GetAdditionalBufferView(AdditionalBufferView, Name)))
+		{
+			return false;
+		}
+
+		if (Elements != GetBasisElements(Data))
+		{
+			return false;
+		}
+
+		if (!SupportedTypes.Contains(ComponentType))
+		{
+			return false;
+		}
+
+		Data.AddUninitialized(Count);
+
+		if (ComponentType == 5126)
+		{
+			DecodeFloatWithBasis(Blob, Stride, Count, Data, bPosition);
+			return true;
+		}
+
+		auto Filter = [this, bPosition](T Value) -> T { return TransformWithBasis(Value, bPosition); };
+		if (!glTFRuntime::Accessors::DecodeVectors(ComponentType, Blob.Data, Stride, Elements, bNormalized, Count, Data.GetData(), Filter))
+		{
+			UE_LOG(LogGLTFRuntime, Error, TEXT("Unsupported type %d"), ComponentType);
+			Data.Reset();
+			return false;
+		}
+
+		return true;
+	}
+
+	// WEIGHTS_n decoded straight into normalized 16 bit weights (UNSIGNED_SHORT is copied as is, UNSIGNED_BYTE is rescaled exactly, FLOAT is rounded)
+	bool BuildWeightsFromAccessorField(TSharedRef<FJsonObject> JsonObject, const FString& Name, TArray<FglTFRuntimeUInt16Vector4>& Data, const int64 AdditionalBufferView, int64* ComponentTypePtr);
+
 	template<int32 Num, typename T>
 	bool GetJsonVector(const TArray<TSharedPtr<FJsonValue>>* JsonValues, T& Value)
 	{
@@ -3145,19 +3556,20 @@ public:
 	bool IsArchive() const;
 	TArray<FString> GetArchiveItems() const;
 	bool GetBlobByName(const FString& Name, TArray64<uint8>& Blob) const;
+	// decompresses (in parallel) the archive entries referenced by the buffers and the images, returns the number of prefetched entries
+	int32 PrefetchArchiveEntries();
 
 	template<typename FUNCTION>
 	void LoadAsRuntimeLODAsync(FUNCTION Function, const FglTFRuntimeMeshLODAsync& AsyncCallback)
 	{
-		Async(EAsyncExecution::Thread, [Function, AsyncCallback]()
+		AddAsyncTask([Function, AsyncCallback](const bool bCancelled)
 			{
 				FglTFRuntimeMeshLOD LOD;
-				bool bSuccess = Function(LOD);
-				FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([bSuccess, &LOD, AsyncCallback]()
+				bool bSuccess = !bCancelled && Function(LOD);
+				FFunctionGraphTask::CreateAndDispatchWhenReady([bSuccess, RuntimeLOD = bSuccess ? MoveTemp(LOD) : FglTFRuntimeMeshLOD(), AsyncCallback]()
 					{
-						AsyncCallback.ExecuteIfBound(bSuccess, bSuccess ? LOD : FglTFRuntimeMeshLOD());
+						AsyncCallback.ExecuteIfBound(bSuccess, RuntimeLOD);
 					}, TStatId(), nullptr, ENamedThreads::GameThread);
-				FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
 			}
 
 		);
@@ -3168,6 +3580,7 @@ public:
 
 	const FString& GetBaseDirectory() const { return BaseDirectory; }
 	const FString& GetBaseFilename() const { return BaseFilename; }
+	const FString& GetContentHash() const { return ContentHash; }
 
 	void SetBaseDirectory(const FString& NewBaseDirectory) { BaseDirectory = NewBaseDirectory; }
 
@@ -0,0 +1,44 @@
+// Copyright 2020-2025, Roberto De Ioris.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/*
+* Normals and tangents generation for a triangle list.
+* The constructor builds the vertex -> triangle corners adjacency, then every vertex is resolved independently (in parallel and without locks)
+* by accumulating the contributions of the triangles sharing it. Accumulation order is fixed, so results are deterministic.
+* Vertices are addressed relative to GetFirstVertex() (the lowest index), only the referenced ones are written.
+* Normals are flat by default (as the glTF specification requires for primitives without them): a vertex gets the normal of its first triangle,
+* so vertices shared by differently oriented triangles must be split by the caller. Smooth normals accumulate every triangle sharing the vertex.
+* MikkTSpace mode weights every corner by its angle and orthogonalizes per corner (like the reference implementation), vertices are not split
+* on handedness changes (glTF exporters already split them).
+*/
+class GLTFRUNTIME_API FglTFRuntimeTangentsGenerator
+{
+public:
+	FglTFRuntimeTangentsGenerator() = delete;
+	FglTFRuntimeTangentsGenerator(const FglTFRuntimeTangentsGenerator&) = delete;
+	FglTFRuntimeTangentsGenerator& operator=(const FglTFRuntimeTangentsGenerator&) = delete;
+
+	FglTFRuntimeTangentsGenerator(TArrayView<const uint32> InIndices);
+
+	int32 GetFirstVertex() const { return FirstVertex; }
+	int32 GetNumVertices() const { return NumVertices; }
+	bool IsVertexReferenced(const int32 VertexIndex) const { return CornersOffsets[VertexIndex + 1] > CornersOffsets[VertexIndex]; }
+
+	// bMikkTSpace only affects smooth normals (area weighted otherwise)
+	void GenerateNormals(TArrayView<const FVector> Positions, TArrayView<FVector> Normals, const bool bSmooth, const bool bMikkTSpace) const;
+
+	// UVs can be empty (an arbitrary orthogonal tangent is generated), W is the glTF bitangent sign (only computed in MikkTSpace mode, 1 otherwise)
+	void GenerateTangents(TArrayView<const FVector> Positions, TArrayView<const FVector2D> UVs, TArrayView<const FVector> Normals, TArrayView<FVector4> Tangents, const bool bMikkTSpace) const;
+
+protected:
+	float GetCornerAngle(TArrayView<const FVector> Positions, const int32 Corner) const;
+
+	TArrayView<const uint32> Indices;
+	int32 FirstVertex;
+	int32 NumVertices;
+	TArray<int32> CornersOffsets;
+	TArray<int32> Corners;
+};
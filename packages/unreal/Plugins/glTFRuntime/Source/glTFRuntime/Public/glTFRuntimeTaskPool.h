@@ -0,0 +1,155 @@
+// Copyright 2020-2025, Roberto De Ioris.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Queue.h"
+#include "HAL/ThreadSafeBool.h"
+#include "Misc/QueuedThreadPool.h"
+#include "Templates/Function.h"
+#include "glTFRuntimeTaskPool.generated.h"
+
+UENUM()
+enum class EglTFRuntimeAsyncPriority : uint8
+{
+	High,
+	Normal,
+	Low
+};
+
+USTRUCT(BlueprintType)
+struct FglTFRuntimeTaskPoolStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "glTFRuntime")
+	int32 NumThreads;
+
+	// tasks waiting for a worker, per priority
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "glTFRuntime")
+	int32 QueueDepthHigh;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "glTFRuntime")
+	int32 QueueDepthNormal;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "glTFRuntime")
+	int32 QueueDepthLow;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "glTFRuntime")
+	int32 NumRunning;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "glTFRuntime")
+	int32 NumCompleted;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "glTFRuntime")
+	int32 NumCancelled;
+
+	// seconds between the submission of a task and its execution
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "glTFRuntime")
+	float AverageWaitTime;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "glTFRuntime")
+	float MaxWaitTime;
+
+	FglTFRuntimeTaskPoolStats()
+	{
+		NumThreads = 0;
+		QueueDepthHigh = 0;
+		QueueDepthNormal = 0;
+		QueueDepthLow = 0;
+		NumRunning = 0;
+		NumCompleted = 0;
+		NumCancelled = 0;
+		AverageWaitTime = 0;
+		MaxWaitTime = 0;
+	}
+};
+
+/*
+* Shared between the requester and the async task.
+* The token is checked when a worker picks up the task: cancelled tasks are still invoked (with bCancelled set)
+* so they can report the failure to their callbacks, but they skip the actual loading.
+*/
+class GLTFRUNTIME_API FglTFRuntimeCancellationToken
+{
+public:
+	void Cancel()
+	{
+		bCancelled = true;
+	}
+
+	bool IsCancelled() const
+	{
+		return bCancelled;
+	}
+
+private:
+	FThreadSafeBool bCancelled;
+};
+
+typedef TSharedPtr<FglTFRuntimeCancellationToken, ESPMode::ThreadSafe> FglTFRuntimeCancellationTokenPtr;
+
+/*
+* Bounded pool of worker threads used by all of the *Async loaders.
+* Tasks are queued by priority (FIFO within the same priority) and every worker always picks
+* the oldest task with the highest priority, so a burst of requests does not spawn a thread per request
+* and does not starve the ParallelFor calls running inside the loaders.
+*/
+class GLTFRUNTIME_API FglTFRuntimeTaskPool
+{
+public:
+	typedef TUniqueFunction<void(const bool bCancelled)> FTask;
+
+	static FglTFRuntimeTaskPool& Get();
+
+	// called by the module on shutdown, pending tasks are discarded
+	static void Shutdown();
+
+	void AddTask(FTask&& Task, const EglTFRuntimeAsyncPriority Priority = EglTFRuntimeAsyncPriority::Normal, FglTFRuntimeCancellationTokenPtr CancellationToken = nullptr);
+
+	FglTFRuntimeTaskPoolStats GetStats() const;
+
+	~FglTFRuntimeTaskPool();
+
+private:
+	FglTFRuntimeTaskPool();
+
+	struct FPendingTask
+	{
+		FTask Task;
+		FglTFRuntimeCancellationTokenPtr CancellationToken;
+		double EnqueueTime;
+	};
+
+	class FPumpWork : public IQueuedWork
+	{
+	public:
+		FPumpWork(FglTFRuntimeTaskPool& InTaskPool) : TaskPool(InTaskPool)
+		{
+		}
+
+		virtual void DoThreadedWork() override;
+		virtual void Abandon() override;
+
+	private:
+		FglTFRuntimeTaskPool& TaskPool;
+	};
+
+	bool Dequeue(FPendingTask& PendingTask);
+	void RunNext();
+
+	static constexpr int32 NumPriorities = 3;
+
+	FQueuedThreadPool* ThreadPool;
+	int32 NumThreads;
+
+	TQueue<FPendingTask> Queues[NumPriorities];
+	int32 QueueDepth[NumPriorities];
+	mutable FCriticalSection QueuesLock;
+
+	int32 NumRunning;
+	int32 NumCompleted;
+	int32 NumCancelled;
+	double TotalWaitTime;
+	double MaxWaitTime;
+};
@@ -0,0 +1,29 @@
+// Copyright 2020-2025, Roberto De Ioris.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "glTFRuntimeParser.h"
+
+/*
+* CPU encoder of B8G8R8A8 mips to GPU block compressed formats (see FglTFRuntimeImagesConfig::BlockCompression).
+* Supports BC1 (PF_DXT1), BC3 (PF_DXT5), BC5 (PF_BC5) and BC7 (PF_BC7, mode 6 only).
+* Every mip is split in tiles of block rows, and all the tiles of all the mips are encoded in parallel.
+*/
+class GLTFRUNTIME_API FglTFRuntimeTextureCompressor
+{
+public:
+	// returns PF_Unknown if block compression is disabled, or if the resulting format is not supported by the current RHI
+	static EPixelFormat GetPixelFormat(const EglTFRuntimeBlockCompression BlockCompression, const bool bNormalMap, const bool bHasAlpha);
+
+	static bool HasAlpha(const FglTFRuntimeMipMap& MipMap);
+
+	// encodes the mips in place, they must all be PF_B8G8R8A8 (the first one with a size multiple of 4)
+	static bool CompressMips(TArray<FglTFRuntimeMipMap>& Mips, const EPixelFormat PixelFormat, const EglTFRuntimeBlockCompressionQuality Quality);
+
+	// Pixels are 16 B8G8R8A8 texels in row order
+	static void EncodeBC1(const uint8* Pixels, uint8* Block, const EglTFRuntimeBlockCompressionQuality Quality);
+	static void EncodeBC3(const uint8* Pixels, uint8* Block, const EglTFRuntimeBlockCompressionQuality Quality);
+	static void EncodeBC5(const uint8* Pixels, uint8* Block, const EglTFRuntimeBlockCompressionQuality Quality);
+	static void EncodeBC7(const uint8* Pixels, uint8* Block, const EglTFRuntimeBlockCompressionQuality Quality);
+};
@@ -0,0 +1,37 @@
+// Copyright 2020-2025, Roberto De Ioris.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FglTFRuntimeZstdFrame
+{
+	int64 Offset = 0;
+	int64 Size = 0;
+	// INDEX_NONE if the frame header does not store it
+	int64 ContentSize = INDEX_NONE;
+};
+
+/*
+* Zstandard decoder (https://github.com/facebook/zstd/blob/dev/doc/zstd_compression_format.md)
+* Wraps the single-file decompressor of the reference implementation vendored in Source/ThirdParty/zstd.
+* Streams made of multiple frames (like the output of multithreaded encoders) can be decoded in parallel
+* when every frame stores its content size.
+*/
+class GLTFRUNTIME_API FglTFRuntimeZstd
+{
+public:
+	static bool IsFrame(const uint8* DataPtr, const int64 DataNum);
+
+	// splits a stream into its frames (skippable frames are ignored)
+	static bool GetFrames(const uint8* DataPtr, const int64 DataNum, TArray<FglTFRuntimeZstdFrame>& Frames);
+
+	// sum of the frames content sizes, INDEX_NONE if any frame does not store it
+	static int64 GetContentSize(const uint8* DataPtr, const int64 DataNum);
+
+	// fails on malformed data or if the decompressed size is not exactly OutputNum
+	static bool Decompress(const uint8* DataPtr, const int64 DataNum, uint8* Output, const int64 OutputNum);
+
+	// the output size is taken from the frames headers
+	static bool Decompress(const uint8* DataPtr, const int64 DataNum, TArray64<uint8>& Output);
+};
@@ -1,5 +1,6 @@
 // Copyright 2020, Roberto De Ioris.
 
+using System.IO;
 using UnrealBuildTool;
 
 public class glTFRuntime : ModuleRules
@@ -17,6 +18,7 @@ public class glTFRuntime : ModuleRules
 
         PrivateIncludePaths.AddRange(
             new string[] {
+                Path.Combine(ModuleDirectory, "..", "ThirdParty", "zstd")
             }
             );
 
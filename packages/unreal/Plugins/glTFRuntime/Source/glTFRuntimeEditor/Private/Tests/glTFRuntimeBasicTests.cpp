@@ -2,8 +2,23 @@
 
 #if WITH_DEV_AUTOMATION_TESTS
 #include "glTFRuntimeEditor.h"
+#include "glTFAnimBoneCompressionCodec.h"
+#include "glTFRuntimeAnimationCurve.h"
+#include "glTFRuntimeBase64.h"
+#include "glTFRuntimeDeflate64.h"
 #include "glTFRuntimeFunctionLibrary.h"
+#include "glTFRuntimeGLBStream.h"
+#include "glTFRuntimeKTX2.h"
+#include "glTFRuntimeMipGenerator.h"
+#include "glTFRuntimeNodeAnimationSubsystem.h"
+#include "glTFRuntimeTangentsGenerator.h"
+#include "glTFRuntimeZstd.h"
+#include "Components/SceneComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "HAL/ThreadSafeCounter.h"
 #include "Misc/AutomationTest.h"
+#include "Misc/Base64.h"
 
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Basic_BlenderEmpty_Copyright, "glTFRuntime.UnitTests.Basic.BlenderEmpty.Copyright", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
 
@@ -128,4 +143,847 @@ bool FglTFRuntimeTests_Basic_EmptyScene::RunTest(const FString& Parameters)
 	return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Basic_PrefetchMeshesTextures, "glTFRuntime.UnitTests.Basic.PrefetchMeshesTextures", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeTests_Basic_PrefetchMeshesTextures::RunTest(const FString& Parameters)
+{
+	// texture 0 is used both as sRGB (base color) and linear (occlusion), texture 1 as normal map, texture 2 by another material
+	glTFRuntime::Tests::FFixture32 Fixture("PrefetchTextures.gltf");
+
+	FglTFRuntimeConfig LoaderConfig;
+	UglTFRuntimeAsset* Asset = UglTFRuntimeFunctionLibrary::glTFLoadAssetFromData(Fixture.Blob, LoaderConfig);
+	if (!TestTrue("Asset != nullptr", Asset != nullptr))
+	{
+		return false;
+	}
+
+	TSharedPtr<FglTFRuntimeParser> Parser = Asset->GetParser();
+
+	FThreadSafeCounter NumImageIndexBroadcasts;
+	const FDelegateHandle ImageIndexHandle = FglTFRuntimeParser::OnTextureImageIndex.AddLambda([&NumImageIndexBroadcasts](TSharedRef<FglTFRuntimeParser>, TSharedRef<FJsonObject>, int64&)
+		{
+			NumImageIndexBroadcasts.Increment();
+		});
+
+	FglTFRuntimeMaterialsConfig MaterialsConfig;
+	FglTFRuntimeMaterialsConfig NormalMapMaterialsConfig;
+	NormalMapMaterialsConfig.ImagesConfig.Compression = TextureCompressionSettings::TC_Normalmap;
+
+	const TArray<FglTFRuntimePrefetchedTextureKey> Keys = Parser->PrefetchMeshesTextures(Parser->GetMeshes(), MaterialsConfig);
+	TestEqual("Keys.Num() == 4", Keys.Num(), 4);
+	TestEqual("OnTextureImageIndex broadcasts after the prefetch", NumImageIndexBroadcasts.GetValue(), 3);
+
+	// every slot consumes its prefetched mips, without resolving the image again
+	auto LoadTextureMips = [&](const int32 TextureIndex, const bool sRGB, const FglTFRuntimeMaterialsConfig& TextureMaterialsConfig)
+	{
+		TArray<FglTFRuntimeMipMap> Mips;
+		FglTFRuntimeTextureSampler Sampler;
+		Parser->LoadTexture(TextureIndex, Mips, sRGB, TextureMaterialsConfig, Sampler);
+		return Mips;
+	};
+
+	const TArray<FglTFRuntimeMipMap> BaseColorMips = LoadTextureMips(0, true, MaterialsConfig);
+	const TArray<FglTFRuntimeMipMap> OcclusionMips = LoadTextureMips(0, false, MaterialsConfig);
+	const TArray<FglTFRuntimeMipMap> NormalMips = LoadTextureMips(1, false, NormalMapMaterialsConfig);
+	const TArray<FglTFRuntimeMipMap> EmissiveMips = LoadTextureMips(2, true, MaterialsConfig);
+
+	TestTrue("BaseColorMips.Num() > 0", BaseColorMips.Num() > 0 && BaseColorMips[0].Width == 2 && BaseColorMips[0].Height == 2);
+	TestTrue("OcclusionMips.Num() > 0", OcclusionMips.Num() > 0);
+	TestTrue("NormalMips.Num() > 0", NormalMips.Num() > 0);
+	TestTrue("EmissiveMips.Num() > 0", EmissiveMips.Num() > 0);
+	TestEqual("OnTextureImageIndex broadcasts after LoadTexture()", NumImageIndexBroadcasts.GetValue(), 3);
+
+	// not prefetched anymore, so resolved again
+	LoadTextureMips(2, true, MaterialsConfig);
+	TestEqual("OnTextureImageIndex broadcasts after a second LoadTexture()", NumImageIndexBroadcasts.GetValue(), 4);
+
+	Parser->DiscardPrefetchedTextures(Keys);
+	FglTFRuntimeParser::OnTextureImageIndex.Remove(ImageIndexHandle);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Basic_GLBStream, "glTFRuntime.UnitTests.Basic.GLBStream", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeTests_Basic_GLBStream::RunTest(const FString& Parameters)
+{
+	FTCHARToUTF8 Json(TEXT("{\"asset\":{\"version\":\"2.0\"},\"buffers\":[{\"byteLength\":16}],\"bufferViews\":[{\"buffer\":0,\"byteLength\":8},{\"buffer\":0,\"byteOffset\":8,\"byteLength\":8}]}"));
+	const uint32 JsonLength = Align(Json.Length(), 4);
+	const uint32 BinaryLength = 16;
+	const uint32 TotalLength = 12 + 8 + JsonLength + 8 + BinaryLength;
+
+	TArray<uint8> GLB;
+	auto AppendUInt32 = [&GLB](const uint32 Value) { GLB.Append(reinterpret_cast<const uint8*>(&Value), 4); };
+	AppendUInt32(0x46546C67);
+	AppendUInt32(2);
+	AppendUInt32(TotalLength);
+	AppendUInt32(JsonLength);
+	AppendUInt32(0x4E4F534A);
+	GLB.Append(reinterpret_cast<const uint8*>(Json.Get()), Json.Length());
+	while (GLB.Num() % 4)
+	{
+		GLB.Add(' ');
+	}
+	AppendUInt32(BinaryLength);
+	AppendUInt32(0x004E4942);
+	for (uint32 Index = 0; Index < BinaryLength; Index++)
+	{
+		GLB.Add(Index);
+	}
+
+	FglTFRuntimeConfig LoaderConfig;
+	TSharedRef<FglTFRuntimeGLBStream, ESPMode::ThreadSafe> Stream = MakeShared<FglTFRuntimeGLBStream, ESPMode::ThreadSafe>(LoaderConfig);
+	int32 JsonChunkNotifications = 0;
+	Stream->OnJsonChunkReceived = [&JsonChunkNotifications]() { JsonChunkNotifications++; };
+
+	// header and a partial json chunk
+	Stream->Append(GLB.GetData(), 16);
+	TestTrue("IsGLB()", Stream->IsGLB());
+	TestEqual("GetTotalSize()", Stream->GetTotalSize(), static_cast<int64>(TotalLength));
+	TestEqual("No json notification", JsonChunkNotifications, 0);
+
+	// json chunk, BIN chunk header and the first buffer view
+	const int64 FirstViewEnd = TotalLength - BinaryLength + 8;
+	Stream->Append(GLB.GetData() + 16, FirstViewEnd - 16);
+	TestEqual("Json notification", JsonChunkNotifications, 1);
+
+	TSharedPtr<FglTFRuntimeParser> Parser = FglTFRuntimeParser::FromStream(Stream, LoaderConfig);
+	TestTrue("Parser != nullptr", Parser.IsValid());
+
+	FglTFRuntimeBlob Blob;
+	int64 Stride;
+	TestTrue("GetBufferView(0) == true", Parser->GetBufferView(0, Blob, Stride));
+	TestEqual("Blob.Data[7] == 7", Blob.Data[7], 7);
+
+	// the game thread never waits
+	AddExpectedError("BufferView 1 has not been received", EAutomationExpectedErrorFlags::Contains, 1);
+	TestFalse("GetBufferView(1) == false", Parser->GetBufferView(1, Blob, Stride));
+
+	Stream->Append(GLB.GetData() + FirstViewEnd, GLB.Num() - FirstViewEnd);
+	Stream->Finish(true);
+	TestFalse("IsFailed()", Stream->IsFailed());
+	TestTrue("GetBufferView(1) == true", Parser->GetBufferView(1, Blob, Stride));
+	TestEqual("Blob.Data[0] == 8", Blob.Data[0], 8);
+	TestEqual("Json notifications", JsonChunkNotifications, 1);
+
+	// the cooked mesh cache key is available before the BIN chunk and depends on the source
+	FglTFRuntimeConfig CookedLoaderConfig;
+	CookedLoaderConfig.bCookedMeshCache = true;
+	TSharedRef<FglTFRuntimeGLBStream, ESPMode::ThreadSafe> CookedStream = MakeShared<FglTFRuntimeGLBStream, ESPMode::ThreadSafe>(CookedLoaderConfig);
+	TSharedRef<FglTFRuntimeGLBStream, ESPMode::ThreadSafe> OtherStream = MakeShared<FglTFRuntimeGLBStream, ESPMode::ThreadSafe>(CookedLoaderConfig);
+	CookedStream->SetUrl(TEXT("https://example.com/a.glb"));
+	CookedStream->SetETag(TEXT("\"a\""));
+	OtherStream->SetUrl(TEXT("https://example.com/b.glb"));
+	OtherStream->SetETag(TEXT("\"a\""));
+	CookedStream->Append(GLB.GetData(), FirstViewEnd);
+	OtherStream->Append(GLB.GetData(), FirstViewEnd);
+	TestFalse("GetContentHash() is not empty", CookedStream->GetContentHash().IsEmpty());
+	TestNotEqual("GetContentHash() depends on the url", CookedStream->GetContentHash(), OtherStream->GetContentHash());
+	TestFalse("IsFinished()", CookedStream->IsFinished());
+
+	// the ETag is frozen with the JSON chunk
+	const FString CookedContentHash = CookedStream->GetContentHash();
+	CookedStream->SetETag(TEXT("\"b\""));
+	TestEqual("GetContentHash() ignores a late ETag", CookedStream->GetContentHash(), CookedContentHash);
+
+	// the BIN chunk is not part of the key, without a strong ETag the cache is skipped
+	for (const TCHAR* WeakETag : { TEXT(""), TEXT("W/\"a\"") })
+	{
+		TSharedRef<FglTFRuntimeGLBStream, ESPMode::ThreadSafe> WeakStream = MakeShared<FglTFRuntimeGLBStream, ESPMode::ThreadSafe>(CookedLoaderConfig);
+		WeakStream->SetUrl(TEXT("https://example.com/a.glb"));
+		WeakStream->SetETag(WeakETag);
+		WeakStream->Append(GLB.GetData(), FirstViewEnd);
+		TestTrue(FString::Printf(TEXT("GetContentHash() is empty with ETag '%s'"), WeakETag), WeakStream->GetContentHash().IsEmpty());
+	}
+
+	// the blob is preallocated with the GLB header, the received bytes never move
+	TSharedRef<FglTFRuntimeGLBStream, ESPMode::ThreadSafe> PreallocatedStream = MakeShared<FglTFRuntimeGLBStream, ESPMode::ThreadSafe>(LoaderConfig);
+	PreallocatedStream->Append(GLB.GetData(), 12);
+	const uint8* PreallocatedData = PreallocatedStream->GetData();
+	for (int32 Index = 12; Index < GLB.Num(); Index++)
+	{
+		PreallocatedStream->Append(GLB.GetData() + Index, 1);
+	}
+	PreallocatedStream->Finish(true);
+	TestTrue("GetData() is stable", PreallocatedStream->GetData() == PreallocatedData);
+	TestEqual("GetReceivedBytes()", PreallocatedStream->GetReceivedBytes(), static_cast<int64>(TotalLength));
+	TestTrue("Content matches", FMemory::Memcmp(PreallocatedStream->GetData(), GLB.GetData(), GLB.Num()) == 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Basic_MipGenerator, "glTFRuntime.UnitTests.Basic.MipGenerator", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeTests_Basic_MipGenerator::RunTest(const FString& Parameters)
+{
+	// non power of two, black and white checkerboard with half transparent alpha
+	const int32 Width = 5;
+	const int32 Height = 3;
+	TArray<FglTFRuntimeMipMap> Mips;
+	FglTFRuntimeMipMap MipMap(-1, EPixelFormat::PF_B8G8R8A8, Width, Height);
+	for (int32 Index = 0; Index < Width * Height; Index++)
+	{
+		const uint8 Value = (Index % 2) == 0 ? 255 : 0;
+		MipMap.Pixels.Append({ Value, Value, Value, 128 });
+	}
+	Mips.Add(MipMap);
+
+	TestTrue("GenerateMips() == true", FglTFRuntimeMipGenerator::GenerateMips(Mips, true));
+	TestEqual("Mips.Num() == 3", Mips.Num(), 3);
+	TestEqual("Mips[1].Width == 2", Mips[1].Width, 2);
+	TestEqual("Mips[1].Height == 1", Mips[1].Height, 1);
+	TestEqual("Mips[2].Width == 1", Mips[2].Width, 1);
+	TestEqual("Mips[2].Height == 1", Mips[2].Height, 1);
+	TestEqual("Mips[2].Pixels.Num() == 4", Mips[2].Pixels.Num(), static_cast<int64>(4));
+
+	// 8 white and 7 black texels averaged in linear space, not 255 * 8 / 15
+	const int32 Expected = FMath::RoundToInt(FMath::Pow(8.0f / 15.0f, 1.0f / 2.4f) * 1.055f * 255.0f - 0.055f * 255.0f);
+	TestTrue("Mips[2] is sRGB filtered", FMath::Abs(Mips[2].Pixels[0] - Expected) <= 2);
+	TestEqual("Mips[2] alpha is linear", static_cast<int32>(Mips[2].Pixels[3]), 128);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Basic_KTX2, "glTFRuntime.UnitTests.Basic.KTX2", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeTests_Basic_KTX2::RunTest(const FString& Parameters)
+{
+	// 4x2 VK_FORMAT_R8G8B8A8_UNORM with 3 levels, no data format descriptor
+	const uint32 NumLevels = 3;
+	const int64 LevelSizes[NumLevels] = { 4 * 2 * 4, 2 * 1 * 4, 1 * 1 * 4 };
+	TArray64<uint8> KTX2;
+	KTX2.Append({ 0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A });
+	const uint32 Header[] = { 37, 1, 4, 2, 0, 0, 1, NumLevels, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+	KTX2.Append(reinterpret_cast<const uint8*>(Header), sizeof(Header));
+
+	int64 LevelOffset = 80 + NumLevels * 24;
+	for (uint32 Level = 0; Level < NumLevels; Level++)
+	{
+		const uint64 LevelIndexEntry[] = { static_cast<uint64>(LevelOffset), static_cast<uint64>(LevelSizes[Level]), static_cast<uint64>(LevelSizes[Level]) };
+		KTX2.Append(reinterpret_cast<const uint8*>(LevelIndexEntry), sizeof(LevelIndexEntry));
+		LevelOffset += LevelSizes[Level];
+	}
+	for (uint32 Level = 0; Level < NumLevels; Level++)
+	{
+		for (int64 Index = 0; Index < LevelSizes[Level] / 4; Index++)
+		{
+			KTX2.Append({ 10, 20, 30, static_cast<uint8>(Level) });
+		}
+	}
+
+	TestTrue("IsKTX2()", FglTFRuntimeKTX2::IsKTX2(KTX2));
+
+	FglTFRuntimeImagesConfig ImagesConfig;
+	TArray<FglTFRuntimeMipMap> Mips;
+	FglTFRuntimeKTX2 KTX2Texture(KTX2);
+	KTX2Texture.LoadMips(0, Mips, 0, ImagesConfig);
+
+	if (!TestEqual("Mips.Num() == 3", Mips.Num(), 3))
+	{
+		return false;
+	}
+	TestEqual("Mips[0].Width == 4", Mips[0].Width, 4);
+	TestEqual("Mips[0].Height == 2", Mips[0].Height, 2);
+	TestEqual("Mips[2].Width == 1", Mips[2].Width, 1);
+	TestTrue("Mips[0].PixelFormat == PF_B8G8R8A8", Mips[0].PixelFormat == EPixelFormat::PF_B8G8R8A8);
+	TestEqual("Mips[0] is swizzled", static_cast<int32>(Mips[0].Pixels[0]), 30);
+	TestEqual("Mips[2] alpha", static_cast<int32>(Mips[2].Pixels[3]), 2);
+
+	// VK_FORMAT_UNDEFINED without a Basis Universal data format descriptor
+	KTX2[12] = 0;
+	FglTFRuntimeKTX2 BasisTexture(KTX2);
+	TArray<FglTFRuntimeMipMap> BasisMips;
+	AddExpectedError("Unsupported KTX2 vkFormat", EAutomationExpectedErrorFlags::Contains, 1);
+	BasisTexture.LoadMips(0, BasisMips, 0, ImagesConfig);
+	TestEqual("BasisMips.Num() == 0", BasisMips.Num(), 0);
+	KTX2[12] = 37;
+
+	// more levels than the full mip chain
+	const uint32 BogusNumLevels = 1000;
+	FMemory::Memcpy(KTX2.GetData() + 40, &BogusNumLevels, sizeof(uint32));
+	FglTFRuntimeKTX2 ClampedTexture(KTX2);
+	TArray<FglTFRuntimeMipMap> ClampedMips;
+	ClampedTexture.LoadMips(0, ClampedMips, 0, ImagesConfig);
+	TestEqual("ClampedMips.Num() == 3", ClampedMips.Num(), 3);
+	TestFalse("ClampedTexture.RequiresMipGeneration()", ClampedTexture.RequiresMipGeneration());
+
+	// levelCount 0, only the base level is loaded and the chain must be generated
+	const uint32 NoLevels = 0;
+	FMemory::Memcpy(KTX2.GetData() + 40, &NoLevels, sizeof(uint32));
+	FglTFRuntimeKTX2 BaseLevelTexture(KTX2);
+	TArray<FglTFRuntimeMipMap> BaseLevelMips;
+	BaseLevelTexture.LoadMips(0, BaseLevelMips, 0, ImagesConfig);
+	TestEqual("BaseLevelMips.Num() == 1", BaseLevelMips.Num(), 1);
+	TestTrue("BaseLevelTexture.RequiresMipGeneration()", BaseLevelTexture.RequiresMipGeneration());
+	FMemory::Memcpy(KTX2.GetData() + 40, &NumLevels, sizeof(uint32));
+
+	// ETC1S data format descriptor with no transcoder bound
+	TArray64<uint8> ETC1SKTX2 = KTX2;
+	ETC1SKTX2[12] = 0;
+	const uint32 DFDOffset = static_cast<uint32>(ETC1SKTX2.Num());
+	const uint32 DFD[] = { 28, 0, 2 | (24 << 16), 163, 0, 0, 0 };
+	ETC1SKTX2.Append(reinterpret_cast<const uint8*>(DFD), sizeof(DFD));
+	const uint32 DFDLength = sizeof(DFD);
+	FMemory::Memcpy(ETC1SKTX2.GetData() + 48, &DFDOffset, sizeof(uint32));
+	FMemory::Memcpy(ETC1SKTX2.GetData() + 52, &DFDLength, sizeof(uint32));
+	FglTFRuntimeKTX2 ETC1STexture(ETC1SKTX2);
+	TArray<FglTFRuntimeMipMap> ETC1SMips;
+	const FglTFRuntimeKTX2Transcoder Transcoder = FglTFRuntimeKTX2::Transcoder;
+	FglTFRuntimeKTX2::Transcoder.Unbind();
+	AddExpectedError("no transcoder bound", EAutomationExpectedErrorFlags::Contains, 1);
+	ETC1STexture.LoadMips(0, ETC1SMips, 0, ImagesConfig);
+	FglTFRuntimeKTX2::Transcoder = Transcoder;
+	TestTrue("ETC1STexture.IsBasisUniversal()", ETC1STexture.IsBasisUniversal());
+	TestEqual("ETC1SMips.Num() == 0", ETC1SMips.Num(), 0);
+
+	// LevelOffset + LevelLength wrapping around
+	TArray64<uint8> WrappingKTX2 = KTX2;
+	const uint64 WrappingLevelOffset = MAX_uint64 - 15;
+	FMemory::Memcpy(WrappingKTX2.GetData() + 80, &WrappingLevelOffset, sizeof(uint64));
+	FglTFRuntimeKTX2 WrappingTexture(WrappingKTX2);
+	TArray<FglTFRuntimeMipMap> WrappingMips;
+	AddExpectedError("Invalid KTX2 level 0", EAutomationExpectedErrorFlags::Contains, 1);
+	WrappingTexture.LoadMips(0, WrappingMips, 0, ImagesConfig);
+	TestEqual("WrappingMips.Num() == 0", WrappingMips.Num(), 0);
+
+	// the same levels with Zstandard supercompression (zstd -19, raw block for the smaller levels)
+	const TArray<TArray<uint8>> ZstdLevels =
+	{
+		{ 0x28, 0xB5, 0x2F, 0xFD, 0x00, 0x68, 0x5D, 0x00, 0x00, 0x28, 0x0A, 0x14, 0x1E, 0x00, 0x0A, 0x01, 0x00, 0xC2, 0xAB, 0x05 },
+		{ 0x28, 0xB5, 0x2F, 0xFD, 0x00, 0x68, 0x41, 0x00, 0x00, 0x0A, 0x14, 0x1E, 0x01, 0x0A, 0x14, 0x1E, 0x01 },
+		{ 0x28, 0xB5, 0x2F, 0xFD, 0x00, 0x68, 0x21, 0x00, 0x00, 0x0A, 0x14, 0x1E, 0x02 }
+	};
+	TArray64<uint8> ZstdKTX2;
+	ZstdKTX2.Append(KTX2.GetData(), 80);
+	const uint32 SupercompressionZstd = 2;
+	FMemory::Memcpy(ZstdKTX2.GetData() + 44, &SupercompressionZstd, sizeof(uint32));
+	LevelOffset = 80 + NumLevels * 24;
+	for (uint32 Level = 0; Level < NumLevels; Level++)
+	{
+		const uint64 LevelIndexEntry[] = { static_cast<uint64>(LevelOffset), static_cast<uint64>(ZstdLevels[Level].Num()), static_cast<uint64>(LevelSizes[Level]) };
+		ZstdKTX2.Append(reinterpret_cast<const uint8*>(LevelIndexEntry), sizeof(LevelIndexEntry));
+		LevelOffset += ZstdLevels[Level].Num();
+	}
+	for (uint32 Level = 0; Level < NumLevels; Level++)
+	{
+		ZstdKTX2.Append(ZstdLevels[Level].GetData(), ZstdLevels[Level].Num());
+	}
+
+	FglTFRuntimeKTX2 ZstdTexture(ZstdKTX2);
+	TArray<FglTFRuntimeMipMap> ZstdMips;
+	ZstdTexture.LoadMips(0, ZstdMips, 0, ImagesConfig);
+	if (!TestEqual("ZstdMips.Num() == 3", ZstdMips.Num(), 3))
+	{
+		return false;
+	}
+	for (int32 Level = 0; Level < static_cast<int32>(NumLevels); Level++)
+	{
+		TestTrue(FString::Printf(TEXT("ZstdMips[%d] == Mips[%d]"), Level, Level), ZstdMips[Level].Pixels == Mips[Level].Pixels);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Basic_TangentsGenerator, "glTFRuntime.UnitTests.Basic.TangentsGenerator", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeTests_Basic_TangentsGenerator::RunTest(const FString& Parameters)
+{
+	// indexed quad (two triangles sharing two vertices), starting from vertex 10
+	const TArray<uint32> Indices = { 10, 11, 12, 12, 11, 13 };
+	const TArray<FVector> Positions = { FVector(0, 0, 0), FVector(1, 0, 0), FVector(0, 1, 0), FVector(1, 1, 0) };
+	const TArray<FVector2D> UVs = { FVector2D(0, 0), FVector2D(1, 0), FVector2D(0, 1), FVector2D(1, 1) };
+
+	const FglTFRuntimeTangentsGenerator TangentsGenerator(Indices);
+	TestEqual("GetFirstVertex() == 10", TangentsGenerator.GetFirstVertex(), 10);
+	TestEqual("GetNumVertices() == 4", TangentsGenerator.GetNumVertices(), 4);
+
+	for (const bool bSmooth : { false, true })
+	{
+		for (const bool bMikkTSpace : { false, true })
+		{
+			TArray<FVector> Normals;
+			Normals.AddZeroed(4);
+			TangentsGenerator.GenerateNormals(Positions, Normals, bSmooth, bMikkTSpace);
+
+			TArray<FVector4> Tangents;
+			Tangents.AddZeroed(4);
+			TangentsGenerator.GenerateTangents(Positions, UVs, Normals, Tangents, bMikkTSpace);
+
+			for (int32 VertexIndex = 0; VertexIndex < 4; VertexIndex++)
+			{
+				TestTrue(FString::Printf(TEXT("Normals[%d] == (0, 0, -1)"), VertexIndex), Normals[VertexIndex].Equals(FVector(0, 0, -1), KINDA_SMALL_NUMBER));
+				TestTrue(FString::Printf(TEXT("Tangents[%d] == (1, 0, 0)"), VertexIndex), FVector(Tangents[VertexIndex]).Equals(FVector(1, 0, 0), KINDA_SMALL_NUMBER));
+				TestEqual(FString::Printf(TEXT("Tangents[%d].W == 1"), VertexIndex), static_cast<float>(Tangents[VertexIndex].W), 1.0f);
+			}
+		}
+	}
+
+	// folded quad: the shared edge gets the first triangle normal when flat, the area weighted average when smooth
+	const TArray<uint32> FoldedIndices = { 0, 1, 2, 2, 1, 3 };
+	const TArray<FVector> FoldedPositions = { FVector(0, 0, 0), FVector(1, 0, 0), FVector(0, 1, 0), FVector(1, 0, 1) };
+	const FglTFRuntimeTangentsGenerator FoldedTangentsGenerator(FoldedIndices);
+
+	const FVector FirstNormal = FVector(0, 0, -1);
+	const FVector SecondNormal = FVector(1, 1, 0).GetSafeNormal();
+
+	TArray<FVector> FlatNormals;
+	FlatNormals.AddZeroed(4);
+	FoldedTangentsGenerator.GenerateNormals(FoldedPositions, FlatNormals, false, false);
+	TestTrue("FlatNormals[0] is the first triangle normal", FlatNormals[0].Equals(FirstNormal, KINDA_SMALL_NUMBER));
+	TestTrue("FlatNormals[1] is the first triangle normal", FlatNormals[1].Equals(FirstNormal, KINDA_SMALL_NUMBER));
+	TestTrue("FlatNormals[2] is the first triangle normal", FlatNormals[2].Equals(FirstNormal, KINDA_SMALL_NUMBER));
+	TestTrue("FlatNormals[3] is the second triangle normal", FlatNormals[3].Equals(SecondNormal, KINDA_SMALL_NUMBER));
+
+	TArray<FVector> SmoothNormals;
+	SmoothNormals.AddZeroed(4);
+	FoldedTangentsGenerator.GenerateNormals(FoldedPositions, SmoothNormals, true, false);
+	TestTrue("SmoothNormals[0] is the first triangle normal", SmoothNormals[0].Equals(FirstNormal, KINDA_SMALL_NUMBER));
+	TestTrue("SmoothNormals[1] is the area weighted average", SmoothNormals[1].Equals(FVector(1, 1, -1).GetSafeNormal(), KINDA_SMALL_NUMBER));
+	TestTrue("SmoothNormals[2] is the area weighted average", SmoothNormals[2].Equals(FVector(1, 1, -1).GetSafeNormal(), KINDA_SMALL_NUMBER));
+	TestTrue("SmoothNormals[3] is the second triangle normal", SmoothNormals[3].Equals(SecondNormal, KINDA_SMALL_NUMBER));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Basic_CapsuleFitter, "glTFRuntime.UnitTests.Basic.CapsuleFitter", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeTests_Basic_CapsuleFitter::RunTest(const FString& Parameters)
+{
+	// two rings (radius 10) at -50 and 50 along a diagonal axis, moved away from the origin
+	const FVector Axis = FVector(1, 1, 0).GetSafeNormal();
+	const FVector Side = FVector(1, -1, 0).GetSafeNormal();
+	const FVector Offset = FVector(5, -3, 20);
+
+	TArray<FVector> Positions;
+	for (const float T : { -50.0f, 50.0f })
+	{
+		for (const FVector& RingDirection : { Side, FVector::UpVector, -Side, FVector::DownVector })
+		{
+			Positions.Add(Offset + Axis * T + RingDirection * 10);
+		}
+	}
+
+	FglTFRuntimeCapsule Capsule;
+	TestTrue("FglTFRuntimeCapsuleFitter::Fit()", FglTFRuntimeCapsuleFitter::Fit(Positions, Capsule));
+	TestTrue("Capsule.Center == Offset", Capsule.Center.Equals(Offset, KINDA_SMALL_NUMBER));
+	TestTrue("Capsule.Radius == 10", FMath::IsNearlyEqual(Capsule.Radius, 10.0f, KINDA_SMALL_NUMBER));
+	// Length does not include the caps, the caps centers are on the rings
+	TestTrue("Capsule.Length == 100", FMath::IsNearlyEqual(Capsule.Length, 100.0f, KINDA_SMALL_NUMBER));
+	const FVector CapsuleAxis = FRotationMatrix(Capsule.Rotation).GetUnitAxis(EAxis::Z);
+	TestTrue("Capsule Z axis is the rings axis", FMath::IsNearlyEqual(FMath::Abs(static_cast<float>(FVector::DotProduct(CapsuleAxis, Axis))), 1.0f, KINDA_SMALL_NUMBER));
+
+	auto ContainsAll = [](const FglTFRuntimeCapsule& InCapsule, const TArray<FVector>& InPositions)
+		{
+			const FVector HalfSegment = FRotationMatrix(InCapsule.Rotation).GetUnitAxis(EAxis::Z) * (InCapsule.Length * 0.5);
+			for (const FVector& Position : InPositions)
+			{
+				const FVector Closest = FMath::ClosestPointOnSegment(Position, InCapsule.Center - HalfSegment, InCapsule.Center + HalfSegment);
+				if (FVector::Dist(Position, Closest) > InCapsule.Radius + 0.01f)
+				{
+					return false;
+				}
+			}
+			return true;
+		};
+
+	TestTrue("Capsule contains every position", ContainsAll(Capsule, Positions));
+
+	// a tapered shape, the narrow end ring and the tip are both past the widest ring radius
+	TArray<FVector> TaperedPositions;
+	for (const FVector& RingDirection : { Side, FVector::UpVector, -Side, FVector::DownVector })
+	{
+		TaperedPositions.Add(Offset + Axis * -50 + RingDirection * 10);
+		TaperedPositions.Add(Offset + Axis * 50 + RingDirection * 6);
+	}
+	TaperedPositions.Add(Offset + Axis * 56);
+
+	FglTFRuntimeCapsule TaperedCapsule;
+	TestTrue("FglTFRuntimeCapsuleFitter::Fit() with a tapered shape", FglTFRuntimeCapsuleFitter::Fit(TaperedPositions, TaperedCapsule));
+	TestTrue("TaperedCapsule contains every position", ContainsAll(TaperedCapsule, TaperedPositions));
+
+	// partial fitters (like the per chunk ones of the skeletal meshes) give the same capsule
+	FglTFRuntimeCapsuleFitter Fitter;
+	FglTFRuntimeCapsuleFitter SecondFitter;
+	for (int32 PositionIndex = 0; PositionIndex < Positions.Num(); PositionIndex++)
+	{
+		(PositionIndex % 2 ? SecondFitter : Fitter).Add(Positions[PositionIndex]);
+	}
+	Fitter.Merge(SecondFitter);
+	TestTrue("Fitter.ComputeAxis()", Fitter.ComputeAxis(FVector::ForwardVector));
+
+	SecondFitter = Fitter;
+	for (int32 PositionIndex = 0; PositionIndex < Positions.Num(); PositionIndex++)
+	{
+		(PositionIndex % 2 ? SecondFitter : Fitter).AddExtent(Positions[PositionIndex]);
+	}
+	Fitter.MergeExtents(SecondFitter);
+
+	const FglTFRuntimeCapsule MergedCapsule = Fitter.GetCapsule();
+	TestTrue("MergedCapsule.Center == Capsule.Center", MergedCapsule.Center.Equals(Capsule.Center, KINDA_SMALL_NUMBER));
+	TestTrue("MergedCapsule.Radius == Capsule.Radius", FMath::IsNearlyEqual(MergedCapsule.Radius, Capsule.Radius, KINDA_SMALL_NUMBER));
+	TestTrue("MergedCapsule.Length == Capsule.Length", FMath::IsNearlyEqual(MergedCapsule.Length, Capsule.Length, KINDA_SMALL_NUMBER));
+
+	// a single position has no axis
+	const TArray<FVector> SinglePosition = { Offset };
+	TestFalse("FglTFRuntimeCapsuleFitter::Fit() with a single position", FglTFRuntimeCapsuleFitter::Fit(SinglePosition, Capsule));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Basic_SampleTimeline, "glTFRuntime.UnitTests.Basic.SampleTimeline", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeTests_Basic_SampleTimeline::RunTest(const FString& Parameters)
+{
+	// timeline not starting at 0, frames at 0, 0.25, 0.5, 0.75 and 1 (relative)
+	const TArray<float> Timeline = { 1, 1.5f, 1.75f };
+
+	TArray<FglTFRuntimeAnimationFrameSample> Samples;
+	FglTFRuntimeParser::SampleTimeline(Timeline, 5, 0.25f, Samples);
+
+	TestEqual("Samples.Num() == 5", Samples.Num(), 5);
+	TestTrue("Samples[0] is key 0", Samples[0].FirstIndex == 0 && Samples[0].SecondIndex == 0);
+	TestTrue("Samples[1] is between key 0 and 1", Samples[1].FirstIndex == 0 && Samples[1].SecondIndex == 1 && FMath::IsNearlyEqual(Samples[1].Alpha, 0.5f));
+	TestTrue("Samples[2] is key 1", Samples[2].FirstIndex == 1 && Samples[2].SecondIndex == 1);
+	TestTrue("Samples[3] is key 2", Samples[3].FirstIndex == 2 && Samples[3].SecondIndex == 2);
+	// past the end the last two keys are extrapolated
+	TestTrue("Samples[4] is after key 2", Samples[4].FirstIndex == 1 && Samples[4].SecondIndex == 2 && FMath::IsNearlyEqual(Samples[4].Alpha, 2.0f));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Basic_BakedAnimationCurve, "glTFRuntime.UnitTests.Basic.BakedAnimationCurve", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeTests_Basic_BakedAnimationCurve::RunTest(const FString& Parameters)
+{
+	const FMatrix SceneBasis = FglTFRuntimeConfig().GetMatrix();
+
+	UglTFRuntimeAnimationCurve* AnimationCurve = NewObject<UglTFRuntimeAnimationCurve>();
+	AnimationCurve->SetDefaultValues(FVector(1, 2, 3), FQuat::Identity, FRotator::ZeroRotator, FVector(1, 2, 1));
+	AnimationCurve->BasisMatrix = SceneBasis;
+	AnimationCurve->glTFCurveAnimationDuration = 2;
+
+	// translation and rotation on different timelines, scale not animated
+	AnimationCurve->AddLocationValue(0, FVector(0, 0, 0), ERichCurveInterpMode::RCIM_Linear);
+	AnimationCurve->AddLocationValue(1, FVector(100, 0, 50), ERichCurveInterpMode::RCIM_Linear);
+	AnimationCurve->AddLocationValue(2, FVector(0, 200, 0), ERichCurveInterpMode::RCIM_Linear);
+	for (int32 KeyIndex = 0; KeyIndex < 5; KeyIndex++)
+	{
+		const FQuat Quat = FQuat(FVector(0, 1, 0), KeyIndex * 0.4f);
+		AnimationCurve->AddQuatValue(KeyIndex * 0.5f, Quat, ERichCurveInterpMode::RCIM_Linear);
+		AnimationCurve->AddConvertedQuaternion(KeyIndex * 0.5f, (SceneBasis.Inverse() * FQuatRotationMatrix(Quat) * SceneBasis).ToQuat().GetNormalized(), false);
+	}
+
+	TestFalse("AnimationCurve->IsBaked()", AnimationCurve->IsBaked());
+	AnimationCurve->Bake();
+	TestTrue("AnimationCurve->IsBaked()", AnimationCurve->IsBaked());
+
+	const FglTFRuntimeBakedAnimationCurve& BakedCurve = AnimationCurve->GetBakedCurve();
+	TestEqual("BakedCurve.Locations.Times.Num() == 3", BakedCurve.Locations.Times.Num(), 3);
+	TestEqual("BakedCurve.Rotations.Times.Num() == 5", BakedCurve.Rotations.Times.Num(), 5);
+	TestEqual("BakedCurve.Scales.Times.Num() == 1", BakedCurve.Scales.Times.Num(), 1);
+
+	// forward playback (cursor hits) and then a jump back (search)
+	FglTFRuntimeBakedAnimationCursor Cursor;
+	for (const float Time : { 0.0f, 0.1f, 0.6f, 0.75f, 1.0f, 1.3f, 2.0f, 2.5f, 0.2f, 1.9f })
+	{
+		const FTransform Expected = AnimationCurve->GetTransformValue(Time);
+		const FTransform Transform = BakedCurve.Evaluate(Time, Cursor);
+		TestTrue(FString::Printf(TEXT("Transform at %f"), Time), Transform.Equals(Expected, 0.001f));
+	}
+
+	// adding values invalidates the baked curve
+	AnimationCurve->AddScaleValue(1, FVector(2, 2, 2), ERichCurveInterpMode::RCIM_Linear);
+	TestFalse("AnimationCurve->IsBaked()", AnimationCurve->IsBaked());
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Basic_AnimationCompressionLargeRange, "glTFRuntime.UnitTests.Basic.AnimationCompressionLargeRange", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeTests_Basic_AnimationCompressionLargeRange::RunTest(const FString& Parameters)
+{
+	const int32 NumFrames = 200;
+	const float TranslationTolerance = 0.01f;
+
+	// track 0 travels 5000 units (a 16 bit step is ~0.076 there), track 1 stays within a few units
+	UglTFAnimBoneCompressionCodec* RawCodec = NewObject<UglTFAnimBoneCompressionCodec>();
+	RawCodec->Tracks.AddDefaulted(2);
+	for (int32 FrameIndex = 0; FrameIndex < NumFrames; FrameIndex++)
+	{
+		const float Phase = 2 * PI * FrameIndex / (NumFrames - 1);
+		RawCodec->Tracks[0].PosKeys.Emplace(FVector(5000.0f * FrameIndex / (NumFrames - 1), FMath::Sin(Phase) * 30.0f, 0.123f));
+		RawCodec->Tracks[1].PosKeys.Emplace(FVector(FMath::Sin(Phase) * 3.0f, 0, 1));
+		for (FRawAnimSequenceTrack& Track : RawCodec->Tracks)
+		{
+			Track.RotKeys.Emplace(FQuat::Identity);
+			Track.ScaleKeys.Emplace(FVector::OneVector);
+		}
+	}
+
+	UglTFAnimBoneCompressionCodec* Codec = NewObject<UglTFAnimBoneCompressionCodec>();
+	Codec->Tracks = RawCodec->Tracks;
+	if (!TestTrue("Codec->CompressTracks()", Codec->CompressTracks(TranslationTolerance, 0.05f, 0.0001f)))
+	{
+		return false;
+	}
+
+	// every frame (retained keys included) must be within the tolerance
+	for (int32 TrackIndex = 0; TrackIndex < 2; TrackIndex++)
+	{
+		float MaxError = 0;
+		for (int32 FrameIndex = 0; FrameIndex < NumFrames; FrameIndex++)
+		{
+			const float RelativePos = static_cast<float>(FrameIndex) / (NumFrames - 1);
+			MaxError = FMath::Max(MaxError, static_cast<float>(FVector::Distance(Codec->GetTrackLocation(TrackIndex, RelativePos, EAnimInterpolationType::Linear), RawCodec->GetTrackLocation(TrackIndex, RelativePos, EAnimInterpolationType::Linear))));
+		}
+		TestTrue(FString::Printf(TEXT("Track %d translation error %f"), TrackIndex, MaxError), MaxError <= TranslationTolerance);
+	}
+
+	TestTrue("Codec->GetCompressedSize() < Codec->GetRawSize()", Codec->GetCompressedSize() < Codec->GetRawSize());
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Basic_NodeAnimationSubsystem, "glTFRuntime.UnitTests.Basic.NodeAnimationSubsystem", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeTests_Basic_NodeAnimationSubsystem::RunTest(const FString& Parameters)
+{
+	// enough animations for the parallel batch
+	const int32 NumActors = 40;
+	const float DeltaTime = 0.25f;
+
+	glTFRuntime::Tests::FTransientWorld TransientWorld;
+	UglTFRuntimeNodeAnimationSubsystem* Subsystem = TransientWorld.World->GetSubsystem<UglTFRuntimeNodeAnimationSubsystem>();
+	if (!TestNotNull("Subsystem", Subsystem))
+	{
+		return false;
+	}
+
+	UglTFRuntimeAnimationCurve* MovingCurve = NewObject<UglTFRuntimeAnimationCurve>();
+	MovingCurve->SetDefaultValues(FVector::ZeroVector, FQuat::Identity, FRotator::ZeroRotator, FVector::OneVector);
+	MovingCurve->BasisMatrix = FglTFRuntimeConfig().GetMatrix();
+	MovingCurve->glTFCurveAnimationDuration = 1;
+	MovingCurve->AddLocationValue(0, FVector(0, 0, 0), ERichCurveInterpMode::RCIM_Linear);
+	MovingCurve->AddLocationValue(1, FVector(100, 0, 0), ERichCurveInterpMode::RCIM_Linear);
+
+	UglTFRuntimeAnimationCurve* StillCurve = NewObject<UglTFRuntimeAnimationCurve>();
+	StillCurve->SetDefaultValues(FVector::ZeroVector, FQuat::Identity, FRotator::ZeroRotator, FVector::OneVector);
+	StillCurve->BasisMatrix = MovingCurve->BasisMatrix;
+	StillCurve->glTFCurveAnimationDuration = 1;
+	StillCurve->AddLocationValue(0, FVector(0, 50, 0), ERichCurveInterpMode::RCIM_Linear);
+
+	// every actor has a moving and a still node, the first one runs at double speed, the second one does not tick
+	TArray<AActor*> Actors;
+	TArray<USceneComponent*> MovingComponents;
+	TArray<USceneComponent*> StillComponents;
+	for (int32 ActorIndex = 0; ActorIndex < NumActors; ActorIndex++)
+	{
+		AActor* Actor = TransientWorld.World->SpawnActor<AActor>();
+		Actor->PrimaryActorTick.bCanEverTick = true;
+		Actor->SetActorTickEnabled(ActorIndex != 1);
+		Actor->CustomTimeDilation = ActorIndex == 0 ? 2 : 1;
+
+		USceneComponent* MovingComponent = NewObject<USceneComponent>(Actor);
+		MovingComponent->RegisterComponent();
+		USceneComponent* StillComponent = NewObject<USceneComponent>(Actor);
+		StillComponent->RegisterComponent();
+
+		TMap<USceneComponent*, UglTFRuntimeAnimationCurve*> NodeAnimations;
+		NodeAnimations.Add(MovingComponent, MovingCurve);
+		NodeAnimations.Add(StillComponent, StillCurve);
+		Subsystem->RegisterNodeAnimations(Actor, NodeAnimations);
+
+		Actors.Add(Actor);
+		MovingComponents.Add(MovingComponent);
+		StillComponents.Add(StillComponent);
+	}
+
+	TestEqual("GetNumNodeAnimations() == NumActors * 2", Subsystem->GetNumNodeAnimations(), NumActors * 2);
+	TestTrue("MovingCurve->IsBaked()", MovingCurve->IsBaked());
+
+	auto Evaluate = [](UglTFRuntimeAnimationCurve* AnimationCurve, const float Time)
+		{
+			FglTFRuntimeBakedAnimationCursor Cursor;
+			return AnimationCurve->GetBakedCurve().Evaluate(Time, Cursor);
+		};
+
+	// the first tick evaluates the animations at 0
+	Subsystem->Tick(DeltaTime);
+	TestTrue("StillComponents[2] moved", StillComponents[2]->GetRelativeTransform().Equals(Evaluate(StillCurve, 0), 0.001f));
+
+	// unchanged transforms are not applied again
+	StillComponents[2]->SetRelativeLocation(FVector(999, 0, 0));
+
+	Subsystem->Tick(DeltaTime);
+	TestTrue("MovingComponents[0] at 0.5 (time dilation)", MovingComponents[0]->GetRelativeTransform().Equals(Evaluate(MovingCurve, DeltaTime * 2), 0.001f));
+	TestTrue("MovingComponents[1] did not move (tick disabled)", MovingComponents[1]->GetRelativeTransform().Equals(FTransform::Identity, 0.001f));
+	bool bAllMoved = true;
+	for (int32 ActorIndex = 2; ActorIndex < NumActors; ActorIndex++)
+	{
+		bAllMoved &= MovingComponents[ActorIndex]->GetRelativeTransform().Equals(Evaluate(MovingCurve, DeltaTime), 0.001f);
+	}
+	TestTrue("MovingComponents at 0.25", bAllMoved);
+	TestEqual("StillComponents[2] location not applied again", StillComponents[2]->GetRelativeLocation(), FVector(999, 0, 0));
+
+	// explicit unregistration and destroyed actors
+	Subsystem->UnregisterNodeAnimations(Actors[2]);
+	TestEqual("GetNumNodeAnimations() after UnregisterNodeAnimations()", Subsystem->GetNumNodeAnimations(), (NumActors - 1) * 2);
+
+	Actors[3]->Destroy();
+	Subsystem->Tick(DeltaTime);
+	TestEqual("GetNumNodeAnimations() after Destroy()", Subsystem->GetNumNodeAnimations(), (NumActors - 2) * 2);
+	TestTrue("MovingComponents[2] not animated after UnregisterNodeAnimations()", MovingComponents[2]->GetRelativeTransform().Equals(Evaluate(MovingCurve, DeltaTime), 0.001f));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Basic_Base64, "glTFRuntime.UnitTests.Basic.Base64", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeTests_Basic_Base64::RunTest(const FString& Parameters)
+{
+	FRandomStream RandomStream(25);
+
+	// every tail (vector blocks, scalar quartets, padding) and a parallel chunked payload
+	for (const int32 Len : { 0, 1, 2, 3, 11, 12, 13, 47, 48, 49, 100, 1000, 2 * 1024 * 1024 + 1 })
+	{
+		TArray<uint8> Bytes;
+		Bytes.AddUninitialized(Len);
+		for (int32 ByteIndex = 0; ByteIndex < Len; ByteIndex++)
+		{
+			Bytes[ByteIndex] = static_cast<uint8>(RandomStream.RandHelper(256));
+		}
+
+		const FString Encoded = FBase64::Encode(Bytes);
+		TestEqual(FString::Printf(TEXT("GetDecodedSize(%d)"), Len), FglTFRuntimeBase64::GetDecodedSize(*Encoded, Encoded.Len()), static_cast<int64>(Len));
+
+		TArray64<uint8> Decoded;
+		TestTrue(FString::Printf(TEXT("Decode(%d)"), Len), FglTFRuntimeBase64::Decode(*Encoded, Encoded.Len(), Decoded));
+		TestTrue(FString::Printf(TEXT("Decoded(%d) == Bytes"), Len), Decoded.Num() == Len && FMemory::Memcmp(Decoded.GetData(), Bytes.GetData(), Len) == 0);
+
+		// missing padding
+		FString Unpadded = Encoded;
+		Unpadded.RemoveFromEnd(TEXT("="));
+		Unpadded.RemoveFromEnd(TEXT("="));
+		Decoded.Empty();
+		TestTrue(FString::Printf(TEXT("Decode(%d) unpadded"), Len), FglTFRuntimeBase64::Decode(*Unpadded, Unpadded.Len(), Decoded) && Decoded.Num() == Len);
+
+		// invalid characters in the vector and the scalar parts
+		if (Len > 48)
+		{
+			for (const int32 CharIndex : { 5, Encoded.Len() - 6 })
+			{
+				for (const TCHAR InvalidChar : { TCHAR('*'), TCHAR('='), TCHAR(0x141) })
+				{
+					FString Invalid = Encoded;
+					Invalid[CharIndex] = InvalidChar;
+					Decoded.Empty();
+					TestFalse(FString::Printf(TEXT("Decode(%d) with invalid char at %d"), Len, CharIndex), FglTFRuntimeBase64::Decode(*Invalid, Invalid.Len(), Decoded));
+					TestEqual(TEXT("Decoded.Num() == 0"), Decoded.Num(), static_cast<int64>(0));
+				}
+			}
+		}
+	}
+
+	TestEqual("GetDecodedSize(\"QUJDR\")", FglTFRuntimeBase64::GetDecodedSize(TEXT("QUJDR"), 5), static_cast<int64>(-1));
+	TestEqual("GetDecodedSize(\"QQ=\")", FglTFRuntimeBase64::GetDecodedSize(TEXT("QQ="), 3), static_cast<int64>(-1));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Basic_Zstd, "glTFRuntime.UnitTests.Basic.Zstd", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeTests_Basic_Zstd::RunTest(const FString& Parameters)
+{
+	// zstd -19 of "glTFRuntime " x 64, a skippable frame, zstd -19 of 1024 bytes (16 times each byte from 0 to 63)
+	const uint8 Compressed[] =
+	{
+		0x28, 0xB5, 0x2F, 0xFD, 0x64, 0x00, 0x02, 0x9D, 0x00, 0x00, 0x60, 0x67, 0x6C, 0x54, 0x46, 0x52,
+		0x75, 0x6E, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x01, 0x00, 0xF1, 0x5E, 0x95, 0x24, 0x0E, 0xE2, 0xC2,
+		0x88, 0x50, 0x2A, 0x4D, 0x18, 0x04, 0x00, 0x00, 0x00, 0x75, 0x73, 0x65, 0x72, 0x28, 0xB5, 0x2F,
+		0xFD, 0x64, 0x00, 0x03, 0x85, 0x02, 0x00, 0x14, 0x04, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+		0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
+		0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26,
+		0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36,
+		0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x3E, 0x3F, 0x3F, 0x40, 0x98, 0x10, 0xF0, 0x07, 0x00,
+		0x10, 0xFE, 0xC4, 0x0F, 0xD5, 0x77, 0x01, 0x04, 0xC9, 0xC9, 0x6F,
+	};
+
+	TArray64<uint8> Expected;
+	for (int32 Index = 0; Index < 64; Index++)
+	{
+		Expected.Append(reinterpret_cast<const uint8*>("glTFRuntime "), 12);
+	}
+	for (int32 Index = 0; Index < 1024; Index++)
+	{
+		Expected.Add(static_cast<uint8>(Index / 16));
+	}
+
+	TestTrue("IsFrame()", FglTFRuntimeZstd::IsFrame(Compressed, sizeof(Compressed)));
+
+	TArray<FglTFRuntimeZstdFrame> Frames;
+	TestTrue("GetFrames()", FglTFRuntimeZstd::GetFrames(Compressed, sizeof(Compressed), Frames));
+	TestEqual("Frames.Num()", Frames.Num(), 2);
+	TestEqual("GetContentSize()", FglTFRuntimeZstd::GetContentSize(Compressed, sizeof(Compressed)), Expected.Num());
+
+	TArray64<uint8> Decompressed;
+	TestTrue("Decompress()", FglTFRuntimeZstd::Decompress(Compressed, sizeof(Compressed), Decompressed));
+	TestTrue("Decompressed == Expected", Decompressed == Expected);
+
+	AddExpectedError("Unable to decompress Zstandard data", EAutomationExpectedErrorFlags::Contains, 0);
+
+	TestFalse("Decompress() with a smaller output", FglTFRuntimeZstd::Decompress(Compressed, sizeof(Compressed), Decompressed.GetData(), Decompressed.Num() - 1));
+	TestFalse("Decompress() truncated", FglTFRuntimeZstd::Decompress(Compressed, sizeof(Compressed) - 10, Decompressed.GetData(), Decompressed.Num()));
+
+	TArray64<uint8> Larger;
+	Larger.AddZeroed(Expected.Num() + 1);
+	TestFalse("Decompress() with a larger output", FglTFRuntimeZstd::Decompress(Compressed, sizeof(Compressed), Larger.GetData(), Larger.Num()));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Basic_Deflate64, "glTFRuntime.UnitTests.Basic.Deflate64", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeTests_Basic_Deflate64::RunTest(const FString& Parameters)
+{
+	// stored, fixed and dynamic blocks, with a 40000 bytes match (length code 285) and a 40064 bytes distance (distance code 30)
+	const uint8 Compressed[] =
+	{
+		0x62, 0x50, 0xF5, 0xCA, 0x9F, 0xB2, 0xF3, 0x1E, 0xB3, 0x86, 0x6F, 0xD1, 0xF4, 0x3D, 0x0F, 0xD9,
+		0xB4, 0x03, 0x4A, 0x67, 0xED, 0x7F, 0xC2, 0xA9, 0x07, 0x20, 0x00, 0x0E, 0x2C, 0x00, 0x00, 0x81,
+		0x00, 0x00, 0x2E, 0x10, 0xD1, 0x26, 0x11, 0x0D, 0x12, 0x11, 0x0D, 0x12, 0x11, 0x0D, 0x12, 0xF1,
+		0x9B, 0x3C, 0xCF, 0x6F, 0xF2, 0x3C, 0xBF, 0xC3, 0x5F, 0x5B, 0x0F, 0x25, 0xE4, 0xBE, 0x3F, 0x69,
+		0x2C, 0xE3, 0x00, 0x5B, 0xAA, 0xF3, 0x3A, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xED, 0xDE, 0x41, 0x09,
+		0x00, 0x20, 0x0C, 0x00, 0x40, 0x4B, 0x08, 0x82, 0x4D, 0x04, 0x1F, 0x26, 0x11, 0xCC, 0x22, 0xD8,
+		0x44, 0x10, 0x6C, 0x32, 0x18, 0xAC, 0xC9, 0x60, 0xB0, 0xF7, 0x42, 0xEC, 0xBB, 0x4B, 0x72, 0x17,
+		0x38, 0xB7, 0xB9, 0x1F, 0x4A, 0xE9, 0xEB, 0x7C, 0xD2, 0x9A, 0xA2, 0x87, 0x93, 0xF3, 0x1F, 0x37,
+		0x82, 0x76, 0x81, 0x01,
+	};
+
+	TArray64<uint8> Pattern;
+	for (int32 Index = 0; Index < 64; Index++)
+	{
+		Pattern.Add(static_cast<uint8>(Index * 37));
+	}
+
+	TArray64<uint8> Expected = Pattern;
+	Expected.AddZeroed(40000);
+	Expected.Append(Pattern);
+	for (int32 Index = 0; Index < 3000; Index++)
+	{
+		Expected.Add('A');
+	}
+
+	TArray64<uint8> Inflated;
+	Inflated.AddZeroed(Expected.Num());
+	TestTrue("Inflate()", FglTFRuntimeDeflate64::Inflate(Compressed, sizeof(Compressed), Inflated.GetData(), Inflated.Num()));
+	TestTrue("Inflated == Expected", Inflated == Expected);
+
+	AddExpectedError("Invalid Deflate64 stream", EAutomationExpectedErrorFlags::Contains, 0);
+
+	TestFalse("Inflate() with a smaller output", FglTFRuntimeDeflate64::Inflate(Compressed, sizeof(Compressed), Inflated.GetData(), Inflated.Num() - 1));
+	TestFalse("Inflate() truncated", FglTFRuntimeDeflate64::Inflate(Compressed, sizeof(Compressed) - 12, Inflated.GetData(), Inflated.Num()));
+
+	return true;
+}
+
 #endif
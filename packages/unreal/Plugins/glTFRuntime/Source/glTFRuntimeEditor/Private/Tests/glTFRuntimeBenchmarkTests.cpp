@@ -0,0 +1,1799 @@
+// Copyright 2025 - Roberto De Ioris
+
+#if WITH_DEV_AUTOMATION_TESTS
+#include "glTFRuntimeEditor.h"
+#include "glTFAnimBoneCompressionCodec.h"
+#include "glTFRuntimeAnimationCurve.h"
+#include "glTFRuntimeAccessorDecoders.h"
+#include "glTFRuntimeAsset.h"
+#include "glTFRuntimeBase64.h"
+#include "glTFRuntimeLZ4.h"
+#include "glTFRuntimeNodeAnimationSubsystem.h"
+#include "glTFRuntimeParser.h"
+#include "glTFRuntimeTextureCompressor.h"
+#include "glTFRuntimeZstd.h"
+#include "Components/SceneComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/Compression.h"
+#include "Misc/Crc.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/Base64.h"
+
+namespace glTFRuntime
+{
+	namespace Tests
+	{
+		// every accessor points to the same vec3 float, we are only interested in the lookup cost
+		FString BuildAccessorsBenchmarkJson(const int32 NumAccessors)
+		{
+			FString Json = TEXT("{\"asset\":{\"version\":\"2.0\"},");
+			Json += TEXT("\"buffers\":[{\"byteLength\":12,\"uri\":\"data:application/octet-stream;base64,AAAAAAAAAAAAAAAA\"}],");
+			Json += TEXT("\"bufferViews\":[{\"buffer\":0,\"byteLength\":12}],");
+			Json += TEXT("\"accessors\":[");
+			for (int32 AccessorIndex = 0; AccessorIndex < NumAccessors; AccessorIndex++)
+			{
+				if (AccessorIndex > 0)
+				{
+					Json += TEXT(",");
+				}
+				Json += TEXT("{\"bufferView\":0,\"componentType\":5126,\"count\":1,\"type\":\"VEC3\"}");
+			}
+			Json += TEXT("]}");
+			return Json;
+		}
+
+		// GLB with a json chunk and a BIN chunk of BinarySize bytes (filled by the caller)
+		TArray64<uint8> BuildGLBBlob(const FString& Json, const int64 BinarySize, uint8*& BinaryChunk)
+		{
+			auto UTF8Json = StringCast<UTF8CHAR>(*Json);
+
+			const uint32 JsonChunkSize = static_cast<uint32>(Align(UTF8Json.Length(), 4));
+			const uint32 BinaryChunkSize = static_cast<uint32>(Align(BinarySize, 4));
+
+			TArray64<uint8> Blob;
+			Blob.AddUninitialized(12 + 8 + JsonChunkSize + 8 + BinaryChunkSize);
+
+			uint32* Header = reinterpret_cast<uint32*>(Blob.GetData());
+			Header[0] = 0x46546C67;
+			Header[1] = 2;
+			Header[2] = static_cast<uint32>(Blob.Num());
+			Header[3] = JsonChunkSize;
+			Header[4] = 0x4E4F534A;
+
+			uint8* JsonChunk = Blob.GetData() + 20;
+			FMemory::Memset(JsonChunk, ' ', JsonChunkSize);
+			FMemory::Memcpy(JsonChunk, UTF8Json.Get(), UTF8Json.Length());
+
+			uint32* BinaryHeader = reinterpret_cast<uint32*>(JsonChunk + JsonChunkSize);
+			BinaryHeader[0] = BinaryChunkSize;
+			BinaryHeader[1] = 0x004E4942;
+
+			BinaryChunk = JsonChunk + JsonChunkSize + 8;
+			FMemory::Memzero(BinaryChunk, BinaryChunkSize);
+
+			return Blob;
+		}
+
+		// minimal GLB with a json chunk and a BIN chunk of BinarySize bytes (filled with a known pattern)
+		TArray64<uint8> BuildGLBBenchmarkBlob(const int64 BinarySize)
+		{
+			uint8* BinaryChunk = nullptr;
+			TArray64<uint8> Blob = BuildGLBBlob(FString::Printf(TEXT("{\"asset\":{\"version\":\"2.0\"},\"buffers\":[{\"byteLength\":%lld}]}"), BinarySize), BinarySize, BinaryChunk);
+			for (int64 Index = 0; Index < Align(BinarySize, 4); Index++)
+			{
+				BinaryChunk[Index] = static_cast<uint8>(Index * 31);
+			}
+
+			return Blob;
+		}
+
+		// the pre-specialization decoding strategy (type-erased per-element function + per-element ParallelFor), used as baseline
+		template<typename T, typename Callback>
+		void LegacyDecodeFloatVectors(const uint8* Data, const int64 Stride, const int64 Elements, const int64 Count, TArray<T>& Out, Callback Filter)
+		{
+			TFunction<void(const int64 Elements, const int64 Index, T& Value)> ComponentFunction = [Data](const int64 Elements, const int64 Index, T& Value)
+				{
+					const float* Ptr = (const float*)&(Data[Index]);
+					for (int32 i = 0; i < Elements; i++)
+					{
+						Value[i] = Ptr[i];
+					}
+				};
+
+			Out.AddUninitialized(Count);
+			ParallelFor(Count, [&](const int64 ElementIndex)
+				{
+					T Value;
+					ComponentFunction(Elements, ElementIndex * Stride, Value);
+					Out[ElementIndex] = Filter(Value);
+				});
+		}
+
+		// LZ4 frame (independent 64KB blocks, with content size and all the checksums) built with the engine LZ4 block compressor
+		TArray64<uint8> BuildLZ4BenchmarkFrame(const TArray64<uint8>& Content)
+		{
+			const int64 BlockMaxSize = 64 * 1024;
+
+			TArray64<uint8> Frame;
+			auto AppendUInt32 = [&Frame](const uint32 Value) { Frame.Append(reinterpret_cast<const uint8*>(&Value), 4); };
+
+			AppendUInt32(0x184D2204);
+			// version 01, independent blocks, block checksum, content size, content checksum
+			Frame.Add(0x40 | 0x20 | 0x10 | 0x08 | 0x04);
+			// 64KB blocks
+			Frame.Add(0x40);
+			const uint64 ContentSize = Content.Num();
+			Frame.Append(reinterpret_cast<const uint8*>(&ContentSize), 8);
+			Frame.Add((FglTFRuntimeLZ4::XXH32(Frame.GetData() + 4, 10) >> 8) & 0xFF);
+
+			TArray<uint8> CompressedBlock;
+			CompressedBlock.AddUninitialized(FCompression::CompressMemoryBound(NAME_LZ4, BlockMaxSize));
+
+			for (int64 BlockStart = 0; BlockStart < Content.Num(); BlockStart += BlockMaxSize)
+			{
+				const int32 BlockSize = static_cast<int32>(FMath::Min<int64>(BlockMaxSize, Content.Num() - BlockStart));
+				int32 CompressedSize = CompressedBlock.Num();
+				if (FCompression::CompressMemory(NAME_LZ4, CompressedBlock.GetData(), CompressedSize, Content.GetData() + BlockStart, BlockSize) && CompressedSize < BlockSize)
+				{
+					AppendUInt32(CompressedSize);
+					Frame.Append(CompressedBlock.GetData(), CompressedSize);
+					AppendUInt32(FglTFRuntimeLZ4::XXH32(CompressedBlock.GetData(), CompressedSize));
+				}
+				else
+				{
+					AppendUInt32(BlockSize | 0x80000000);
+					Frame.Append(Content.GetData() + BlockStart, BlockSize);
+					AppendUInt32(FglTFRuntimeLZ4::XXH32(Content.GetData() + BlockStart, BlockSize));
+				}
+			}
+
+			AppendUInt32(0);
+			AppendUInt32(FglTFRuntimeLZ4::XXH32(Content.GetData(), Content.Num()));
+
+			return Frame;
+		}
+
+		/*
+		* LZ4 frame with linked (dependent) 64KB blocks: the first block is stored, every other one is a single match
+		* at Distance bytes (reaching into the previous block) followed by the 12 literals LZ4 requires at the end of a block.
+		* Content is periodic (Distance bytes), so every match reproduces it.
+		*/
+		TArray64<uint8> BuildLZ4DependentFrame(const int32 NumBlocks, const int32 Distance, TArray64<uint8>& Content)
+		{
+			const int64 BlockMaxSize = 64 * 1024;
+			const int64 NumLiterals = 12;
+
+			Content.SetNumUninitialized(NumBlocks * BlockMaxSize);
+			for (int64 Index = 0; Index < Distance; Index++)
+			{
+				Content[Index] = static_cast<uint8>(FCrc::MemCrc32(&Index, sizeof(int64)) >> 24);
+			}
+			for (int64 Index = Distance; Index < Content.Num(); Index++)
+			{
+				Content[Index] = Content[Index - Distance];
+			}
+
+			TArray64<uint8> Frame;
+			auto AppendUInt32 = [&Frame](const uint32 Value) { Frame.Append(reinterpret_cast<const uint8*>(&Value), 4); };
+
+			AppendUInt32(0x184D2204);
+			// version 01, linked blocks, block checksum, content size, content checksum
+			Frame.Add(0x40 | 0x10 | 0x08 | 0x04);
+			// 64KB blocks
+			Frame.Add(0x40);
+			const uint64 ContentSize = Content.Num();
+			Frame.Append(reinterpret_cast<const uint8*>(&ContentSize), 8);
+			Frame.Add((FglTFRuntimeLZ4::XXH32(Frame.GetData() + 4, 10) >> 8) & 0xFF);
+
+			// first block stored as is
+			AppendUInt32(BlockMaxSize | 0x80000000);
+			Frame.Append(Content.GetData(), BlockMaxSize);
+			AppendUInt32(FglTFRuntimeLZ4::XXH32(Content.GetData(), BlockMaxSize));
+
+			for (int32 BlockIndex = 1; BlockIndex < NumBlocks; BlockIndex++)
+			{
+				const int64 BlockStart = BlockIndex * BlockMaxSize;
+
+				TArray64<uint8> Block;
+				// no literals, match length (minus the 4 bytes minimum) in the token and the extra bytes
+				int64 MatchLength = BlockMaxSize - NumLiterals - 4;
+				Block.Add(0x0F);
+				Block.Add(static_cast<uint8>(Distance & 0xFF));
+				Block.Add(static_cast<uint8>((Distance >> 8) & 0xFF));
+				for (MatchLength -= 15; MatchLength >= 255; MatchLength -= 255)
+				{
+					Block.Add(255);
+				}
+				Block.Add(static_cast<uint8>(MatchLength));
+				// last sequence, literals only
+				Block.Add(static_cast<uint8>(NumLiterals << 4));
+				Block.Append(Content.GetData() + BlockStart + BlockMaxSize - NumLiterals, NumLiterals);
+
+				AppendUInt32(static_cast<uint32>(Block.Num()));
+				Frame.Append(Block);
+				AppendUInt32(FglTFRuntimeLZ4::XXH32(Block.GetData(), Block.Num()));
+			}
+
+			AppendUInt32(0);
+			AppendUInt32(FglTFRuntimeLZ4::XXH32(Content.GetData(), Content.Num()));
+
+			return Frame;
+		}
+
+		// the original per-byte LZ4 block decoder, used as baseline
+		bool LegacyLZ4Decompress(const uint8* BlockData, const int64 BlockSize, TArray64<uint8>& Output)
+		{
+			const uint32 TrueBlockSize = BlockSize & 0x7FFFFFFF;
+			if (((BlockSize >> 31) & 0x01) == 1)
+			{
+				Output.Append(BlockData, TrueBlockSize);
+				return true;
+			}
+
+			int64 Offset = 0;
+			while (Offset < TrueBlockSize)
+			{
+				const uint8 Token = BlockData[Offset++];
+				int64 Length = Token >> 4;
+
+				if (Length > 0)
+				{
+					int64 TempLength = Length + 240;
+					while (TempLength == 255)
+					{
+						if (Offset + 1 >= TrueBlockSize)
+						{
+							return false;
+						}
+						TempLength = BlockData[Offset++];
+						Length += TempLength;
+					}
+
+					if (Offset + Length > TrueBlockSize)
+					{
+						return false;
+					}
+
+					while (Length > 0)
+					{
+						Output.Add(BlockData[Offset++]);
+						Length--;
+					}
+
+					if (Offset == TrueBlockSize)
+					{
+						return true;
+					}
+				}
+
+				if (Offset + 2 >= TrueBlockSize)
+				{
+					return false;
+				}
+
+				uint16 CopyOffset = static_cast<uint16>(BlockData[Offset++]);
+				CopyOffset |= (static_cast<uint16>(BlockData[Offset++]) << 8);
+
+				int64 MatchOffset = Output.Num() - CopyOffset;
+				if (CopyOffset == 0 || MatchOffset < 0)
+				{
+					return false;
+				}
+
+				int64 MatchLength = Token & 0x0F;
+				int64 TempMatchLength = MatchLength + 240;
+				while (TempMatchLength == 255)
+				{
+					if (Offset + 1 > TrueBlockSize)
+					{
+						return false;
+					}
+					TempMatchLength = BlockData[Offset++];
+					MatchLength += TempMatchLength;
+				}
+
+				MatchLength += 4;
+
+				while (MatchLength > 0)
+				{
+					if (!Output.IsValidIndex(MatchOffset))
+					{
+						return false;
+					}
+					const uint8 Byte = Output[MatchOffset++];
+					Output.Add(Byte);
+					MatchLength--;
+				}
+			}
+
+			return true;
+		}
+
+		bool LegacyLZ4DecompressFrame(const TArray64<uint8>& Frame, TArray64<uint8>& Output)
+		{
+			const bool bBlockChecksum = ((Frame[4] >> 4) & 0x01) == 1;
+			int64 Offset = 7 + 8;
+			while (Offset + 4 <= Frame.Num())
+			{
+				const uint32 BlockSize = *reinterpret_cast<const uint32*>(Frame.GetData() + Offset);
+				if (BlockSize == 0)
+				{
+					return true;
+				}
+				if (!LegacyLZ4Decompress(Frame.GetData() + Offset + 4, BlockSize, Output))
+				{
+					return false;
+				}
+				Offset += 4 + (BlockSize & 0x7FFFFFFF) + (bBlockChecksum ? 4 : 0);
+			}
+			return false;
+		}
+
+		// reference decoders for measuring the encoders error (texels are written as B8G8R8A8)
+		void DecodeBC1ColorBlock(const uint8* Block, uint8* Pixels)
+		{
+			const uint16 Color0 = Block[0] | (Block[1] << 8);
+			const uint16 Color1 = Block[2] | (Block[3] << 8);
+			int32 Palette[4][3];
+			for (int32 Endpoint = 0; Endpoint < 2; Endpoint++)
+			{
+				const uint16 Color = Endpoint == 0 ? Color0 : Color1;
+				const int32 R = (Color >> 11) & 0x1F;
+				const int32 G = (Color >> 5) & 0x3F;
+				const int32 B = Color & 0x1F;
+				Palette[Endpoint][0] = (R << 3) | (R >> 2);
+				Palette[Endpoint][1] = (G << 2) | (G >> 4);
+				Palette[Endpoint][2] = (B << 3) | (B >> 2);
+			}
+			for (int32 Channel = 0; Channel < 3; Channel++)
+			{
+				Palette[2][Channel] = (2 * Palette[0][Channel] + Palette[1][Channel]) / 3;
+				Palette[3][Channel] = (Palette[0][Channel] + 2 * Palette[1][Channel]) / 3;
+			}
+
+			const uint32 Indices = Block[4] | (Block[5] << 8) | (Block[6] << 16) | (static_cast<uint32>(Block[7]) << 24);
+			for (int32 Index = 0; Index < 16; Index++)
+			{
+				const int32 PaletteIndex = (Indices >> (Index * 2)) & 0x03;
+				Pixels[Index * 4 + 0] = Palette[PaletteIndex][2];
+				Pixels[Index * 4 + 1] = Palette[PaletteIndex][1];
+				Pixels[Index * 4 + 2] = Palette[PaletteIndex][0];
+				Pixels[Index * 4 + 3] = 255;
+			}
+		}
+
+		void DecodeBC4Block(const uint8* Block, uint8* Pixels, const int32 Channel)
+		{
+			const int32 Value0 = Block[0];
+			const int32 Value1 = Block[1];
+			uint64 Indices = 0;
+			for (int32 Byte = 0; Byte < 6; Byte++)
+			{
+				Indices |= static_cast<uint64>(Block[2 + Byte]) << (Byte * 8);
+			}
+			for (int32 Index = 0; Index < 16; Index++)
+			{
+				const int32 PaletteIndex = (Indices >> (Index * 3)) & 0x07;
+				int32 Value = PaletteIndex == 0 ? Value0 : Value1;
+				if (PaletteIndex > 1)
+				{
+					Value = Value0 > Value1 ? ((8 - PaletteIndex) * Value0 + (PaletteIndex - 1) * Value1) / 7 : (PaletteIndex >= 6 ? (PaletteIndex == 6 ? 0 : 255) : ((6 - PaletteIndex) * Value0 + (PaletteIndex - 1) * Value1) / 5);
+				}
+				Pixels[Index * 4 + Channel] = Value;
+			}
+		}
+
+		// mode 6 only
+		bool DecodeBC7Block(const uint8* Block, uint8* Pixels)
+		{
+			if ((Block[0] & 0x7F) != 0x40)
+			{
+				return false;
+			}
+
+			int32 BitPosition = 7;
+			auto ReadBits = [Block, &BitPosition](const int32 Bits)
+				{
+					uint32 Value = 0;
+					for (int32 Bit = 0; Bit < Bits; Bit++, BitPosition++)
+					{
+						Value |= ((Block[BitPosition / 8] >> (BitPosition % 8)) & 0x01) << Bit;
+					}
+					return Value;
+				};
+
+			int32 Endpoints[2][4];
+			for (int32 Channel = 0; Channel < 4; Channel++)
+			{
+				Endpoints[0][Channel] = ReadBits(7) << 1;
+				Endpoints[1][Channel] = ReadBits(7) << 1;
+			}
+			const uint32 PBit0 = ReadBits(1);
+			const uint32 PBit1 = ReadBits(1);
+
+			constexpr int32 Weights[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+			constexpr int32 Swizzle[4] = { 2, 1, 0, 3 };
+			for (int32 Index = 0; Index < 16; Index++)
+			{
+				const int32 Weight = Weights[ReadBits(Index == 0 ? 3 : 4)];
+				for (int32 Channel = 0; Channel < 4; Channel++)
+				{
+					const int32 Value0 = Endpoints[0][Channel] | PBit0;
+					const int32 Value1 = Endpoints[1][Channel] | PBit1;
+					Pixels[Index * 4 + Swizzle[Channel]] = ((64 - Weight) * Value0 + Weight * Value1 + 32) >> 6;
+				}
+			}
+			return true;
+		}
+
+		// root mean square error of the decoded first mip (only the Channels in the mask are compared)
+		double BlockCompressionRMSE(const FglTFRuntimeMipMap& Source, const FglTFRuntimeMipMap& Compressed, const uint8 ChannelsMask)
+		{
+			const int32 BlocksX = FMath::DivideAndRoundUp(Source.Width, 4);
+			const int32 BlockBytes = GPixelFormats[Compressed.PixelFormat].BlockBytes;
+			double Error = 0;
+			int64 Samples = 0;
+			uint8 Pixels[16 * 4];
+
+			for (int32 BlockY = 0; BlockY < Source.Height / 4; BlockY++)
+			{
+				for (int32 BlockX = 0; BlockX < Source.Width / 4; BlockX++)
+				{
+					const uint8* Block = Compressed.Pixels.GetData() + (static_cast<int64>(BlockY) * BlocksX + BlockX) * BlockBytes;
+					FMemory::Memset(Pixels, 255, sizeof(Pixels));
+					switch (Compressed.PixelFormat)
+					{
+					case EPixelFormat::PF_DXT1:
+						DecodeBC1ColorBlock(Block, Pixels);
+						break;
+					case EPixelFormat::PF_DXT5:
+						DecodeBC1ColorBlock(Block + 8, Pixels);
+						DecodeBC4Block(Block, Pixels, 3);
+						break;
+					case EPixelFormat::PF_BC5:
+						DecodeBC4Block(Block, Pixels, 2);
+						DecodeBC4Block(Block + 8, Pixels, 1);
+						break;
+					case EPixelFormat::PF_BC7:
+						if (!DecodeBC7Block(Block, Pixels))
+						{
+							return MAX_dbl;
+						}
+						break;
+					default:
+						return MAX_dbl;
+					}
+
+					for (int32 Index = 0; Index < 16; Index++)
+					{
+						const int64 PixelOffset = ((static_cast<int64>(BlockY) * 4 + Index / 4) * Source.Width + BlockX * 4 + Index % 4) * 4;
+						for (int32 Channel = 0; Channel < 4; Channel++)
+						{
+							if (ChannelsMask & (1 << Channel))
+							{
+								const double Delta = static_cast<double>(Pixels[Index * 4 + Channel]) - Source.Pixels[PixelOffset + Channel];
+								Error += Delta * Delta;
+								Samples++;
+							}
+						}
+					}
+				}
+			}
+
+			return Samples > 0 ? FMath::Sqrt(Error / Samples) : 0;
+		}
+
+		// the original linear timeline scan, used as baseline
+		float LegacyFindBestFrames(const TArray<float>& FramesTimes, float WantedTime, int32& FirstIndex, int32& SecondIndex)
+		{
+			SecondIndex = INDEX_NONE;
+			for (int32 i = 0; i < FramesTimes.Num(); i++)
+			{
+				float TimeValue = FramesTimes[i] - FramesTimes[0];
+				if (FMath::IsNearlyEqual(TimeValue, WantedTime))
+				{
+					FirstIndex = i;
+					SecondIndex = i;
+					return 0;
+				}
+				else if (TimeValue > WantedTime)
+				{
+					SecondIndex = i;
+					break;
+				}
+			}
+
+			if (SecondIndex == INDEX_NONE)
+			{
+				SecondIndex = FramesTimes.Num() - 1;
+			}
+
+			if (SecondIndex == 0)
+			{
+				FirstIndex = 0;
+				return 1.f;
+			}
+
+			FirstIndex = SecondIndex - 1;
+
+			return ((WantedTime + FramesTimes[0]) - FramesTimes[FirstIndex]) / (FramesTimes[SecondIndex] - FramesTimes[FirstIndex]);
+		}
+
+		// mocap-like rotation curve: uniformly spaced keys with a little jitter on both time and value
+		FglTFRuntimeAnimationCurve BuildRotationBenchmarkCurve(const int32 NumKeys, const float KeysPerSecond, const int32 Seed)
+		{
+			FRandomStream RandomStream(Seed);
+			FglTFRuntimeAnimationCurve Curve;
+			Curve.bStep = false;
+			Curve.Timeline.AddUninitialized(NumKeys);
+			Curve.Values.AddUninitialized(NumKeys);
+			for (int32 KeyIndex = 0; KeyIndex < NumKeys; KeyIndex++)
+			{
+				Curve.Timeline[KeyIndex] = (KeyIndex + RandomStream.FRandRange(0, 0.25f)) / KeysPerSecond;
+				const FQuat Quat = FQuat(FVector(0, 0, 1).RotateAngleAxis(KeyIndex * 0.1f, FVector(1, 0, 0)), RandomStream.FRandRange(-PI, PI));
+				Curve.Values[KeyIndex] = FVector4(Quat.X, Quat.Y, Quat.Z, Quat.W);
+			}
+			return Curve;
+		}
+
+		// one node per curve ("bone_<index>") and an animation rotating each of them with its curve (all the curves share the first timeline)
+		TArray64<uint8> BuildAnimationBenchmarkBlob(const TArray<FglTFRuntimeAnimationCurve>& Curves)
+		{
+			const int32 NumKeys = Curves[0].Timeline.Num();
+			const int64 TimelineSize = NumKeys * sizeof(float);
+			const int64 ValuesSize = NumKeys * sizeof(float) * 4;
+			const int64 BinarySize = TimelineSize + ValuesSize * Curves.Num();
+
+			FString Nodes;
+			FString Accessors = FString::Printf(TEXT("{\"bufferView\":0,\"componentType\":5126,\"count\":%d,\"type\":\"SCALAR\"}"), NumKeys);
+			FString Samplers;
+			FString Channels;
+			for (int32 CurveIndex = 0; CurveIndex < Curves.Num(); CurveIndex++)
+			{
+				const TCHAR* Separator = CurveIndex > 0 ? TEXT(",") : TEXT("");
+				Nodes += FString::Printf(TEXT("%s{\"name\":\"bone_%d\"}"), Separator, CurveIndex);
+				Accessors += FString::Printf(TEXT(",{\"bufferView\":1,\"byteOffset\":%lld,\"componentType\":5126,\"count\":%d,\"type\":\"VEC4\"}"), ValuesSize * CurveIndex, NumKeys);
+				Samplers += FString::Printf(TEXT("%s{\"input\":0,\"output\":%d}"), Separator, CurveIndex + 1);
+				Channels += FString::Printf(TEXT("%s{\"sampler\":%d,\"target\":{\"node\":%d,\"path\":\"rotation\"}}"), Separator, CurveIndex, CurveIndex);
+			}
+
+			const FString Json = FString::Printf(TEXT("{\"asset\":{\"version\":\"2.0\"},\"buffers\":[{\"byteLength\":%lld}],")
+				TEXT("\"bufferViews\":[{\"buffer\":0,\"byteLength\":%lld},{\"buffer\":0,\"byteOffset\":%lld,\"byteLength\":%lld}],")
+				TEXT("\"accessors\":[%s],\"nodes\":[%s],\"animations\":[{\"samplers\":[%s],\"channels\":[%s]}]}"),
+				BinarySize, TimelineSize, TimelineSize, ValuesSize * Curves.Num(), *Accessors, *Nodes, *Samplers, *Channels);
+
+			uint8* BinaryChunk = nullptr;
+			TArray64<uint8> Blob = BuildGLBBlob(Json, BinarySize, BinaryChunk);
+
+			float* Floats = reinterpret_cast<float*>(BinaryChunk);
+			for (const float Time : Curves[0].Timeline)
+			{
+				*Floats++ = Time;
+			}
+
+			for (const FglTFRuntimeAnimationCurve& Curve : Curves)
+			{
+				for (const FVector4& Value : Curve.Values)
+				{
+					*Floats++ = Value.X;
+					*Floats++ = Value.Y;
+					*Floats++ = Value.Z;
+					*Floats++ = Value.W;
+				}
+			}
+
+			return Blob;
+		}
+
+		// baked node animation swaying on its own axis (with the phase given by NodeIndex)
+		UglTFRuntimeAnimationCurve* BuildNodeBenchmarkCurve(const int32 NumKeys, const float Duration, const int32 NodeIndex, const FMatrix& SceneBasis)
+		{
+			UglTFRuntimeAnimationCurve* AnimationCurve = NewObject<UglTFRuntimeAnimationCurve>();
+			AnimationCurve->SetDefaultValues(FVector::ZeroVector, FQuat::Identity, FRotator::ZeroRotator, FVector::OneVector);
+			AnimationCurve->BasisMatrix = SceneBasis;
+			AnimationCurve->glTFCurveAnimationDuration = Duration;
+			const FVector Axis = FVector(FMath::Sin(static_cast<float>(NodeIndex)), 1, FMath::Cos(static_cast<float>(NodeIndex))).GetSafeNormal();
+			for (int32 KeyIndex = 0; KeyIndex < NumKeys; KeyIndex++)
+			{
+				const float Time = Duration * KeyIndex / (NumKeys - 1);
+				const FQuat Quat = FQuat(Axis, FMath::Sin(Time + NodeIndex) * PI);
+				AnimationCurve->AddLocationValue(Time, FVector(FMath::Sin(Time) * 10, 0, NodeIndex), ERichCurveInterpMode::RCIM_Linear);
+				AnimationCurve->AddQuatValue(Time, Quat, ERichCurveInterpMode::RCIM_Linear);
+				AnimationCurve->AddConvertedQuaternion(Time, (SceneBasis.Inverse() * FQuatRotationMatrix(Quat) * SceneBasis).ToQuat().GetNormalized(), false);
+				AnimationCurve->AddScaleValue(Time, FVector(1, 1, 1 + FMath::Sin(Time) * 0.1f), ERichCurveInterpMode::RCIM_Linear);
+			}
+			AnimationCurve->Bake();
+			return AnimationCurve;
+		}
+
+		void WriteZipUInt16(TArray64<uint8>& Output, const uint16 Value)
+		{
+			Output.Add(static_cast<uint8>(Value & 0xFF));
+			Output.Add(static_cast<uint8>(Value >> 8));
+		}
+
+		void WriteZipUInt32(TArray64<uint8>& Output, const uint32 Value)
+		{
+			WriteZipUInt16(Output, static_cast<uint16>(Value & 0xFFFF));
+			WriteZipUInt16(Output, static_cast<uint16>(Value >> 16));
+		}
+
+		TArray64<uint8> DeflateRaw(const TArray64<uint8>& Content)
+		{
+			int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Zlib, static_cast<int32>(Content.Num()), COMPRESS_NoFlags, -15);
+			TArray64<uint8> Compressed;
+			Compressed.AddUninitialized(CompressedSize);
+			FCompression::CompressMemory(NAME_Zlib, Compressed.GetData(), CompressedSize, Content.GetData(), static_cast<int32>(Content.Num()), COMPRESS_NoFlags, -15);
+			Compressed.SetNum(CompressedSize);
+			return Compressed;
+		}
+
+		// entries compressed with the specified zip method (no crc, glTFRuntime does not check it) followed by an archive comment
+		TArray64<uint8> BuildZipArchive(const TArray<FString>& Filenames, const TArray<TArray64<uint8>>& Contents, const int32 CommentLen, const uint16 Method, TFunctionRef<TArray64<uint8>(const TArray64<uint8>&)> Compress)
+		{
+			TArray64<uint8> Zip;
+			TArray64<uint8> CentralDirectory;
+
+			for (int32 EntryIndex = 0; EntryIndex < Filenames.Num(); EntryIndex++)
+			{
+				const TArray64<uint8>& Content = Contents[EntryIndex];
+				const TArray64<uint8> Compressed = Compress(Content);
+				const uint32 CompressedSize = static_cast<uint32>(Compressed.Num());
+
+				FTCHARToUTF8 Filename(*Filenames[EntryIndex]);
+				const uint32 LocalEntryOffset = static_cast<uint32>(Zip.Num());
+
+				WriteZipUInt32(Zip, 0x04034b50);
+				WriteZipUInt16(Zip, 20);
+				WriteZipUInt16(Zip, 0);
+				WriteZipUInt16(Zip, Method);
+				WriteZipUInt32(Zip, 0);
+				WriteZipUInt32(Zip, 0);
+				WriteZipUInt32(Zip, CompressedSize);
+				WriteZipUInt32(Zip, static_cast<uint32>(Content.Num()));
+				WriteZipUInt16(Zip, static_cast<uint16>(Filename.Length()));
+				WriteZipUInt16(Zip, 0);
+				Zip.Append(reinterpret_cast<const uint8*>(Filename.Get()), Filename.Length());
+				Zip.Append(Compressed.GetData(), CompressedSize);
+
+				WriteZipUInt32(CentralDirectory, 0x02014b50);
+				WriteZipUInt16(CentralDirectory, 20);
+				WriteZipUInt16(CentralDirectory, 20);
+				WriteZipUInt16(CentralDirectory, 0);
+				WriteZipUInt16(CentralDirectory, Method);
+				WriteZipUInt32(CentralDirectory, 0);
+				WriteZipUInt32(CentralDirectory, 0);
+				WriteZipUInt32(CentralDirectory, CompressedSize);
+				WriteZipUInt32(CentralDirectory, static_cast<uint32>(Content.Num()));
+				WriteZipUInt16(CentralDirectory, static_cast<uint16>(Filename.Length()));
+				WriteZipUInt16(CentralDirectory, 0);
+				WriteZipUInt16(CentralDirectory, 0);
+				WriteZipUInt16(CentralDirectory, 0);
+				WriteZipUInt16(CentralDirectory, 0);
+				WriteZipUInt32(CentralDirectory, 0);
+				WriteZipUInt32(CentralDirectory, LocalEntryOffset);
+				CentralDirectory.Append(reinterpret_cast<const uint8*>(Filename.Get()), Filename.Length());
+			}
+
+			const uint32 CentralDirectoryOffset = static_cast<uint32>(Zip.Num());
+			Zip.Append(CentralDirectory);
+
+			WriteZipUInt32(Zip, 0x06054b50);
+			WriteZipUInt16(Zip, 0);
+			WriteZipUInt16(Zip, 0);
+			WriteZipUInt16(Zip, static_cast<uint16>(Filenames.Num()));
+			WriteZipUInt16(Zip, static_cast<uint16>(Filenames.Num()));
+			WriteZipUInt32(Zip, static_cast<uint32>(CentralDirectory.Num()));
+			WriteZipUInt32(Zip, CentralDirectoryOffset);
+			WriteZipUInt16(Zip, static_cast<uint16>(CommentLen));
+			for (int32 CommentIndex = 0; CommentIndex < CommentLen; CommentIndex++)
+			{
+				Zip.Add('x');
+			}
+
+			return Zip;
+		}
+
+		TArray64<uint8> BuildZipArchive(const TArray<FString>& Filenames, const TArray<TArray64<uint8>>& Contents, const int32 CommentLen)
+		{
+			return BuildZipArchive(Filenames, Contents, CommentLen, 8, [](const TArray64<uint8>& Content) { return DeflateRaw(Content); });
+		}
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Benchmark_AccessorsLookup, "glTFRuntime.Benchmarks.AccessorsLookup", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FglTFRuntimeTests_Benchmark_AccessorsLookup::RunTest(const FString& Parameters)
+{
+	const TArray<int32> AccessorsCounts = { 1000, 4000, 16000 };
+	TArray<double> NanosecondsPerAccessor;
+
+	for (const int32 NumAccessors : AccessorsCounts)
+	{
+		const FString Json = glTFRuntime::Tests::BuildAccessorsBenchmarkJson(NumAccessors);
+
+		FglTFRuntimeConfig LoaderConfig;
+		const double StartTime = FPlatformTime::Seconds();
+		TSharedPtr<FglTFRuntimeParser> Parser = FglTFRuntimeParser::FromString(Json, LoaderConfig);
+		if (!TestTrue("Parser != nullptr", Parser.IsValid()))
+		{
+			return false;
+		}
+
+		bool bAllAccessorsValid = true;
+		for (int32 AccessorIndex = 0; AccessorIndex < NumAccessors; AccessorIndex++)
+		{
+			FglTFRuntimeBlob Blob;
+			int64 ComponentType, Stride, Elements, ElementSize, Count;
+			bool bNormalized = false;
+			bAllAccessorsValid &= Parser->GetAccessor(AccessorIndex, ComponentType, Stride, Elements, ElementSize, Count, bNormalized, Blob, nullptr);
+		}
+		const double ElapsedTime = FPlatformTime::Seconds() - StartTime;
+
+		TestTrue(FString::Printf(TEXT("GetAccessor() on %d accessors"), NumAccessors), bAllAccessorsValid);
+
+		NanosecondsPerAccessor.Add(ElapsedTime * 1000000000.0 / NumAccessors);
+		AddInfo(FString::Printf(TEXT("%d accessors: %.3f ms (%.1f ns per accessor)"), NumAccessors, ElapsedTime * 1000.0, NanosecondsPerAccessor.Last()));
+	}
+
+	// with O(1) lookups the per-accessor cost must not grow with the number of accessors (16x more accessors, generous 4x margin)
+	TestTrue("Accessors lookup scales linearly", NanosecondsPerAccessor.Last() < NanosecondsPerAccessor[0] * 4);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Benchmark_GLBIngestion, "glTFRuntime.Benchmarks.GLBIngestion", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FglTFRuntimeTests_Benchmark_GLBIngestion::RunTest(const FString& Parameters)
+{
+	const int64 BinarySize = 32 * 1024 * 1024;
+	FglTFRuntimeConfig LoaderConfig;
+
+	TArray64<uint8> Blob = glTFRuntime::Tests::BuildGLBBenchmarkBlob(BinarySize);
+	const uint8* BinaryChunk = Blob.GetData() + Blob.Num() - BinarySize;
+
+	double StartTime = FPlatformTime::Seconds();
+	TSharedPtr<FglTFRuntimeParser> BorrowedParser = FglTFRuntimeParser::FromData(Blob.GetData(), Blob.Num(), LoaderConfig);
+	const double BorrowedTime = FPlatformTime::Seconds() - StartTime;
+
+	if (!TestTrue("BorrowedParser != nullptr", BorrowedParser.IsValid()))
+	{
+		return false;
+	}
+
+	FglTFRuntimeBlob BorrowedBuffer;
+	TestTrue("BorrowedParser->GetBuffer(0)", BorrowedParser->GetBuffer(0, BorrowedBuffer));
+	TestEqual("BorrowedBuffer.Num", BorrowedBuffer.Num, BinarySize);
+	TestTrue("BorrowedBuffer content", BorrowedBuffer.Num == BinarySize && FMemory::Memcmp(BorrowedBuffer.Data, BinaryChunk, BinarySize) == 0);
+
+	StartTime = FPlatformTime::Seconds();
+	TSharedPtr<FglTFRuntimeParser> OwnedParser = FglTFRuntimeParser::FromData(MoveTemp(Blob), LoaderConfig);
+	const double OwnedTime = FPlatformTime::Seconds() - StartTime;
+
+	if (!TestTrue("OwnedParser != nullptr", OwnedParser.IsValid()))
+	{
+		return false;
+	}
+
+	// the BIN chunk must be referenced in place
+	FglTFRuntimeBlob OwnedBuffer;
+	TestTrue("OwnedParser->GetBuffer(0)", OwnedParser->GetBuffer(0, OwnedBuffer));
+	TestTrue("OwnedBuffer.Data is the original BIN chunk", OwnedBuffer.Data == BinaryChunk);
+	TestEqual("OwnedBuffer.Num", OwnedBuffer.Num, BinarySize);
+
+	// the http loaders (and the base64 ones) go through the asset, which must adopt the blob too
+	TArray64<uint8> AssetBlob = glTFRuntime::Tests::BuildGLBBenchmarkBlob(BinarySize);
+	const uint8* AssetBinaryChunk = AssetBlob.GetData() + AssetBlob.Num() - BinarySize;
+
+	UglTFRuntimeAsset* Asset = NewObject<UglTFRuntimeAsset>();
+	StartTime = FPlatformTime::Seconds();
+	const bool bAssetLoaded = Asset->LoadFromData(MoveTemp(AssetBlob), LoaderConfig);
+	const double AssetTime = FPlatformTime::Seconds() - StartTime;
+
+	if (!TestTrue("Asset->LoadFromData()", bAssetLoaded))
+	{
+		return false;
+	}
+
+	FglTFRuntimeBlob AssetBuffer;
+	TestTrue("Asset->GetParser()->GetBuffer(0)", Asset->GetParser()->GetBuffer(0, AssetBuffer));
+	TestTrue("AssetBuffer.Data is the original BIN chunk", AssetBuffer.Data == AssetBinaryChunk);
+	TestEqual("AssetBuffer.Num", AssetBuffer.Num, BinarySize);
+
+	AddInfo(FString::Printf(TEXT("%lld bytes BIN chunk: borrowed %.3f ms, owned %.3f ms, asset %.3f ms"), BinarySize, BorrowedTime * 1000.0, OwnedTime * 1000.0, AssetTime * 1000.0));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Benchmark_AccessorDecoders, "glTFRuntime.Benchmarks.AccessorDecoders", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FglTFRuntimeTests_Benchmark_AccessorDecoders::RunTest(const FString& Parameters)
+{
+	const int64 NumElements = 10 * 1000 * 1000;
+
+	FglTFRuntimeConfig LoaderConfig;
+	const FMatrix SceneBasis = LoaderConfig.GetMatrix();
+	const float SceneScale = LoaderConfig.SceneScale;
+
+	// interleaved position (vec3) + normal (vec3) + uv (vec2)
+	const int64 Stride = sizeof(float) * 8;
+	TArray64<uint8> Vertices;
+	Vertices.AddUninitialized(NumElements * Stride);
+	float* VerticesPtr = reinterpret_cast<float*>(Vertices.GetData());
+	for (int64 Index = 0; Index < NumElements * 8; Index++)
+	{
+		VerticesPtr[Index] = static_cast<float>(Index % 1021) / 1021.f - 0.5f;
+	}
+
+	auto Measure = [this](const TCHAR* Name, const int64 Count, TFunctionRef<void()> Legacy, TFunctionRef<void()> Specialized)
+		{
+			double StartTime = FPlatformTime::Seconds();
+			Legacy();
+			const double LegacyTime = FPlatformTime::Seconds() - StartTime;
+
+			StartTime = FPlatformTime::Seconds();
+			Specialized();
+			const double SpecializedTime = FPlatformTime::Seconds() - StartTime;
+
+			AddInfo(FString::Printf(TEXT("%s: legacy %.1f M/s, specialized %.1f M/s (%.2fx)"), Name, Count / LegacyTime / 1000000.0, Count / SpecializedTime / 1000000.0, LegacyTime / SpecializedTime));
+		};
+
+	{
+		TArray<FVector> Legacy;
+		TArray<FVector> Specialized;
+		Measure(TEXT("POSITION"), NumElements,
+			[&]() { glTFRuntime::Tests::LegacyDecodeFloatVectors(Vertices.GetData(), Stride, 3, NumElements, Legacy, [&](FVector Value) -> FVector { return SceneBasis.TransformPosition(Value) * SceneScale; }); },
+			[&]() { Specialized.AddUninitialized(NumElements); glTFRuntime::Accessors::DecodeFloat3WithBasis(Vertices.GetData(), Stride, NumElements, Specialized.GetData(), SceneBasis, SceneScale, true); });
+
+		bool bMatch = true;
+		for (int64 Index = 0; Index < NumElements; Index += 997)
+		{
+			bMatch &= Legacy[Index].Equals(Specialized[Index], KINDA_SMALL_NUMBER * SceneScale);
+		}
+		TestTrue("POSITION decoding matches", bMatch);
+	}
+
+	{
+		TArray<FVector> Legacy;
+		TArray<FVector> Specialized;
+		Measure(TEXT("NORMAL"), NumElements,
+			[&]() { glTFRuntime::Tests::LegacyDecodeFloatVectors(Vertices.GetData() + sizeof(float) * 3, Stride, 3, NumElements, Legacy, [&](FVector Value) -> FVector { return SceneBasis.TransformVector(Value); }); },
+			[&]() { Specialized.AddUninitialized(NumElements); glTFRuntime::Accessors::DecodeFloat3WithBasis(Vertices.GetData() + sizeof(float) * 3, Stride, NumElements, Specialized.GetData(), SceneBasis, SceneScale, false); });
+
+		bool bMatch = true;
+		for (int64 Index = 0; Index < NumElements; Index += 997)
+		{
+			bMatch &= Legacy[Index].Equals(Specialized[Index], KINDA_SMALL_NUMBER);
+		}
+		TestTrue("NORMAL decoding matches", bMatch);
+	}
+
+	{
+		TArray<FVector2D> Legacy;
+		TArray<FVector2D> Specialized;
+		auto Identity = [](FVector2D Value) -> FVector2D { return Value; };
+		Measure(TEXT("TEXCOORD"), NumElements,
+			[&]() { glTFRuntime::Tests::LegacyDecodeFloatVectors(Vertices.GetData() + sizeof(float) * 6, Stride, 2, NumElements, Legacy, Identity); },
+			[&]() { Specialized.AddUninitialized(NumElements); glTFRuntime::Accessors::DecodeVectors(5126, Vertices.GetData() + sizeof(float) * 6, Stride, 2, false, NumElements, Specialized.GetData(), Identity); });
+
+		bool bMatch = true;
+		for (int64 Index = 0; Index < NumElements; Index += 997)
+		{
+			bMatch &= Legacy[Index] == Specialized[Index];
+		}
+		TestTrue("TEXCOORD decoding matches", bMatch);
+	}
+
+	// normalized UNSIGNED_SHORT uvs (interleaved, 8 bytes stride) and UNSIGNED_BYTE colors (packed)
+	{
+		TArray64<uint8> Normalized;
+		Normalized.AddUninitialized(NumElements * 8);
+		for (int64 Index = 0; Index < Normalized.Num(); Index++)
+		{
+			Normalized[Index] = static_cast<uint8>(Index * 31 + (Index >> 8));
+		}
+
+		auto ScalarDecode = [](const uint8* Data, const int64 ComponentStride, const int64 Elements, const int64 Count, const int64 ElementStride, auto Decode, TArray<FVector4>& Out)
+			{
+				Out.AddUninitialized(Count);
+				ParallelFor(static_cast<int32>(Count), [&](const int32 Index)
+					{
+						FVector4 Value(0, 0, 0, 0);
+						for (int32 i = 0; i < Elements; i++)
+						{
+							Value[i] = Decode(Data + Index * ElementStride + i * ComponentStride);
+						}
+						Out[Index] = Value;
+					});
+			};
+
+		auto Identity = [](FVector4 Value) -> FVector4 { return Value; };
+
+		TArray<FVector4> Legacy;
+		TArray<FVector4> Specialized;
+		Measure(TEXT("TEXCOORD (normalized UNSIGNED_SHORT)"), NumElements,
+			[&]() { ScalarDecode(Normalized.GetData(), sizeof(uint16), 2, NumElements, 8, [](const uint8* Ptr) { return glTFRuntime::Accessors::TComponentDecoder<uint16, true>::Decode(Ptr); }, Legacy); },
+			[&]() { Specialized.AddUninitialized(NumElements); glTFRuntime::Accessors::DecodeVectors(5123, Normalized.GetData(), 8, 2, true, NumElements, Specialized.GetData(), Identity); });
+
+		bool bMatch = true;
+		for (int64 Index = 0; Index < NumElements; Index++)
+		{
+			bMatch &= Legacy[Index].X == Specialized[Index].X && Legacy[Index].Y == Specialized[Index].Y;
+		}
+		TestTrue("TEXCOORD (normalized UNSIGNED_SHORT) decoding matches", bMatch);
+
+		Legacy.Empty();
+		Specialized.Empty();
+		Measure(TEXT("COLOR (normalized UNSIGNED_BYTE)"), NumElements,
+			[&]() { ScalarDecode(Normalized.GetData(), sizeof(uint8), 4, NumElements, 4, [](const uint8* Ptr) { return glTFRuntime::Accessors::TComponentDecoder<uint8, true>::Decode(Ptr); }, Legacy); },
+			[&]() { Specialized.AddUninitialized(NumElements); glTFRuntime::Accessors::DecodeVectors(5121, Normalized.GetData(), 4, 4, true, NumElements, Specialized.GetData(), Identity); });
+
+		TestTrue("COLOR (normalized UNSIGNED_BYTE) decoding matches", Legacy == Specialized);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Benchmark_CompactPrimitive, "glTFRuntime.Benchmarks.CompactPrimitive", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FglTFRuntimeTests_Benchmark_CompactPrimitive::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumVertices = 1000000;
+
+	FglTFRuntimeMeshLOD LOD;
+	FglTFRuntimePrimitive& Primitive = LOD.Primitives.AddDefaulted_GetRef();
+	Primitive.Positions.AddUninitialized(NumVertices);
+	Primitive.Normals.AddUninitialized(NumVertices);
+	Primitive.Tangents.AddUninitialized(NumVertices);
+	Primitive.UVs.AddDefaulted_GetRef().AddUninitialized(NumVertices);
+	Primitive.Weights.AddDefaulted_GetRef().AddUninitialized(NumVertices);
+
+	FRandomStream RandomStream(17);
+	for (int32 Index = 0; Index < NumVertices; Index++)
+	{
+		Primitive.Positions[Index] = RandomStream.GetUnitVector() * 100;
+		Primitive.Normals[Index] = RandomStream.GetUnitVector();
+		Primitive.Tangents[Index] = FVector4(RandomStream.GetUnitVector(), Index % 2 ? 1 : -1);
+		Primitive.UVs[0][Index] = FVector2D(RandomStream.GetFraction(), RandomStream.GetFraction());
+		Primitive.Weights[0][Index] = FVector4(0.5, 0.25, 0.25, 0);
+	}
+
+	const FglTFRuntimePrimitive Reference = Primitive;
+
+	double StartTime = FPlatformTime::Seconds();
+	const int64 BytesSaved = glTFRuntime::CompactMeshLOD(LOD);
+	const double CompactTime = FPlatformTime::Seconds() - StartTime;
+
+	AddInfo(FString::Printf(TEXT("Compacted %d vertices in %.2f ms, %lld bytes saved"), NumVertices, CompactTime * 1000.0, BytesSaved));
+	TestTrue("Bytes saved", BytesSaved > 0);
+	TestEqual("Bytes saved reported on the LOD", LOD.CompactBytesSaved, BytesSaved);
+
+	bool bMatch = true;
+	for (int32 Index = 0; Index < NumVertices; Index += 997)
+	{
+		bMatch &= FVector(Primitive.GetPosition(Index)).Equals(Reference.Positions[Index], KINDA_SMALL_NUMBER * 100);
+		bMatch &= FVector(Primitive.GetNormal(Index)).Equals(Reference.Normals[Index], KINDA_SMALL_NUMBER);
+		bMatch &= FVector(FVector4(Primitive.GetTangent(Index))).Equals(FVector(Reference.Tangents[Index]), 1.0f / 127);
+		bMatch &= FMath::IsNearlyEqual(Primitive.GetWeight(0, Index, 1), 0.25f, 1.0f / 65535);
+	}
+	TestTrue("Compact accessors match the wide data", bMatch);
+
+	glTFRuntime::ExpandMeshLOD(LOD);
+	TestEqual("Expanded vertices", LOD.Primitives[0].Positions.Num(), NumVertices);
+	TestFalse("Expanded primitive", LOD.Primitives[0].bCompact);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Benchmark_LZ4Frame, "glTFRuntime.Benchmarks.LZ4Frame", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FglTFRuntimeTests_Benchmark_LZ4Frame::RunTest(const FString& Parameters)
+{
+	// vertex-like content: slowly changing floats, compresses like a typical BIN chunk
+	const int64 ContentSize = 32 * 1024 * 1024;
+	TArray64<uint8> Content;
+	Content.AddUninitialized(ContentSize);
+	float* Floats = reinterpret_cast<float*>(Content.GetData());
+	for (int64 Index = 0; Index < ContentSize / 4; Index++)
+	{
+		Floats[Index] = static_cast<float>((Index / 3) % 1024) * 0.25f;
+	}
+
+	const TArray64<uint8> Frame = glTFRuntime::Tests::BuildLZ4BenchmarkFrame(Content);
+
+	TArray64<uint8> LegacyOutput;
+	double StartTime = FPlatformTime::Seconds();
+	const bool bLegacySuccess = glTFRuntime::Tests::LegacyLZ4DecompressFrame(Frame, LegacyOutput);
+	const double LegacyTime = FPlatformTime::Seconds() - StartTime;
+
+	TArray64<uint8> Output;
+	StartTime = FPlatformTime::Seconds();
+	const bool bSuccess = FglTFRuntimeLZ4::DecompressFrame(Frame.GetData(), Frame.Num(), Output);
+	const double Time = FPlatformTime::Seconds() - StartTime;
+
+	TestTrue("Legacy decompression", bLegacySuccess);
+	TestTrue("DecompressFrame()", bSuccess);
+	TestTrue("Legacy content", LegacyOutput.Num() == ContentSize && FMemory::Memcmp(LegacyOutput.GetData(), Content.GetData(), ContentSize) == 0);
+	TestTrue("Content", Output.Num() == ContentSize && FMemory::Memcmp(Output.GetData(), Content.GetData(), ContentSize) == 0);
+
+	// linked blocks whose matches reach into the previous block (sequential path with a shared window)
+	TArray64<uint8> DependentContent;
+	const TArray64<uint8> DependentFrame = glTFRuntime::Tests::BuildLZ4DependentFrame(ContentSize / (64 * 1024), 40000, DependentContent);
+	TArray64<uint8> DependentOutput;
+	StartTime = FPlatformTime::Seconds();
+	TestTrue("DecompressFrame() (dependent blocks)", FglTFRuntimeLZ4::DecompressFrame(DependentFrame.GetData(), DependentFrame.Num(), DependentOutput));
+	const double DependentTime = FPlatformTime::Seconds() - StartTime;
+	TestTrue("Content (dependent blocks)", DependentOutput == DependentContent);
+
+	// the same blocks flagged as independent cannot be decoded (the matches point before their block)
+	TArray64<uint8> UnlinkedFrame = DependentFrame;
+	UnlinkedFrame[4] |= 0x20;
+	UnlinkedFrame[14] = (FglTFRuntimeLZ4::XXH32(UnlinkedFrame.GetData() + 4, 10) >> 8) & 0xFF;
+	TArray64<uint8> UnlinkedOutput;
+	AddExpectedError("LZ4", EAutomationExpectedErrorFlags::Contains, 0);
+	TestFalse("DecompressFrame() (dependent blocks flagged as independent)", FglTFRuntimeLZ4::DecompressFrame(UnlinkedFrame.GetData(), UnlinkedFrame.Num(), UnlinkedOutput));
+
+	// corrupted block checksum
+	TArray64<uint8> CorruptedFrame = Frame;
+	CorruptedFrame[20] ^= 0xFF;
+	TArray64<uint8> CorruptedOutput;
+	AddExpectedError("LZ4", EAutomationExpectedErrorFlags::Contains, 0);
+	TestFalse("DecompressFrame() (corrupted)", FglTFRuntimeLZ4::DecompressFrame(CorruptedFrame.GetData(), CorruptedFrame.Num(), CorruptedOutput));
+
+	AddInfo(FString::Printf(TEXT("%lld bytes (%lld compressed): legacy %.3f ms, parallel %.3f ms, sequential %.3f ms"), ContentSize, Frame.Num(), LegacyTime * 1000.0, Time * 1000.0, DependentTime * 1000.0));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Benchmark_BlockCompression, "glTFRuntime.Benchmarks.BlockCompression", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FglTFRuntimeTests_Benchmark_BlockCompression::RunTest(const FString& Parameters)
+{
+	FglTFRuntimeConfig LoaderConfig;
+	FglTFRuntimeMaterialsConfig MaterialsConfig;
+
+	// the textures of the models served by the web client
+	TArray<TArray<FglTFRuntimeMipMap>> Textures;
+	const FString ModelsDir = FPaths::Combine(FPaths::ProjectDir(), TEXT("../web/public/models"));
+	TArray<FString> Filenames;
+	IFileManager::Get().FindFiles(Filenames, *FPaths::Combine(ModelsDir, TEXT("*.glb")), true, false);
+	for (const FString& Filename : Filenames)
+	{
+		TArray64<uint8> Blob;
+		if (!FFileHelper::LoadFileToArray(Blob, *FPaths::Combine(ModelsDir, Filename)))
+		{
+			continue;
+		}
+
+		TSharedPtr<FglTFRuntimeParser> Parser = FglTFRuntimeParser::FromData(MoveTemp(Blob), LoaderConfig);
+		if (!Parser)
+		{
+			continue;
+		}
+
+		for (int32 ImageIndex = 0; ImageIndex < Parser->GetNumImages(); ImageIndex++)
+		{
+			TSharedPtr<FJsonObject> JsonImageObject;
+			TArray64<uint8> ImageBytes;
+			TArray<FglTFRuntimeMipMap> Mips;
+			if (Parser->LoadImageBytes(ImageIndex, JsonImageObject, ImageBytes) && Parser->LoadBlobToMips(ImageBytes, Mips, true, MaterialsConfig) &&
+				Mips.Num() > 0 && Mips[0].PixelFormat == EPixelFormat::PF_B8G8R8A8 && (Mips[0].Width % 4) == 0 && (Mips[0].Height % 4) == 0)
+			{
+				Textures.Add(MoveTemp(Mips));
+			}
+		}
+	}
+
+	if (Textures.Num() == 0)
+	{
+		// synthetic gradients
+		TArray<FglTFRuntimeMipMap> Mips;
+		FglTFRuntimeMipMap MipMap(-1, EPixelFormat::PF_B8G8R8A8, 1024, 1024);
+		MipMap.Pixels.AddUninitialized(1024 * 1024 * 4);
+		for (int64 Index = 0; Index < 1024 * 1024; Index++)
+		{
+			MipMap.Pixels[Index * 4 + 0] = (Index % 1024) / 4;
+			MipMap.Pixels[Index * 4 + 1] = (Index / 1024) / 4;
+			MipMap.Pixels[Index * 4 + 2] = 128;
+			MipMap.Pixels[Index * 4 + 3] = ((Index % 1024) + (Index / 1024)) / 8;
+		}
+		Mips.Add(MipMap);
+		Textures.Add(MoveTemp(Mips));
+	}
+
+	int64 SourceBytes = 0;
+	for (const TArray<FglTFRuntimeMipMap>& Mips : Textures)
+	{
+		for (const FglTFRuntimeMipMap& MipMap : Mips)
+		{
+			SourceBytes += MipMap.Pixels.Num();
+		}
+	}
+
+	struct FBlockCompressionFormat
+	{
+		const TCHAR* Name;
+		EPixelFormat PixelFormat;
+		uint8 ChannelsMask;
+		double MaxRMSE;
+	};
+
+	// B, G, R, A bits
+	const FBlockCompressionFormat Formats[] = {
+		{ TEXT("BC1"), EPixelFormat::PF_DXT1, 0x07, 16 },
+		{ TEXT("BC3"), EPixelFormat::PF_DXT5, 0x0F, 16 },
+		{ TEXT("BC5"), EPixelFormat::PF_BC5, 0x06, 8 },
+		{ TEXT("BC7"), EPixelFormat::PF_BC7, 0x0F, 12 },
+	};
+
+	const EglTFRuntimeBlockCompressionQuality Qualities[] = { EglTFRuntimeBlockCompressionQuality::Fast, EglTFRuntimeBlockCompressionQuality::Balanced, EglTFRuntimeBlockCompressionQuality::Best };
+
+	for (const FBlockCompressionFormat& Format : Formats)
+	{
+		for (const EglTFRuntimeBlockCompressionQuality Quality : Qualities)
+		{
+			double Time = 0;
+			double RMSE = 0;
+			int64 CompressedBytes = 0;
+			for (const TArray<FglTFRuntimeMipMap>& Mips : Textures)
+			{
+				TArray<FglTFRuntimeMipMap> CompressedMips = Mips;
+				const double StartTime = FPlatformTime::Seconds();
+				const bool bSuccess = FglTFRuntimeTextureCompressor::CompressMips(CompressedMips, Format.PixelFormat, Quality);
+				Time += FPlatformTime::Seconds() - StartTime;
+
+				if (!TestTrue(FString::Printf(TEXT("CompressMips(%s)"), Format.Name), bSuccess))
+				{
+					return false;
+				}
+
+				for (const FglTFRuntimeMipMap& MipMap : CompressedMips)
+				{
+					CompressedBytes += MipMap.Pixels.Num();
+				}
+				RMSE = FMath::Max(RMSE, glTFRuntime::Tests::BlockCompressionRMSE(Mips[0], CompressedMips[0], Format.ChannelsMask));
+			}
+
+			TestTrue(FString::Printf(TEXT("%s (quality %d) RMSE %.2f"), Format.Name, static_cast<int32>(Quality), RMSE), RMSE <= Format.MaxRMSE);
+
+			AddInfo(FString::Printf(TEXT("%s quality %d: %d textures, %.1f MB/s, %.2f:1, max RMSE %.2f"), Format.Name, static_cast<int32>(Quality), Textures.Num(), SourceBytes / Time / (1024 * 1024), static_cast<double>(SourceBytes) / CompressedBytes, RMSE));
+		}
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Benchmark_AnimationResampling, "glTFRuntime.Benchmarks.AnimationResampling", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FglTFRuntimeTests_Benchmark_AnimationResampling::RunTest(const FString& Parameters)
+{
+	const int32 NumBones = 128;
+	const int32 NumKeys = 12000;
+	const float KeysPerSecond = 120;
+
+	FglTFRuntimeConfig LoaderConfig;
+	const FMatrix SceneBasis = LoaderConfig.GetMatrix();
+
+	TArray<FglTFRuntimeAnimationCurve> Curves;
+	for (int32 BoneIndex = 0; BoneIndex < NumBones; BoneIndex++)
+	{
+		Curves.Add(glTFRuntime::Tests::BuildRotationBenchmarkCurve(NumKeys, KeysPerSecond, BoneIndex));
+		// the animation shares the first timeline
+		Curves[BoneIndex].Timeline = Curves[0].Timeline;
+	}
+
+	TSharedPtr<FglTFRuntimeParser> Parser = FglTFRuntimeParser::FromData(glTFRuntime::Tests::BuildAnimationBenchmarkBlob(Curves), LoaderConfig);
+	if (!TestTrue("Parser != nullptr", Parser.IsValid()))
+	{
+		return false;
+	}
+
+	const FglTFRuntimeSkeletalAnimationConfig SkeletalAnimationConfig;
+	const float FrameDelta = 1.f / SkeletalAnimationConfig.FramesPerSecond;
+
+	// the production path (accessors decoding included)
+	TMap<FString, FRawAnimSequenceTrack> Tracks;
+	TMap<FName, TArray<TPair<float, float>>> MorphTargetCurves;
+	float Duration = 0;
+	double StartTime = FPlatformTime::Seconds();
+	const bool bLoaded = Parser->LoadAnimationAsTracksAndMorphTargets(0, Tracks, MorphTargetCurves, Duration, SkeletalAnimationConfig);
+	const double Time = FPlatformTime::Seconds() - StartTime;
+
+	if (!TestTrue("LoadAnimationAsTracksAndMorphTargets()", bLoaded) || !TestEqual("Tracks.Num() == NumBones", Tracks.Num(), NumBones))
+	{
+		return false;
+	}
+
+	TArray<int32> NumFrames;
+	for (int32 BoneIndex = 0; BoneIndex < NumBones; BoneIndex++)
+	{
+		const FRawAnimSequenceTrack* Track = Tracks.Find(FString::Printf(TEXT("bone_%d"), BoneIndex));
+		if (!TestNotNull(FString::Printf(TEXT("bone_%d track"), BoneIndex), Track))
+		{
+			return false;
+		}
+		NumFrames.Add(Track->RotKeys.Num());
+	}
+
+	TArray<TArray<FQuat>> LegacyRotations;
+	LegacyRotations.SetNum(NumBones);
+
+	// per frame linear search and per key basis conversion (the previous LoadSkeletalAnimation_Internal strategy)
+	StartTime = FPlatformTime::Seconds();
+	for (int32 BoneIndex = 0; BoneIndex < NumBones; BoneIndex++)
+	{
+		const FglTFRuntimeAnimationCurve& Curve = Curves[BoneIndex];
+		LegacyRotations[BoneIndex].AddUninitialized(NumFrames[BoneIndex]);
+		ParallelFor(NumFrames[BoneIndex], [&](const int32 FrameIndex)
+			{
+				int32 FirstIndex;
+				int32 SecondIndex;
+				const float Alpha = glTFRuntime::Tests::LegacyFindBestFrames(Curve.Timeline, FrameDelta * FrameIndex, FirstIndex, SecondIndex);
+				const FVector4 FirstQuatV = Curve.Values[FirstIndex];
+				const FVector4 SecondQuatV = Curve.Values[SecondIndex];
+				const FQuat FirstQuat = (SceneBasis.Inverse() * FQuatRotationMatrix(FQuat(FirstQuatV.X, FirstQuatV.Y, FirstQuatV.Z, FirstQuatV.W).GetNormalized()) * SceneBasis).ToQuat();
+				const FQuat SecondQuat = (SceneBasis.Inverse() * FQuatRotationMatrix(FQuat(SecondQuatV.X, SecondQuatV.Y, SecondQuatV.Z, SecondQuatV.W).GetNormalized()) * SceneBasis).ToQuat();
+				LegacyRotations[BoneIndex][FrameIndex] = FQuat::Slerp(FirstQuat, SecondQuat, Alpha);
+			});
+	}
+	const double LegacyTime = FPlatformTime::Seconds() - StartTime;
+
+	// the keys are stored as floats in the buffer
+	bool bMatches = true;
+	for (int32 BoneIndex = 0; BoneIndex < NumBones && bMatches; BoneIndex++)
+	{
+		const FRawAnimSequenceTrack& Track = Tracks[FString::Printf(TEXT("bone_%d"), BoneIndex)];
+		for (int32 FrameIndex = 0; FrameIndex < NumFrames[BoneIndex]; FrameIndex++)
+		{
+			if (!FQuat(Track.RotKeys[FrameIndex]).Equals(LegacyRotations[BoneIndex][FrameIndex], 1e-3f))
+			{
+				bMatches = false;
+				break;
+			}
+		}
+	}
+
+	TestTrue("Resampled rotations match", bMatches);
+
+	AddInfo(FString::Printf(TEXT("%d bones, %d keys, %d frames: legacy resampling %.2f ms, LoadAnimationAsTracksAndMorphTargets %.2f ms (%.1fx)"), NumBones, NumKeys, NumFrames[0], LegacyTime * 1000.0, Time * 1000.0, LegacyTime / Time));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Benchmark_AnimationCompression, "glTFRuntime.Benchmarks.AnimationCompression", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FglTFRuntimeTests_Benchmark_AnimationCompression::RunTest(const FString& Parameters)
+{
+	const int32 NumBones = 100;
+	const int32 NumFrames = 300;
+	const float TranslationTolerance = 0.01f;
+	const float RotationTolerance = 0.05f;
+	const float ScaleTolerance = 0.0001f;
+
+	// idle-like loop: every bone sways on its own axis, only the root moves, scales are constant
+	UglTFAnimBoneCompressionCodec* RawCodec = NewObject<UglTFAnimBoneCompressionCodec>();
+	RawCodec->Tracks.AddDefaulted(NumBones);
+	for (int32 BoneIndex = 0; BoneIndex < NumBones; BoneIndex++)
+	{
+		FRawAnimSequenceTrack& Track = RawCodec->Tracks[BoneIndex];
+		const FVector Axis = FVector(FMath::Sin(static_cast<float>(BoneIndex)), FMath::Cos(static_cast<float>(BoneIndex)), 0.5f).GetSafeNormal();
+		for (int32 FrameIndex = 0; FrameIndex < NumFrames; FrameIndex++)
+		{
+			const float Phase = 2 * PI * FrameIndex / (NumFrames - 1);
+			Track.RotKeys.Emplace(FQuat(Axis, FMath::Sin(Phase + BoneIndex) * 0.3f));
+			Track.PosKeys.Emplace(BoneIndex == 0 ? FVector(FMath::Sin(Phase) * 10, 0, FMath::Abs(FMath::Cos(Phase)) * 2) : FVector(0, 0, 10));
+			Track.ScaleKeys.Emplace(FVector::OneVector);
+		}
+	}
+
+	UglTFAnimBoneCompressionCodec* Codec = NewObject<UglTFAnimBoneCompressionCodec>();
+	Codec->Tracks = RawCodec->Tracks;
+
+	double StartTime = FPlatformTime::Seconds();
+	const bool bCompressed = Codec->CompressTracks(TranslationTolerance, RotationTolerance, ScaleTolerance);
+	const double CompressionTime = FPlatformTime::Seconds() - StartTime;
+
+	if (!TestTrue("CompressTracks()", bCompressed))
+	{
+		return false;
+	}
+
+	// error on every frame (quantization included) and in between
+	const int32 NumSamples = NumFrames * 4;
+	float MaxRotationError = 0;
+	float MaxTranslationError = 0;
+	float MaxScaleError = 0;
+	for (int32 SampleIndex = 0; SampleIndex <= NumSamples; SampleIndex++)
+	{
+		const float RelativePos = static_cast<float>(SampleIndex) / NumSamples;
+		for (int32 BoneIndex = 0; BoneIndex < NumBones; BoneIndex++)
+		{
+			MaxRotationError = FMath::Max(MaxRotationError, static_cast<float>(Codec->GetTrackRotation(BoneIndex, RelativePos, EAnimInterpolationType::Linear).AngularDistance(RawCodec->GetTrackRotation(BoneIndex, RelativePos, EAnimInterpolationType::Linear))));
+			MaxTranslationError = FMath::Max(MaxTranslationError, static_cast<float>(FVector::Distance(Codec->GetTrackLocation(BoneIndex, RelativePos, EAnimInterpolationType::Linear), RawCodec->GetTrackLocation(BoneIndex, RelativePos, EAnimInterpolationType::Linear))));
+			MaxScaleError = FMath::Max(MaxScaleError, static_cast<float>((Codec->GetTrackScale(BoneIndex, RelativePos, EAnimInterpolationType::Linear) - RawCodec->GetTrackScale(BoneIndex, RelativePos, EAnimInterpolationType::Linear)).GetAbsMax()));
+		}
+	}
+
+	// in between frames the raw tracks are interpolated too, so allow twice the tolerance there
+	TestTrue(FString::Printf(TEXT("Rotation error %f degrees"), FMath::RadiansToDegrees(MaxRotationError)), FMath::RadiansToDegrees(MaxRotationError) <= RotationTolerance * 2);
+	TestTrue(FString::Printf(TEXT("Translation error %f"), MaxTranslationError), MaxTranslationError <= TranslationTolerance * 2);
+	TestTrue(FString::Printf(TEXT("Scale error %f"), MaxScaleError), MaxScaleError <= ScaleTolerance * 2);
+
+	auto DecodePoses = [NumBones, NumSamples](const UglTFAnimBoneCompressionCodec* PoseCodec)
+		{
+			TArray<FTransform> Pose;
+			Pose.AddDefaulted(NumBones);
+			const double DecodeStartTime = FPlatformTime::Seconds();
+			for (int32 SampleIndex = 0; SampleIndex <= NumSamples; SampleIndex++)
+			{
+				const float RelativePos = static_cast<float>(SampleIndex) / NumSamples;
+				for (int32 BoneIndex = 0; BoneIndex < NumBones; BoneIndex++)
+				{
+					Pose[BoneIndex].SetRotation(PoseCodec->GetTrackRotation(BoneIndex, RelativePos, EAnimInterpolationType::Linear));
+					Pose[BoneIndex].SetLocation(PoseCodec->GetTrackLocation(BoneIndex, RelativePos, EAnimInterpolationType::Linear));
+					Pose[BoneIndex].SetScale3D(PoseCodec->GetTrackScale(BoneIndex, RelativePos, EAnimInterpolationType::Linear));
+				}
+			}
+			return (FPlatformTime::Seconds() - DecodeStartTime) * 1000000000.0 / (NumSamples + 1);
+		};
+
+	const double RawPoseTime = DecodePoses(RawCodec);
+	const double PoseTime = DecodePoses(Codec);
+
+	AddInfo(FString::Printf(TEXT("%d bones, %d frames: %lld -> %lld bytes (%.2f:1) in %.2f ms, decode %.0f ns per pose (raw %.0f ns)"),
+		NumBones, NumFrames, Codec->GetRawSize(), Codec->GetCompressedSize(), static_cast<double>(Codec->GetRawSize()) / Codec->GetCompressedSize(), CompressionTime * 1000.0, PoseTime, RawPoseTime));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Benchmark_PoseDecompression, "glTFRuntime.Benchmarks.PoseDecompression", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FglTFRuntimeTests_Benchmark_PoseDecompression::RunTest(const FString& Parameters)
+{
+	const int32 NumCharacters = 100;
+	const int32 NumBones = 100;
+	const int32 NumFrames = 300;
+	const int32 NumTicks = 120;
+
+	// a different loop for every character
+	TArray<UglTFAnimBoneCompressionCodec*> Codecs;
+	for (int32 CharacterIndex = 0; CharacterIndex < NumCharacters; CharacterIndex++)
+	{
+		UglTFAnimBoneCompressionCodec* Codec = NewObject<UglTFAnimBoneCompressionCodec>();
+		Codec->Tracks.AddDefaulted(NumBones);
+		for (int32 BoneIndex = 0; BoneIndex < NumBones; BoneIndex++)
+		{
+			FRawAnimSequenceTrack& Track = Codec->Tracks[BoneIndex];
+			const FVector Axis = FVector(FMath::Sin(static_cast<float>(BoneIndex + CharacterIndex)), FMath::Cos(static_cast<float>(BoneIndex)), 0.5f).GetSafeNormal();
+			for (int32 FrameIndex = 0; FrameIndex < NumFrames; FrameIndex++)
+			{
+				const float Phase = 2 * PI * FrameIndex / (NumFrames - 1);
+				Track.RotKeys.Emplace(FQuat(Axis, FMath::Sin(Phase + BoneIndex) * 0.5f));
+				Track.PosKeys.Emplace(FVector(FMath::Sin(Phase) * BoneIndex, 0, 10));
+				Track.ScaleKeys.Emplace(FVector::OneVector);
+			}
+		}
+		Codecs.Add(Codec);
+	}
+
+	TArray<BoneTrackPair> Pairs;
+	for (int32 BoneIndex = 0; BoneIndex < NumBones; BoneIndex++)
+	{
+		Pairs.Add(BoneTrackPair(BoneIndex, BoneIndex));
+	}
+
+	TArray<FTransform> Pose;
+	Pose.AddDefaulted(NumBones);
+	TArrayView<FTransform> PoseView(Pose);
+
+	TArray<FTransform> LegacyPose;
+	LegacyPose.AddDefaulted(NumBones);
+
+	double LegacyTime = 0;
+	double Time = 0;
+	float MaxRotationError = 0;
+	float MaxTranslationError = 0;
+
+	for (int32 TickIndex = 0; TickIndex < NumTicks; TickIndex++)
+	{
+		for (int32 CharacterIndex = 0; CharacterIndex < NumCharacters; CharacterIndex++)
+		{
+			const UglTFAnimBoneCompressionCodec* Codec = Codecs[CharacterIndex];
+			const float RelativePos = FMath::Frac((TickIndex + CharacterIndex * 0.37f) / NumTicks);
+
+			// per track lookups and slerp (the previous DecompressPose strategy)
+			double StartTime = FPlatformTime::Seconds();
+			for (int32 BoneIndex = 0; BoneIndex < NumBones; BoneIndex++)
+			{
+				LegacyPose[BoneIndex].SetRotation(Codec->GetTrackRotation(BoneIndex, RelativePos, EAnimInterpolationType::Linear));
+			}
+			for (int32 BoneIndex = 0; BoneIndex < NumBones; BoneIndex++)
+			{
+				LegacyPose[BoneIndex].SetLocation(Codec->GetTrackLocation(BoneIndex, RelativePos, EAnimInterpolationType::Linear));
+			}
+			for (int32 BoneIndex = 0; BoneIndex < NumBones; BoneIndex++)
+			{
+				LegacyPose[BoneIndex].SetScale3D(Codec->GetTrackScale(BoneIndex, RelativePos, EAnimInterpolationType::Linear));
+			}
+			LegacyTime += FPlatformTime::Seconds() - StartTime;
+
+			StartTime = FPlatformTime::Seconds();
+			Codec->DecompressPose(RelativePos, EAnimInterpolationType::Linear, Pairs, Pairs, Pairs, PoseView);
+			Time += FPlatformTime::Seconds() - StartTime;
+
+			for (int32 BoneIndex = 0; BoneIndex < NumBones; BoneIndex++)
+			{
+				MaxRotationError = FMath::Max(MaxRotationError, static_cast<float>(Pose[BoneIndex].GetRotation().AngularDistance(LegacyPose[BoneIndex].GetRotation())));
+				MaxTranslationError = FMath::Max(MaxTranslationError, static_cast<float>(FVector::Distance(Pose[BoneIndex].GetLocation(), LegacyPose[BoneIndex].GetLocation())));
+			}
+		}
+	}
+
+	// normalized lerp between adjacent frames is indistinguishable from slerp
+	TestTrue(FString::Printf(TEXT("Rotation error %f degrees"), FMath::RadiansToDegrees(MaxRotationError)), FMath::RadiansToDegrees(MaxRotationError) < 0.01f);
+	TestTrue(FString::Printf(TEXT("Translation error %f"), MaxTranslationError), MaxTranslationError < 0.001f);
+
+	const int32 NumPoses = NumCharacters * NumTicks;
+	AddInfo(FString::Printf(TEXT("%d characters, %d bones: per track %.0f ns per pose, batched %.0f ns per pose (%.2fx), %.3f ms per tick"),
+		NumCharacters, NumBones, LegacyTime * 1000000000.0 / NumPoses, Time * 1000000000.0 / NumPoses, LegacyTime / Time, Time * 1000.0 / NumTicks));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Benchmark_NodeCurveEvaluation, "glTFRuntime.Benchmarks.NodeCurveEvaluation", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FglTFRuntimeTests_Benchmark_NodeCurveEvaluation::RunTest(const FString& Parameters)
+{
+	const int32 NumNodes = 500;
+	const int32 NumKeys = 120;
+	const int32 NumTicks = 240;
+	const float Duration = 4;
+
+	const FMatrix SceneBasis = FglTFRuntimeConfig().GetMatrix();
+
+	// a village worth of flags and fans, every node with its own phase
+	TArray<UglTFRuntimeAnimationCurve*> AnimationCurves;
+	for (int32 NodeIndex = 0; NodeIndex < NumNodes; NodeIndex++)
+	{
+		AnimationCurves.Add(glTFRuntime::Tests::BuildNodeBenchmarkCurve(NumKeys, Duration, NodeIndex, SceneBasis));
+	}
+
+	TArray<FglTFRuntimeBakedAnimationCursor> Cursors;
+	Cursors.AddDefaulted(NumNodes);
+
+	TArray<FTransform> Transforms;
+	Transforms.AddDefaulted(NumNodes);
+
+	double LegacyTime = 0;
+	double Time = 0;
+	float MaxError = 0;
+
+	for (int32 TickIndex = 0; TickIndex < NumTicks; TickIndex++)
+	{
+		const float AnimationTime = Duration * TickIndex / NumTicks;
+
+		double StartTime = FPlatformTime::Seconds();
+		for (int32 NodeIndex = 0; NodeIndex < NumNodes; NodeIndex++)
+		{
+			Transforms[NodeIndex] = AnimationCurves[NodeIndex]->GetTransformValue(AnimationTime);
+		}
+		LegacyTime += FPlatformTime::Seconds() - StartTime;
+
+		StartTime = FPlatformTime::Seconds();
+		for (int32 NodeIndex = 0; NodeIndex < NumNodes; NodeIndex++)
+		{
+			const FTransform Transform = AnimationCurves[NodeIndex]->GetBakedCurve().Evaluate(AnimationTime, Cursors[NodeIndex]);
+			MaxError = FMath::Max(MaxError, static_cast<float>(FVector::Distance(Transform.GetLocation(), Transforms[NodeIndex].GetLocation())));
+			Transforms[NodeIndex] = Transform;
+		}
+		Time += FPlatformTime::Seconds() - StartTime;
+	}
+
+	TestTrue(FString::Printf(TEXT("Location error %f"), MaxError), MaxError < 0.001f);
+
+	const int32 NumEvaluations = NumNodes * NumTicks;
+	AddInfo(FString::Printf(TEXT("%d nodes, %d keys: rich curves %.0f ns per node, baked %.0f ns per node (%.2fx)"),
+		NumNodes, NumKeys, LegacyTime * 1000000000.0 / NumEvaluations, Time * 1000000000.0 / NumEvaluations, LegacyTime / Time));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Benchmark_NodeAnimationSubsystem, "glTFRuntime.Benchmarks.NodeAnimationSubsystem", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FglTFRuntimeTests_Benchmark_NodeAnimationSubsystem::RunTest(const FString& Parameters)
+{
+	const int32 NumActors = 250;
+	const int32 NumNodesPerActor = 8;
+	const int32 NumKeys = 120;
+	const int32 NumTicks = 240;
+	const float Duration = 4;
+	const float DeltaTime = 1.f / 60;
+
+	const FMatrix SceneBasis = FglTFRuntimeConfig().GetMatrix();
+
+	glTFRuntime::Tests::FTransientWorld TransientWorld;
+	UglTFRuntimeNodeAnimationSubsystem* Subsystem = TransientWorld.World->GetSubsystem<UglTFRuntimeNodeAnimationSubsystem>();
+	if (!TestNotNull("Subsystem", Subsystem))
+	{
+		return false;
+	}
+
+	TArray<UglTFRuntimeAnimationCurve*> AnimationCurves;
+	for (int32 NodeIndex = 0; NodeIndex < NumNodesPerActor; NodeIndex++)
+	{
+		AnimationCurves.Add(glTFRuntime::Tests::BuildNodeBenchmarkCurve(NumKeys, Duration, NodeIndex, SceneBasis));
+	}
+
+	TArray<TPair<USceneComponent*, UglTFRuntimeAnimationCurve*>> Nodes;
+	for (int32 ActorIndex = 0; ActorIndex < NumActors; ActorIndex++)
+	{
+		AActor* Actor = TransientWorld.World->SpawnActor<AActor>();
+		Actor->PrimaryActorTick.bCanEverTick = true;
+		Actor->SetActorTickEnabled(true);
+
+		TMap<USceneComponent*, UglTFRuntimeAnimationCurve*> NodeAnimations;
+		for (UglTFRuntimeAnimationCurve* AnimationCurve : AnimationCurves)
+		{
+			USceneComponent* Component = NewObject<USceneComponent>(Actor);
+			Component->RegisterComponent();
+			NodeAnimations.Add(Component, AnimationCurve);
+			Nodes.Emplace(Component, AnimationCurve);
+		}
+		Subsystem->RegisterNodeAnimations(Actor, NodeAnimations);
+	}
+
+	// per component rich curves evaluation (the previous AglTFRuntimeAssetActor::Tick strategy)
+	double StartTime = FPlatformTime::Seconds();
+	for (int32 TickIndex = 0; TickIndex < NumTicks; TickIndex++)
+	{
+		const float AnimationTime = FMath::Fmod(DeltaTime * TickIndex, Duration);
+		for (const TPair<USceneComponent*, UglTFRuntimeAnimationCurve*>& Node : Nodes)
+		{
+			Node.Key->SetRelativeTransform(Node.Value->GetTransformValue(AnimationTime));
+		}
+	}
+	const double LegacyTime = FPlatformTime::Seconds() - StartTime;
+
+	StartTime = FPlatformTime::Seconds();
+	for (int32 TickIndex = 0; TickIndex < NumTicks; TickIndex++)
+	{
+		Subsystem->Tick(DeltaTime);
+	}
+	const double Time = FPlatformTime::Seconds() - StartTime;
+
+	// the subsystem restarts the animations past their duration
+	float AnimationTime = 0;
+	for (int32 TickIndex = 0; TickIndex < NumTicks - 1; TickIndex++)
+	{
+		AnimationTime += DeltaTime;
+		if (AnimationTime > Duration)
+		{
+			AnimationTime = 0;
+		}
+	}
+
+	float MaxError = 0;
+	for (const TPair<USceneComponent*, UglTFRuntimeAnimationCurve*>& Node : Nodes)
+	{
+		FglTFRuntimeBakedAnimationCursor Cursor;
+		const FTransform Expected = Node.Value->GetBakedCurve().Evaluate(AnimationTime, Cursor);
+		MaxError = FMath::Max(MaxError, static_cast<float>(FVector::Distance(Node.Key->GetRelativeLocation(), Expected.GetLocation())));
+	}
+
+	TestEqual("GetNumNodeAnimations() == NumActors * NumNodesPerActor", Subsystem->GetNumNodeAnimations(), NumActors * NumNodesPerActor);
+	TestTrue(FString::Printf(TEXT("Location error %f"), MaxError), MaxError < 0.001f);
+
+	const int32 NumEvaluations = Nodes.Num() * NumTicks;
+	AddInfo(FString::Printf(TEXT("%d actors, %d nodes each, %d keys: per component %.0f ns per node, subsystem %.0f ns per node (%.2fx)"),
+		NumActors, NumNodesPerActor, NumKeys, LegacyTime * 1000000000.0 / NumEvaluations, Time * 1000000000.0 / NumEvaluations, LegacyTime / Time));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Benchmark_ZipPrefetch, "glTFRuntime.Benchmarks.ZipPrefetch", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FglTFRuntimeTests_Benchmark_ZipPrefetch::RunTest(const FString& Parameters)
+{
+	const int32 NumEntries = 48;
+	const int32 EntrySize = 1024 * 1024;
+
+	// texture-like entries: noise over smooth gradients (compressible, but not trivially)
+	TArray<FString> Filenames;
+	TArray<TArray64<uint8>> Contents;
+	FRandomStream RandomStream(23);
+	for (int32 EntryIndex = 0; EntryIndex < NumEntries; EntryIndex++)
+	{
+		Filenames.Add(FString::Printf(TEXT("textures/texture_%d.png"), EntryIndex));
+		TArray64<uint8>& Content = Contents.AddDefaulted_GetRef();
+		Content.AddUninitialized(EntrySize);
+		for (int32 ByteIndex = 0; ByteIndex < EntrySize; ByteIndex++)
+		{
+			Content[ByteIndex] = static_cast<uint8>(((ByteIndex / 1024) + EntryIndex) & 0xFF) ^ static_cast<uint8>(RandomStream.RandHelper(8));
+		}
+	}
+
+	// a long comment moves the end of central directory record away from the end of the archive
+	const TArray64<uint8> Zip = glTFRuntime::Tests::BuildZipArchive(Filenames, Contents, 4000);
+
+	double StartTime = FPlatformTime::Seconds();
+	FglTFRuntimeArchiveZip CopiedArchive;
+	if (!TestTrue("CopiedArchive.FromData()", CopiedArchive.FromData(Zip.GetData(), Zip.Num())))
+	{
+		return false;
+	}
+	const double CopyTime = FPlatformTime::Seconds() - StartTime;
+
+	TArray64<uint8> ZipCopy = Zip;
+	StartTime = FPlatformTime::Seconds();
+	FglTFRuntimeArchiveZip AdoptedArchive;
+	if (!TestTrue("AdoptedArchive.FromData()", AdoptedArchive.FromData(MoveTemp(ZipCopy))))
+	{
+		return false;
+	}
+	const double AdoptTime = FPlatformTime::Seconds() - StartTime;
+
+	// on demand, one entry at a time
+	StartTime = FPlatformTime::Seconds();
+	int32 NumMismatches = 0;
+	for (int32 EntryIndex = 0; EntryIndex < NumEntries; EntryIndex++)
+	{
+		TArray64<uint8> Content;
+		if (!CopiedArchive.GetFileContent(Filenames[EntryIndex], Content) || Content != Contents[EntryIndex])
+		{
+			NumMismatches++;
+		}
+	}
+	const double SerialTime = FPlatformTime::Seconds() - StartTime;
+
+	StartTime = FPlatformTime::Seconds();
+	const int32 NumPrefetched = AdoptedArchive.PrefetchFiles(Filenames);
+	for (int32 EntryIndex = 0; EntryIndex < NumEntries; EntryIndex++)
+	{
+		TArray64<uint8> Content;
+		if (!AdoptedArchive.GetFileContent(Filenames[EntryIndex], Content) || Content != Contents[EntryIndex])
+		{
+			NumMismatches++;
+		}
+	}
+	const double PrefetchTime = FPlatformTime::Seconds() - StartTime;
+
+	TestEqual("NumPrefetched", NumPrefetched, NumEntries);
+	TestEqual("NumMismatches", NumMismatches, 0);
+
+	AddInfo(FString::Printf(TEXT("%d entries (%.1f MB zip): FromData copy %.3f ms, adopt %.3f ms, serial inflate %.2f ms, prefetch %.2f ms (%.2fx)"),
+		NumEntries, Zip.Num() / (1024.0 * 1024.0), CopyTime * 1000.0, AdoptTime * 1000.0, SerialTime * 1000.0, PrefetchTime * 1000.0, SerialTime / PrefetchTime));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Benchmark_ZipDecompression, "glTFRuntime.Benchmarks.ZipDecompression", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FglTFRuntimeTests_Benchmark_ZipDecompression::RunTest(const FString& Parameters)
+{
+	const int32 NumEntries = 4;
+	const int32 NumReads = 8;
+
+	// a 256x256 grid mesh (positions, uvs and indices) compressed by the zstd cli (-19, one frame every 256 KB, like multithreaded encoders)
+	glTFRuntime::Tests::FFixture Fixture("Zstd/Grid256.zst");
+	if (Fixture.Blob.Num() == 0)
+	{
+		AddWarning(TEXT("Zstd/Grid256.zst fixture not found, skipping the benchmark"));
+		return true;
+	}
+
+	TArray<FglTFRuntimeZstdFrame> Frames;
+	TArray64<uint8> Grid;
+	if (!TestTrue("FglTFRuntimeZstd::GetFrames()", FglTFRuntimeZstd::GetFrames(Fixture.Blob.GetData(), Fixture.Blob.Num(), Frames)) ||
+		!TestTrue("FglTFRuntimeZstd::Decompress()", FglTFRuntimeZstd::Decompress(Fixture.Blob.GetData(), Fixture.Blob.Num(), Grid)))
+	{
+		return false;
+	}
+	TestEqual("Grid CRC32", FCrc::MemCrc32(Grid.GetData(), static_cast<int32>(Grid.Num())), 0xFFDE6F11u);
+
+	TArray<FString> Filenames;
+	TArray<TArray64<uint8>> Contents;
+	for (int32 EntryIndex = 0; EntryIndex < NumEntries; EntryIndex++)
+	{
+		Filenames.Add(FString::Printf(TEXT("buffers/buffer_%d.bin"), EntryIndex));
+		Contents.Add(Grid);
+	}
+
+	const TArray64<uint8> DeflateZip = glTFRuntime::Tests::BuildZipArchive(Filenames, Contents, 0);
+	const TArray64<uint8> ZstdZip = glTFRuntime::Tests::BuildZipArchive(Filenames, Contents, 0, 93, [&](const TArray64<uint8>& Content) { return Fixture.Blob; });
+
+	FglTFRuntimeArchiveZip DeflateArchive;
+	FglTFRuntimeArchiveZip ZstdArchive;
+	if (!TestTrue("DeflateArchive.FromData()", DeflateArchive.FromData(DeflateZip.GetData(), DeflateZip.Num())) ||
+		!TestTrue("ZstdArchive.FromData()", ZstdArchive.FromData(ZstdZip.GetData(), ZstdZip.Num())))
+	{
+		return false;
+	}
+
+	// entries are checked after the timed reads
+	TArray<TArray64<uint8>> ReadContents;
+	ReadContents.SetNum(NumEntries);
+	int32 NumMismatches = 0;
+	auto ReadEntries = [&](FglTFRuntimeArchiveZip& Archive)
+	{
+		double Time = 0;
+		for (int32 ReadIndex = 0; ReadIndex < NumReads; ReadIndex++)
+		{
+			bool bSuccess = true;
+			const double StartTime = FPlatformTime::Seconds();
+			for (int32 EntryIndex = 0; EntryIndex < NumEntries; EntryIndex++)
+			{
+				ReadContents[EntryIndex].Empty();
+				bSuccess &= Archive.GetFileContent(Filenames[EntryIndex], ReadContents[EntryIndex]);
+			}
+			Time += FPlatformTime::Seconds() - StartTime;
+
+			for (int32 EntryIndex = 0; EntryIndex < NumEntries; EntryIndex++)
+			{
+				if (!bSuccess || ReadContents[EntryIndex] != Grid)
+				{
+					NumMismatches++;
+				}
+			}
+		}
+		return Time / NumReads;
+	};
+
+	const double DeflateTime = ReadEntries(DeflateArchive);
+	const double ZstdTime = ReadEntries(ZstdArchive);
+
+	TestEqual("NumMismatches", NumMismatches, 0);
+
+	AddInfo(FString::Printf(TEXT("%d entries of %.1f MB: deflate %.2f ms (%.1f MB zip), zstd %d frames per entry %.2f ms (%.1f MB zip) (%.2fx)"),
+		NumEntries, Grid.Num() / (1024.0 * 1024.0), DeflateTime * 1000.0, DeflateZip.Num() / (1024.0 * 1024.0), Frames.Num(),
+		ZstdTime * 1000.0, ZstdZip.Num() / (1024.0 * 1024.0), DeflateTime / ZstdTime));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Benchmark_Base64Decode, "glTFRuntime.Benchmarks.Base64Decode", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FglTFRuntimeTests_Benchmark_Base64Decode::RunTest(const FString& Parameters)
+{
+	const int32 NumBytes = 36 * 1024 * 1024;
+
+	TArray<uint8> Bytes;
+	Bytes.AddUninitialized(NumBytes);
+	FRandomStream RandomStream(25);
+	for (int32 ByteIndex = 0; ByteIndex < NumBytes; ByteIndex++)
+	{
+		Bytes[ByteIndex] = static_cast<uint8>(RandomStream.RandHelper(256));
+	}
+
+	// a data uri like the ones of embedded .gltf buffers
+	const FString Uri = TEXT("data:application/octet-stream;base64,") + FBase64::Encode(Bytes);
+	const int32 DataIndex = Uri.Find(TEXT(",")) + 1;
+
+	// previous path: substring copy, temporary array and append
+	double StartTime = FPlatformTime::Seconds();
+	TArray<uint8> EngineBytes;
+	TArray64<uint8> EngineOutput;
+	const bool bEngineSuccess = FBase64::Decode(Uri.Mid(DataIndex), EngineBytes);
+	EngineOutput.Append(EngineBytes.GetData(), EngineBytes.Num());
+	const double EngineTime = FPlatformTime::Seconds() - StartTime;
+
+	StartTime = FPlatformTime::Seconds();
+	TArray64<uint8> Output;
+	const bool bSuccess = FglTFRuntimeBase64::Decode(*Uri + DataIndex, Uri.Len() - DataIndex, Output);
+	const double DecodeTime = FPlatformTime::Seconds() - StartTime;
+
+	TestTrue("bEngineSuccess", bEngineSuccess);
+	TestTrue("bSuccess", bSuccess);
+	TestTrue("Output == Bytes", Output.Num() == NumBytes && FMemory::Memcmp(Output.GetData(), Bytes.GetData(), NumBytes) == 0);
+
+	AddInfo(FString::Printf(TEXT("%.1f MB Base64 uri: FBase64 %.2f ms, FglTFRuntimeBase64 %.2f ms (%.2fx)"),
+		Uri.Len() / (1024.0 * 1024.0), EngineTime * 1000.0, DecodeTime * 1000.0, EngineTime / DecodeTime));
+
+	return true;
+}
+
+#endif
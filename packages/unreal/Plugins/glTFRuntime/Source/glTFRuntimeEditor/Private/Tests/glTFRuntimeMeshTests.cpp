@@ -2,7 +2,10 @@
 
 #if WITH_DEV_AUTOMATION_TESTS
 #include "glTFRuntimeEditor.h"
+#include "glTFRuntimeCookedMeshCache.h"
 #include "glTFRuntimeFunctionLibrary.h"
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
 #include "Misc/AutomationTest.h"
 
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Mesh_Blender_Plane, "glTFRuntime.UnitTests.Mesh.Blender.Plane", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
@@ -159,4 +162,218 @@ bool FglTFRuntimeTests_Mesh_BadMesh::RunTest(const FString& Parameters)
 	return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Mesh_CookedMeshCacheRoundTrip, "glTFRuntime.UnitTests.Mesh.CookedMeshCacheRoundTrip", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeTests_Mesh_CookedMeshCacheRoundTrip::RunTest(const FString& Parameters)
+{
+	FglTFRuntimeMeshLOD LOD;
+	LOD.bHasNormals = true;
+	FglTFRuntimePrimitive& Primitive = LOD.Primitives.AddDefaulted_GetRef();
+	Primitive.Positions = { { 0, 0, 100 }, { -100, 0, 0 }, { 100, 0, 0 } };
+	Primitive.Normals = { { 0, 1, 0 }, { 0, 1, 0 }, { 0, 1, 0 } };
+	Primitive.Indices = { 0, 1, 2 };
+	Primitive.Joints.AddDefaulted();
+	Primitive.Joints[0].AddDefaulted(3);
+	Primitive.Weights.AddDefaulted();
+	Primitive.Weights[0].Init(FVector4(1, 0, 0, 0), 3);
+	Primitive.MaterialIndex = 2;
+	FglTFRuntimeMorphTarget& EmptyMorphTarget = Primitive.MorphTargets.AddDefaulted_GetRef();
+	EmptyMorphTarget.Name = TEXT("Empty");
+	EmptyMorphTarget.bSparse = true;
+
+	TArray<FglTFRuntimeBone> Skeleton;
+	Skeleton.AddDefaulted();
+	Skeleton[0].BoneName = "root";
+
+	TMap<int32, FName> BoneMap;
+	BoneMap.Add(0, "root");
+
+	const FString Filename = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("CookedMeshCacheRoundTrip.gltfmesh"));
+	TestTrue("FglTFRuntimeCookedMeshCache::Save()", FglTFRuntimeCookedMeshCache::Save(Filename, LOD, Skeleton, BoneMap));
+
+	FglTFRuntimeMeshLOD CookedLOD;
+	TestTrue("FglTFRuntimeCookedMeshCache::Load()", FglTFRuntimeCookedMeshCache::Load(Filename, CookedLOD));
+	IFileManager::Get().Delete(*Filename);
+
+	TestTrue("CookedLOD.bHasNormals", CookedLOD.bHasNormals);
+	TestEqual("CookedLOD.Skeleton.Num() == 1", CookedLOD.Skeleton.Num(), 1);
+	TestEqual("CookedLOD.Primitives.Num() == 1", CookedLOD.Primitives.Num(), 1);
+	if (CookedLOD.Primitives.Num() != 1)
+	{
+		return false;
+	}
+
+	TestEqual("CookedLOD.Primitives[0].Positions", CookedLOD.Primitives[0].Positions, Primitive.Positions);
+	TestEqual("CookedLOD.Primitives[0].Indices = { 0, 1, 2 }", CookedLOD.Primitives[0].Indices, { 0, 1, 2 });
+	TestEqual("CookedLOD.Primitives[0].Weights[0].Num() == 3", CookedLOD.Primitives[0].Weights[0].Num(), 3);
+	TestEqual("CookedLOD.Primitives[0].MaterialIndex == 2", CookedLOD.Primitives[0].MaterialIndex, 2);
+	TestEqual("CookedLOD.Primitives[0].OverrideBoneMap", CookedLOD.Primitives[0].OverrideBoneMap[0], FName("root"));
+	TestEqual("CookedLOD.Primitives[0].MorphTargets.Num() == 1", CookedLOD.Primitives[0].MorphTargets.Num(), 1);
+	if (CookedLOD.Primitives[0].MorphTargets.Num() == 1)
+	{
+		TestTrue("CookedLOD.Primitives[0].MorphTargets[0].IsSparse()", CookedLOD.Primitives[0].MorphTargets[0].IsSparse());
+		TestEqual("CookedLOD.Primitives[0].MorphTargets[0].Indices.Num() == 0", CookedLOD.Primitives[0].MorphTargets[0].Indices.Num(), 0);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Mesh_CookedMeshCacheKey, "glTFRuntime.UnitTests.Mesh.CookedMeshCacheKey", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeTests_Mesh_CookedMeshCacheKey::RunTest(const FString& Parameters)
+{
+	const uint8 Content[] = { 1, 2, 3, 4 };
+
+	FglTFRuntimeConfig LoaderConfig;
+	const FString ContentHash = FglTFRuntimeCookedMeshCache::HashContent(Content, sizeof(Content), LoaderConfig);
+
+	// the runtime context and the async settings do not change the cooked data
+	FglTFRuntimeConfig ContextLoaderConfig = LoaderConfig;
+	ContextLoaderConfig.RuntimeContextObject = GetTransientPackage();
+	ContextLoaderConfig.RuntimeContextString = TEXT("context");
+	ContextLoaderConfig.AsyncPriority = EglTFRuntimeAsyncPriority::High;
+	TestEqual("HashContent() ignores the runtime context", FglTFRuntimeCookedMeshCache::HashContent(Content, sizeof(Content), ContextLoaderConfig), ContentHash);
+
+	FglTFRuntimeConfig ScaledLoaderConfig = LoaderConfig;
+	ScaledLoaderConfig.SceneScale = 1;
+	TestNotEqual("HashContent() depends on the scene scale", FglTFRuntimeCookedMeshCache::HashContent(Content, sizeof(Content), ScaledLoaderConfig), ContentHash);
+
+	FglTFRuntimeSkeletalMeshConfig SkeletalMeshConfig;
+	const FString Filename = FglTFRuntimeCookedMeshCache::GetFilename(ContentHash, 0, 0, SkeletalMeshConfig);
+	TestFalse("GetFilename() is not empty", Filename.IsEmpty());
+
+	FglTFRuntimeSkeletalMeshConfig OuterSkeletalMeshConfig = SkeletalMeshConfig;
+	OuterSkeletalMeshConfig.Outer = GetTransientPackage();
+	OuterSkeletalMeshConfig.bPerPolyCollision = true;
+	TestEqual("GetFilename() ignores the outer and the collision settings", FglTFRuntimeCookedMeshCache::GetFilename(ContentHash, 0, 0, OuterSkeletalMeshConfig), Filename);
+
+	FglTFRuntimeSkeletalMeshConfig MappedSkeletalMeshConfig = SkeletalMeshConfig;
+	MappedSkeletalMeshConfig.SkeletonConfig.BonesNameMap.Add(TEXT("a"), TEXT("b"));
+	TestNotEqual("GetFilename() depends on the bones name map", FglTFRuntimeCookedMeshCache::GetFilename(ContentHash, 0, 0, MappedSkeletalMeshConfig), Filename);
+
+	FglTFRuntimeSkeletalMeshConfig SmoothSkeletalMeshConfig = SkeletalMeshConfig;
+	SmoothSkeletalMeshConfig.bSmoothNormals = true;
+	TestNotEqual("GetFilename() depends on the normals generation", FglTFRuntimeCookedMeshCache::GetFilename(ContentHash, 0, 0, SmoothSkeletalMeshConfig), Filename);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Mesh_SparseMorphTargets, "glTFRuntime.UnitTests.Mesh.SparseMorphTargets", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeTests_Mesh_SparseMorphTargets::RunTest(const FString& Parameters)
+{
+	// two triangles, the first one with a sparse target moving its second vertex, the second one with an incomplete (all zeros) sparse target
+	glTFRuntime::Tests::FFixturePath Fixture("SparseMorphTargets.gltf");
+
+	FglTFRuntimeConfig LoaderConfig;
+	UglTFRuntimeAsset* Asset = UglTFRuntimeFunctionLibrary::glTFLoadAssetFromFilename(Fixture.Path, false, LoaderConfig);
+
+	const FVector Delta = Asset->GetParser()->TransformPosition(FVector(0, 0, 1));
+
+	FglTFRuntimeMaterialsConfig MaterialsConfig;
+	FglTFRuntimeMeshLOD LOD;
+	TestTrue("Asset->LoadMeshAsRuntimeLOD()", Asset->LoadMeshAsRuntimeLOD(0, LOD, MaterialsConfig));
+
+	TestEqual("LOD.Primitives.Num() == 2", LOD.Primitives.Num(), 2);
+	if (LOD.Primitives.Num() != 2 || LOD.Primitives[0].MorphTargets.Num() != 1 || LOD.Primitives[1].MorphTargets.Num() != 1)
+	{
+		return false;
+	}
+
+	const FglTFRuntimeMorphTarget& SparseMorphTarget = LOD.Primitives[0].MorphTargets[0];
+	TestTrue("SparseMorphTarget.IsSparse()", SparseMorphTarget.IsSparse());
+	TestEqual("SparseMorphTarget.Indices = { 1 }", SparseMorphTarget.Indices, { 1 });
+	TestEqual("SparseMorphTarget.Positions = { Delta }", SparseMorphTarget.Positions, { Delta });
+
+	const FglTFRuntimeMorphTarget& IncompleteMorphTarget = LOD.Primitives[1].MorphTargets[0];
+	TestTrue("IncompleteMorphTarget.IsSparse()", IncompleteMorphTarget.IsSparse());
+	TestEqual("IncompleteMorphTarget.Indices.Num() == 0", IncompleteMorphTarget.Indices.Num(), 0);
+	TestEqual("IncompleteMorphTarget.Positions.Num() == 0", IncompleteMorphTarget.Positions.Num(), 0);
+
+	MaterialsConfig.bMergeSectionsByMaterial = true;
+	FglTFRuntimeMeshLOD MergedLOD;
+	TestTrue("Asset->LoadMeshAsRuntimeLOD() merged", Asset->LoadMeshAsRuntimeLOD(0, MergedLOD, MaterialsConfig));
+
+	TestEqual("MergedLOD.Primitives.Num() == 1", MergedLOD.Primitives.Num(), 1);
+	if (MergedLOD.Primitives.Num() != 1 || MergedLOD.Primitives[0].MorphTargets.Num() != 1)
+	{
+		return false;
+	}
+
+	TestEqual("MergedLOD.Primitives[0].Positions.Num() == 6", MergedLOD.Primitives[0].Positions.Num(), 6);
+
+	const FglTFRuntimeMorphTarget& MergedMorphTarget = MergedLOD.Primitives[0].MorphTargets[0];
+	TestTrue("MergedMorphTarget.IsSparse()", MergedMorphTarget.IsSparse());
+	TestEqual("MergedMorphTarget.Indices = { 1 }", MergedMorphTarget.Indices, { 1 });
+	TestEqual("MergedMorphTarget.Positions = { Delta }", MergedMorphTarget.Positions, { Delta });
+	TestEqual("MergedMorphTarget.Normals.Num() == 1", MergedMorphTarget.Normals.Num(), 1);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Mesh_CompactPrimitives, "glTFRuntime.UnitTests.Mesh.CompactPrimitives", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeTests_Mesh_CompactPrimitives::RunTest(const FString& Parameters)
+{
+	// a triangle with UNSIGNED_SHORT (WEIGHTS_0) and UNSIGNED_BYTE (WEIGHTS_1) normalized weights
+	glTFRuntime::Tests::FFixturePath Fixture("CompactWeights.gltf");
+
+	FglTFRuntimeConfig LoaderConfig;
+	UglTFRuntimeAsset* Asset = UglTFRuntimeFunctionLibrary::glTFLoadAssetFromFilename(Fixture.Path, false, LoaderConfig);
+	TSharedPtr<FglTFRuntimeParser> Parser = Asset->GetParser();
+	TSharedPtr<FJsonObject> JsonMeshObject = Parser->GetJsonObjectFromRootIndex("meshes", 0);
+	if (!JsonMeshObject)
+	{
+		return false;
+	}
+
+	FglTFRuntimeMaterialsConfig MaterialsConfig;
+	MaterialsConfig.bSkipLoad = true;
+
+	TArray<FglTFRuntimePrimitive> CompactPrimitives;
+	TestTrue("Parser->LoadPrimitives() compact", Parser->LoadPrimitives(JsonMeshObject.ToSharedRef(), CompactPrimitives, MaterialsConfig, true, true));
+	TArray<FglTFRuntimePrimitive> WidePrimitives;
+	TestTrue("Parser->LoadPrimitives() wide", Parser->LoadPrimitives(JsonMeshObject.ToSharedRef(), WidePrimitives, MaterialsConfig, true));
+	if (CompactPrimitives.Num() != 1 || WidePrimitives.Num() != 1)
+	{
+		return false;
+	}
+
+	const FglTFRuntimePrimitive& Compact = CompactPrimitives[0];
+	const FglTFRuntimePrimitive& Wide = WidePrimitives[0];
+
+	// decoded straight into the compact streams
+	TestTrue("Compact.bCompact", Compact.bCompact);
+	TestEqual("Compact.Positions.Num() == 0", Compact.Positions.Num(), 0);
+	TestEqual("Compact.Weights.Num() == 0", Compact.Weights.Num(), 0);
+	TestEqual("Compact.GetNumVertices() == 3", Compact.GetNumVertices(), 3);
+	TestEqual("Compact.CompactWeights.Num() == 2", Compact.CompactWeights.Num(), 2);
+	TestEqual("Compact.Indices = { 0, 1, 2 }", Compact.Indices, { 0, 1, 2 });
+	TestFalse("Wide.bCompact", Wide.bCompact);
+
+	// UNSIGNED_SHORT weights are kept bit exact, UNSIGNED_BYTE ones are rescaled exactly (x * 257)
+	TestEqual("Compact.GetQuantizedWeight(0, 1, 0) == 21845", Compact.GetQuantizedWeight(0, 1, 0), (uint16)21845);
+	TestEqual("Compact.GetQuantizedWeight(0, 2, 0) == 32768", Compact.GetQuantizedWeight(0, 2, 0), (uint16)32768);
+	TestEqual("Compact.GetQuantizedWeight(0, 2, 1) == 32767", Compact.GetQuantizedWeight(0, 2, 1), (uint16)32767);
+	TestEqual("Compact.GetQuantizedWeight(1, 0, 0) == 65535", Compact.GetQuantizedWeight(1, 0, 0), (uint16)65535);
+	TestEqual("Compact.GetQuantizedWeight(1, 1, 0) == 128 * 257", Compact.GetQuantizedWeight(1, 1, 0), (uint16)(128 * 257));
+
+	bool bMatch = true;
+	for (int32 VertexIndex = 0; VertexIndex < 3; VertexIndex++)
+	{
+		bMatch &= FVector(Compact.GetPosition(VertexIndex)).Equals(Wide.Positions[VertexIndex]);
+		for (int32 JointsIndex = 0; JointsIndex < 2; JointsIndex++)
+		{
+			for (int32 Influence = 0; Influence < 4; Influence++)
+			{
+				// the wide weights round to the same quantized values
+				bMatch &= Compact.GetQuantizedWeight(JointsIndex, VertexIndex, Influence) == Wide.GetQuantizedWeight(JointsIndex, VertexIndex, Influence);
+			}
+		}
+	}
+	TestTrue("Compact and wide primitives match", bMatch);
+
+	return true;
+}
+
 #endif
@@ -0,0 +1,222 @@
+// Copyright 2025 - Roberto De Ioris
+
+#if WITH_DEV_AUTOMATION_TESTS
+#include "glTFRuntimeEditor.h"
+#include "glTFRuntimeGLBStream.h"
+#include "glTFRuntimeTaskPool.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/ThreadSafeBool.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/ScopeLock.h"
+
+namespace glTFRuntime
+{
+	namespace Tests
+	{
+		template<typename Predicate>
+		bool WaitFor(Predicate Condition, const double Timeout = 10)
+		{
+			const double StartTime = FPlatformTime::Seconds();
+			while (!Condition())
+			{
+				if (FPlatformTime::Seconds() - StartTime > Timeout)
+				{
+					return false;
+				}
+				FPlatformProcess::Sleep(0.001f);
+			}
+			return true;
+		}
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_TaskPool_PriorityAndCancellation, "glTFRuntime.UnitTests.TaskPool.PriorityAndCancellation", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeTests_TaskPool_PriorityAndCancellation::RunTest(const FString& Parameters)
+{
+	FglTFRuntimeTaskPool& TaskPool = FglTFRuntimeTaskPool::Get();
+	const FglTFRuntimeTaskPoolStats InitialStats = TaskPool.GetStats();
+	const int32 NumThreads = InitialStats.NumThreads;
+
+	// occupy every worker, so the next tasks can only be queued
+	TArray<FEvent*> Gates;
+	for (int32 ThreadIndex = 0; ThreadIndex < NumThreads; ThreadIndex++)
+	{
+		FEvent* Gate = FPlatformProcess::GetSynchEventFromPool(true);
+		Gates.Add(Gate);
+		TaskPool.AddTask([Gate](const bool bCancelled)
+			{
+				Gate->Wait();
+			}, EglTFRuntimeAsyncPriority::High);
+	}
+
+	TestTrue("Workers busy", glTFRuntime::Tests::WaitFor([&]() { return TaskPool.GetStats().NumRunning >= NumThreads; }));
+
+	FCriticalSection OrderLock;
+	TArray<FString> Order;
+	auto Record = [&](const FString& Name)
+		{
+			return [&, Name](const bool bCancelled)
+				{
+					FScopeLock Lock(&OrderLock);
+					Order.Add(bCancelled ? Name + TEXT("(cancelled)") : Name);
+				};
+		};
+
+	FglTFRuntimeCancellationTokenPtr CancellationToken = MakeShared<FglTFRuntimeCancellationToken, ESPMode::ThreadSafe>();
+
+	TaskPool.AddTask(Record("Far"), EglTFRuntimeAsyncPriority::Low);
+	TaskPool.AddTask(Record("Nearby"), EglTFRuntimeAsyncPriority::Normal);
+	TaskPool.AddTask(Record("LocalPlayer"), EglTFRuntimeAsyncPriority::High);
+	TaskPool.AddTask(Record("Despawned"), EglTFRuntimeAsyncPriority::High, CancellationToken);
+	CancellationToken->Cancel();
+
+	const FglTFRuntimeTaskPoolStats QueuedStats = TaskPool.GetStats();
+	TestEqual("High queue depth", QueuedStats.QueueDepthHigh, 2);
+	TestEqual("Normal queue depth", QueuedStats.QueueDepthNormal, 1);
+	TestEqual("Low queue depth", QueuedStats.QueueDepthLow, 1);
+
+	// a single free worker drains the queues sequentially
+	Gates[0]->Trigger();
+	TestTrue("Queued tasks executed", glTFRuntime::Tests::WaitFor([&]() { FScopeLock Lock(&OrderLock); return Order.Num() == 4; }));
+
+	for (FEvent* Gate : Gates)
+	{
+		Gate->Trigger();
+	}
+
+	TestTrue("Workers released", glTFRuntime::Tests::WaitFor([&]() { return TaskPool.GetStats().NumRunning == 0; }));
+
+	for (FEvent* Gate : Gates)
+	{
+		FPlatformProcess::ReturnSynchEventToPool(Gate);
+	}
+
+	TestEqual("Execution order", Order, TArray<FString>({ TEXT("LocalPlayer"), TEXT("Despawned(cancelled)"), TEXT("Nearby"), TEXT("Far") }));
+
+	const FglTFRuntimeTaskPoolStats FinalStats = TaskPool.GetStats();
+	TestEqual("Cancelled tasks", FinalStats.NumCancelled - InitialStats.NumCancelled, 1);
+	TestEqual("Completed tasks", FinalStats.NumCompleted - InitialStats.NumCompleted, NumThreads + 3);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_TaskPool_Saturation, "glTFRuntime.UnitTests.TaskPool.Saturation", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeTests_TaskPool_Saturation::RunTest(const FString& Parameters)
+{
+	FglTFRuntimeTaskPool& TaskPool = FglTFRuntimeTaskPool::Get();
+	const FglTFRuntimeTaskPoolStats InitialStats = TaskPool.GetStats();
+	const int32 NumTasks = InitialStats.NumThreads * 8;
+
+	// every task hands its result to the game thread, which is not pumped until the pool is drained
+	int32 NumDelivered = 0;
+	for (int32 TaskIndex = 0; TaskIndex < NumTasks; TaskIndex++)
+	{
+		TaskPool.AddTask([&NumDelivered](const bool bCancelled)
+			{
+				FFunctionGraphTask::CreateAndDispatchWhenReady([&NumDelivered]()
+					{
+						NumDelivered++;
+					}, TStatId(), nullptr, ENamedThreads::GameThread);
+			});
+	}
+
+	TestTrue("Pool drained without the game thread", glTFRuntime::Tests::WaitFor([&]()
+		{
+			const FglTFRuntimeTaskPoolStats Stats = TaskPool.GetStats();
+			return Stats.NumCompleted - InitialStats.NumCompleted == NumTasks && Stats.NumRunning == 0;
+		}));
+
+	const FglTFRuntimeTaskPoolStats DrainedStats = TaskPool.GetStats();
+	TestEqual("Empty queues", DrainedStats.QueueDepthHigh + DrainedStats.QueueDepthNormal + DrainedStats.QueueDepthLow, 0);
+	TestEqual("Nothing delivered yet", NumDelivered, 0);
+
+	FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+	TestEqual("Every result delivered", NumDelivered, NumTasks);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_TaskPool_StreamingGate, "glTFRuntime.UnitTests.TaskPool.StreamingGate", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeTests_TaskPool_StreamingGate::RunTest(const FString& Parameters)
+{
+	FTCHARToUTF8 Json(TEXT("{\"asset\":{\"version\":\"2.0\"},\"buffers\":[{\"byteLength\":16}],\"bufferViews\":[{\"buffer\":0,\"byteLength\":8},{\"buffer\":0,\"byteOffset\":8,\"byteLength\":8}]}"));
+	const uint32 JsonLength = Align(Json.Length(), 4);
+	const uint32 BinaryLength = 16;
+	const uint32 TotalLength = 12 + 8 + JsonLength + 8 + BinaryLength;
+
+	TArray<uint8> GLB;
+	auto AppendUInt32 = [&GLB](const uint32 Value) { GLB.Append(reinterpret_cast<const uint8*>(&Value), 4); };
+	AppendUInt32(0x46546C67);
+	AppendUInt32(2);
+	AppendUInt32(TotalLength);
+	AppendUInt32(JsonLength);
+	AppendUInt32(0x4E4F534A);
+	GLB.Append(reinterpret_cast<const uint8*>(Json.Get()), Json.Length());
+	while (GLB.Num() % 4)
+	{
+		GLB.Add(' ');
+	}
+	AppendUInt32(BinaryLength);
+	AppendUInt32(0x004E4942);
+	for (uint32 Index = 0; Index < BinaryLength; Index++)
+	{
+		GLB.Add(Index);
+	}
+
+	// everything but the last buffer view
+	FglTFRuntimeConfig LoaderConfig;
+	TSharedRef<FglTFRuntimeGLBStream, ESPMode::ThreadSafe> Stream = MakeShared<FglTFRuntimeGLBStream, ESPMode::ThreadSafe>(LoaderConfig);
+	Stream->Append(GLB.GetData(), TotalLength - 8);
+
+	TSharedPtr<FglTFRuntimeParser> Parser = FglTFRuntimeParser::FromStream(Stream, LoaderConfig);
+	TestTrue("Parser != nullptr", Parser.IsValid());
+	if (!Parser)
+	{
+		return false;
+	}
+
+	FglTFRuntimeTaskPool& TaskPool = FglTFRuntimeTaskPool::Get();
+	const FglTFRuntimeTaskPoolStats InitialStats = TaskPool.GetStats();
+	const int32 NumTasks = InitialStats.NumThreads * 4;
+
+	// more loads than workers, each one reading the missing buffer view
+	FThreadSafeCounter NumLoaded;
+	for (int32 TaskIndex = 0; TaskIndex < NumTasks; TaskIndex++)
+	{
+		Parser->AddAsyncTask([Parser, &NumLoaded](const bool bCancelled)
+			{
+				FglTFRuntimeBlob Blob;
+				int64 Stride;
+				if (Parser->GetBufferView(1, Blob, Stride) && Blob.Data[7] == 15)
+				{
+					NumLoaded.Increment();
+				}
+			});
+	}
+
+	// the loads are parked on the stream, not sleeping on pool workers
+	const FglTFRuntimeTaskPoolStats GatedStats = TaskPool.GetStats();
+	TestEqual("No running tasks", GatedStats.NumRunning, 0);
+	TestEqual("No queued tasks", GatedStats.QueueDepthHigh + GatedStats.QueueDepthNormal + GatedStats.QueueDepthLow, 0);
+
+	FThreadSafeBool bFreeTaskExecuted = false;
+	TaskPool.AddTask([&bFreeTaskExecuted](const bool bCancelled) { bFreeTaskExecuted = true; });
+	TestTrue("Pool available while streaming", glTFRuntime::Tests::WaitFor([&]() { return bFreeTaskExecuted; }));
+	TestEqual("Nothing loaded yet", NumLoaded.GetValue(), 0);
+
+	Stream->Append(GLB.GetData() + TotalLength - 8, 8);
+	TestTrue("Loads executed once received", glTFRuntime::Tests::WaitFor([&]() { return NumLoaded.GetValue() == NumTasks; }));
+	TestTrue("Workers released", glTFRuntime::Tests::WaitFor([&]() { return TaskPool.GetStats().NumRunning == 0; }));
+
+	Stream->Finish(true);
+
+	return true;
+}
+
+#endif
@@ -7,6 +7,8 @@
 #include "glTFRuntimeEditorDelegates.h"
 #include "glTFRuntimeFunctionLibrary.h"
 #include "glTFRuntimeAssetActor.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
 #include "IDesktopPlatform.h"
 #include "LevelEditor.h"
 #include "Interfaces/IPluginManager.h"
@@ -199,6 +201,19 @@ glTFRuntime::Tests::FFixturePath::FFixturePath(const FString& Filename)
 	Path = FPaths::Combine(PluginDir, TEXT("Source/glTFRuntimeEditor/Private/Tests/Fixtures"), Filename);
 }
 
+glTFRuntime::Tests::FTransientWorld::FTransientWorld()
+{
+	World = UWorld::CreateWorld(EWorldType::Game, false);
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+}
+
+glTFRuntime::Tests::FTransientWorld::~FTransientWorld()
+{
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+}
+
 #undef LOCTEXT_NAMESPACE
 
 IMPLEMENT_MODULE(FglTFRuntimeEditorModule, glTFRuntimeEditor)
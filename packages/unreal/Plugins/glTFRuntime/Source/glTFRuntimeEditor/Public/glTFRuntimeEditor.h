@@ -30,6 +30,15 @@ namespace glTFRuntime
 
 			FString Path;
 		};
+
+		// game world (subsystems included) alive for the lifetime of the struct
+		struct FTransientWorld
+		{
+			FTransientWorld();
+			~FTransientWorld();
+
+			class UWorld* World;
+		};
 	}
 };
 
@@ -12,6 +12,10 @@ AGLBCharacter::AGLBCharacter()
     // Create a root for GLB meshes, attached to the character's mesh
     GLBMeshRoot = CreateDefaultSubobject<USceneComponent>(TEXT("GLBMeshRoot"));
     GLBMeshRoot->SetupAttachment(GetMesh());
+
+    // Animation and skinning bookkeeping once per character instead of once per part
+    AssemblyMode = EGLBCharacterAssemblyMode::LeaderPose;
+    GLBLeaderMeshComponent = nullptr;
 }
 
 void AGLBCharacter::BeginPlay()
@@ -102,10 +106,24 @@ void AGLBCharacter::AttachGLBMeshes(const TArray<USkeletalMesh*>& Meshes)
         }
     }
     GLBMeshComponents.Empty();
+    GLBLeaderMeshComponent = nullptr;
 
     // Rotate the GLB root to fix model orientation (Blender exports face camera by default)
     GLBMeshRoot->SetRelativeRotation(FRotator(0, 180, 0));
 
+    // The leader needs every bone the parts are skinned to: pick the part with the largest skeleton
+    int32 LeaderIndex = INDEX_NONE;
+    if (AssemblyMode == EGLBCharacterAssemblyMode::LeaderPose)
+    {
+        for (int32 i = 0; i < Meshes.Num(); i++)
+        {
+            if (Meshes[i] && (LeaderIndex == INDEX_NONE || Meshes[i]->GetRefSkeleton().GetNum() > Meshes[LeaderIndex]->GetRefSkeleton().GetNum()))
+            {
+                LeaderIndex = i;
+            }
+        }
+    }
+
     // Attach each mesh
     for (int32 i = 0; i < Meshes.Num(); i++)
     {
@@ -115,15 +133,35 @@ void AGLBCharacter::AttachGLBMeshes(const TArray<USkeletalMesh*>& Meshes)
             MeshComp->SetupAttachment(GLBMeshRoot);
             MeshComp->RegisterComponent();
             MeshComp->SetSkeletalMesh(Meshes[i]);
-            
+
             GLBMeshComponents.Add(MeshComp);
-            
+
+            if (i == LeaderIndex)
+            {
+                GLBLeaderMeshComponent = MeshComp;
+            }
+
             UE_LOG(LogTemp, Log, TEXT("[GLBCharacter] Attached mesh %d"), i);
         }
     }
 
+    if (GLBLeaderMeshComponent)
+    {
+        // Followers skip their own animation evaluation and bounds calculation, they reuse the leader bone transforms
+        for (USkeletalMeshComponent* MeshComp : GLBMeshComponents)
+        {
+            if (MeshComp != GLBLeaderMeshComponent)
+            {
+                MeshComp->bUseBoundsFromLeaderPoseComponent = true;
+                MeshComp->SetLeaderPoseComponent(GLBLeaderMeshComponent);
+            }
+        }
+
+        UE_LOG(LogTemp, Log, TEXT("[GLBCharacter] %d meshes following the pose of mesh %d"), GLBMeshComponents.Num() - 1, LeaderIndex);
+    }
+
     // Hide the default mesh since we're using GLB meshes
     GetMesh()->SetVisibility(false);
-    
+
     UE_LOG(LogTemp, Log, TEXT("[GLBCharacter] Total meshes attached: %d"), GLBMeshComponents.Num());
 }
\ No newline at end of file
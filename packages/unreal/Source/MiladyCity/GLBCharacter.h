@@ -5,6 +5,18 @@
 #include "MiladyCityCharacter.h"
 #include "GLBCharacter.generated.h"
 
+// How the trait meshes (hair, eyes, shirt, hat...) of a GLB avatar are assembled
+UENUM(BlueprintType)
+enum class EGLBCharacterAssemblyMode : uint8
+{
+	// One independent component per part, every part evaluates its own pose
+	Independent,
+	// Every part follows the pose (and bounds) of a single leader component
+	LeaderPose,
+	// Every part sharing the base skeleton is merged into a single skeletal mesh, one section per material
+	MergedMesh
+};
+
 UCLASS()
 class MILADYCITY_API AGLBCharacter : public AMiladyCityCharacter
 {
@@ -24,7 +36,18 @@ public:
 	UFUNCTION(BlueprintPure, Category = "GLB")
 	USceneComponent* GetGLBRoot() const { return GLBMeshRoot; }
 
+	// The component driving the pose of every part (the only one to animate), nullptr unless AssemblyMode is LeaderPose
+	UFUNCTION(BlueprintPure, Category = "GLB")
+	USkeletalMeshComponent* GetGLBLeaderMesh() const { return GLBLeaderMeshComponent; }
+
+	UFUNCTION(BlueprintPure, Category = "GLB")
+	EGLBCharacterAssemblyMode GetAssemblyMode() const { return AssemblyMode; }
+
 protected:
+	// Read by the loader before the meshes are built (MergedMesh loads a single mesh for the whole avatar)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GLB")
+	EGLBCharacterAssemblyMode AssemblyMode;
+
 	// Root component for attached GLB meshes
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "GLB")
 	USceneComponent* GLBMeshRoot;
@@ -32,4 +55,7 @@ protected:
 	// Keep references to spawned mesh components
 	UPROPERTY()
 	TArray<USkeletalMeshComponent*> GLBMeshComponents;
-};
\ No newline at end of file
+
+	UPROPERTY()
+	USkeletalMeshComponent* GLBLeaderMeshComponent;
+};
@@ -2,7 +2,6 @@
 
 #include "GLBCharacterLoader.h"
 #include "GLBCharacter.h"
-#include "HttpModule.h"
 #include "glTFRuntimeFunctionLibrary.h"
 #include "Components/SkeletalMeshComponent.h"
 
@@ -13,45 +12,81 @@ AGLBCharacterLoader::AGLBCharacterLoader()
 
 void AGLBCharacterLoader::LoadCharacterFromURL(const FString& URL, FVector SpawnLocation, FRotator SpawnRotation)
 {
-    PendingSpawnLocation = SpawnLocation;
-    PendingSpawnRotation = SpawnRotation;
+    UGLBCharacterLoadRequest* Request = NewObject<UGLBCharacterLoadRequest>(this);
+    PendingRequests.Add(Request);
+
+    Request->Start(this, URL, SpawnLocation, SpawnRotation);
+}
+
+void AGLBCharacterLoader::CompleteRequest(UGLBCharacterLoadRequest* Request, AActor* SpawnedCharacter)
+{
+    PendingRequests.Remove(Request);
+    OnCharacterLoaded.Broadcast(SpawnedCharacter);
+}
+
+void UGLBCharacterLoadRequest::Start(AGLBCharacterLoader* InLoader, const FString& URL, const FVector& InSpawnLocation, const FRotator& InSpawnRotation)
+{
+    Loader = InLoader;
+    Asset = nullptr;
+    Character = nullptr;
+    SpawnLocation = InSpawnLocation;
+    SpawnRotation = InSpawnRotation;
 
     UE_LOG(LogTemp, Log, TEXT("[GLBLoader] Fetching GLB from: %s"), *URL);
 
-    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
-    Request->SetURL(URL);
-    Request->SetVerb(TEXT("GET"));
-    Request->OnProcessRequestComplete().BindUObject(this, &AGLBCharacterLoader::OnGLBDownloaded);
-    Request->ProcessRequest();
+    // Parse the GLB while it is downloading, the mesh jobs wait only for the byte ranges they read.
+    // Repeat logins load the same avatar, let the cooked mesh cache skip the mesh decoding
+    // (streamed assets are keyed by url, ETag and JSON chunk, the lookup does not wait for the body)
+    FglTFRuntimeConfig Config;
+    Config.bCookedMeshCache = true;
+
+    FglTFRuntimeHttpResponse OnAssetReady;
+    OnAssetReady.BindUFunction(this, GET_FUNCTION_NAME_CHECKED(UGLBCharacterLoadRequest, OnGLBAssetReady));
+    FglTFRuntimeHttpResponse OnDownloaded;
+    OnDownloaded.BindUFunction(this, GET_FUNCTION_NAME_CHECKED(UGLBCharacterLoadRequest, OnGLBDownloaded));
+
+    UglTFRuntimeFunctionLibrary::glTFLoadAssetFromUrlWithStreaming(URL, {}, OnAssetReady, OnDownloaded, FglTFRuntimeHttpProgress(), Config);
 }
 
-void AGLBCharacterLoader::OnGLBDownloaded(TSharedPtr<IHttpRequest, ESPMode::ThreadSafe> Request, TSharedPtr<IHttpResponse, ESPMode::ThreadSafe> Response, bool bWasSuccessful)
+void UGLBCharacterLoadRequest::Complete(AActor* SpawnedCharacter)
 {
-    if (!bWasSuccessful || !Response.IsValid())
+    Asset = nullptr;
+    Character = nullptr;
+
+    if (IsValid(Loader))
     {
-        UE_LOG(LogTemp, Error, TEXT("[GLBLoader] Failed to download GLB"));
-        OnCharacterLoaded.Broadcast(nullptr);
-        return;
+        Loader->CompleteRequest(this, SpawnedCharacter);
     }
+}
 
-    if (Response->GetResponseCode() != 200)
+void UGLBCharacterLoadRequest::OnGLBDownloaded(UglTFRuntimeAsset* InAsset)
+{
+    if (!InAsset)
     {
-        UE_LOG(LogTemp, Error, TEXT("[GLBLoader] HTTP error: %d"), Response->GetResponseCode());
-        OnCharacterLoaded.Broadcast(nullptr);
+        // OnGLBAssetReady already reported a parse failure, this is an interrupted download
+        if (Asset)
+        {
+            UE_LOG(LogTemp, Error, TEXT("[GLBLoader] GLB download interrupted while loading meshes"));
+        }
         return;
     }
 
-    TArray<uint8> Data = Response->GetContent();
-    UE_LOG(LogTemp, Log, TEXT("[GLBLoader] Downloaded %d bytes"), Data.Num());
+    UE_LOG(LogTemp, Log, TEXT("[GLBLoader] Downloaded GLB in %f seconds"), InAsset->GetDownloadTime());
+}
 
-    // Parse GLB data
-    FglTFRuntimeConfig Config;
-    UglTFRuntimeAsset* Asset = UglTFRuntimeFunctionLibrary::glTFLoadAssetFromData(Data, Config);
+void UGLBCharacterLoadRequest::OnGLBAssetReady(UglTFRuntimeAsset* InAsset)
+{
+    if (!InAsset)
+    {
+        UE_LOG(LogTemp, Error, TEXT("[GLBLoader] Failed to download or parse GLB"));
+        Complete(nullptr);
+        return;
+    }
 
-    if (!Asset)
+    if (!IsValid(Loader))
     {
-        UE_LOG(LogTemp, Error, TEXT("[GLBLoader] Failed to parse GLB data"));
-        OnCharacterLoaded.Broadcast(nullptr);
+        UE_LOG(LogTemp, Error, TEXT("[GLBLoader] GLBCharacterLoader destroyed while downloading"));
+        Complete(nullptr);
         return;
     }
 
@@ -61,39 +96,75 @@ void AGLBCharacterLoader::OnGLBDownloaded(TSharedPtr<IHttpRequest, ESPMode::Thre
     FActorSpawnParameters SpawnParams;
     SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
 
-    AGLBCharacter* SpawnedCharacter = GetWorld()->SpawnActor<AGLBCharacter>(
-        AGLBCharacter::StaticClass(), 
-        PendingSpawnLocation, 
-        PendingSpawnRotation, 
+    AGLBCharacter* SpawnedCharacter = Loader->GetWorld()->SpawnActor<AGLBCharacter>(
+        AGLBCharacter::StaticClass(),
+        SpawnLocation,
+        SpawnRotation,
         SpawnParams
     );
-    
+
     if (!SpawnedCharacter)
     {
         UE_LOG(LogTemp, Error, TEXT("[GLBLoader] Failed to spawn GLBCharacter"));
-        OnCharacterLoaded.Broadcast(nullptr);
+        Complete(nullptr);
         return;
     }
 
-    // Load all skeletal meshes from GLB
-    TArray<USkeletalMesh*> LoadedMeshes;
+    // Load every skinned mesh of the scene in a single background job,
+    // the meshes share one skeleton and are finalized together on the game thread
+    Asset = InAsset;
+    Character = SpawnedCharacter;
+
     FglTFRuntimeSkeletalMeshConfig SkeletalConfig;
 
-    for (int32 NodeIndex = 0; NodeIndex < 20; NodeIndex++)
+    if (SpawnedCharacter->GetAssemblyMode() == EGLBCharacterAssemblyMode::MergedMesh)
     {
-        USkeletalMesh* SkeletalMesh = Asset->LoadSkeletalMesh(NodeIndex, -1, SkeletalConfig);
-        if (SkeletalMesh)
-        {
-            LoadedMeshes.Add(SkeletalMesh);
-            UE_LOG(LogTemp, Log, TEXT("[GLBLoader] Loaded skeletal mesh from node %d"), NodeIndex);
-        }
+        // Every skinned node (from the root) is merged in a single skeletal mesh with one section per material:
+        // a single component to animate, skin and draw
+        FglTFRuntimeSkeletalMeshAsync OnMergedMeshLoaded;
+        OnMergedMeshLoaded.BindUFunction(this, GET_FUNCTION_NAME_CHECKED(UGLBCharacterLoadRequest, OnMergedSkeletalMeshLoaded));
+
+        InAsset->LoadSkeletalMeshRecursiveAsync(TEXT(""), {}, OnMergedMeshLoaded, SkeletalConfig);
+        return;
     }
 
-    UE_LOG(LogTemp, Log, TEXT("[GLBLoader] Total meshes loaded: %d"), LoadedMeshes.Num());
+    FglTFRuntimeSkeletalMeshesAsync OnMeshesLoaded;
+    OnMeshesLoaded.BindUFunction(this, GET_FUNCTION_NAME_CHECKED(UGLBCharacterLoadRequest, OnSkeletalMeshesLoaded));
+
+    InAsset->LoadSkinnedMeshNodesAsync(OnMeshesLoaded, SkeletalConfig);
+}
+
+void UGLBCharacterLoadRequest::OnSkeletalMeshesLoaded(const TArray<USkeletalMesh*>& SkeletalMeshes)
+{
+    AGLBCharacter* SpawnedCharacter = Character;
+
+    UE_LOG(LogTemp, Log, TEXT("[GLBLoader] Total meshes loaded: %d"), SkeletalMeshes.Num());
+
+    if (!IsValid(SpawnedCharacter))
+    {
+        UE_LOG(LogTemp, Error, TEXT("[GLBLoader] GLBCharacter destroyed while loading meshes"));
+        Complete(nullptr);
+        return;
+    }
 
     // Attach meshes to character
-    SpawnedCharacter->AttachGLBMeshes(LoadedMeshes);
+    SpawnedCharacter->AttachGLBMeshes(SkeletalMeshes);
 
-    UE_LOG(LogTemp, Log, TEXT("[GLBLoader] Character spawned at %s"), *PendingSpawnLocation.ToString());
-    OnCharacterLoaded.Broadcast(SpawnedCharacter);
-}
\ No newline at end of file
+    UE_LOG(LogTemp, Log, TEXT("[GLBLoader] Character spawned at %s"), *SpawnLocation.ToString());
+    Complete(SpawnedCharacter);
+}
+
+void UGLBCharacterLoadRequest::OnMergedSkeletalMeshLoaded(USkeletalMesh* SkeletalMesh)
+{
+    TArray<USkeletalMesh*> SkeletalMeshes;
+    if (SkeletalMesh)
+    {
+        SkeletalMeshes.Add(SkeletalMesh);
+    }
+    else
+    {
+        UE_LOG(LogTemp, Error, TEXT("[GLBLoader] Failed to merge the GLB skinned meshes"));
+    }
+
+    OnSkeletalMeshesLoaded(SkeletalMeshes);
+}
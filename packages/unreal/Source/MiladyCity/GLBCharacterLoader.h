@@ -4,13 +4,58 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
-#include "Interfaces/IHttpRequest.h"
-#include "Interfaces/IHttpResponse.h"
 #include "glTFRuntimeAsset.h"
 #include "GLBCharacterLoader.generated.h"
 
+class AGLBCharacter;
+class AGLBCharacterLoader;
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnCharacterLoaded, AActor*, SpawnedCharacter);
 
+// A single LoadCharacterFromURL() call: the glTFRuntime callbacks carry no payload,
+// so every request binds them to its own object (concurrent loads never share state)
+UCLASS()
+class MILADYCITY_API UGLBCharacterLoadRequest : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	void Start(AGLBCharacterLoader* InLoader, const FString& URL, const FVector& InSpawnLocation, const FRotator& InSpawnRotation);
+
+private:
+	// Called as soon as the JSON chunk of the GLB is parsed, the BIN chunk may still be downloading
+	UFUNCTION()
+	void OnGLBAssetReady(UglTFRuntimeAsset* InAsset);
+
+	// Called once the whole GLB has been received
+	UFUNCTION()
+	void OnGLBDownloaded(UglTFRuntimeAsset* InAsset);
+
+	// Called on the game thread once every skinned mesh of the GLB is built
+	UFUNCTION()
+	void OnSkeletalMeshesLoaded(const TArray<USkeletalMesh*>& SkeletalMeshes);
+
+	// Called on the game thread once every skinned mesh of the GLB is merged in a single one (EGLBCharacterAssemblyMode::MergedMesh)
+	UFUNCTION()
+	void OnMergedSkeletalMeshLoaded(USkeletalMesh* SkeletalMesh);
+
+	// Broadcasts the result through the loader and releases the request
+	void Complete(AActor* SpawnedCharacter);
+
+	UPROPERTY()
+	AGLBCharacterLoader* Loader;
+
+	// Kept alive while the skeletal meshes are loading
+	UPROPERTY()
+	UglTFRuntimeAsset* Asset;
+
+	UPROPERTY()
+	AGLBCharacter* Character;
+
+	FVector SpawnLocation;
+	FRotator SpawnRotation;
+};
+
 UCLASS()
 class MILADYCITY_API AGLBCharacterLoader : public AActor
 {
@@ -19,7 +64,7 @@ class MILADYCITY_API AGLBCharacterLoader : public AActor
 public:
 	AGLBCharacterLoader();
 
-	// Load GLB from URL and spawn character
+	// Load GLB from URL and spawn character (multiple loads can be in flight at the same time)
 	UFUNCTION(BlueprintCallable, Category = "GLB")
 	void LoadCharacterFromURL(const FString& URL, FVector SpawnLocation, FRotator SpawnRotation);
 
@@ -28,8 +73,11 @@ public:
 	FOnCharacterLoaded OnCharacterLoaded;
 
 private:
-	void OnGLBDownloaded(TSharedPtr<IHttpRequest, ESPMode::ThreadSafe> Request, TSharedPtr<IHttpResponse, ESPMode::ThreadSafe> Response, bool bWasSuccessful);
-    
-	FVector PendingSpawnLocation;
-	FRotator PendingSpawnRotation;
-};
\ No newline at end of file
+	friend class UGLBCharacterLoadRequest;
+
+	void CompleteRequest(UGLBCharacterLoadRequest* Request, AActor* SpawnedCharacter);
+
+	// Every in-flight request, kept alive until its character is spawned (or fails)
+	UPROPERTY()
+	TSet<UGLBCharacterLoadRequest*> PendingRequests;
+};